@@ -0,0 +1,106 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkSMPTaskGraphImpl_h
+#define vtkSMPTaskGraphImpl_h
+
+#include "vtkSystemIncludes.h"
+
+#include <atomic>     // For std::atomic
+#include <cstddef>    // For std::size_t
+#include <functional> // For std::function
+#include <memory>     // For std::unique_ptr
+#include <vector>     // For std::vector
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+/**
+ * Storage of a vtkSMPTaskGraph shared with the backends.
+ *
+ * Tasks can only depend on tasks added before them, so the graph is acyclic by
+ * construction. Backends call Prepare() once, schedule the returned roots and
+ * then call Run() for every task that becomes ready. Run() may be called
+ * concurrently for different tasks.
+ */
+class vtkSMPTaskGraphImpl
+{
+public:
+  struct Task
+  {
+    std::function<void()> Function;
+    std::vector<std::size_t> Successors;
+    std::size_t NumberOfDependencies = 0;
+    std::atomic<std::size_t> RemainingDependencies{ 0 };
+  };
+
+  std::vector<std::unique_ptr<Task>> Tasks;
+
+  //--------------------------------------------------------------------------------
+  std::size_t GetNumberOfTasks() const { return this->Tasks.size(); }
+
+  //--------------------------------------------------------------------------------
+  // Reset the dependency counters and return the tasks without dependencies.
+  std::vector<std::size_t> Prepare()
+  {
+    std::vector<std::size_t> roots;
+    for (std::size_t id = 0; id < this->Tasks.size(); ++id)
+    {
+      Task& task = *this->Tasks[id];
+      task.RemainingDependencies = task.NumberOfDependencies;
+      if (task.NumberOfDependencies == 0)
+      {
+        roots.push_back(id);
+      }
+    }
+    return roots;
+  }
+
+  //--------------------------------------------------------------------------------
+  // Execute a task then call ready(successorId) for each successor whose last
+  // dependency just completed.
+  template <typename ReadyCallback>
+  void Run(std::size_t id, ReadyCallback&& ready)
+  {
+    Task& task = *this->Tasks[id];
+    if (task.Function)
+    {
+      task.Function();
+    }
+    for (std::size_t successor : task.Successors)
+    {
+      if (this->Tasks[successor]->RemainingDependencies.fetch_sub(1) == 1)
+      {
+        ready(successor);
+      }
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  // Execute the whole graph on the calling thread.
+  void ExecuteSequential()
+  {
+    std::vector<std::size_t> ready = this->Prepare();
+    while (!ready.empty())
+    {
+      const std::size_t id = ready.back();
+      ready.pop_back();
+      this->Run(id, [&ready](std::size_t successor) { ready.push_back(successor); });
+    }
+  }
+};
+
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+#endif
+/* VTK-HeaderTest-Exclude: vtkSMPTaskGraphImpl.h */
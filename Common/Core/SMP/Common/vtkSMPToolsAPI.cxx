@@ -2,6 +2,8 @@
 // SPDX-License-Identifier: BSD-3-Clause
 
 #include "SMP/Common/vtkSMPToolsAPI.h"
+#include "SMP/Common/vtkSMPTaskGraphImpl.h"
+#include "vtkExecutionTracer.h" // For vtkExecutionTracer::Scope
 #include "vtkSMP.h"    // For SMP preprocessor information
 #include "vtkSetGet.h" // For vtkWarningMacro
 
@@ -250,6 +252,39 @@ bool vtkSMPToolsAPI::IsParallelScope()
   return false;
 }
 
+//------------------------------------------------------------------------------
+// Constant initialized, so that it can be set by vtkExecutionTracer during the
+// static initialization.
+std::atomic<bool> vtkSMPToolsAPI::TraceParallelRegions{ false };
+
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::SetTraceParallelRegions(bool enabled)
+{
+  TraceParallelRegions.store(enabled);
+}
+
+//------------------------------------------------------------------------------
+struct vtkSMPToolsAPI::ForTraceScope::vtkInternals
+{
+  vtkExecutionTracer::Scope Scope{ "vtkSMPTools::For", "smp" };
+};
+
+//------------------------------------------------------------------------------
+vtkSMPToolsAPI::ForTraceScope::ForTraceScope(
+  vtkSMPToolsAPI& api, vtkIdType first, vtkIdType last, vtkIdType grain)
+  : Internals(new vtkInternals)
+{
+  vtkExecutionTracer::Scope& scope = this->Internals->Scope;
+  scope.AddArgument("first", static_cast<vtkTypeInt64>(first));
+  scope.AddArgument("last", static_cast<vtkTypeInt64>(last));
+  scope.AddArgument("grain", static_cast<vtkTypeInt64>(grain));
+  scope.AddArgument("backend", api.GetBackend());
+  scope.AddArgument("threads", api.GetEstimatedNumberOfThreads());
+}
+
+//------------------------------------------------------------------------------
+vtkSMPToolsAPI::ForTraceScope::~ForTraceScope() = default;
+
 //------------------------------------------------------------------------------
 bool vtkSMPToolsAPI::GetSingleThread()
 {
@@ -271,6 +306,26 @@ bool vtkSMPToolsAPI::GetSingleThread()
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkSMPToolsAPI::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph)
+{
+  switch (this->ActivatedBackend)
+  {
+    case BackendType::Sequential:
+      this->SequentialBackend->ExecuteTaskGraph(graph);
+      break;
+    case BackendType::STDThread:
+      this->STDThreadBackend->ExecuteTaskGraph(graph);
+      break;
+    case BackendType::TBB:
+      this->TBBBackend->ExecuteTaskGraph(graph);
+      break;
+    case BackendType::OpenMP:
+      this->OpenMPBackend->ExecuteTaskGraph(graph);
+      break;
+  }
+}
+
 //------------------------------------------------------------------------------
 // Must NOT be initialized. Default initialization to zero is necessary.
 unsigned int vtkSMPToolsAPIInitializeCount;
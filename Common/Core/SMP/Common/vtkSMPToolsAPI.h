@@ -9,6 +9,7 @@
 #include "vtkObject.h"
 #include "vtkSMP.h"
 
+#include <atomic>
 #include <memory>
 
 #include "SMP/Common/vtkSMPToolsImpl.h"
@@ -74,6 +75,9 @@ public:
   //--------------------------------------------------------------------------------
   int GetInternalDesiredNumberOfThread() { return this->DesiredNumberOfThread; }
 
+  //--------------------------------------------------------------------------------
+  void ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph);
+
   //------------------------------------------------------------------------------
   template <typename Config, typename T>
   void LocalScope(Config const& config, T&& lambda)
@@ -92,24 +96,25 @@ public:
     *this << oldConfig;
   }
 
+  //--------------------------------------------------------------------------------
+  // Enable/disable the tracing of the outermost parallel regions. Called by
+  // vtkExecutionTracer::SetEnabled.
+  static void SetTraceParallelRegions(bool enabled);
+
   //--------------------------------------------------------------------------------
   template <typename FunctorInternal>
   void For(vtkIdType first, vtkIdType last, vtkIdType grain, FunctorInternal& fi)
   {
-    switch (this->ActivatedBackend)
+    // Only the outermost parallel regions are traced. The event is recorded
+    // out of line, so that the untraced path is a single atomic load.
+    if (TraceParallelRegions.load(std::memory_order_relaxed) && !this->IsParallelScope())
     {
-      case BackendType::Sequential:
-        this->SequentialBackend->For(first, last, grain, fi);
-        break;
-      case BackendType::STDThread:
-        this->STDThreadBackend->For(first, last, grain, fi);
-        break;
-      case BackendType::TBB:
-        this->TBBBackend->For(first, last, grain, fi);
-        break;
-      case BackendType::OpenMP:
-        this->OpenMPBackend->For(first, last, grain, fi);
-        break;
+      ForTraceScope traceScope(*this, first, last, grain);
+      this->ForInBackend(first, last, grain, fi);
+    }
+    else
+    {
+      this->ForInBackend(first, last, grain, fi);
     }
   }
 
@@ -219,6 +224,87 @@ public:
     }
   }
 
+  //--------------------------------------------------------------------------------
+  template <typename RandomAccessIterator, typename Compare>
+  void StableSort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        this->SequentialBackend->StableSort(begin, end, comp);
+        break;
+      case BackendType::STDThread:
+        this->STDThreadBackend->StableSort(begin, end, comp);
+        break;
+      case BackendType::TBB:
+        this->TBBBackend->StableSort(begin, end, comp);
+        break;
+      case BackendType::OpenMP:
+        this->OpenMPBackend->StableSort(begin, end, comp);
+        break;
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        this->SequentialBackend->InclusiveScan(inBegin, inEnd, outBegin, op);
+        break;
+      case BackendType::STDThread:
+        this->STDThreadBackend->InclusiveScan(inBegin, inEnd, outBegin, op);
+        break;
+      case BackendType::TBB:
+        this->TBBBackend->InclusiveScan(inBegin, inEnd, outBegin, op);
+        break;
+      case BackendType::OpenMP:
+        this->OpenMPBackend->InclusiveScan(inBegin, inEnd, outBegin, op);
+        break;
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        this->SequentialBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::STDThread:
+        this->STDThreadBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::TBB:
+        this->TBBBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+      case BackendType::OpenMP:
+        this->OpenMPBackend->ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+        break;
+    }
+  }
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename Predicate>
+  OutputIt CopyIf(InputIt inBegin, InputIt inEnd, OutputIt outBegin, Predicate pred)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        return this->SequentialBackend->CopyIf(inBegin, inEnd, outBegin, pred);
+      case BackendType::STDThread:
+        return this->STDThreadBackend->CopyIf(inBegin, inEnd, outBegin, pred);
+      case BackendType::TBB:
+        return this->TBBBackend->CopyIf(inBegin, inEnd, outBegin, pred);
+      case BackendType::OpenMP:
+        return this->OpenMPBackend->CopyIf(inBegin, inEnd, outBegin, pred);
+    }
+    return outBegin;
+  }
+
   // disable copying
   vtkSMPToolsAPI(vtkSMPToolsAPI const&) = delete;
   void operator=(vtkSMPToolsAPI const&) = delete;
@@ -235,6 +321,43 @@ private:
   //--------------------------------------------------------------------------------
   vtkSMPToolsAPI();
 
+  //--------------------------------------------------------------------------------
+  // Record a vtkExecutionTracer event for the lifetime of a parallel region.
+  class VTKCOMMONCORE_EXPORT ForTraceScope
+  {
+  public:
+    ForTraceScope(vtkSMPToolsAPI& api, vtkIdType first, vtkIdType last, vtkIdType grain);
+    ~ForTraceScope();
+
+  private:
+    ForTraceScope(const ForTraceScope&) = delete;
+    void operator=(const ForTraceScope&) = delete;
+
+    struct vtkInternals;
+    std::unique_ptr<vtkInternals> Internals;
+  };
+
+  //--------------------------------------------------------------------------------
+  template <typename FunctorInternal>
+  void ForInBackend(vtkIdType first, vtkIdType last, vtkIdType grain, FunctorInternal& fi)
+  {
+    switch (this->ActivatedBackend)
+    {
+      case BackendType::Sequential:
+        this->SequentialBackend->For(first, last, grain, fi);
+        break;
+      case BackendType::STDThread:
+        this->STDThreadBackend->For(first, last, grain, fi);
+        break;
+      case BackendType::TBB:
+        this->TBBBackend->For(first, last, grain, fi);
+        break;
+      case BackendType::OpenMP:
+        this->OpenMPBackend->For(first, last, grain, fi);
+        break;
+    }
+  }
+
   //--------------------------------------------------------------------------------
   void RefreshNumberOfThread();
 
@@ -250,6 +373,11 @@ private:
     return *this;
   }
 
+  /**
+   * Whether the parallel regions are traced, see vtkExecutionTracer.
+   */
+  static std::atomic<bool> TraceParallelRegions;
+
   /**
    * Indicate which backend to use.
    */
@@ -42,6 +42,8 @@ const BackendType DefaultBackend = BackendType::TBB;
 const BackendType DefaultBackend = BackendType::OpenMP;
 #endif
 
+class vtkSMPTaskGraphImpl;
+
 template <BackendType Backend>
 class VTKCOMMONCORE_EXPORT vtkSMPToolsImpl
 {
@@ -92,6 +94,25 @@ public:
   template <typename RandomAccessIterator, typename Compare>
   void Sort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp);
 
+  //--------------------------------------------------------------------------------
+  template <typename RandomAccessIterator, typename Compare>
+  void StableSort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op);
+
+  //--------------------------------------------------------------------------------
+  template <typename InputIt, typename OutputIt, typename Predicate>
+  OutputIt CopyIf(InputIt inBegin, InputIt inEnd, OutputIt outBegin, Predicate pred);
+
+  //--------------------------------------------------------------------------------
+  void ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph);
+
   //--------------------------------------------------------------------------------
   vtkSMPToolsImpl()
     : NestedActivated(true)
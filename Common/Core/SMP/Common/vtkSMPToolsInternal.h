@@ -4,7 +4,10 @@
 #ifndef vtkSMPToolsInternal_h
 #define vtkSMPToolsInternal_h
 
-#include <iterator> // For std::advance
+#include <algorithm>   // For std::merge, std::stable_sort
+#include <iterator>    // For std::advance, std::make_move_iterator
+#include <type_traits> // For std::decay
+#include <vector>      // For std::vector
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
 namespace vtk
@@ -90,6 +93,396 @@ public:
   T operator()(T vtkNotUsed(inValue)) { return Value; }
 };
 
+//--------------------------------------------------------------------------------
+// Number of blocks used to split `size` elements for the block based algorithms below
+// (scans, stable sort, compaction). Inputs too small to amortize the threading overhead
+// end up in a single block, which the callers process serially. Backends without
+// threads pass 0 threads to always get a single block.
+inline vtkIdType GetNumberOfBlocks(vtkIdType size, int numberOfThreads)
+{
+  const vtkIdType minimumBlockSize = 4096;
+  const vtkIdType numberOfBlocks =
+    std::min(size / minimumBlockSize, 4 * static_cast<vtkIdType>(numberOfThreads));
+  return std::max(numberOfBlocks, static_cast<vtkIdType>(1));
+}
+
+//--------------------------------------------------------------------------------
+// Blocked scan executed in two passes: the first one reduces each block, the carries
+// of the blocks are then scanned serially and the second pass scans each block
+// starting from its carry. In-place scans (Out == In) are supported.
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+class ScanCall
+{
+  InputIt In;
+  OutputIt Out;
+  vtkIdType Size;
+  vtkIdType NumberOfBlocks;
+  BinaryOp& Op;
+  bool Inclusive;
+  bool HasInit;
+  bool Reducing;
+  std::vector<T> Sums;
+  std::vector<T> Carries;
+
+  vtkIdType GetBlockBegin(vtkIdType block) const
+  {
+    return this->Size * block / this->NumberOfBlocks;
+  }
+
+public:
+  ScanCall(InputIt _in, OutputIt _out, vtkIdType _size, vtkIdType _numberOfBlocks,
+    BinaryOp& _op, bool _inclusive, const T* _init)
+    : In(_in)
+    , Out(_out)
+    , Size(_size)
+    , NumberOfBlocks(_numberOfBlocks)
+    , Op(_op)
+    , Inclusive(_inclusive)
+    , HasInit(_init != nullptr)
+    , Reducing(_numberOfBlocks > 1)
+    , Sums(_numberOfBlocks)
+    , Carries(_numberOfBlocks)
+  {
+    if (_init)
+    {
+      this->Carries[0] = *_init;
+    }
+  }
+
+  // To be called between the two passes.
+  void ComputeCarries()
+  {
+    for (vtkIdType block = 1; block < this->NumberOfBlocks; ++block)
+    {
+      this->Carries[block] = (block == 1 && !this->HasInit)
+        ? this->Sums[0]
+        : this->Op(this->Carries[block - 1], this->Sums[block - 1]);
+    }
+    this->Reducing = false;
+  }
+
+  void Execute(vtkIdType firstBlock, vtkIdType lastBlock)
+  {
+    for (vtkIdType block = firstBlock; block < lastBlock; ++block)
+    {
+      const vtkIdType begin = this->GetBlockBegin(block);
+      const vtkIdType end = this->GetBlockBegin(block + 1);
+      InputIt itIn(this->In);
+      std::advance(itIn, begin);
+      if (this->Reducing)
+      {
+        T sum = *itIn;
+        for (vtkIdType it = begin + 1; it < end; ++it)
+        {
+          ++itIn;
+          sum = this->Op(sum, *itIn);
+        }
+        this->Sums[block] = sum;
+        continue;
+      }
+
+      OutputIt itOut(this->Out);
+      std::advance(itOut, begin);
+      if (this->Inclusive)
+      {
+        T acc = (this->HasInit || block > 0) ? this->Op(this->Carries[block], *itIn) : T(*itIn);
+        *itOut = acc;
+        for (vtkIdType it = begin + 1; it < end; ++it)
+        {
+          ++itIn;
+          ++itOut;
+          acc = this->Op(acc, *itIn);
+          *itOut = acc;
+        }
+      }
+      else
+      {
+        T acc = this->Carries[block];
+        for (vtkIdType it = begin; it < end; ++it)
+        {
+          T value = *itIn;
+          *itOut = acc;
+          acc = this->Op(acc, value);
+          ++itIn;
+          ++itOut;
+        }
+      }
+    }
+  }
+};
+
+template <typename Backend, typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void ExecuteScan(Backend& backend, int numberOfThreads, InputIt inBegin, InputIt inEnd,
+  OutputIt outBegin, BinaryOp op, bool inclusive, const T* init)
+{
+  const vtkIdType size = std::distance(inBegin, inEnd);
+  if (size <= 0)
+  {
+    return;
+  }
+  const vtkIdType numberOfBlocks = GetNumberOfBlocks(size, numberOfThreads);
+  ScanCall<InputIt, OutputIt, T, BinaryOp> exec(
+    inBegin, outBegin, size, numberOfBlocks, op, inclusive, init);
+  if (numberOfBlocks > 1)
+  {
+    backend.For(0, numberOfBlocks, 1, exec);
+  }
+  exec.ComputeCarries();
+  backend.For(0, numberOfBlocks, 1, exec);
+}
+
+// Inclusive scans accumulate in the type returned by the operator (as std::inclusive_scan
+// does), which allows scanning e.g. arrays of std::atomic counters in place.
+template <typename Backend, typename InputIt, typename OutputIt, typename BinaryOp>
+void ExecuteInclusiveScan(Backend& backend, int numberOfThreads, InputIt inBegin, InputIt inEnd,
+  OutputIt outBegin, BinaryOp op)
+{
+  using ValueType = typename std::decay<decltype(op(*inBegin, *inBegin))>::type;
+  ExecuteScan(backend, numberOfThreads, inBegin, inEnd, outBegin, op, true,
+    static_cast<const ValueType*>(nullptr));
+}
+
+//--------------------------------------------------------------------------------
+// Stable sort: runs are sorted in parallel with std::stable_sort then merged pairwise,
+// alternating between the input range and a buffer. std::merge takes equal elements from
+// the first range first, so stability is preserved.
+template <typename RandomAccessIterator, typename Compare>
+class StableSortCall
+{
+  RandomAccessIterator Begin;
+  const std::vector<vtkIdType>& Bounds;
+  Compare& Comp;
+
+public:
+  StableSortCall(
+    RandomAccessIterator _begin, const std::vector<vtkIdType>& _bounds, Compare& _comp)
+    : Begin(_begin)
+    , Bounds(_bounds)
+    , Comp(_comp)
+  {
+  }
+
+  void Execute(vtkIdType firstRun, vtkIdType lastRun)
+  {
+    for (vtkIdType run = firstRun; run < lastRun; ++run)
+    {
+      std::stable_sort(
+        this->Begin + this->Bounds[run], this->Begin + this->Bounds[run + 1], this->Comp);
+    }
+  }
+};
+
+template <typename SourceIt, typename DestinationIt, typename Compare>
+class MergeRunsCall
+{
+  SourceIt Source;
+  DestinationIt Destination;
+  const std::vector<vtkIdType>& Bounds;
+  Compare& Comp;
+
+public:
+  MergeRunsCall(SourceIt _source, DestinationIt _destination,
+    const std::vector<vtkIdType>& _bounds, Compare& _comp)
+    : Source(_source)
+    , Destination(_destination)
+    , Bounds(_bounds)
+    , Comp(_comp)
+  {
+  }
+
+  void Execute(vtkIdType firstPair, vtkIdType lastPair)
+  {
+    const vtkIdType numberOfRuns = static_cast<vtkIdType>(this->Bounds.size()) - 1;
+    for (vtkIdType pair = firstPair; pair < lastPair; ++pair)
+    {
+      const vtkIdType begin = this->Bounds[2 * pair];
+      const vtkIdType middle = this->Bounds[2 * pair + 1];
+      const vtkIdType end = (2 * pair + 2 <= numberOfRuns) ? this->Bounds[2 * pair + 2] : middle;
+      std::merge(std::make_move_iterator(this->Source + begin),
+        std::make_move_iterator(this->Source + middle),
+        std::make_move_iterator(this->Source + middle), std::make_move_iterator(this->Source + end),
+        this->Destination + begin, this->Comp);
+    }
+  }
+};
+
+template <typename SourceIt, typename DestinationIt>
+class MoveCall
+{
+  SourceIt Source;
+  DestinationIt Destination;
+
+public:
+  MoveCall(SourceIt _source, DestinationIt _destination)
+    : Source(_source)
+    , Destination(_destination)
+  {
+  }
+
+  void Execute(vtkIdType begin, vtkIdType end)
+  {
+    std::move(this->Source + begin, this->Source + end, this->Destination + begin);
+  }
+};
+
+template <typename Backend, typename RandomAccessIterator, typename Compare>
+void ExecuteStableSort(Backend& backend, int numberOfThreads, RandomAccessIterator begin,
+  RandomAccessIterator end, Compare comp)
+{
+  using ValueType = typename std::iterator_traits<RandomAccessIterator>::value_type;
+  using BufferIterator = typename std::vector<ValueType>::iterator;
+
+  const vtkIdType size = std::distance(begin, end);
+  const vtkIdType numberOfRuns = GetNumberOfBlocks(size, numberOfThreads);
+  if (numberOfRuns <= 1)
+  {
+    std::stable_sort(begin, end, comp);
+    return;
+  }
+
+  std::vector<vtkIdType> bounds(numberOfRuns + 1);
+  for (vtkIdType run = 0; run <= numberOfRuns; ++run)
+  {
+    bounds[run] = size * run / numberOfRuns;
+  }
+  StableSortCall<RandomAccessIterator, Compare> sorter(begin, bounds, comp);
+  backend.For(0, numberOfRuns, 1, sorter);
+
+  std::vector<ValueType> buffer(size);
+  bool inBuffer = false;
+  while (bounds.size() > 2)
+  {
+    const vtkIdType numberOfPairs = static_cast<vtkIdType>(bounds.size()) / 2;
+    if (inBuffer)
+    {
+      MergeRunsCall<BufferIterator, RandomAccessIterator, Compare> merger(
+        buffer.begin(), begin, bounds, comp);
+      backend.For(0, numberOfPairs, 1, merger);
+    }
+    else
+    {
+      MergeRunsCall<RandomAccessIterator, BufferIterator, Compare> merger(
+        begin, buffer.begin(), bounds, comp);
+      backend.For(0, numberOfPairs, 1, merger);
+    }
+    inBuffer = !inBuffer;
+
+    std::vector<vtkIdType> merged;
+    for (std::size_t run = 0; run + 1 < bounds.size(); run += 2)
+    {
+      merged.push_back(bounds[run]);
+    }
+    merged.push_back(bounds.back());
+    bounds.swap(merged);
+  }
+
+  if (inBuffer)
+  {
+    MoveCall<BufferIterator, RandomAccessIterator> mover(buffer.begin(), begin);
+    backend.For(0, size, 0, mover);
+  }
+}
+
+//--------------------------------------------------------------------------------
+// Order preserving stream compaction: the first pass counts the selected elements of
+// each block, the counts are scanned serially and the second pass copies the selected
+// elements. The predicate is evaluated twice per element.
+template <typename InputIt, typename OutputIt, typename Predicate>
+class CopyIfCall
+{
+  InputIt In;
+  OutputIt Out;
+  vtkIdType Size;
+  vtkIdType NumberOfBlocks;
+  Predicate& Pred;
+  bool Counting;
+  std::vector<vtkIdType> Offsets;
+
+  vtkIdType GetBlockBegin(vtkIdType block) const
+  {
+    return this->Size * block / this->NumberOfBlocks;
+  }
+
+public:
+  CopyIfCall(InputIt _in, OutputIt _out, vtkIdType _size, vtkIdType _numberOfBlocks,
+    Predicate& _pred)
+    : In(_in)
+    , Out(_out)
+    , Size(_size)
+    , NumberOfBlocks(_numberOfBlocks)
+    , Pred(_pred)
+    , Counting(true)
+    , Offsets(_numberOfBlocks + 1, 0)
+  {
+  }
+
+  // To be called between the two passes, returns the number of selected elements.
+  vtkIdType ComputeOffsets()
+  {
+    vtkIdType total = 0;
+    for (vtkIdType block = 0; block < this->NumberOfBlocks; ++block)
+    {
+      const vtkIdType count = this->Offsets[block];
+      this->Offsets[block] = total;
+      total += count;
+    }
+    this->Offsets[this->NumberOfBlocks] = total;
+    this->Counting = false;
+    return total;
+  }
+
+  void Execute(vtkIdType firstBlock, vtkIdType lastBlock)
+  {
+    for (vtkIdType block = firstBlock; block < lastBlock; ++block)
+    {
+      const vtkIdType begin = this->GetBlockBegin(block);
+      const vtkIdType end = this->GetBlockBegin(block + 1);
+      InputIt itIn(this->In);
+      std::advance(itIn, begin);
+      if (this->Counting)
+      {
+        vtkIdType count = 0;
+        for (vtkIdType it = begin; it < end; ++it, ++itIn)
+        {
+          count += this->Pred(*itIn) ? 1 : 0;
+        }
+        this->Offsets[block] = count;
+      }
+      else
+      {
+        OutputIt itOut(this->Out);
+        std::advance(itOut, this->Offsets[block]);
+        for (vtkIdType it = begin; it < end; ++it, ++itIn)
+        {
+          if (this->Pred(*itIn))
+          {
+            *itOut = *itIn;
+            ++itOut;
+          }
+        }
+      }
+    }
+  }
+};
+
+template <typename Backend, typename InputIt, typename OutputIt, typename Predicate>
+OutputIt ExecuteCopyIf(Backend& backend, int numberOfThreads, InputIt inBegin, InputIt inEnd,
+  OutputIt outBegin, Predicate pred)
+{
+  const vtkIdType size = std::distance(inBegin, inEnd);
+  const vtkIdType numberOfBlocks = GetNumberOfBlocks(size, numberOfThreads);
+  if (numberOfBlocks <= 1)
+  {
+    return std::copy_if(inBegin, inEnd, outBegin, pred);
+  }
+  CopyIfCall<InputIt, OutputIt, Predicate> exec(inBegin, outBegin, size, numberOfBlocks, pred);
+  backend.For(0, numberOfBlocks, 1, exec);
+  const vtkIdType total = exec.ComputeOffsets();
+  backend.For(0, numberOfBlocks, 1, exec);
+  std::advance(outBegin, total);
+  return outBegin;
+}
+
 VTK_ABI_NAMESPACE_END
 
 } // namespace smp
@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include "SMP/Common/vtkSMPTaskGraphImpl.h"
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/OpenMP/vtkSMPToolsImpl.txx"
 
@@ -113,7 +114,9 @@ void vtkSMPToolsImplForOpenMP(vtkIdType first, vtkIdType last, vtkIdType grain,
 
   omp_set_nested(nestedActivated);
 
-#pragma omp single
+  // A critical section rather than a single construct: this can be reached from an explicit
+  // task of ExecuteTaskGraph, where worksharing constructs are not allowed.
+#pragma omp critical(vtkSMPToolsImplOpenMPThreadIdStack)
   threadIdStack->emplace(omp_get_thread_num());
 
 #pragma omp parallel for schedule(runtime)
@@ -122,10 +125,48 @@ void vtkSMPToolsImplForOpenMP(vtkIdType first, vtkIdType last, vtkIdType grain,
     functorExecuter(functor, from, grain, last);
   }
 
-#pragma omp single
+#pragma omp critical(vtkSMPToolsImplOpenMPThreadIdStack)
   threadIdStack->pop();
 }
 
+//------------------------------------------------------------------------------
+static void SpawnTaskOpenMP(vtkSMPTaskGraphImpl* graph, std::size_t id)
+{
+#pragma omp task firstprivate(graph, id)
+  graph->Run(id, [graph](std::size_t successor) { SpawnTaskOpenMP(graph, successor); });
+}
+
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::OpenMP>::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph)
+{
+  if (graph.GetNumberOfTasks() <= 1 || (!this->NestedActivated && this->IsParallel))
+  {
+    graph.ExecuteSequential();
+    return;
+  }
+
+  bool fromParallelCode = this->IsParallel.exchange(true);
+
+  omp_set_nested(this->NestedActivated);
+
+  vtkSMPTaskGraphImpl* graphPtr = &graph;
+  // The implicit barrier closing the parallel region waits for every task, including the
+  // successors spawned from within other tasks.
+#pragma omp parallel
+#pragma omp single
+  {
+    for (std::size_t root : graphPtr->Prepare())
+    {
+      SpawnTaskOpenMP(graphPtr, root);
+    }
+  }
+
+  // Same as in vtkSMPToolsImpl<BackendType::OpenMP>::For: IsParallel &= fromParallelCode
+  bool trueFlag = true;
+  this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -143,6 +143,46 @@ void vtkSMPToolsImpl<BackendType::OpenMP>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename RandomAccessIterator, typename Compare>
+void vtkSMPToolsImpl<BackendType::OpenMP>::StableSort(
+  RandomAccessIterator begin, RandomAccessIterator end, Compare comp)
+{
+  ExecuteStableSort(*this, GetNumberOfThreadsOpenMP(), begin, end, comp);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::OpenMP>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+{
+  ExecuteInclusiveScan(*this, GetNumberOfThreadsOpenMP(), inBegin, inEnd, outBegin, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::OpenMP>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  ExecuteScan(*this, GetNumberOfThreadsOpenMP(), inBegin, inEnd, outBegin, op, false, &init);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename Predicate>
+OutputIt vtkSMPToolsImpl<BackendType::OpenMP>::CopyIf(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, Predicate pred)
+{
+  return ExecuteCopyIf(*this, GetNumberOfThreadsOpenMP(), inBegin, inEnd, outBegin, pred);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::OpenMP>::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph);
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::OpenMP>::Initialize(int);
@@ -1,11 +1,14 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include "SMP/Common/vtkSMPTaskGraphImpl.h"
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/STDThread/vtkSMPToolsImpl.txx"
 
-#include <cstdlib> // For std::getenv()
-#include <thread>  // For std::thread::hardware_concurrency()
+#include <condition_variable> // For std::condition_variable
+#include <cstdlib>            // For std::getenv()
+#include <mutex>              // For std::mutex
+#include <thread>             // For std::thread::hardware_concurrency()
 
 namespace vtk
 {
@@ -74,6 +77,59 @@ bool vtkSMPToolsImpl<BackendType::STDThread>::IsParallelScope()
   return vtkSMPThreadPool::GetInstance().IsParallelScope();
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::STDThread>::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph)
+{
+  const std::size_t numberOfTasks = graph.GetNumberOfTasks();
+  const std::size_t threadNumber =
+    std::min(static_cast<std::size_t>(GetNumberOfThreadsSTDThread()), numberOfTasks);
+  if (threadNumber <= 1 ||
+    (!this->NestedActivated && vtkSMPThreadPool::GetInstance().IsParallelScope()))
+  {
+    graph.ExecuteSequential();
+    return;
+  }
+
+  // A proxy must only be fed from the thread that allocated it, so instead of submitting
+  // tasks as they become ready, each pool thread runs a worker pulling from a shared queue.
+  std::vector<std::size_t> ready = graph.Prepare();
+  std::size_t remaining = numberOfTasks;
+  std::mutex mutex;
+  std::condition_variable condition;
+
+  auto worker = [&]() {
+    std::vector<std::size_t> newlyReady;
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true)
+    {
+      condition.wait(lock, [&]() { return !ready.empty() || remaining == 0; });
+      if (remaining == 0)
+      {
+        return;
+      }
+      const std::size_t id = ready.back();
+      ready.pop_back();
+      lock.unlock();
+
+      newlyReady.clear();
+      graph.Run(id, [&newlyReady](std::size_t successor) { newlyReady.push_back(successor); });
+
+      lock.lock();
+      --remaining;
+      ready.insert(ready.end(), newlyReady.begin(), newlyReady.end());
+      condition.notify_all();
+    }
+  };
+
+  auto proxy = vtkSMPThreadPool::GetInstance().AllocateThreads(threadNumber);
+  for (std::size_t i = 0; i < threadNumber; ++i)
+  {
+    proxy.DoJob(worker);
+  }
+  proxy.Join();
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
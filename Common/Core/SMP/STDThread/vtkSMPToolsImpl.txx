@@ -115,6 +115,46 @@ void vtkSMPToolsImpl<BackendType::STDThread>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename RandomAccessIterator, typename Compare>
+void vtkSMPToolsImpl<BackendType::STDThread>::StableSort(
+  RandomAccessIterator begin, RandomAccessIterator end, Compare comp)
+{
+  ExecuteStableSort(*this, GetNumberOfThreadsSTDThread(), begin, end, comp);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::STDThread>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+{
+  ExecuteInclusiveScan(*this, GetNumberOfThreadsSTDThread(), inBegin, inEnd, outBegin, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::STDThread>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  ExecuteScan(*this, GetNumberOfThreadsSTDThread(), inBegin, inEnd, outBegin, op, false, &init);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename Predicate>
+OutputIt vtkSMPToolsImpl<BackendType::STDThread>::CopyIf(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, Predicate pred)
+{
+  return ExecuteCopyIf(*this, GetNumberOfThreadsSTDThread(), inBegin, inEnd, outBegin, pred);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::STDThread>::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph);
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::STDThread>::Initialize(int);
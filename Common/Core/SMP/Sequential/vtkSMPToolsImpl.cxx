@@ -1,6 +1,7 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include "SMP/Common/vtkSMPTaskGraphImpl.h"
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/Sequential/vtkSMPToolsImpl.txx"
 
@@ -39,6 +40,13 @@ bool vtkSMPToolsImpl<BackendType::Sequential>::GetSingleThread()
   return true;
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::Sequential>::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph)
+{
+  graph.ExecuteSequential();
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
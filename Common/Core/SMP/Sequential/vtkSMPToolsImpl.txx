@@ -93,6 +93,46 @@ void vtkSMPToolsImpl<BackendType::Sequential>::Sort(
   std::sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename RandomAccessIterator, typename Compare>
+void vtkSMPToolsImpl<BackendType::Sequential>::StableSort(
+  RandomAccessIterator begin, RandomAccessIterator end, Compare comp)
+{
+  ExecuteStableSort(*this, 0, begin, end, comp);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::Sequential>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+{
+  ExecuteInclusiveScan(*this, 0, inBegin, inEnd, outBegin, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::Sequential>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  ExecuteScan(*this, 0, inBegin, inEnd, outBegin, op, false, &init);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename Predicate>
+OutputIt vtkSMPToolsImpl<BackendType::Sequential>::CopyIf(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, Predicate pred)
+{
+  return ExecuteCopyIf(*this, 0, inBegin, inEnd, outBegin, pred);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::Sequential>::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph);
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::Sequential>::Initialize(int);
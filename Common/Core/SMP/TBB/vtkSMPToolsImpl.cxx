@@ -1,12 +1,14 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include "SMP/Common/vtkSMPTaskGraphImpl.h"
 #include "SMP/Common/vtkSMPToolsImpl.h"
 #include "SMP/TBB/vtkSMPToolsImpl.txx"
 
-#include <cstdlib> // For std::getenv()
-#include <mutex>   // For std::mutex
-#include <stack>   // For std::stack
+#include <cstdlib>    // For std::getenv()
+#include <functional> // For std::function
+#include <mutex>      // For std::mutex
+#include <stack>      // For std::stack
 
 #ifdef _MSC_VER
 #pragma push_macro("__TBB_NO_IMPLICIT_LINKAGE")
@@ -14,6 +16,7 @@
 #endif
 
 #include <tbb/task_arena.h> // For tbb:task_arena
+#include <tbb/task_group.h> // For tbb::task_group
 
 #ifdef _MSC_VER
 #pragma pop_macro("__TBB_NO_IMPLICIT_LINKAGE")
@@ -150,6 +153,44 @@ void vtkSMPToolsImplForTBB(vtkIdType first, vtkIdType last, vtkIdType grain,
   threadIdStackLock->unlock();
 }
 
+//------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::TBB>::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph)
+{
+  if (!this->NestedActivated && this->IsParallel)
+  {
+    graph.ExecuteSequential();
+    return;
+  }
+
+  bool fromParallelCode = this->IsParallel.exchange(true);
+
+  auto execute = [&graph]() {
+    tbb::task_group group;
+    std::function<void(std::size_t)> spawn = [&](std::size_t id) {
+      group.run([&, id]() { graph.Run(id, spawn); });
+    };
+    for (std::size_t root : graph.Prepare())
+    {
+      spawn(root);
+    }
+    group.wait();
+  };
+
+  if (taskArena->is_active())
+  {
+    taskArena->execute(execute);
+  }
+  else
+  {
+    execute();
+  }
+
+  // Same as in vtkSMPToolsImpl<BackendType::TBB>::For: IsParallel &= fromParallelCode
+  bool trueFlag = true;
+  this->IsParallel.compare_exchange_weak(trueFlag, fromParallelCode);
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -194,6 +194,10 @@ void vtkSMPToolsImpl<BackendType::TBB>::Sort(
   tbb::parallel_sort(begin, end, comp);
 }
 
+//--------------------------------------------------------------------------------
+template <>
+void vtkSMPToolsImpl<BackendType::TBB>::ExecuteTaskGraph(vtkSMPTaskGraphImpl& graph);
+
 //--------------------------------------------------------------------------------
 template <>
 void vtkSMPToolsImpl<BackendType::TBB>::Initialize(int);
@@ -210,6 +214,43 @@ int vtkSMPToolsImpl<BackendType::TBB>::GetEstimatedNumberOfThreads();
 template <>
 bool vtkSMPToolsImpl<BackendType::TBB>::GetSingleThread();
 
+//--------------------------------------------------------------------------------
+template <>
+template <typename RandomAccessIterator, typename Compare>
+void vtkSMPToolsImpl<BackendType::TBB>::StableSort(
+  RandomAccessIterator begin, RandomAccessIterator end, Compare comp)
+{
+  ExecuteStableSort(*this, this->GetEstimatedNumberOfThreads(), begin, end, comp);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::TBB>::InclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+{
+  ExecuteInclusiveScan(*this, this->GetEstimatedNumberOfThreads(), inBegin, inEnd, outBegin, op);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+void vtkSMPToolsImpl<BackendType::TBB>::ExclusiveScan(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+{
+  ExecuteScan(
+    *this, this->GetEstimatedNumberOfThreads(), inBegin, inEnd, outBegin, op, false, &init);
+}
+
+//--------------------------------------------------------------------------------
+template <>
+template <typename InputIt, typename OutputIt, typename Predicate>
+OutputIt vtkSMPToolsImpl<BackendType::TBB>::CopyIf(
+  InputIt inBegin, InputIt inEnd, OutputIt outBegin, Predicate pred)
+{
+  return ExecuteCopyIf(*this, this->GetEstimatedNumberOfThreads(), inBegin, inEnd, outBegin, pred);
+}
+
 VTK_ABI_NAMESPACE_END
 } // namespace smp
 } // namespace detail
@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkBufferPlacement.h"
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+#include "vtkSOADataArrayTemplate.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ArrayT>
+bool TestArray(ArrayT* array, const char* name)
+{
+  // Large enough to be above vtkBufferPlacement::GetMinimumSize().
+  const vtkIdType numTuples = 200000;
+  array->SetNumberOfComponents(3);
+  array->SetNumberOfTuples(numTuples);
+  vtkSMPTools::For(0, numTuples, [array](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType tupleId = begin; tupleId < end; ++tupleId)
+    {
+      for (int comp = 0; comp < 3; ++comp)
+      {
+        array->SetTypedComponent(tupleId, comp, static_cast<double>(3 * tupleId + comp));
+      }
+    }
+  });
+
+  // Grow the array to go through Reallocate().
+  array->Resize(2 * numTuples);
+  array->SetNumberOfTuples(2 * numTuples);
+  for (vtkIdType tupleId = numTuples; tupleId < 2 * numTuples; ++tupleId)
+  {
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      array->SetTypedComponent(tupleId, comp, static_cast<double>(3 * tupleId + comp));
+    }
+  }
+
+  for (vtkIdType tupleId = 0; tupleId < 2 * numTuples; ++tupleId)
+  {
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      if (array->GetTypedComponent(tupleId, comp) != static_cast<double>(3 * tupleId + comp))
+      {
+        std::cerr << name << ": wrong value at tuple " << tupleId << " component " << comp
+                  << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestBufferPlacement(int, char*[])
+{
+  const int initialMode = vtkBufferPlacement::GetGlobalMode();
+  bool success = true;
+
+  vtkBufferPlacement::SetGlobalMode(vtkBufferPlacement::USE_GLOBAL);
+  if (vtkBufferPlacement::GetGlobalMode() != initialMode)
+  {
+    std::cerr << "USE_GLOBAL must not be accepted as global mode." << std::endl;
+    success = false;
+  }
+
+  const int modes[] = { vtkBufferPlacement::SYSTEM, vtkBufferPlacement::FIRST_TOUCH,
+    vtkBufferPlacement::INTERLEAVE };
+  for (int mode : modes)
+  {
+    vtkBufferPlacement::SetGlobalMode(mode);
+    if (vtkBufferPlacement::GetGlobalMode() != mode)
+    {
+      std::cerr << "Global mode was not set to " << mode << std::endl;
+      success = false;
+    }
+
+    vtkNew<vtkAOSDataArrayTemplate<double>> aos;
+    success &= TestArray(aos.Get(), "AOS with global mode");
+    vtkNew<vtkSOADataArrayTemplate<double>> soa;
+    success &= TestArray(soa.Get(), "SOA with global mode");
+  }
+  vtkBufferPlacement::SetGlobalMode(vtkBufferPlacement::SYSTEM);
+
+  for (int mode : modes)
+  {
+    vtkNew<vtkAOSDataArrayTemplate<double>> aos;
+    aos->SetPlacementMode(mode);
+    success &= TestArray(aos.Get(), "AOS with per-array mode");
+    vtkNew<vtkSOADataArrayTemplate<double>> soa;
+    soa->SetPlacementMode(mode);
+    success &= TestArray(soa.Get(), "SOA with per-array mode");
+  }
+
+  vtkBufferPlacement::SetGlobalMode(initialMode);
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,250 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkContiguousStringArray.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+namespace
+{
+//------------------------------------------------------------------------------
+bool ViewEquals(const vtkContiguousStringArray::StringView& view, const std::string& str)
+{
+  return view.ToString() == str;
+}
+
+//------------------------------------------------------------------------------
+bool CheckOffsets(vtkContiguousStringArray* array)
+{
+  vtkIdTypeArray* offsets = array->GetOffsets();
+  vtkCharArray* characters = array->GetCharacters();
+  if (offsets->GetNumberOfValues() != array->GetNumberOfValues() + 1 ||
+    offsets->GetValue(0) != 0 ||
+    offsets->GetValue(array->GetNumberOfValues()) != characters->GetNumberOfValues())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < array->GetNumberOfValues(); ++i)
+  {
+    const vtkContiguousStringArray::StringView view = array->GetView(i);
+    if (view.Size != offsets->GetValue(i + 1) - offsets->GetValue(i) ||
+      view.Data != characters->GetPointer(offsets->GetValue(i)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestContiguousStringArray(int, char*[])
+{
+  vtkNew<vtkContiguousStringArray> array;
+  if (array->GetDataType() != VTK_CONTIGUOUS_STRING || array->GetNumberOfValues() != 0)
+  {
+    std::cerr << "Wrong data type or number of values of a new array." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Appending
+  const vtkIdType numValues = 1000;
+  for (vtkIdType i = 0; i < numValues; ++i)
+  {
+    if (array->InsertNextValue("value " + std::to_string(i)) != i)
+    {
+      std::cerr << "Wrong index returned by InsertNextValue for value " << i << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (array->GetNumberOfValues() != numValues || !ViewEquals(array->GetView(0), "value 0") ||
+    array->GetValue(999) != "value 999" || !CheckOffsets(array))
+  {
+    std::cerr << "Wrong values after appending." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Values with embedded null characters and empty values
+  const std::string withNull("a\0b", 3);
+  array->SetValue(10, withNull);
+  array->SetValue(11, "");
+  if (array->GetView(10).Size != 3 || !ViewEquals(array->GetView(10), withNull) ||
+    array->GetView(11).Size != 0 || !ViewEquals(array->GetView(12), "value 12"))
+  {
+    std::cerr << "Wrong values with an embedded null character or empty values." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Growing and shrinking a value in the middle moves the values that follow
+  array->SetValue(5, "a much longer value than before");
+  if (!ViewEquals(array->GetView(5), "a much longer value than before") ||
+    !ViewEquals(array->GetView(6), "value 6"))
+  {
+    std::cerr << "Wrong values after growing a value." << std::endl;
+    return EXIT_FAILURE;
+  }
+  array->SetValue(5, "x");
+  if (!ViewEquals(array->GetView(5), "x") || !ViewEquals(array->GetView(998), "value 998") ||
+    !CheckOffsets(array))
+  {
+    std::cerr << "Wrong values after shrinking a value." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Setting a value from a view of the same array
+  const vtkContiguousStringArray::StringView view = array->GetView(998);
+  array->SetValue(0, view.Data, view.Size);
+  if (!ViewEquals(array->GetView(0), "value 998"))
+  {
+    std::cerr << "Wrong value set from a view of the same array." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Growing with SetNumberOfValues adds empty values
+  array->SetNumberOfValues(numValues + 10);
+  if (array->GetView(numValues + 5).Size != 0)
+  {
+    std::cerr << "The values added by SetNumberOfValues are not empty." << std::endl;
+    return EXIT_FAILURE;
+  }
+  array->SetValue(numValues + 7, "seven");
+  if (array->GetView(numValues + 6).Size != 0 ||
+    !ViewEquals(array->GetView(numValues + 7), "seven") ||
+    array->GetView(numValues + 8).Size != 0 || !CheckOffsets(array))
+  {
+    std::cerr << "Wrong values after setting a value added by SetNumberOfValues." << std::endl;
+    return EXIT_FAILURE;
+  }
+  array->SetNumberOfValues(3);
+  if (array->GetNumberOfValues() != 3 || !ViewEquals(array->GetView(2), "value 2") ||
+    !CheckOffsets(array))
+  {
+    std::cerr << "Wrong values after shrinking with SetNumberOfValues." << std::endl;
+    return EXIT_FAILURE;
+  }
+  array->InsertValue(5, "five");
+  if (array->GetNumberOfValues() != 6 || array->GetView(3).Size != 0 ||
+    !ViewEquals(array->GetView(5), "five"))
+  {
+    std::cerr << "Wrong values after inserting past the end." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Lookup
+  if (array->LookupValue("five", 4) != 5 || array->LookupValue(vtkVariant("value 1")) != 1 ||
+    array->LookupValue(vtkVariant("missing")) != -1)
+  {
+    std::cerr << "Wrong index returned by LookupValue." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkNew<vtkIdList> ids;
+  array->LookupValue(vtkVariant(""), ids);
+  if (ids->GetNumberOfIds() != 2 || ids->GetId(0) != 3 || ids->GetId(1) != 4)
+  {
+    std::cerr << "Wrong indices of the empty values returned by LookupValue." << std::endl;
+    return EXIT_FAILURE;
+  }
+  array->SetValue(3, "five");
+  if (array->LookupValue(vtkVariant("five")) != 3)
+  {
+    std::cerr << "LookupValue does not find a modified value." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Conversions from and to vtkStringArray
+  vtkNew<vtkStringArray> strings;
+  strings->SetNumberOfComponents(2);
+  strings->InsertNextValue("a");
+  strings->InsertNextValue("bb");
+  strings->InsertNextValue("");
+  strings->InsertNextValue("dddd");
+  strings->SetName("strings");
+  vtkNew<vtkContiguousStringArray> copy;
+  copy->DeepCopy(strings);
+  if (copy->GetNumberOfComponents() != 2 || copy->GetNumberOfTuples() != 2 ||
+    std::string(copy->GetName()) != "strings" || copy->GetValue(1) != "bb" ||
+    copy->GetValue(3) != "dddd" || copy->GetDataSize() != strings->GetDataSize())
+  {
+    std::cerr << "Wrong deep copy of a vtkStringArray." << std::endl;
+    return EXIT_FAILURE;
+  }
+  copy->InsertNextTuple(0, strings);
+  if (copy->GetNumberOfTuples() != 3 || copy->GetValue(5) != "bb")
+  {
+    std::cerr << "Wrong tuple inserted from a vtkStringArray." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkNew<vtkStringArray> back;
+  back->SetNumberOfComponents(2);
+  back->SetNumberOfTuples(3);
+  copy->GetTuples(0, 2, back);
+  if (back->GetValue(3) != "dddd" || back->GetValue(4) != "a")
+  {
+    std::cerr << "Wrong tuples copied to a vtkStringArray." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Copying from a numeric array converts the values to strings
+  vtkNew<vtkIntArray> ints;
+  ints->InsertNextValue(42);
+  vtkNew<vtkContiguousStringArray> fromInts;
+  fromInts->InsertNextTuple(0, ints);
+  if (fromInts->GetValue(0) != "42" || fromInts->GetVariantValue(0).ToString() != "42")
+  {
+    std::cerr << "Wrong value converted from an int array." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Interpolation copies the value with the largest weight
+  vtkNew<vtkIdList> ptIds;
+  ptIds->InsertNextId(0);
+  ptIds->InsertNextId(1);
+  double weights[2] = { 0.25, 0.75 };
+  vtkNew<vtkContiguousStringArray> interpolated;
+  interpolated->SetNumberOfComponents(2);
+  interpolated->InterpolateTuple(0, ptIds, copy, weights);
+  if (!interpolated->GetValue(0).empty() || interpolated->GetValue(1) != "dddd")
+  {
+    std::cerr << "Wrong interpolated tuple." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Zero copy buffers
+  vtkNew<vtkContiguousStringArray> shared;
+  if (!shared->SetData(copy->GetCharacters(), copy->GetOffsets()) ||
+    shared->GetCharacters() != copy->GetCharacters() ||
+    shared->GetNumberOfValues() != copy->GetNumberOfValues() || shared->GetValue(3) != "dddd")
+  {
+    std::cerr << "Wrong values when sharing the buffers of another array." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkNew<vtkIdTypeArray> badOffsets;
+  badOffsets->InsertNextValue(0);
+  badOffsets->InsertNextValue(1000);
+  vtkObject::GlobalWarningDisplayOff();
+  const bool badOffsetsSet = shared->SetData(copy->GetCharacters(), badOffsets);
+  vtkObject::GlobalWarningDisplayOn();
+  if (badOffsetsSet)
+  {
+    std::cerr << "Offsets past the end of the characters were accepted." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Factory
+  vtkSmartPointer<vtkAbstractArray> created =
+    vtkSmartPointer<vtkAbstractArray>::Take(vtkAbstractArray::CreateArray(VTK_CONTIGUOUS_STRING));
+  if (!vtkContiguousStringArray::SafeDownCast(created))
+  {
+    std::cerr << "vtkAbstractArray::CreateArray does not create a vtkContiguousStringArray."
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
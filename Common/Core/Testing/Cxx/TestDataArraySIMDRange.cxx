@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkAOSDataArrayTemplate.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkSOADataArrayTemplate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <type_traits>
+
+// Checks the ranges computed by the SIMD kernels of vtkDataArrayPrivate.txx
+// against a brute force computation, for all the vectorized value types and
+// for numbers of components that do not match the vector widths.
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ArrayT>
+void FillArray(ArrayT* array, int numComps, vtkIdType numTuples, bool specialValues)
+{
+  using ValueType = typename ArrayT::ValueType;
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(numComps * 1000 + static_cast<int>(numTuples % 1000));
+  array->SetNumberOfComponents(numComps);
+  array->SetNumberOfTuples(numTuples);
+  for (vtkIdType valueId = 0; valueId < numComps * numTuples; ++valueId)
+  {
+    random->Next();
+    array->SetValue(valueId, static_cast<ValueType>(random->GetRangeValue(-1000.0, 1000.0)));
+  }
+  if (specialValues && std::numeric_limits<ValueType>::has_infinity && numTuples > 10)
+  {
+    array->SetValue(3, std::numeric_limits<ValueType>::quiet_NaN());
+    array->SetValue(7, std::numeric_limits<ValueType>::infinity());
+    array->SetValue(numComps * numTuples - 1, -std::numeric_limits<ValueType>::infinity());
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ArrayT>
+void ComputeExpectedRange(ArrayT* array, int comp, bool finite, double range[2])
+{
+  range[0] = vtkMath::Inf();
+  range[1] = -vtkMath::Inf();
+  for (vtkIdType tupleId = 0; tupleId < array->GetNumberOfTuples(); ++tupleId)
+  {
+    double value;
+    if (comp >= 0)
+    {
+      value = static_cast<double>(array->GetTypedComponent(tupleId, comp));
+    }
+    else
+    {
+      double squaredSum = 0.0;
+      for (int c = 0; c < array->GetNumberOfComponents(); ++c)
+      {
+        const double x = static_cast<double>(array->GetTypedComponent(tupleId, c));
+        squaredSum += x * x;
+      }
+      value = std::sqrt(squaredSum);
+    }
+    if (vtkMath::IsNan(value) || (finite && vtkMath::IsInf(value)))
+    {
+      continue;
+    }
+    range[0] = std::min(range[0], value);
+    range[1] = std::max(range[1], value);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool SameValue(double a, double b)
+{
+  return a == b || std::abs(a - b) <= 1e-12 * std::max(std::abs(a), std::abs(b));
+}
+
+//------------------------------------------------------------------------------
+template <typename ArrayT>
+bool TestArrayType(const char* name)
+{
+  const vtkIdType tupleCounts[] = { 1, 5, 17, 1000, 100003 };
+  for (int numComps = 1; numComps <= 11; ++numComps)
+  {
+    for (vtkIdType numTuples : tupleCounts)
+    {
+      for (bool specialValues : { false, true })
+      {
+        vtkNew<ArrayT> array;
+        FillArray(array.Get(), numComps, numTuples, specialValues);
+        for (bool finite : { false, true })
+        {
+          // Component -1 is the magnitude range, except for single component arrays.
+          for (int comp = numComps > 1 ? -1 : 0; comp < numComps; ++comp)
+          {
+            double expected[2];
+            ComputeExpectedRange(array.Get(), comp, finite, expected);
+            double range[2];
+            if (finite)
+            {
+              array->GetFiniteRange(range, comp);
+            }
+            else
+            {
+              array->GetRange(range, comp);
+            }
+            if (!SameValue(range[0], expected[0]) || !SameValue(range[1], expected[1]))
+            {
+              std::cerr << name << ": wrong " << (finite ? "finite range" : "range")
+                        << " for component " << comp << " of " << numComps << " with "
+                        << numTuples << " tuples" << (specialValues ? " and special values" : "")
+                        << ". Got [" << range[0] << ", " << range[1] << "], expected ["
+                        << expected[0] << ", " << expected[1] << "]." << std::endl;
+              return false;
+            }
+          }
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestDataArraySIMDRange(int, char*[])
+{
+  bool success = true;
+  success &= TestArrayType<vtkAOSDataArrayTemplate<float>>("AOS float");
+  success &= TestArrayType<vtkAOSDataArrayTemplate<double>>("AOS double");
+  success &= TestArrayType<vtkAOSDataArrayTemplate<int>>("AOS int");
+  success &= TestArrayType<vtkSOADataArrayTemplate<float>>("SOA float");
+  success &= TestArrayType<vtkSOADataArrayTemplate<double>>("SOA double");
+  success &= TestArrayType<vtkSOADataArrayTemplate<int>>("SOA int");
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
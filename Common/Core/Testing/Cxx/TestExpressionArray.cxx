@@ -0,0 +1,197 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkExpressionArray.h"
+
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIntArray.h"
+#include "vtkMathUtilities.h"
+#include "vtkSOADataArrayTemplate.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> MakeArray(vtkDataArray* array, const vtkArrayExpression& expr)
+{
+  vtkSmartPointer<vtkExpressionArray<double>> result =
+    vtkSmartPointer<vtkExpressionArray<double>>::New();
+  result->ConstructBackend(expr);
+  result->SetNumberOfComponents(expr.GetNumberOfComponents());
+  result->SetNumberOfTuples(array->GetNumberOfTuples());
+  return result;
+}
+
+//------------------------------------------------------------------------------
+// Compare the on-access and the bulk evaluations of an expression to reference values.
+bool CheckExpression(const char* name, const vtkArrayExpression& expr, vtkDataArray* expected)
+{
+  if (!expr.IsValid() || expr.GetNumberOfComponents() != expected->GetNumberOfComponents() ||
+    expr.GetNumberOfTuples() != expected->GetNumberOfTuples())
+  {
+    std::cerr << name << ": wrong expression shape" << std::endl;
+    return false;
+  }
+  vtkSmartPointer<vtkDataArray> implicit = MakeArray(expected, expr);
+  vtkNew<vtkDoubleArray> bulk;
+  expr.Evaluate(bulk);
+  const int numComps = expected->GetNumberOfComponents();
+  std::vector<double> tuple(numComps);
+  for (vtkIdType i = 0; i < expected->GetNumberOfTuples(); ++i)
+  {
+    expr.EvaluateTuple(i, tuple.data());
+    for (int comp = 0; comp < numComps; ++comp)
+    {
+      const double value = expected->GetComponent(i, comp);
+      if (!vtkMathUtilities::FuzzyCompare(implicit->GetComponent(i, comp), value, 1e-12) ||
+        !vtkMathUtilities::FuzzyCompare(bulk->GetComponent(i, comp), value, 1e-12) ||
+        !vtkMathUtilities::FuzzyCompare(tuple[comp], value, 1e-12))
+      {
+        std::cerr << name << ": wrong value at tuple " << i << " component " << comp << ": "
+                  << implicit->GetComponent(i, comp) << ", " << bulk->GetComponent(i, comp)
+                  << ", " << tuple[comp] << " instead of " << value << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestExpressionArray(int, char*[])
+{
+  // More tuples than a block of the bulk evaluation
+  const vtkIdType numTuples = 2500;
+  vtkNew<vtkFloatArray> points;
+  points->SetNumberOfComponents(3);
+  points->SetNumberOfTuples(numTuples);
+  vtkNew<vtkSOADataArrayTemplate<double>> vectors;
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(numTuples);
+  vtkNew<vtkIntArray> ids;
+  ids->SetNumberOfTuples(numTuples);
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    points->SetTuple3(i, 0.5 * i, std::sin(0.01 * i), -2.0 * i);
+    vectors->SetTuple3(i, 1.0, 0.25 * i, std::cos(0.03 * i));
+    ids->SetValue(i, static_cast<int>(i));
+  }
+
+  const vtkArrayExpression p = vtkArrayExpression::Array(points);
+  const vtkArrayExpression v = vtkArrayExpression::Array(vectors);
+  const vtkArrayExpression id = vtkArrayExpression::Array(ids);
+
+  vtkNew<vtkDoubleArray> expected;
+  expected->SetNumberOfTuples(numTuples);
+
+  // Norm
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    double* x = vectors->GetTuple3(i);
+    expected->SetValue(i, std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]));
+  }
+  if (!CheckExpression("norm", vtkArrayExpression::Norm(v), expected))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Dot product and component extraction
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    double x[3], y[3];
+    points->GetTuple(i, x);
+    vectors->GetTuple(i, y);
+    expected->SetValue(i, x[0] * y[0] + x[1] * y[1] + x[2] * y[2] - x[2]);
+  }
+  if (!CheckExpression("dot",
+        vtkArrayExpression::Dot(p, v) - vtkArrayExpression::Component(p, 2), expected))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Clamped elevation with chained affine operations
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    const double z = points->GetComponent(i, 2);
+    expected->SetValue(i, std::min(std::max((z + 100.0) / 1000.0 * 2.0, 0.0), 1.0));
+  }
+  const vtkArrayExpression elevation =
+    vtkArrayExpression::Clamp((vtkArrayExpression::Component(p, 2) + 100.0) / 1000.0 * 2.0, 0, 1);
+  if (!CheckExpression("elevation", elevation, expected))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Broadcast of single component operands, integer operands
+  vtkNew<vtkDoubleArray> expected3;
+  expected3->SetNumberOfComponents(3);
+  expected3->SetNumberOfTuples(numTuples);
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    for (int comp = 0; comp < 3; ++comp)
+    {
+      expected3->SetComponent(
+        i, comp, std::abs(-points->GetComponent(i, comp) * i / (1.0 + i) + 3.0 * i));
+    }
+  }
+  const vtkArrayExpression broadcast =
+    vtkArrayExpression::Abs(-p * id / (id + 1.0) + 3.0 * id);
+  if (!CheckExpression("broadcast", broadcast, expected3))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Transform
+  const double matrix[16] = { 0, -1, 0, 1, 1, 0, 0, 2, 0, 0, 2, 3, 0, 0, 0, 1 };
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    double* x = points->GetTuple3(i);
+    expected3->SetTuple3(i, 1 - x[1], 2 + x[0], 3 + 2 * x[2]);
+  }
+  if (!CheckExpression("transform", vtkArrayExpression::Transform(p, matrix), expected3))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Fusion: an expression over an expression array reuses its expression instead of reading the
+  // intermediate array
+  vtkSmartPointer<vtkDataArray> normArray = MakeArray(vectors, vtkArrayExpression::Norm(v));
+  const vtkArrayExpression scaled = vtkArrayExpression::Array(normArray) * 2.0;
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    double* x = vectors->GetTuple3(i);
+    expected->SetValue(i, 2.0 * std::sqrt(x[0] * x[0] + x[1] * x[1] + x[2] * x[2]));
+  }
+  if (!CheckExpression("fused", scaled, expected))
+  {
+    return EXIT_FAILURE;
+  }
+  if (scaled.GetActualMemorySize() != vtkArrayExpression::Norm(v).GetActualMemorySize())
+  {
+    std::cerr << "The fused expression should only refer to the vectors." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Invalid expressions
+  vtkNew<vtkDoubleArray> small;
+  small->SetNumberOfComponents(2);
+  small->SetNumberOfTuples(10);
+  vtkObject::GlobalWarningDisplayOff();
+  const bool invalid = (p + vtkArrayExpression::Array(small)).IsValid() ||
+    vtkArrayExpression::Component(p, 3).IsValid() ||
+    vtkArrayExpression::Transform(id, matrix).IsValid();
+  vtkObject::GlobalWarningDisplayOn();
+  if (invalid)
+  {
+    std::cerr << "Invalid expressions were not detected." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
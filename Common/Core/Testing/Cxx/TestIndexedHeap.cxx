@@ -0,0 +1,180 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkIndexedHeap.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+
+#include <iostream>
+#include <limits>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+// Apply random insertions, priority updates, deletions and pops to a heap and
+// to an ordered set of (priority, id) pairs, and check that they agree.
+template <typename PriorityType, int Arity>
+bool TestRandomOperations(const char* name)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(8775070);
+
+  // Few distinct priorities, to exercise the ordering of equal priorities
+  const vtkIdType numberOfIds = 2000;
+  std::vector<PriorityType> priorities(numberOfIds);
+  for (vtkIdType id = 0; id < numberOfIds; ++id)
+  {
+    priorities[id] = static_cast<PriorityType>(random->GetNextRangeValue(0, 100)) / 4;
+  }
+
+  vtkIndexedHeap<PriorityType, Arity> heap;
+  std::set<std::pair<PriorityType, vtkIdType>> expected;
+  std::map<vtkIdType, PriorityType> expectedPriorities;
+
+  // Build with every other id
+  std::vector<vtkIdType> ids;
+  std::vector<PriorityType> buildPriorities;
+  for (vtkIdType id = 0; id < numberOfIds; id += 2)
+  {
+    ids.push_back(id);
+    buildPriorities.push_back(priorities[id]);
+    expected.insert(std::make_pair(priorities[id], id));
+    expectedPriorities[id] = priorities[id];
+  }
+  heap.Build(static_cast<vtkIdType>(ids.size()), buildPriorities.data(), ids.data());
+
+  for (int i = 0; i < 20000; ++i)
+  {
+    const vtkIdType id = static_cast<vtkIdType>(random->GetNextRangeValue(0, numberOfIds));
+    const PriorityType priority =
+      static_cast<PriorityType>(random->GetNextRangeValue(0, 100)) / 4;
+    const auto found = expectedPriorities.find(id);
+    const int operation = static_cast<int>(random->GetNextRangeValue(0, 4));
+    if (operation == 0)
+    {
+      if (heap.Insert(priority, id) != (found == expectedPriorities.end()))
+      {
+        std::cerr << name << ": wrong result of Insert for id " << id << std::endl;
+        return false;
+      }
+      if (found == expectedPriorities.end())
+      {
+        expected.insert(std::make_pair(priority, id));
+        expectedPriorities[id] = priority;
+      }
+    }
+    else if (operation == 1)
+    {
+      heap.UpdatePriority(priority, id);
+      if (found != expectedPriorities.end())
+      {
+        expected.erase(std::make_pair(found->second, id));
+      }
+      expected.insert(std::make_pair(priority, id));
+      expectedPriorities[id] = priority;
+    }
+    else if (operation == 2)
+    {
+      const PriorityType deleted = heap.DeleteId(id);
+      const PriorityType expectedDeleted = found == expectedPriorities.end()
+        ? std::numeric_limits<PriorityType>::max()
+        : found->second;
+      if (deleted != expectedDeleted)
+      {
+        std::cerr << name << ": wrong priority deleted for id " << id << std::endl;
+        return false;
+      }
+      if (found != expectedPriorities.end())
+      {
+        expected.erase(std::make_pair(found->second, id));
+        expectedPriorities.erase(found);
+      }
+    }
+    else
+    {
+      PriorityType popped = 0;
+      const vtkIdType poppedId = heap.Pop(popped);
+      if (expected.empty() ? poppedId != -1
+                           : (poppedId != expected.begin()->second ||
+                               popped != expected.begin()->first))
+      {
+        std::cerr << name << ": wrong id " << poppedId << " popped" << std::endl;
+        return false;
+      }
+      if (!expected.empty())
+      {
+        expectedPriorities.erase(poppedId);
+        expected.erase(expected.begin());
+      }
+    }
+
+    if (heap.GetNumberOfItems() != static_cast<vtkIdType>(expected.size()) ||
+      heap.GetPriority(id) != (expectedPriorities.count(id)
+                                  ? expectedPriorities[id]
+                                  : std::numeric_limits<PriorityType>::max()))
+    {
+      std::cerr << name << ": heap and reference differ after operation " << i << std::endl;
+      return false;
+    }
+  }
+
+  // Pop everything in order
+  for (const auto& item : expected)
+  {
+    PriorityType priority = 0;
+    if (heap.Peek() != item.second || heap.Pop(priority) != item.second || priority != item.first)
+    {
+      std::cerr << name << ": wrong order of the remaining items" << std::endl;
+      return false;
+    }
+  }
+  if (!heap.IsEmpty() || heap.Pop() != -1 || heap.Peek() != -1)
+  {
+    std::cerr << name << ": the heap should be empty" << std::endl;
+    return false;
+  }
+
+  // Reuse after a reset
+  heap.Insert(1, 5);
+  heap.Insert(0, 7);
+  heap.Reset();
+  if (!heap.IsEmpty() || heap.Contains(5) || !heap.Insert(2, 5) || heap.Pop() != 5)
+  {
+    std::cerr << name << ": wrong state after Reset" << std::endl;
+    return false;
+  }
+  return true;
+}
+
+} // end anonymous namespace
+
+int TestIndexedHeap(int, char*[])
+{
+  if (!TestRandomOperations<double, 4>("double 4-ary") ||
+    !TestRandomOperations<double, 2>("double binary") ||
+    !TestRandomOperations<float, 8>("float 8-ary"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Identity ids built from priorities only
+  const double priorities[] = { 3.0, 1.0, 2.0, 1.0, 0.5 };
+  vtkIndexedHeap<> heap;
+  heap.Build(5, priorities);
+  const vtkIdType order[] = { 4, 1, 3, 2, 0 };
+  for (vtkIdType expectedId : order)
+  {
+    if (heap.Pop() != expectedId)
+    {
+      std::cerr << "Wrong order of a heap built from priorities." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,183 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the mapping of large arrays, split across threads, against the mapping
+// of single values with MapValue.
+
+#include "vtkLookupTable.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+
+//------------------------------------------------------------------------------
+// Expected color of a value in the given output format.
+void ExpectedColor(
+  vtkLookupTable* lut, double value, int outputFormat, unsigned char expected[4])
+{
+  const unsigned char* rgba = lut->MapValue(value);
+  const double alpha = lut->GetAlpha();
+  const unsigned char opacity =
+    alpha < 1.0 ? static_cast<unsigned char>(rgba[3] * alpha + 0.5) : rgba[3];
+  const unsigned char luminance =
+    static_cast<unsigned char>(rgba[0] * 0.30 + rgba[1] * 0.59 + rgba[2] * 0.11 + 0.5);
+  switch (outputFormat)
+  {
+    case VTK_RGBA:
+      expected[0] = rgba[0];
+      expected[1] = rgba[1];
+      expected[2] = rgba[2];
+      expected[3] = opacity;
+      break;
+    case VTK_RGB:
+      expected[0] = rgba[0];
+      expected[1] = rgba[1];
+      expected[2] = rgba[2];
+      break;
+    case VTK_LUMINANCE_ALPHA:
+      expected[0] = luminance;
+      expected[1] = opacity;
+      break;
+    default:
+      expected[0] = luminance;
+      break;
+  }
+}
+
+//------------------------------------------------------------------------------
+bool CheckColors(vtkLookupTable* lut, const std::vector<double>& values,
+  const std::vector<unsigned char>& colors, int outputFormat, const char* name)
+{
+  unsigned char expected[4];
+  for (size_t i = 0; i < values.size(); ++i)
+  {
+    ExpectedColor(lut, values[i], outputFormat, expected);
+    for (int c = 0; c < outputFormat; ++c)
+    {
+      if (colors[i * outputFormat + c] != expected[c])
+      {
+        std::cerr << name << ", format " << outputFormat << ": wrong color component " << c
+                  << " for value " << values[i] << " at index " << i << std::endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Map the first component of 2 component tuples in every output format.
+template <class T>
+bool TestMapScalars(vtkLookupTable* lut, const std::vector<T>& tuples, const char* name)
+{
+  const int numberOfValues = static_cast<int>(tuples.size() / 2);
+  std::vector<double> values(numberOfValues);
+  for (int i = 0; i < numberOfValues; ++i)
+  {
+    values[i] = static_cast<double>(tuples[2 * i]);
+  }
+
+  for (int outputFormat = VTK_LUMINANCE; outputFormat <= VTK_RGBA; ++outputFormat)
+  {
+    std::vector<unsigned char> colors(numberOfValues * outputFormat);
+    lut->MapScalarsThroughTable2(const_cast<T*>(tuples.data()), colors.data(),
+      vtkTypeTraits<T>::VTK_TYPE_ID, numberOfValues, 2, outputFormat);
+    if (!CheckColors(lut, values, colors, outputFormat, name))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+} // end anonymous namespace
+
+int TestLookupTableMapScalars(int, char*[])
+{
+  vtkNew<vtkLookupTable> lut;
+  lut->SetNumberOfTableValues(256);
+  lut->SetTableRange(1.0, 1000.0);
+  lut->SetHueRange(0.0, 0.667);
+  lut->SetAlphaRange(0.2, 1.0);
+  lut->UseBelowRangeColorOn();
+  lut->SetBelowRangeColor(0.0, 1.0, 0.0, 1.0);
+  lut->UseAboveRangeColorOn();
+  lut->SetAboveRangeColor(1.0, 0.0, 1.0, 0.5);
+  lut->Build();
+
+  // Enough values to be split across threads, including values out of range and NaN.
+  // Values are positive, MapValue does not use the below range color of the
+  // mapping for values that have no logarithm.
+  const int numberOfValues = 300007;
+  std::vector<double> doubles(2 * numberOfValues);
+  std::vector<float> floats(2 * numberOfValues);
+  std::vector<int> ints(2 * numberOfValues);
+  for (int i = 0; i < numberOfValues; ++i)
+  {
+    double value = 0.01 + 1100.0 * i / numberOfValues;
+    if (i % 1001 == 0)
+    {
+      value = vtkMath::Nan();
+    }
+    doubles[2 * i] = value;
+    floats[2 * i] = static_cast<float>(value);
+    ints[2 * i] = vtkMath::IsNan(value) ? 1 : static_cast<int>(value) + 1;
+    doubles[2 * i + 1] = floats[2 * i + 1] = ints[2 * i + 1] = -1;
+  }
+
+  for (int scale = VTK_SCALE_LINEAR; scale <= VTK_SCALE_LOG10; ++scale)
+  {
+    lut->SetScale(scale);
+    for (double alpha : { 1.0, 0.5 })
+    {
+      lut->SetAlpha(alpha);
+      if (!TestMapScalars(lut.Get(), doubles, "double") ||
+        !TestMapScalars(lut.Get(), floats, "float") || !TestMapScalars(lut.Get(), ints, "int"))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Vector magnitude and component modes
+  lut->SetScale(VTK_SCALE_LINEAR);
+  lut->SetAlpha(1.0);
+  lut->SetTableRange(0.0, 500.0);
+  std::vector<double> vectors(3 * numberOfValues);
+  std::vector<double> magnitudes(numberOfValues);
+  std::vector<double> components(numberOfValues);
+  for (int i = 0; i < numberOfValues; ++i)
+  {
+    vectors[3 * i] = 0.001 * i;
+    vectors[3 * i + 1] = -0.0005 * i;
+    vectors[3 * i + 2] = std::sqrt(static_cast<double>(i));
+    magnitudes[i] = std::sqrt(vectors[3 * i] * vectors[3 * i] +
+      vectors[3 * i + 1] * vectors[3 * i + 1] + vectors[3 * i + 2] * vectors[3 * i + 2]);
+    components[i] = vectors[3 * i + 2];
+  }
+
+  std::vector<unsigned char> colors(4 * numberOfValues);
+  lut->SetVectorModeToMagnitude();
+  lut->MapVectorsThroughTable(
+    vectors.data(), colors.data(), VTK_DOUBLE, numberOfValues, 3, VTK_RGBA);
+  if (!CheckColors(lut, magnitudes, colors, VTK_RGBA, "magnitude"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  lut->SetVectorModeToComponent();
+  lut->SetVectorComponent(2);
+  lut->MapVectorsThroughTable(
+    vectors.data(), colors.data(), VTK_DOUBLE, numberOfValues, 3, VTK_RGBA);
+  if (!CheckColors(lut, components, colors, VTK_RGBA, "component"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,193 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkBitArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkMemoryMappedFile.h"
+#include "vtkNew.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkSmartPointer.h"
+
+#include "vtksys/FStream.hxx"
+
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+constexpr vtkIdType NumberOfFloats = 3 * 70000;
+constexpr vtkIdType NumberOfDoubles = 50000;
+constexpr vtkTypeInt64 FloatsOffset = 16;
+constexpr vtkTypeInt64 DoublesOffset = FloatsOffset + NumberOfFloats * sizeof(float);
+
+//------------------------------------------------------------------------------
+bool WriteFile(const char* fileName)
+{
+  vtksys::ofstream file(fileName, std::ios::out | std::ios::binary);
+  if (!file)
+  {
+    return false;
+  }
+  const char header[FloatsOffset] = "header";
+  file.write(header, FloatsOffset);
+  std::vector<float> floats(NumberOfFloats);
+  for (vtkIdType i = 0; i < NumberOfFloats; ++i)
+  {
+    floats[i] = 0.5f * static_cast<float>(i);
+  }
+  file.write(reinterpret_cast<const char*>(floats.data()), NumberOfFloats * sizeof(float));
+  std::vector<double> doubles(NumberOfDoubles);
+  for (vtkIdType i = 0; i < NumberOfDoubles; ++i)
+  {
+    doubles[i] = -0.25 * static_cast<double>(i);
+  }
+  file.write(reinterpret_cast<const char*>(doubles.data()), NumberOfDoubles * sizeof(double));
+  return static_cast<bool>(file);
+}
+}
+
+//------------------------------------------------------------------------------
+int TestMemoryMappedFile(int argc, char* argv[])
+{
+  if (argc < 2)
+  {
+    std::cout << "Usage: " << argv[0] << " outputFilename" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const char* fileName = argv[1];
+  if (!WriteFile(fileName))
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkMemoryMappedFile> mappedFile;
+  if (mappedFile->IsOpen() || !mappedFile->Open(fileName) ||
+    mappedFile->GetFileSize() != DoublesOffset + NumberOfDoubles * 8)
+  {
+    std::cerr << "Cannot open " << fileName << " or wrong file size." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Map a 3 components array, it outlives the mapped file.
+  vtkSmartPointer<vtkFloatArray> floats = vtkSmartPointer<vtkFloatArray>::New();
+  {
+    vtkNew<vtkMemoryMappedFile> otherFile;
+    floats->SetNumberOfComponents(3);
+    if (!otherFile->Open(fileName) ||
+      !otherFile->MapArray(floats, FloatsOffset, NumberOfFloats / 3))
+    {
+      std::cerr << "Cannot map the float array." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  if (floats->GetNumberOfTuples() != NumberOfFloats / 3 ||
+    !vtkMemoryMappedFile::IsMapped(floats->GetPointer(0)))
+  {
+    std::cerr << "The float array is not mapped with the requested number of tuples."
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < NumberOfFloats; ++i)
+  {
+    if (floats->GetValue(i) != 0.5f * static_cast<float>(i))
+    {
+      std::cerr << "Wrong mapped float value " << floats->GetValue(i) << " at index " << i
+                << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Copy on write arrays can be modified without modifying the file.
+  floats->SetValue(10, -1.0f);
+  vtkNew<vtkFloatArray> otherFloats;
+  if (floats->GetValue(10) != -1.0f ||
+    !mappedFile->MapArray(otherFloats, FloatsOffset, NumberOfFloats) ||
+    otherFloats->GetValue(10) != 5.0f)
+  {
+    std::cerr << "Modifying a copy on write array is not private to the array." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Resized arrays are copied to memory and the range is unmapped.
+  const float* mapped = floats->GetPointer(0);
+  floats->InsertNextTuple3(1.0, 2.0, 3.0);
+  if (vtkMemoryMappedFile::IsMapped(mapped) || floats->GetValue(10) != -1.0f ||
+    floats->GetValue(NumberOfFloats - 1) != 0.5f * static_cast<float>(NumberOfFloats - 1) ||
+    floats->GetValue(NumberOfFloats) != 1.0f)
+  {
+    std::cerr << "The resized array is not copied to memory." << std::endl;
+    return EXIT_FAILURE;
+  }
+  floats = nullptr;
+
+  // Read only mapping of an offset that is not a multiple of the page size.
+  mappedFile->SetAccessModeToReadOnly();
+  vtkNew<vtkDoubleArray> doubles;
+  if (!mappedFile->MapArray(doubles, DoublesOffset + 8, NumberOfDoubles - 1))
+  {
+    std::cerr << "Cannot map the double array." << std::endl;
+    return EXIT_FAILURE;
+  }
+  for (vtkIdType i = 0; i < NumberOfDoubles - 1; ++i)
+  {
+    if (doubles->GetValue(i) != -0.25 * static_cast<double>(i + 1))
+    {
+      std::cerr << "Wrong mapped double value " << doubles->GetValue(i) << " at index " << i
+                << "." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  const double* mappedDoubles = doubles->GetPointer(0);
+  doubles->Initialize();
+  if (vtkMemoryMappedFile::IsMapped(mappedDoubles))
+  {
+    std::cerr << "The range of an initialized array is still mapped." << std::endl;
+    return EXIT_FAILURE;
+  }
+  mappedFile->SetAccessModeToCopyOnWrite();
+
+  // Invalid requests leave the array untouched.
+  vtkNew<vtkDoubleArray> unmapped;
+  unmapped->SetNumberOfValues(4);
+  if (mappedFile->MapArray(unmapped, DoublesOffset + 4, NumberOfDoubles / 2) ||
+    mappedFile->MapArray(unmapped, DoublesOffset, NumberOfDoubles + 1) ||
+    mappedFile->MapArray(unmapped, DoublesOffset, 10))
+  {
+    std::cerr << "A misaligned, too large or too small range was mapped." << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (unmapped->GetNumberOfValues() != 4 || vtkMemoryMappedFile::IsMapped(unmapped->GetPointer(0)))
+  {
+    std::cerr << "A failed mapping modified the array." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkNew<vtkSOADataArrayTemplate<double>> soa;
+  vtkNew<vtkBitArray> bits;
+  if (mappedFile->MapArray(soa, DoublesOffset, NumberOfDoubles) ||
+    mappedFile->MapArray(bits, DoublesOffset, NumberOfDoubles))
+  {
+    std::cerr << "An array that is not an AOS array of values was mapped." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Small ranges are mapped when the minimum size allows it.
+  mappedFile->SetMinimumSize(0);
+  if (!mappedFile->MapArray(unmapped, DoublesOffset, 10) || unmapped->GetNumberOfValues() != 10 ||
+    unmapped->GetValue(9) != -2.25)
+  {
+    std::cerr << "A small range is not mapped with a minimum size of 0." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  mappedFile->Close();
+  if (mappedFile->IsOpen() || mappedFile->MapArray(otherFloats, FloatsOffset, NumberOfFloats) ||
+    otherFloats->GetValue(11) != 5.5f)
+  {
+    std::cerr << "The mapped arrays are not kept, or the file is not closed." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
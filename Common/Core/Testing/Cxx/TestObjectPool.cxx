@@ -0,0 +1,188 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCallbackCommand.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkObjectPool.h"
+#include "vtkPoints.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <cstdlib>
+#include <iostream>
+
+namespace
+{
+//------------------------------------------------------------------------------
+struct FillIds
+{
+  vtkSMPThreadLocalObject<vtkIdList> TLIds;
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkIdList* ids = this->TLIds.Local();
+    for (vtkIdType id = begin; id < end; ++id)
+    {
+      ids->InsertNextId(id);
+    }
+  }
+};
+}
+
+//------------------------------------------------------------------------------
+int TestObjectPool(int, char*[])
+{
+  vtkObjectPool::SetEnabled(true);
+  vtkObjectPool::Clear();
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() != 0)
+  {
+    std::cerr << "The pools are not empty after Clear()." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // A released id list is reset and handed out again.
+  vtkIdList* ids = vtkObjectPool::Acquire<vtkIdList>();
+  for (vtkIdType id = 0; id < 100; ++id)
+  {
+    ids->InsertNextId(id);
+  }
+  vtkObjectPool::Release(ids);
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() != 1)
+  {
+    std::cerr << "The released id list is not pooled." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkIdList* recycled = vtkObjectPool::Acquire<vtkIdList>();
+  if (recycled != ids || recycled->GetNumberOfIds() != 0 ||
+    vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() != 0)
+  {
+    std::cerr << "The pooled id list is not reset and handed out again." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Objects referenced elsewhere are not recycled.
+  recycled->Register(nullptr);
+  vtkObjectPool::Release(recycled);
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() != 0 ||
+    recycled->GetReferenceCount() != 1)
+  {
+    std::cerr << "An id list referenced elsewhere was recycled." << std::endl;
+    return EXIT_FAILURE;
+  }
+  recycled->UnRegister(nullptr);
+
+  // Recycled points are back to an empty float array.
+  vtkPoints* points = vtkObjectPool::Acquire<vtkPoints>();
+  points->SetDataTypeToDouble();
+  points->InsertNextPoint(1.0, 2.0, 3.0);
+  vtkObjectPool::Release(points);
+  points = vtkObjectPool::Acquire<vtkPoints>();
+  if (points->GetDataType() != VTK_FLOAT || points->GetNumberOfPoints() != 0)
+  {
+    std::cerr << "Recycled points are not reset to an empty float array." << std::endl;
+    return EXIT_FAILURE;
+  }
+  vtkObjectPool::Release(points);
+
+  // Classes without vtkObjectPoolTraits are not pooled.
+  vtkDoubleArray* array = vtkObjectPool::Acquire<vtkDoubleArray>();
+  vtkObjectPool::Release(array);
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkDoubleArray>() != 0)
+  {
+    std::cerr << "A class without vtkObjectPoolTraits was pooled." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Scoped handles.
+  {
+    vtkPooledObject<vtkIdList> scoped;
+    scoped->InsertNextId(1);
+  }
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() != 1)
+  {
+    std::cerr << "The id list of a vtkPooledObject is not released to the pool." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Clearing deletes everything before returning.
+  int numberOfDeletes = 0;
+  vtkNew<vtkCallbackCommand> onDelete;
+  onDelete->SetClientData(&numberOfDeletes);
+  onDelete->SetCallback([](vtkObject*, unsigned long, void* clientData, void*) {
+    ++*static_cast<int*>(clientData);
+  });
+  ids = vtkObjectPool::Acquire<vtkIdList>();
+  ids->AddObserver(vtkCommand::DeleteEvent, onDelete);
+  vtkObjectPool::Release(ids);
+  vtkObjectPool::Clear();
+  if (numberOfDeletes != 1 || vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() != 0)
+  {
+    std::cerr << "Clear() did not delete the pooled objects." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Disabling bypasses the free lists.
+  vtkObjectPool::SetEnabled(false);
+  {
+    vtkPooledObject<vtkIdList> scoped;
+  }
+  vtkObjectPool::SetEnabled(true);
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() != 0)
+  {
+    std::cerr << "An id list was pooled while pooling is disabled." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Objects of thread local objects are released when the thread local is
+  // destroyed, and reused by the next algorithm.
+  {
+    FillIds functor;
+    vtkSMPTools::For(0, 100000, 1000, functor);
+  }
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() == 0)
+  {
+    std::cerr << "The thread local id lists are not released to the pool." << std::endl;
+    return EXIT_FAILURE;
+  }
+  {
+    FillIds functor;
+    vtkSMPTools::For(0, 100000, 1000, functor);
+    vtkIdType numberOfIds = 0;
+    for (vtkIdList* localIds : functor.TLIds)
+    {
+      numberOfIds += localIds->GetNumberOfIds();
+    }
+    if (numberOfIds != 100000)
+    {
+      std::cerr << "Got " << numberOfIds << " ids in the recycled thread local id lists "
+                << "instead of 100000." << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Thread local objects are only pooled for the classes opting in.
+  vtkObjectPool::Clear();
+  {
+    vtkSMPThreadLocalObject<vtkPoints> tlPoints;
+    tlPoints.Local()->InsertNextPoint(0.0, 0.0, 0.0);
+  }
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkPoints>() != 0)
+  {
+    std::cerr << "Thread local points were pooled." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // The maximum size bounds the number of objects kept.
+  vtkObjectPool::Clear();
+  vtkObjectPool::SetMaximumSize(0);
+  vtkObjectPool::Release(vtkObjectPool::Acquire<vtkIdList>());
+  vtkObjectPool::SetMaximumSize(64);
+  if (vtkObjectPool::GetNumberOfPooledObjects<vtkIdList>() != 0)
+  {
+    std::cerr << "An id list was pooled with a maximum size of 0." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -5,13 +5,18 @@
 #include "vtkObject.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPThreadLocal.h"
+#include "vtkSMPTaskGraph.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include <atomic>
+#include <algorithm>
 #include <cstdlib>
 #include <deque>
 #include <functional>
+#include <iterator>
 #include <numeric>
 #include <set>
+#include <utility>
 #include <vector>
 
 static const int Target = 10000;
@@ -480,6 +485,106 @@ int doTestSMP()
       return EXIT_FAILURE;
     }
   }
+
+  // Test scans, large enough to be split in several blocks
+  const int scanSize = 100003;
+  std::vector<vtkIdType> scanData(scanSize);
+  for (int i = 0; i < scanSize; ++i)
+  {
+    scanData[i] = (i * 7) % 13;
+  }
+  std::vector<vtkIdType> inclusive(scanSize);
+  std::vector<vtkIdType> exclusive(scanData);
+  vtkSMPTools::InclusiveScan(scanData.begin(), scanData.end(), inclusive.begin());
+  vtkSMPTools::ExclusiveScan(exclusive.begin(), exclusive.end(), exclusive.begin(), vtkIdType(5));
+  vtkIdType sum = 0;
+  for (int i = 0; i < scanSize; ++i)
+  {
+    if (exclusive[i] != sum + 5 || inclusive[i] != sum + scanData[i])
+    {
+      cerr << "Error: Invalid output for vtkSMPTools scans at index " << i << endl;
+      return EXIT_FAILURE;
+    }
+    sum += scanData[i];
+  }
+  std::vector<int> maxScan(scanSize);
+  vtkSMPTools::InclusiveScan(scanData.begin(), scanData.end(), maxScan.begin(),
+    [](vtkIdType a, vtkIdType b) { return std::max(a, b); });
+  if (maxScan[0] != 0 || maxScan[scanSize - 1] != 12)
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::InclusiveScan with custom operation" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Test stable sort: sort on the key only, the index must stay ordered for equal keys
+  std::vector<std::pair<int, int>> stableData(scanSize);
+  for (int i = 0; i < scanSize; ++i)
+  {
+    stableData[i] = std::make_pair((i * 31) % 17, i);
+  }
+  vtkSMPTools::StableSort(stableData.begin(), stableData.end(),
+    [](const std::pair<int, int>& a, const std::pair<int, int>& b) { return a.first < b.first; });
+  for (int i = 1; i < scanSize; ++i)
+  {
+    if (stableData[i - 1].first > stableData[i].first ||
+      (stableData[i - 1].first == stableData[i].first &&
+        stableData[i - 1].second > stableData[i].second))
+    {
+      cerr << "Error: Invalid output for vtkSMPTools::StableSort at index " << i << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Test stream compaction
+  std::vector<vtkIdType> compacted(scanSize, -1);
+  auto compactedEnd = vtkSMPTools::CopyIf(scanData.begin(), scanData.end(), compacted.begin(),
+    [](vtkIdType value) { return value % 2 == 0; });
+  std::vector<vtkIdType> expected;
+  std::copy_if(scanData.begin(), scanData.end(), std::back_inserter(expected),
+    [](vtkIdType value) { return value % 2 == 0; });
+  if (compactedEnd - compacted.begin() != static_cast<std::ptrdiff_t>(expected.size()) ||
+    !std::equal(expected.begin(), expected.end(), compacted.begin()))
+  {
+    cerr << "Error: Invalid output for vtkSMPTools::CopyIf" << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Test task graph: a diamond of stages plus independent tasks running a nested For
+  std::vector<int> stages(4, -1);
+  std::atomic<int> order(0);
+  std::atomic<int> independent(0);
+  vtkSMPTaskGraph graph;
+  auto source = graph.AddTask([&]() { stages[0] = order++; });
+  auto left = graph.Then(source, [&]() { stages[1] = order++; });
+  auto right = graph.Then(source, [&]() { stages[2] = order++; });
+  graph.AddTask([&]() { stages[3] = order++; }, { left, right });
+  for (int i = 0; i < 10; ++i)
+  {
+    graph.AddTask([&]() {
+      vtkSMPTools::For(0, Target, [&](vtkIdType begin, vtkIdType end) {
+        independent += static_cast<int>(end - begin);
+      });
+    });
+  }
+  if (graph.GetNumberOfTasks() != 14)
+  {
+    cerr << "Error: vtkSMPTaskGraph has " << graph.GetNumberOfTasks() << " tasks instead of 14"
+         << endl;
+    return EXIT_FAILURE;
+  }
+  graph.Wait();
+  if (stages[0] != 0 || stages[1] <= stages[0] || stages[2] <= stages[0] ||
+    stages[3] <= stages[1] || stages[3] <= stages[2] || independent != 10 * Target)
+  {
+    cerr << "Error: vtkSMPTaskGraph did not respect task dependencies!" << endl;
+    return EXIT_FAILURE;
+  }
+  if (graph.GetNumberOfTasks() != 0)
+  {
+    cerr << "Error: vtkSMPTaskGraph was not emptied by Wait()" << endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
 
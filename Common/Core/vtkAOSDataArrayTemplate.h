@@ -173,6 +173,17 @@ public:
   void* GetVoidPointer(vtkIdType valueIdx) override;
   ///@}
 
+  ///@{
+  /**
+   * Set/Get the NUMA placement mode of the memory allocated by this array,
+   * one of vtkBufferPlacement::PlacementModes. The default,
+   * vtkBufferPlacement::USE_GLOBAL, follows vtkBufferPlacement::GetGlobalMode().
+   * The mode applies to subsequent allocations.
+   */
+  void SetPlacementMode(int mode) { this->PlacementMode = mode; }
+  int GetPlacementMode() const { return this->PlacementMode; }
+  ///@}
+
   ///@{
   /**
    * This method lets the user specify data to be held by the array.  The
@@ -299,6 +310,7 @@ protected:
   bool ReallocateTuples(vtkIdType numTuples);
 
   vtkBuffer<ValueType>* Buffer;
+  int PlacementMode;
 
 private:
   vtkAOSDataArrayTemplate(const vtkAOSDataArrayTemplate&) = delete;
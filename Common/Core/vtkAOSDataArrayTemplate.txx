@@ -44,6 +44,7 @@ vtkAOSDataArrayTemplate<ValueTypeT>::FastDownCast(vtkAbstractArray* source)
 //-----------------------------------------------------------------------------
 template <class ValueTypeT>
 vtkAOSDataArrayTemplate<ValueTypeT>::vtkAOSDataArrayTemplate()
+  : PlacementMode(vtkBufferPlacement::USE_GLOBAL)
 {
   this->Buffer = vtkBuffer<ValueType>::New();
 }
@@ -438,6 +439,7 @@ template <class ValueTypeT>
 bool vtkAOSDataArrayTemplate<ValueTypeT>::AllocateTuples(vtkIdType numTuples)
 {
   vtkIdType numValues = numTuples * this->GetNumberOfComponents();
+  this->Buffer->SetPlacementMode(this->PlacementMode);
   if (this->Buffer->Allocate(numValues))
   {
     this->Size = this->Buffer->GetSize();
@@ -450,6 +452,7 @@ bool vtkAOSDataArrayTemplate<ValueTypeT>::AllocateTuples(vtkIdType numTuples)
 template <class ValueTypeT>
 bool vtkAOSDataArrayTemplate<ValueTypeT>::ReallocateTuples(vtkIdType numTuples)
 {
+  this->Buffer->SetPlacementMode(this->PlacementMode);
   if (this->Buffer->Reallocate(numTuples * this->GetNumberOfComponents()))
   {
     this->Size = this->Buffer->GetSize();
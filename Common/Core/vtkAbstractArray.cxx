@@ -5,6 +5,7 @@
 
 #include "vtkBitArray.h"
 #include "vtkCharArray.h"
+#include "vtkContiguousStringArray.h"
 #include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
@@ -357,6 +358,9 @@ int vtkAbstractArray::GetDataTypeSize(int type)
     case VTK_STRING:
       return 0;
 
+    case VTK_CONTIGUOUS_STRING:
+      return static_cast<int>(sizeof(char));
+
     default:
       vtkGenericWarningMacro(<< "Unsupported data type!");
   }
@@ -458,6 +462,9 @@ vtkAbstractArray* vtkAbstractArray::CreateArray(int dataType)
     case VTK_VARIANT:
       return vtkVariantArray::New();
 
+    case VTK_CONTIGUOUS_STRING:
+      return vtkContiguousStringArray::New();
+
     default:
       break;
   }
@@ -0,0 +1,858 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkArrayExpression.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkExpressionArray.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <set>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// Number of tuples evaluated at once by the bulk evaluation
+constexpr vtkIdType BlockSize = 1024;
+
+//------------------------------------------------------------------------------
+// Typed access to the values of a leaf array.
+struct ArrayAccessor
+{
+  ArrayAccessor(vtkDataArray* array)
+    : Array(array)
+  {
+  }
+  virtual ~ArrayAccessor() = default;
+  virtual double Get(vtkIdType tupleIdx, int comp) const = 0;
+  // Copy the tuples [begin, end) in AOS order
+  virtual void GetTuples(vtkIdType begin, vtkIdType end, double* values) const = 0;
+  // Copy one component of the tuples [begin, end)
+  virtual void GetComponent(vtkIdType begin, vtkIdType end, int comp, double* values) const = 0;
+
+  vtkSmartPointer<vtkDataArray> Array;
+};
+
+template <typename ArrayT>
+struct TypedArrayAccessor : public ArrayAccessor
+{
+  TypedArrayAccessor(ArrayT* array)
+    : ArrayAccessor(array)
+    , TypedArray(array)
+  {
+  }
+
+  double Get(vtkIdType tupleIdx, int comp) const override
+  {
+    return static_cast<double>(vtk::DataArrayTupleRange(this->TypedArray)[tupleIdx][comp]);
+  }
+
+  void GetTuples(vtkIdType begin, vtkIdType end, double* values) const override
+  {
+    const auto range = vtk::DataArrayValueRange(this->TypedArray,
+      begin * this->TypedArray->GetNumberOfComponents(),
+      end * this->TypedArray->GetNumberOfComponents());
+    std::copy(range.cbegin(), range.cend(), values);
+  }
+
+  void GetComponent(vtkIdType begin, vtkIdType end, int comp, double* values) const override
+  {
+    const auto range = vtk::DataArrayTupleRange(this->TypedArray, begin, end);
+    for (const auto tuple : range)
+    {
+      *values++ = static_cast<double>(tuple[comp]);
+    }
+  }
+
+  ArrayT* TypedArray;
+};
+
+struct MakeAccessorWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, std::shared_ptr<const ArrayAccessor>& accessor) const
+  {
+    accessor = std::make_shared<TypedArrayAccessor<ArrayT>>(array);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Write the evaluated blocks of an expression into an array.
+struct EvaluateWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* output, const vtkArrayExpression& expr) const
+  {
+    using ValueType = vtk::GetAPIType<ArrayT>;
+    const int numComps = output->GetNumberOfComponents();
+    auto evaluate = [&](vtkIdType begin, vtkIdType end) {
+      std::vector<double> values(static_cast<size_t>(BlockSize * numComps));
+      for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += BlockSize)
+      {
+        const vtkIdType blockEnd = std::min(end, blockBegin + BlockSize);
+        expr.Evaluate(blockBegin, blockEnd, values.data());
+        auto range = vtk::DataArrayValueRange(output, blockBegin * numComps, blockEnd * numComps);
+        std::transform(values.cbegin(), values.cbegin() + (blockEnd - blockBegin) * numComps,
+          range.begin(), [](double value) { return static_cast<ValueType>(value); });
+      }
+    };
+    vtkSMPTools::For(0, output->GetNumberOfTuples(), BlockSize, evaluate);
+  }
+};
+}
+
+//------------------------------------------------------------------------------
+struct vtkArrayExpression::Node
+{
+  enum OperationType
+  {
+    ARRAY,
+    CONSTANT,
+    COMPONENT,
+    NEGATE,
+    ABS,
+    SQRT,
+    AFFINE,
+    CLAMP,
+    ADD,
+    SUBTRACT,
+    MULTIPLY,
+    DIVIDE,
+    NORM,
+    DOT,
+    TRANSFORM
+  };
+
+  Node(OperationType operation, int numComps, vtkIdType numTuples)
+    : Operation(operation)
+    , NumberOfComponents(numComps)
+    , NumberOfTuples(numTuples)
+  {
+  }
+
+  const OperationType Operation;
+  const int NumberOfComponents;
+  // -1 when the node only depends on constants
+  const vtkIdType NumberOfTuples;
+
+  std::shared_ptr<const Node> A;
+  std::shared_ptr<const Node> B;
+  std::shared_ptr<const ArrayAccessor> Accessor;
+  // Constant value, affine scale and shift, clamp bounds or transform matrix
+  double Parameters[16] = {};
+  int Component = 0;
+
+  //------------------------------------------------------------------------------
+  static double Apply(OperationType operation, double a, double b)
+  {
+    switch (operation)
+    {
+      case ADD:
+        return a + b;
+      case SUBTRACT:
+        return a - b;
+      case MULTIPLY:
+        return a * b;
+      default:
+        return a / b;
+    }
+  }
+
+  //------------------------------------------------------------------------------
+  double EvaluateComponent(vtkIdType tupleIdx, int comp) const
+  {
+    switch (this->Operation)
+    {
+      case ARRAY:
+        return this->Accessor->Get(tupleIdx, comp);
+      case CONSTANT:
+        return this->Parameters[0];
+      case COMPONENT:
+        return this->A->EvaluateComponent(tupleIdx, this->Component);
+      case NEGATE:
+        return -this->A->EvaluateComponent(tupleIdx, comp);
+      case ABS:
+        return std::abs(this->A->EvaluateComponent(tupleIdx, comp));
+      case SQRT:
+        return std::sqrt(this->A->EvaluateComponent(tupleIdx, comp));
+      case AFFINE:
+        return this->Parameters[0] * this->A->EvaluateComponent(tupleIdx, comp) +
+          this->Parameters[1];
+      case CLAMP:
+        return std::min(std::max(this->A->EvaluateComponent(tupleIdx, comp), this->Parameters[0]),
+          this->Parameters[1]);
+      case ADD:
+      case SUBTRACT:
+      case MULTIPLY:
+      case DIVIDE:
+        return Apply(this->Operation,
+          this->A->EvaluateComponent(tupleIdx, this->A->NumberOfComponents == 1 ? 0 : comp),
+          this->B->EvaluateComponent(tupleIdx, this->B->NumberOfComponents == 1 ? 0 : comp));
+      case NORM:
+      {
+        double sum = 0.0;
+        for (int i = 0; i < this->A->NumberOfComponents; ++i)
+        {
+          const double value = this->A->EvaluateComponent(tupleIdx, i);
+          sum += value * value;
+        }
+        return std::sqrt(sum);
+      }
+      case DOT:
+      {
+        const int numComps = std::max(this->A->NumberOfComponents, this->B->NumberOfComponents);
+        double sum = 0.0;
+        for (int i = 0; i < numComps; ++i)
+        {
+          sum += this->A->EvaluateComponent(tupleIdx, this->A->NumberOfComponents == 1 ? 0 : i) *
+            this->B->EvaluateComponent(tupleIdx, this->B->NumberOfComponents == 1 ? 0 : i);
+        }
+        return sum;
+      }
+      case TRANSFORM:
+      {
+        double in[3];
+        for (int i = 0; i < 3; ++i)
+        {
+          in[i] = this->A->EvaluateComponent(tupleIdx, i);
+        }
+        double out[3];
+        this->TransformPoint(in, out);
+        return out[comp];
+      }
+    }
+    return 0.0;
+  }
+
+  //------------------------------------------------------------------------------
+  void TransformPoint(const double in[3], double out[3]) const
+  {
+    const double* m = this->Parameters;
+    const double w = m[12] * in[0] + m[13] * in[1] + m[14] * in[2] + m[15];
+    for (int i = 0; i < 3; ++i)
+    {
+      out[i] = (m[4 * i] * in[0] + m[4 * i + 1] * in[1] + m[4 * i + 2] * in[2] + m[4 * i + 3]) / w;
+    }
+  }
+
+  //------------------------------------------------------------------------------
+  // Evaluate the tuples [begin, end) in AOS order, at most BlockSize tuples.
+  void EvaluateBlock(vtkIdType begin, vtkIdType end, double* values) const
+  {
+    const vtkIdType numTuples = end - begin;
+    const vtkIdType numValues = numTuples * this->NumberOfComponents;
+    switch (this->Operation)
+    {
+      case ARRAY:
+        this->Accessor->GetTuples(begin, end, values);
+        return;
+      case CONSTANT:
+        std::fill(values, values + numValues, this->Parameters[0]);
+        return;
+      case COMPONENT:
+      {
+        if (this->A->Operation == ARRAY)
+        {
+          this->A->Accessor->GetComponent(begin, end, this->Component, values);
+          return;
+        }
+        const int numComps = this->A->NumberOfComponents;
+        std::vector<double> operand(static_cast<size_t>(numTuples * numComps));
+        this->A->EvaluateBlock(begin, end, operand.data());
+        for (vtkIdType i = 0; i < numTuples; ++i)
+        {
+          values[i] = operand[i * numComps + this->Component];
+        }
+        return;
+      }
+      case NEGATE:
+        this->A->EvaluateBlock(begin, end, values);
+        std::transform(values, values + numValues, values, [](double x) { return -x; });
+        return;
+      case ABS:
+        this->A->EvaluateBlock(begin, end, values);
+        std::transform(values, values + numValues, values, [](double x) { return std::abs(x); });
+        return;
+      case SQRT:
+        this->A->EvaluateBlock(begin, end, values);
+        std::transform(values, values + numValues, values, [](double x) { return std::sqrt(x); });
+        return;
+      case AFFINE:
+      {
+        const double scale = this->Parameters[0];
+        const double shift = this->Parameters[1];
+        this->A->EvaluateBlock(begin, end, values);
+        std::transform(values, values + numValues, values,
+          [scale, shift](double x) { return scale * x + shift; });
+        return;
+      }
+      case CLAMP:
+      {
+        const double min = this->Parameters[0];
+        const double max = this->Parameters[1];
+        this->A->EvaluateBlock(begin, end, values);
+        std::transform(values, values + numValues, values,
+          [min, max](double x) { return std::min(std::max(x, min), max); });
+        return;
+      }
+      case ADD:
+      case SUBTRACT:
+      case MULTIPLY:
+      case DIVIDE:
+        this->EvaluateBinaryBlock(begin, end, values);
+        return;
+      case NORM:
+      {
+        const int numComps = this->A->NumberOfComponents;
+        std::vector<double> operand(static_cast<size_t>(numTuples * numComps));
+        this->A->EvaluateBlock(begin, end, operand.data());
+        for (vtkIdType i = 0; i < numTuples; ++i)
+        {
+          double sum = 0.0;
+          for (int comp = 0; comp < numComps; ++comp)
+          {
+            sum += operand[i * numComps + comp] * operand[i * numComps + comp];
+          }
+          values[i] = std::sqrt(sum);
+        }
+        return;
+      }
+      case DOT:
+      {
+        const int numCompsA = this->A->NumberOfComponents;
+        const int numCompsB = this->B->NumberOfComponents;
+        const int numComps = std::max(numCompsA, numCompsB);
+        std::vector<double> a(static_cast<size_t>(numTuples * numCompsA));
+        std::vector<double> b(static_cast<size_t>(numTuples * numCompsB));
+        this->A->EvaluateBlock(begin, end, a.data());
+        this->B->EvaluateBlock(begin, end, b.data());
+        for (vtkIdType i = 0; i < numTuples; ++i)
+        {
+          double sum = 0.0;
+          for (int comp = 0; comp < numComps; ++comp)
+          {
+            sum += a[i * numCompsA + (numCompsA == 1 ? 0 : comp)] *
+              b[i * numCompsB + (numCompsB == 1 ? 0 : comp)];
+          }
+          values[i] = sum;
+        }
+        return;
+      }
+      case TRANSFORM:
+      {
+        std::vector<double> operand(static_cast<size_t>(numTuples * 3));
+        this->A->EvaluateBlock(begin, end, operand.data());
+        for (vtkIdType i = 0; i < numTuples; ++i)
+        {
+          this->TransformPoint(operand.data() + 3 * i, values + 3 * i);
+        }
+        return;
+      }
+    }
+  }
+
+  //------------------------------------------------------------------------------
+  void EvaluateBinaryBlock(vtkIdType begin, vtkIdType end, double* values) const
+  {
+    const vtkIdType numTuples = end - begin;
+    const int numComps = this->NumberOfComponents;
+    const int numCompsA = this->A->NumberOfComponents;
+    const int numCompsB = this->B->NumberOfComponents;
+    const OperationType operation = this->Operation;
+
+    // The first operand is evaluated in place when it has all the components
+    std::vector<double> a;
+    const double* aValues = values;
+    if (numCompsA == numComps)
+    {
+      this->A->EvaluateBlock(begin, end, values);
+    }
+    else
+    {
+      a.resize(static_cast<size_t>(numTuples));
+      this->A->EvaluateBlock(begin, end, a.data());
+      aValues = a.data();
+    }
+    std::vector<double> b(static_cast<size_t>(numTuples * numCompsB));
+    this->B->EvaluateBlock(begin, end, b.data());
+
+    if (numCompsA == numCompsB)
+    {
+      std::transform(aValues, aValues + numTuples * numComps, b.cbegin(), values,
+        [operation](double x, double y) { return Apply(operation, x, y); });
+      return;
+    }
+    for (vtkIdType i = 0; i < numTuples; ++i)
+    {
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        const double x = aValues[numCompsA == 1 ? i : i * numComps + comp];
+        const double y = b[numCompsB == 1 ? i : i * numComps + comp];
+        values[i * numComps + comp] = Apply(operation, x, y);
+      }
+    }
+  }
+
+  //------------------------------------------------------------------------------
+  void CollectArrays(std::set<vtkDataArray*>& arrays) const
+  {
+    if (this->Accessor)
+    {
+      arrays.insert(this->Accessor->Array);
+    }
+    if (this->A)
+    {
+      this->A->CollectArrays(arrays);
+    }
+    if (this->B)
+    {
+      this->B->CollectArrays(arrays);
+    }
+  }
+};
+
+namespace
+{
+using Node = vtkArrayExpression::Node;
+
+//------------------------------------------------------------------------------
+std::shared_ptr<Node> MakeUnaryNode(
+  Node::OperationType operation, const std::shared_ptr<const Node>& a, int numComps)
+{
+  auto node = std::make_shared<Node>(operation, numComps, a->NumberOfTuples);
+  node->A = a;
+  return node;
+}
+
+//------------------------------------------------------------------------------
+// Return the number of tuples of two operands, or -2 if they do not match.
+vtkIdType MergeNumberOfTuples(const Node& a, const Node& b)
+{
+  if (a.NumberOfTuples < 0)
+  {
+    return b.NumberOfTuples;
+  }
+  if (b.NumberOfTuples < 0 || a.NumberOfTuples == b.NumberOfTuples)
+  {
+    return a.NumberOfTuples;
+  }
+  return -2;
+}
+
+//------------------------------------------------------------------------------
+// Return the fused expression of a floating point expression array.
+template <typename ValueType>
+bool GetFusedExpression(vtkDataArray* array, vtkArrayExpression& expr)
+{
+  auto* exprArray = vtkArrayDownCast<vtkExpressionArray<ValueType>>(array);
+  if (!exprArray || !exprArray->GetBackend())
+  {
+    return false;
+  }
+  const vtkArrayExpression& fused = exprArray->GetBackend()->Expression;
+  if (!fused.IsValid() || fused.GetNumberOfComponents() != array->GetNumberOfComponents() ||
+    fused.GetNumberOfTuples() != array->GetNumberOfTuples())
+  {
+    return false;
+  }
+  expr = fused;
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Array(vtkDataArray* array)
+{
+  if (!array)
+  {
+    vtkGenericWarningMacro("Cannot build an expression on a null array.");
+    return vtkArrayExpression();
+  }
+  vtkArrayExpression fused;
+  if (GetFusedExpression<double>(array, fused) || GetFusedExpression<float>(array, fused))
+  {
+    return fused;
+  }
+
+  auto node =
+    std::make_shared<Node>(Node::ARRAY, array->GetNumberOfComponents(), array->GetNumberOfTuples());
+  MakeAccessorWorker worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(array, worker, node->Accessor))
+  {
+    worker(array, node->Accessor);
+  }
+  return vtkArrayExpression(node);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Constant(double value)
+{
+  auto node = std::make_shared<Node>(Node::CONSTANT, 1, -1);
+  node->Parameters[0] = value;
+  return vtkArrayExpression(node);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Component(const vtkArrayExpression& expr, int comp)
+{
+  if (!expr.IsValid() || comp < 0 || comp >= expr.GetNumberOfComponents())
+  {
+    vtkGenericWarningMacro("Invalid component " << comp << " in expression.");
+    return vtkArrayExpression();
+  }
+  if (expr.GetNumberOfComponents() == 1)
+  {
+    return expr;
+  }
+  auto node = MakeUnaryNode(Node::COMPONENT, expr.Root, 1);
+  node->Component = comp;
+  return vtkArrayExpression(node);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Negate(const vtkArrayExpression& expr)
+{
+  if (!expr.IsValid())
+  {
+    return vtkArrayExpression();
+  }
+  return vtkArrayExpression(MakeUnaryNode(Node::NEGATE, expr.Root, expr.GetNumberOfComponents()));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Abs(const vtkArrayExpression& expr)
+{
+  if (!expr.IsValid())
+  {
+    return vtkArrayExpression();
+  }
+  return vtkArrayExpression(MakeUnaryNode(Node::ABS, expr.Root, expr.GetNumberOfComponents()));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Sqrt(const vtkArrayExpression& expr)
+{
+  if (!expr.IsValid())
+  {
+    return vtkArrayExpression();
+  }
+  return vtkArrayExpression(MakeUnaryNode(Node::SQRT, expr.Root, expr.GetNumberOfComponents()));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Affine(
+  const vtkArrayExpression& expr, double scale, double shift)
+{
+  if (!expr.IsValid())
+  {
+    return vtkArrayExpression();
+  }
+  // Successive affine operations are merged
+  if (expr.Root->Operation == Node::AFFINE)
+  {
+    return Affine(vtkArrayExpression(expr.Root->A), scale * expr.Root->Parameters[0],
+      scale * expr.Root->Parameters[1] + shift);
+  }
+  auto node = MakeUnaryNode(Node::AFFINE, expr.Root, expr.GetNumberOfComponents());
+  node->Parameters[0] = scale;
+  node->Parameters[1] = shift;
+  return vtkArrayExpression(node);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Clamp(const vtkArrayExpression& expr, double min, double max)
+{
+  if (!expr.IsValid())
+  {
+    return vtkArrayExpression();
+  }
+  auto node = MakeUnaryNode(Node::CLAMP, expr.Root, expr.GetNumberOfComponents());
+  node->Parameters[0] = min;
+  node->Parameters[1] = max;
+  return vtkArrayExpression(node);
+}
+
+//------------------------------------------------------------------------------
+namespace
+{
+std::shared_ptr<const Node> MakeBinaryNode(Node::OperationType operation,
+  const std::shared_ptr<const Node>& a, const std::shared_ptr<const Node>& b, bool reduce)
+{
+  if (!a || !b)
+  {
+    return nullptr;
+  }
+  const vtkIdType numTuples = MergeNumberOfTuples(*a, *b);
+  if (numTuples == -2)
+  {
+    vtkGenericWarningMacro("Operands with " << a->NumberOfTuples << " and " << b->NumberOfTuples
+                                            << " tuples cannot be combined in an expression.");
+    return nullptr;
+  }
+  if (a->NumberOfComponents != b->NumberOfComponents && a->NumberOfComponents != 1 &&
+    b->NumberOfComponents != 1)
+  {
+    vtkGenericWarningMacro("Operands with " << a->NumberOfComponents << " and "
+                                            << b->NumberOfComponents
+                                            << " components cannot be combined in an expression.");
+    return nullptr;
+  }
+  const int numComps = reduce ? 1 : std::max(a->NumberOfComponents, b->NumberOfComponents);
+  auto node = std::make_shared<Node>(operation, numComps, numTuples);
+  node->A = a;
+  node->B = b;
+  return node;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Add(const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression(MakeBinaryNode(Node::ADD, a.Root, b.Root, false));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Subtract(
+  const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression(MakeBinaryNode(Node::SUBTRACT, a.Root, b.Root, false));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Multiply(
+  const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression(MakeBinaryNode(Node::MULTIPLY, a.Root, b.Root, false));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Divide(
+  const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression(MakeBinaryNode(Node::DIVIDE, a.Root, b.Root, false));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Norm(const vtkArrayExpression& expr)
+{
+  if (!expr.IsValid())
+  {
+    return vtkArrayExpression();
+  }
+  return vtkArrayExpression(MakeUnaryNode(Node::NORM, expr.Root, 1));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Dot(const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression(MakeBinaryNode(Node::DOT, a.Root, b.Root, true));
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression vtkArrayExpression::Transform(
+  const vtkArrayExpression& expr, const double matrix[16])
+{
+  if (!expr.IsValid() || expr.GetNumberOfComponents() != 3)
+  {
+    vtkGenericWarningMacro("Only expressions with 3 components can be transformed.");
+    return vtkArrayExpression();
+  }
+  auto node = MakeUnaryNode(Node::TRANSFORM, expr.Root, 3);
+  std::copy(matrix, matrix + 16, node->Parameters);
+  return vtkArrayExpression(node);
+}
+
+//------------------------------------------------------------------------------
+int vtkArrayExpression::GetNumberOfComponents() const
+{
+  return this->Root ? this->Root->NumberOfComponents : 0;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkArrayExpression::GetNumberOfTuples() const
+{
+  return this->Root ? this->Root->NumberOfTuples : 0;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkArrayExpression::GetActualMemorySize() const
+{
+  std::set<vtkDataArray*> arrays;
+  if (this->Root)
+  {
+    this->Root->CollectArrays(arrays);
+  }
+  unsigned long size = 1;
+  for (vtkDataArray* array : arrays)
+  {
+    size += array->GetActualMemorySize();
+  }
+  return size;
+}
+
+//------------------------------------------------------------------------------
+double vtkArrayExpression::EvaluateComponent(vtkIdType tupleIdx, int comp) const
+{
+  return this->Root ? this->Root->EvaluateComponent(tupleIdx, comp) : 0.0;
+}
+
+//------------------------------------------------------------------------------
+void vtkArrayExpression::EvaluateTuple(vtkIdType tupleIdx, double* tuple) const
+{
+  if (!this->Root)
+  {
+    return;
+  }
+  if (this->Root->Operation == Node::TRANSFORM)
+  {
+    double in[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      in[i] = this->Root->A->EvaluateComponent(tupleIdx, i);
+    }
+    this->Root->TransformPoint(in, tuple);
+    return;
+  }
+  for (int comp = 0; comp < this->Root->NumberOfComponents; ++comp)
+  {
+    tuple[comp] = this->Root->EvaluateComponent(tupleIdx, comp);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkArrayExpression::Evaluate(vtkIdType begin, vtkIdType end, double* values) const
+{
+  if (!this->Root)
+  {
+    return;
+  }
+  const int numComps = this->Root->NumberOfComponents;
+  for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += BlockSize)
+  {
+    const vtkIdType blockEnd = std::min(end, blockBegin + BlockSize);
+    this->Root->EvaluateBlock(blockBegin, blockEnd, values + (blockBegin - begin) * numComps);
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrayExpression::Evaluate(vtkDataArray* output) const
+{
+  if (!output || !this->Root || this->Root->NumberOfTuples < 0)
+  {
+    return false;
+  }
+  output->SetNumberOfComponents(this->Root->NumberOfComponents);
+  output->SetNumberOfTuples(this->Root->NumberOfTuples);
+
+  EvaluateWorker worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(output, worker, *this))
+  {
+    worker(output, *this);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkArrayExpression::ComputeRange(double range[2], int comp) const
+{
+  if (!this->Root || this->Root->NumberOfTuples <= 0 || comp < 0 ||
+    comp >= this->Root->NumberOfComponents)
+  {
+    return false;
+  }
+  const vtkArrayExpression component = vtkArrayExpression::Component(*this, comp);
+  vtkSMPThreadLocal<std::array<double, 2>> localRanges(
+    std::array<double, 2>{ { VTK_DOUBLE_MAX, VTK_DOUBLE_MIN } });
+  vtkSMPTools::For(0, this->Root->NumberOfTuples, BlockSize, [&](vtkIdType begin, vtkIdType end) {
+    std::array<double, 2>& localRange = localRanges.Local();
+    std::vector<double> values(static_cast<size_t>(BlockSize));
+    for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += BlockSize)
+    {
+      const vtkIdType blockEnd = std::min(end, blockBegin + BlockSize);
+      component.Root->EvaluateBlock(blockBegin, blockEnd, values.data());
+      for (vtkIdType i = 0; i < blockEnd - blockBegin; ++i)
+      {
+        // comparisons with NaN are false
+        localRange[0] = values[i] < localRange[0] ? values[i] : localRange[0];
+        localRange[1] = values[i] > localRange[1] ? values[i] : localRange[1];
+      }
+    }
+  });
+
+  range[0] = VTK_DOUBLE_MAX;
+  range[1] = VTK_DOUBLE_MIN;
+  for (const std::array<double, 2>& localRange : localRanges)
+  {
+    range[0] = std::min(range[0], localRange[0]);
+    range[1] = std::max(range[1], localRange[1]);
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator+(const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression::Add(a, b);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator-(const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression::Subtract(a, b);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator*(const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression::Multiply(a, b);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator/(const vtkArrayExpression& a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression::Divide(a, b);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator-(const vtkArrayExpression& a)
+{
+  return vtkArrayExpression::Negate(a);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator+(const vtkArrayExpression& a, double b)
+{
+  return vtkArrayExpression::Affine(a, 1.0, b);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator-(const vtkArrayExpression& a, double b)
+{
+  return vtkArrayExpression::Affine(a, 1.0, -b);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator*(const vtkArrayExpression& a, double b)
+{
+  return vtkArrayExpression::Affine(a, b, 0.0);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator/(const vtkArrayExpression& a, double b)
+{
+  return vtkArrayExpression::Affine(a, 1.0 / b, 0.0);
+}
+
+//------------------------------------------------------------------------------
+vtkArrayExpression operator*(double a, const vtkArrayExpression& b)
+{
+  return vtkArrayExpression::Affine(b, a, 0.0);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,201 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkArrayExpression_h
+#define vtkArrayExpression_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkType.h"             // For vtkIdType
+
+#include <memory> // For std::shared_ptr
+
+/**
+ * \class vtkArrayExpression
+ * \brief An expression tree over data arrays, evaluated lazily
+ *
+ * vtkArrayExpression describes per-tuple computations over `vtkDataArray`s: arithmetic,
+ * component extraction, norms, dot products, clamping and affine transforms. Nothing is computed
+ * when the expression is built. The expression is evaluated for a single value with
+ * `EvaluateComponent` or `EvaluateTuple`, or for a range of tuples with `Evaluate`, which walks
+ * the expression once per block of tuples instead of once per value.
+ *
+ * The expression is meant to be the backend of a `vtkExpressionArray`, an implicit array whose
+ * values are computed on access. When an operand of an expression is itself a floating point
+ * `vtkExpressionArray`, its expression is inlined in the new one, so a chain of filters that
+ * produce expression arrays evaluates the whole chain in a single pass without intermediate
+ * arrays.
+ *
+ * The expression is a small value type: copies share the same immutable tree. Operands are held
+ * by reference counting and must not be modified while the expression is in use.
+ *
+ * All values are computed in double precision. An operand with a single component is broadcast
+ * to the number of components of the other operand of a binary operation, otherwise the number of
+ * components must match. Operands that are arrays must have the same number of tuples. An
+ * expression built from invalid operands is invalid, see `IsValid`, and evaluates to 0.
+ *
+ * Example computing the elevation of points along the z axis between 0 and 10:
+ * @code
+ * vtkArrayExpression z = vtkArrayExpression::Component(vtkArrayExpression::Array(points), 2);
+ * vtkArrayExpression elevation = vtkArrayExpression::Clamp(z / 10.0, 0.0, 1.0);
+ * vtkNew<vtkExpressionArray<float>> array;
+ * array->ConstructBackend(elevation);
+ * array->SetNumberOfComponents(elevation.GetNumberOfComponents());
+ * array->SetNumberOfTuples(elevation.GetNumberOfTuples());
+ * @endcode
+ *
+ * @sa
+ * vtkExpressionArray vtkExpressionImplicitBackend vtkImplicitArray
+ */
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+
+class VTKCOMMONCORE_EXPORT vtkArrayExpression
+{
+public:
+  /**
+   * Construct an invalid expression.
+   */
+  vtkArrayExpression() = default;
+
+  ///@{
+  /**
+   * Leaves of the expression. `Array` refers to all the components of an array, `Constant` is a
+   * single component value broadcast to every tuple.
+   */
+  static vtkArrayExpression Array(vtkDataArray* array);
+  static vtkArrayExpression Constant(double value);
+  ///@}
+
+  /**
+   * Extract a single component of an expression.
+   */
+  static vtkArrayExpression Component(const vtkArrayExpression& expr, int comp);
+
+  ///@{
+  /**
+   * Component-wise unary operations.
+   */
+  static vtkArrayExpression Negate(const vtkArrayExpression& expr);
+  static vtkArrayExpression Abs(const vtkArrayExpression& expr);
+  static vtkArrayExpression Sqrt(const vtkArrayExpression& expr);
+  ///@}
+
+  /**
+   * Component-wise `scale * expr + shift`.
+   */
+  static vtkArrayExpression Affine(const vtkArrayExpression& expr, double scale, double shift);
+
+  /**
+   * Component-wise clamping in [min, max].
+   */
+  static vtkArrayExpression Clamp(const vtkArrayExpression& expr, double min, double max);
+
+  ///@{
+  /**
+   * Component-wise binary operations.
+   */
+  static vtkArrayExpression Add(const vtkArrayExpression& a, const vtkArrayExpression& b);
+  static vtkArrayExpression Subtract(const vtkArrayExpression& a, const vtkArrayExpression& b);
+  static vtkArrayExpression Multiply(const vtkArrayExpression& a, const vtkArrayExpression& b);
+  static vtkArrayExpression Divide(const vtkArrayExpression& a, const vtkArrayExpression& b);
+  ///@}
+
+  /**
+   * Euclidean norm of the tuples of an expression, with a single component.
+   */
+  static vtkArrayExpression Norm(const vtkArrayExpression& expr);
+
+  /**
+   * Dot product of the tuples of two expressions, with a single component.
+   */
+  static vtkArrayExpression Dot(const vtkArrayExpression& a, const vtkArrayExpression& b);
+
+  /**
+   * Transform the 3-component tuples of an expression by a 4x4 homogeneous matrix given in row
+   * major order, dividing by the homogeneous coordinate.
+   */
+  static vtkArrayExpression Transform(const vtkArrayExpression& expr, const double matrix[16]);
+
+  /**
+   * Return false if the expression was built from invalid operands.
+   */
+  bool IsValid() const { return this->Root != nullptr; }
+
+  /**
+   * Return the number of components of the expression.
+   */
+  int GetNumberOfComponents() const;
+
+  /**
+   * Return the number of tuples of the arrays of the expression, or -1 if the expression only
+   * contains constants.
+   */
+  vtkIdType GetNumberOfTuples() const;
+
+  /**
+   * Return the memory in kibibytes of the arrays the expression refers to.
+   */
+  unsigned long GetActualMemorySize() const;
+
+  ///@{
+  /**
+   * Evaluate one component or all the components of a tuple.
+   */
+  double EvaluateComponent(vtkIdType tupleIdx, int comp) const;
+  void EvaluateTuple(vtkIdType tupleIdx, double* tuple) const;
+  ///@}
+
+  /**
+   * Evaluate the tuples [begin, end) into `values`, which must be able to store
+   * (end - begin) * GetNumberOfComponents() values in AOS order. The expression is walked once per
+   * block of tuples.
+   */
+  void Evaluate(vtkIdType begin, vtkIdType end, double* values) const;
+
+  /**
+   * Evaluate all the tuples of the expression into an array, using vtkSMPTools. The array is
+   * resized to the number of components and tuples of the expression. Return false if the
+   * expression is invalid or has no tuples.
+   */
+  bool Evaluate(vtkDataArray* output) const;
+
+  /**
+   * Compute the range of a component of the expression, evaluating it block by block with
+   * vtkSMPTools without storing the values. NaN values are ignored. Return false if the expression
+   * is invalid or has no tuples.
+   */
+  bool ComputeRange(double range[2], int comp = 0) const;
+
+  struct Node;
+
+private:
+  vtkArrayExpression(std::shared_ptr<const Node> root)
+    : Root(std::move(root))
+  {
+  }
+
+  std::shared_ptr<const Node> Root;
+};
+
+///@{
+/**
+ * Arithmetic operators building expressions.
+ */
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator+(
+  const vtkArrayExpression& a, const vtkArrayExpression& b);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator-(
+  const vtkArrayExpression& a, const vtkArrayExpression& b);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator*(
+  const vtkArrayExpression& a, const vtkArrayExpression& b);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator/(
+  const vtkArrayExpression& a, const vtkArrayExpression& b);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator-(const vtkArrayExpression& a);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator+(const vtkArrayExpression& a, double b);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator-(const vtkArrayExpression& a, double b);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator*(const vtkArrayExpression& a, double b);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator/(const vtkArrayExpression& a, double b);
+VTKCOMMONCORE_EXPORT vtkArrayExpression operator*(double a, const vtkArrayExpression& b);
+///@}
+
+VTK_ABI_NAMESPACE_END
+#endif // vtkArrayExpression_h
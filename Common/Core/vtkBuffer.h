@@ -13,6 +13,7 @@
 #ifndef vtkBuffer_h
 #define vtkBuffer_h
 
+#include "vtkBufferPlacement.h" // For vtkBufferPlacement::Place
 #include "vtkObject.h"
 #include "vtkObjectFactory.h" // New() implementation
 
@@ -60,6 +61,16 @@ public:
    **/
   void SetFreeFunction(bool noFreeFunction, vtkFreeingFunction deleteFunction = free);
 
+  ///@{
+  /**
+   * Set/Get the NUMA placement mode applied to memory allocated by Allocate()
+   * and Reallocate(). One of vtkBufferPlacement::PlacementModes, default is
+   * vtkBufferPlacement::USE_GLOBAL.
+   */
+  void SetPlacementMode(int mode) { this->PlacementMode = mode; }
+  int GetPlacementMode() const { return this->PlacementMode; }
+  ///@}
+
   /**
    * Return the number of elements the current buffer can hold.
    */
@@ -80,6 +91,7 @@ protected:
   vtkBuffer()
     : Pointer(nullptr)
     , Size(0)
+    , PlacementMode(vtkBufferPlacement::USE_GLOBAL)
   {
     this->SetMallocFunction(vtkObjectBase::GetCurrentMallocFunction());
     this->SetReallocFunction(vtkObjectBase::GetCurrentReallocFunction());
@@ -90,6 +102,7 @@ protected:
 
   ScalarType* Pointer;
   vtkIdType Size;
+  int PlacementMode;
   vtkMallocingFunction MallocFunction;
   vtkReallocingFunction ReallocFunction;
   vtkFreeingFunction DeleteFunction;
@@ -172,6 +185,7 @@ bool vtkBuffer<ScalarT>::Allocate(vtkIdType size)
     }
     if (newArray)
     {
+      vtkBufferPlacement::Place(newArray, size * sizeof(ScalarType), this->PlacementMode);
       this->SetBuffer(newArray, size);
       if (!this->MallocFunction)
       {
@@ -219,6 +233,7 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     {
       return false;
     }
+    vtkBufferPlacement::Place(newArray, newsize * sizeof(ScalarType), this->PlacementMode);
     std::copy(this->Pointer, this->Pointer + (std::min)(this->Size, newsize), newArray);
     // now save the new array and release the old one too.
     this->SetBuffer(newArray, newsize);
@@ -245,6 +260,13 @@ bool vtkBuffer<ScalarT>::Reallocate(vtkIdType newsize)
     {
       return false;
     }
+    if (newsize > this->Size)
+    {
+      // Existing elements have already been written by realloc, only the
+      // grown part can still be placed.
+      vtkBufferPlacement::Place(newArray + this->Size, (newsize - this->Size) * sizeof(ScalarType),
+        this->PlacementMode);
+    }
     this->Pointer = newArray;
     this->Size = newsize;
   }
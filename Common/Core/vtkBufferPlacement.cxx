@@ -0,0 +1,198 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkBufferPlacement.h"
+
+#include "vtkSMPTools.h"
+
+#include <atomic>  // For std::atomic
+#include <cstdint> // For std::uintptr_t
+#include <cstdlib> // For std::getenv
+#include <cstring> // For std::strcmp
+
+#if defined(__linux__)
+#include <fstream>       // For std::ifstream
+#include <sys/syscall.h> // For SYS_mbind
+#include <unistd.h>      // For syscall, sysconf
+#elif !defined(_WIN32)
+#include <unistd.h> // For sysconf
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+int GetModeFromEnvironment()
+{
+  const char* mode = std::getenv("VTK_BUFFER_PLACEMENT");
+  if (mode)
+  {
+    if (std::strcmp(mode, "first_touch") == 0)
+    {
+      return vtkBufferPlacement::FIRST_TOUCH;
+    }
+    if (std::strcmp(mode, "interleave") == 0)
+    {
+      return vtkBufferPlacement::INTERLEAVE;
+    }
+  }
+  return vtkBufferPlacement::SYSTEM;
+}
+
+//------------------------------------------------------------------------------
+std::atomic<int>& GlobalMode()
+{
+  static std::atomic<int> mode{ GetModeFromEnvironment() };
+  return mode;
+}
+
+//------------------------------------------------------------------------------
+std::atomic<std::size_t>& MinimumSize()
+{
+  static std::atomic<std::size_t> size{ 1 << 20 };
+  return size;
+}
+
+//------------------------------------------------------------------------------
+std::uintptr_t GetPageSize()
+{
+#if defined(_WIN32)
+  return 4096;
+#else
+  static const long pageSize = sysconf(_SC_PAGESIZE);
+  return pageSize > 0 ? static_cast<std::uintptr_t>(pageSize) : 4096;
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Write one byte in every page of the range so that each page is mapped on the
+// NUMA node of the thread that will process the matching elements.
+struct FirstTouchFunctor
+{
+  char* Pointer;
+  std::uintptr_t PageSize;
+
+  void operator()(vtkIdType begin, vtkIdType end) const
+  {
+    char* first = this->Pointer + begin;
+    char* last = this->Pointer + end;
+    const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(first);
+    // Pages are touched at their first byte, except for the one holding the
+    // beginning of the buffer which may not be page aligned.
+    char* page = first + ((this->PageSize - address % this->PageSize) % this->PageSize);
+    if (begin == 0)
+    {
+      *first = 0;
+    }
+    for (; page < last; page += this->PageSize)
+    {
+      *page = 0;
+    }
+  }
+};
+
+#if defined(__linux__) && defined(SYS_mbind)
+//------------------------------------------------------------------------------
+// Parse /sys/devices/system/node/online (e.g. "0-1" or "0,2-3") into a node mask.
+bool GetOnlineNodes(unsigned long& mask)
+{
+  std::ifstream file("/sys/devices/system/node/online");
+  if (!file)
+  {
+    return false;
+  }
+  mask = 0;
+  unsigned long first = 0;
+  while (file >> first)
+  {
+    unsigned long last = first;
+    char separator = 0;
+    if (file.get(separator) && separator == '-')
+    {
+      file >> last;
+      file.get(separator);
+    }
+    for (unsigned long node = first; node <= last && node < 8 * sizeof(unsigned long); ++node)
+    {
+      mask |= 1UL << node;
+    }
+    if (separator != ',')
+    {
+      break;
+    }
+  }
+  return mask != 0;
+}
+
+//------------------------------------------------------------------------------
+bool Interleave(void* ptr, std::size_t size)
+{
+  static unsigned long nodes = 0;
+  static const bool hasNodes = GetOnlineNodes(nodes);
+  if (!hasNodes || (nodes & (nodes - 1)) == 0)
+  {
+    // Single node: nothing to interleave.
+    return false;
+  }
+  const std::uintptr_t pageSize = GetPageSize();
+  const std::uintptr_t address = reinterpret_cast<std::uintptr_t>(ptr);
+  const std::uintptr_t begin = address - address % pageSize;
+  const std::uintptr_t length = address + size - begin;
+  const int mpolInterleave = 3; // MPOL_INTERLEAVE from <linux/mempolicy.h>
+  const unsigned long maxNode = 8 * sizeof(unsigned long) + 1;
+  return syscall(SYS_mbind, begin, length, mpolInterleave, &nodes, maxNode, 0) == 0;
+}
+#else
+//------------------------------------------------------------------------------
+bool Interleave(void*, std::size_t)
+{
+  return false;
+}
+#endif
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkBufferPlacement::SetGlobalMode(int mode)
+{
+  if (mode >= SYSTEM && mode <= INTERLEAVE)
+  {
+    GlobalMode() = mode;
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkBufferPlacement::GetGlobalMode()
+{
+  return GlobalMode();
+}
+
+//------------------------------------------------------------------------------
+void vtkBufferPlacement::SetMinimumSize(std::size_t size)
+{
+  MinimumSize() = size;
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkBufferPlacement::GetMinimumSize()
+{
+  return MinimumSize();
+}
+
+//------------------------------------------------------------------------------
+void vtkBufferPlacement::Place(void* ptr, std::size_t size, int mode)
+{
+  if (mode == USE_GLOBAL)
+  {
+    mode = GlobalMode();
+  }
+  if (!ptr || mode == SYSTEM || size < MinimumSize())
+  {
+    return;
+  }
+  if (mode == INTERLEAVE && Interleave(ptr, size))
+  {
+    return;
+  }
+  FirstTouchFunctor touch{ static_cast<char*>(ptr), GetPageSize() };
+  vtkSMPTools::For(0, static_cast<vtkIdType>(size), touch);
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,84 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkBufferPlacement
+ * @brief   NUMA page placement policy for vtkBuffer allocations.
+ *
+ * On multi-socket machines, the operating system places a page on the NUMA
+ * node of the thread that first writes to it. Buffers filled by a single
+ * thread therefore end up on a single node and every subsequent
+ * vtkSMPTools::For reads most of its data remotely.
+ *
+ * vtkBufferPlacement controls what vtkBuffer does with freshly allocated
+ * memory:
+ * - SYSTEM: nothing, pages are placed by the first thread writing them.
+ * - FIRST_TOUCH: pages are touched in parallel with vtkSMPTools::For, using
+ *   the same partitioning as a vtkSMPTools::For over the elements of the
+ *   buffer, so that each thread later finds its chunk on its own node.
+ * - INTERLEAVE: pages are interleaved round-robin over all the NUMA nodes
+ *   (Linux only, FIRST_TOUCH is used elsewhere). This is useful for data
+ *   accessed with irregular patterns such as point coordinates.
+ *
+ * The global mode applies to every buffer whose own mode is USE_GLOBAL (the
+ * default). It is initialized from the VTK_BUFFER_PLACEMENT environment
+ * variable (`system`, `first_touch` or `interleave`) and defaults to SYSTEM.
+ * A per-array mode can be set with vtkAOSDataArrayTemplate::SetPlacementMode()
+ * and vtkSOADataArrayTemplate::SetPlacementMode().
+ *
+ * Allocations smaller than GetMinimumSize() bytes are never placed, as the
+ * cost of dispatching threads would exceed the bandwidth gains.
+ *
+ * @sa
+ * vtkBuffer vtkSMPTools
+ */
+
+#ifndef vtkBufferPlacement_h
+#define vtkBufferPlacement_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+#include <cstddef> // For std::size_t
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkBufferPlacement
+{
+public:
+  enum PlacementModes
+  {
+    USE_GLOBAL = -1,
+    SYSTEM = 0,
+    FIRST_TOUCH = 1,
+    INTERLEAVE = 2
+  };
+
+  ///@{
+  /**
+   * Set/Get the placement mode used by buffers whose mode is USE_GLOBAL.
+   * Setting USE_GLOBAL is ignored.
+   */
+  static void SetGlobalMode(int mode);
+  static int GetGlobalMode();
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the size in bytes under which allocations are not placed.
+   * Default is 1 MiB.
+   */
+  static void SetMinimumSize(std::size_t size);
+  static std::size_t GetMinimumSize();
+  ///@}
+
+  /**
+   * Apply `mode` (resolving USE_GLOBAL) to the `size` bytes at `ptr`, which
+   * must have just been allocated and not been written yet. With FIRST_TOUCH,
+   * the memory content is zeroed page by page; callers must not rely on
+   * either the previous content or zeroes.
+   */
+  static void Place(void* ptr, std::size_t size, int mode);
+};
+VTK_ABI_NAMESPACE_END
+
+#endif
+// VTK-HeaderTest-Exclude: vtkBufferPlacement.h
@@ -0,0 +1,653 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkContiguousStringArray.h"
+
+#include "vtkArrayIteratorTemplate.h"
+#include "vtkIdList.h"
+#include "vtkObjectFactory.h"
+#include "vtkStringArray.h"
+#include "vtkVariant.h"
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+// The value ids sorted by value, then by id.
+class vtkContiguousStringArrayLookup
+{
+public:
+  std::vector<vtkIdType> SortedIds;
+  bool Rebuild = true;
+};
+
+namespace
+{
+//------------------------------------------------------------------------------
+int Compare(const vtkContiguousStringArray::StringView& a, const char* b, vtkIdType bSize)
+{
+  const size_t size = static_cast<size_t>(std::min(a.Size, bSize));
+  const int result = size ? std::memcmp(a.Data, b, size) : 0;
+  if (result != 0)
+  {
+    return result;
+  }
+  return a.Size < bSize ? -1 : (a.Size > bSize ? 1 : 0);
+}
+}
+
+vtkStandardNewMacro(vtkContiguousStringArray);
+
+//------------------------------------------------------------------------------
+vtkContiguousStringArray::vtkContiguousStringArray()
+{
+  this->Characters = vtkSmartPointer<vtkCharArray>::New();
+  this->Offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+  this->Offsets->InsertNextValue(0);
+}
+
+//------------------------------------------------------------------------------
+vtkContiguousStringArray::~vtkContiguousStringArray()
+{
+  delete this->Lookup;
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfCharacters: " << this->GetNumberOfCharacters() << "\n";
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::Initialize()
+{
+  this->Characters = vtkSmartPointer<vtkCharArray>::New();
+  this->Offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+  this->Offsets->InsertNextValue(0);
+  this->NumberOfPackedValues = 0;
+  this->Size = 0;
+  this->MaxId = -1;
+  this->DataChanged();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkContiguousStringArray::GetNumberOfCharacters() const
+{
+  return this->Offsets->GetValue(this->NumberOfPackedValues);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkContiguousStringArray::GetDataSize() const
+{
+  return this->GetNumberOfCharacters() + this->GetNumberOfValues();
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::PackValues(vtkIdType numValues)
+{
+  if (numValues <= this->NumberOfPackedValues)
+  {
+    return;
+  }
+  vtkIdType* offsets = this->Offsets->WritePointer(0, numValues + 1);
+  std::fill(offsets + this->NumberOfPackedValues + 1, offsets + numValues + 1,
+    offsets[this->NumberOfPackedValues]);
+  this->NumberOfPackedValues = numValues;
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkContiguousStringArray::Allocate(vtkIdType numValues, vtkIdType)
+{
+  this->MaxId = -1;
+  this->NumberOfPackedValues = 0;
+  if (!this->Offsets->Allocate(numValues + 1))
+  {
+    return 0;
+  }
+  this->Offsets->InsertNextValue(0);
+  this->Size = std::max<vtkIdType>(numValues, 0);
+  this->DataChanged();
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::Squeeze()
+{
+  this->Characters->SetNumberOfValues(this->GetNumberOfCharacters());
+  this->Characters->Squeeze();
+  this->Offsets->SetNumberOfValues(this->NumberOfPackedValues + 1);
+  this->Offsets->Squeeze();
+  this->Size = this->GetNumberOfValues();
+}
+
+//------------------------------------------------------------------------------
+vtkTypeBool vtkContiguousStringArray::Resize(vtkIdType numTuples)
+{
+  const vtkIdType numValues = std::max<vtkIdType>(numTuples, 0) * this->NumberOfComponents;
+  if (numValues < this->GetNumberOfValues())
+  {
+    this->SetNumberOfValues(numValues);
+  }
+  if (numValues + 1 > this->Offsets->GetSize())
+  {
+    if (!this->Offsets->Resize(numValues + 1))
+    {
+      return 0;
+    }
+  }
+  this->Size = numValues;
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+bool vtkContiguousStringArray::SetNumberOfValues(vtkIdType numValues)
+{
+  numValues = std::max<vtkIdType>(numValues, 0);
+  // The values that are added are empty: their offsets are only written when
+  // a value that follows them is set.
+  this->NumberOfPackedValues = std::min(this->NumberOfPackedValues, numValues);
+  this->MaxId = numValues - 1;
+  this->Size = std::max(this->Size, numValues);
+  this->DataChanged();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::SetValue(vtkIdType valueIdx, const char* value, vtkIdType size)
+{
+  // The value may be a view of this array, which is invalidated by the
+  // changes of the buffer.
+  const char* chars = this->Characters->GetPointer(0);
+  if (size > 0 && !std::less<const char*>()(value, chars) &&
+    std::less<const char*>()(value, chars + this->Characters->GetSize()))
+  {
+    const std::string copy(value, static_cast<size_t>(size));
+    this->SetValue(valueIdx, copy.data(), size);
+    return;
+  }
+
+  if (valueIdx >= this->NumberOfPackedValues)
+  {
+    // Append the value after the empty values that precede it.
+    this->PackValues(valueIdx);
+    vtkIdType* offsets = this->Offsets->WritePointer(0, valueIdx + 2);
+    const vtkIdType end = offsets[valueIdx];
+    if (size > 0)
+    {
+      std::copy(value, value + size, this->Characters->WritePointer(end, size));
+    }
+    offsets[valueIdx + 1] = end + size;
+    this->NumberOfPackedValues = valueIdx + 1;
+  }
+  else
+  {
+    vtkIdType* offsets = this->Offsets->GetPointer(0);
+    const vtkIdType begin = offsets[valueIdx];
+    const vtkIdType oldSize = offsets[valueIdx + 1] - begin;
+    const vtkIdType end = offsets[this->NumberOfPackedValues];
+    const vtkIdType delta = size - oldSize;
+    if (delta > 0)
+    {
+      this->Characters->WritePointer(end, delta);
+    }
+    char* buffer = this->Characters->GetPointer(0);
+    if (delta != 0)
+    {
+      // Move the characters of the values that follow.
+      std::memmove(buffer + begin + size, buffer + begin + oldSize,
+        static_cast<size_t>(end - begin - oldSize));
+      for (vtkIdType i = valueIdx + 1; i <= this->NumberOfPackedValues; ++i)
+      {
+        offsets[i] += delta;
+      }
+    }
+    std::copy(value, value + size, buffer + begin);
+  }
+  this->DataChanged();
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::SetValue(vtkIdType valueIdx, const char* value)
+{
+  if (value)
+  {
+    this->SetValue(valueIdx, value, static_cast<vtkIdType>(std::strlen(value)));
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::InsertValue(vtkIdType valueIdx, const char* value, vtkIdType size)
+{
+  if (valueIdx >= this->GetNumberOfValues())
+  {
+    this->SetNumberOfValues(valueIdx + 1);
+  }
+  this->SetValue(valueIdx, value, size);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkContiguousStringArray::InsertNextValue(const char* value, vtkIdType size)
+{
+  const vtkIdType valueIdx = this->GetNumberOfValues();
+  this->InsertValue(valueIdx, value, size);
+  return valueIdx;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkContiguousStringArray::InsertNextValue(const char* value)
+{
+  if (value)
+  {
+    return this->InsertNextValue(value, static_cast<vtkIdType>(std::strlen(value)));
+  }
+  return this->MaxId;
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::ReserveCharacters(vtkIdType numCharacters)
+{
+  if (numCharacters > this->Characters->GetSize())
+  {
+    this->Characters->Resize(numCharacters);
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkCharArray* vtkContiguousStringArray::GetCharacters()
+{
+  const vtkIdType numCharacters = this->GetNumberOfCharacters();
+  if (this->Characters->GetNumberOfValues() != numCharacters)
+  {
+    this->Characters->SetNumberOfValues(numCharacters);
+  }
+  return this->Characters;
+}
+
+//------------------------------------------------------------------------------
+vtkIdTypeArray* vtkContiguousStringArray::GetOffsets()
+{
+  this->PackValues(this->GetNumberOfValues());
+  if (this->Offsets->GetNumberOfValues() != this->NumberOfPackedValues + 1)
+  {
+    this->Offsets->SetNumberOfValues(this->NumberOfPackedValues + 1);
+  }
+  return this->Offsets;
+}
+
+//------------------------------------------------------------------------------
+bool vtkContiguousStringArray::SetData(vtkCharArray* characters, vtkIdTypeArray* offsets)
+{
+  if (!characters || !offsets || offsets->GetNumberOfComponents() != 1 ||
+    offsets->GetNumberOfValues() < 1)
+  {
+    vtkErrorMacro("Invalid buffers.");
+    return false;
+  }
+  const vtkIdType numValues = offsets->GetNumberOfValues() - 1;
+  const vtkIdType* offs = offsets->GetPointer(0);
+  if (offs[0] != 0 || offs[numValues] != characters->GetNumberOfValues() ||
+    !std::is_sorted(offs, offs + numValues + 1))
+  {
+    vtkErrorMacro("The offsets do not match the characters.");
+    return false;
+  }
+  this->Characters = characters;
+  this->Offsets = offsets;
+  this->NumberOfPackedValues = numValues;
+  this->MaxId = numValues - 1;
+  this->Size = numValues;
+  this->DataChanged();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::CopyValue(
+  vtkIdType dstIdx, vtkIdType srcIdx, vtkAbstractArray* source)
+{
+  if (vtkContiguousStringArray* csa = vtkArrayDownCast<vtkContiguousStringArray>(source))
+  {
+    const StringView view = csa->GetView(srcIdx);
+    this->SetValue(dstIdx, view.Data, view.Size);
+  }
+  else if (vtkStringArray* sa = vtkArrayDownCast<vtkStringArray>(source))
+  {
+    this->SetValue(dstIdx, sa->GetValue(srcIdx));
+  }
+  else
+  {
+    this->SetValue(dstIdx, source->GetVariantValue(srcIdx).ToString());
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::SetTuple(
+  vtkIdType dstTupleIdx, vtkIdType srcTupleIdx, vtkAbstractArray* source)
+{
+  const int numComps = this->NumberOfComponents;
+  if (source->GetNumberOfComponents() != numComps)
+  {
+    vtkWarningMacro("Input and output component sizes do not match.");
+    return;
+  }
+  for (int c = 0; c < numComps; ++c)
+  {
+    this->CopyValue(dstTupleIdx * numComps + c, srcTupleIdx * numComps + c, source);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::InsertTuple(
+  vtkIdType dstTupleIdx, vtkIdType srcTupleIdx, vtkAbstractArray* source)
+{
+  if (source->GetNumberOfComponents() != this->NumberOfComponents)
+  {
+    vtkWarningMacro("Input and output component sizes do not match.");
+    return;
+  }
+  const vtkIdType numValues = (dstTupleIdx + 1) * this->NumberOfComponents;
+  if (numValues > this->GetNumberOfValues())
+  {
+    this->SetNumberOfValues(numValues);
+  }
+  this->SetTuple(dstTupleIdx, srcTupleIdx, source);
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::InsertTuples(
+  vtkIdList* dstIds, vtkIdList* srcIds, vtkAbstractArray* source)
+{
+  const vtkIdType numIds = dstIds->GetNumberOfIds();
+  if (srcIds->GetNumberOfIds() != numIds)
+  {
+    vtkWarningMacro("Input and output id array sizes do not match.");
+    return;
+  }
+  for (vtkIdType i = 0; i < numIds; ++i)
+  {
+    this->InsertTuple(dstIds->GetId(i), srcIds->GetId(i), source);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::InsertTuplesStartingAt(
+  vtkIdType dstStart, vtkIdList* srcIds, vtkAbstractArray* source)
+{
+  const vtkIdType numIds = srcIds->GetNumberOfIds();
+  for (vtkIdType i = 0; i < numIds; ++i)
+  {
+    this->InsertTuple(dstStart + i, srcIds->GetId(i), source);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::InsertTuples(
+  vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source)
+{
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    this->InsertTuple(dstStart + i, srcStart + i, source);
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkContiguousStringArray::InsertNextTuple(vtkIdType srcTupleIdx, vtkAbstractArray* source)
+{
+  const vtkIdType tupleIdx = this->GetNumberOfTuples();
+  this->InsertTuple(tupleIdx, srcTupleIdx, source);
+  return tupleIdx;
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::GetTuples(vtkIdList* tupleIds, vtkAbstractArray* output)
+{
+  vtkStringArray* sa = vtkArrayDownCast<vtkStringArray>(output);
+  if (!sa || sa->GetNumberOfComponents() != this->NumberOfComponents)
+  {
+    // the other arrays accept the tuples of this array through SetTuple
+    this->Superclass::GetTuples(tupleIds, output);
+    return;
+  }
+  const int numComps = this->NumberOfComponents;
+  for (vtkIdType i = 0; i < tupleIds->GetNumberOfIds(); ++i)
+  {
+    const vtkIdType srcIdx = tupleIds->GetId(i) * numComps;
+    for (int c = 0; c < numComps; ++c)
+    {
+      sa->SetValue(i * numComps + c, this->GetValue(srcIdx + c));
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::GetTuples(vtkIdType p1, vtkIdType p2, vtkAbstractArray* output)
+{
+  vtkStringArray* sa = vtkArrayDownCast<vtkStringArray>(output);
+  if (!sa || sa->GetNumberOfComponents() != this->NumberOfComponents)
+  {
+    this->Superclass::GetTuples(p1, p2, output);
+    return;
+  }
+  const int numComps = this->NumberOfComponents;
+  const vtkIdType numValues = (p2 - p1 + 1) * numComps;
+  for (vtkIdType i = 0; i < numValues; ++i)
+  {
+    sa->SetValue(i, this->GetValue(p1 * numComps + i));
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::InterpolateTuple(
+  vtkIdType dstTupleIdx, vtkIdList* ptIndices, vtkAbstractArray* source, double* weights)
+{
+  if (ptIndices->GetNumberOfIds() == 0)
+  {
+    return;
+  }
+
+  // Use the nearest neighbour, which is the point with the largest weight.
+  vtkIdType nearest = ptIndices->GetId(0);
+  double maxWeight = weights[0];
+  for (vtkIdType k = 1; k < ptIndices->GetNumberOfIds(); ++k)
+  {
+    if (weights[k] > maxWeight)
+    {
+      nearest = ptIndices->GetId(k);
+      maxWeight = weights[k];
+    }
+  }
+  this->InsertTuple(dstTupleIdx, nearest, source);
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::InterpolateTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx1,
+  vtkAbstractArray* source1, vtkIdType srcTupleIdx2, vtkAbstractArray* source2, double t)
+{
+  if (t >= 0.5)
+  {
+    this->InsertTuple(dstTupleIdx, srcTupleIdx2, source2);
+  }
+  else
+  {
+    this->InsertTuple(dstTupleIdx, srcTupleIdx1, source1);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::DeepCopy(vtkAbstractArray* aa)
+{
+  if (!aa || aa == this)
+  {
+    return;
+  }
+
+  this->Superclass::DeepCopy(aa);
+  this->NumberOfComponents = aa->GetNumberOfComponents();
+
+  if (vtkContiguousStringArray* csa = vtkArrayDownCast<vtkContiguousStringArray>(aa))
+  {
+    this->Characters = vtkSmartPointer<vtkCharArray>::New();
+    this->Characters->DeepCopy(csa->GetCharacters());
+    this->Offsets = vtkSmartPointer<vtkIdTypeArray>::New();
+    this->Offsets->DeepCopy(csa->GetOffsets());
+    this->NumberOfPackedValues = csa->GetNumberOfValues();
+    this->MaxId = csa->GetMaxId();
+    this->Size = this->MaxId + 1;
+    this->DataChanged();
+    return;
+  }
+
+  const vtkIdType numValues = aa->GetNumberOfValues();
+  this->Initialize();
+  this->Allocate(numValues);
+  if (vtkStringArray* sa = vtkArrayDownCast<vtkStringArray>(aa))
+  {
+    vtkIdType numCharacters = 0;
+    for (vtkIdType i = 0; i < numValues; ++i)
+    {
+      numCharacters += static_cast<vtkIdType>(sa->GetValue(i).size());
+    }
+    this->ReserveCharacters(numCharacters);
+  }
+  this->SetNumberOfValues(numValues);
+  for (vtkIdType i = 0; i < numValues; ++i)
+  {
+    this->CopyValue(i, i, aa);
+  }
+}
+
+//------------------------------------------------------------------------------
+void* vtkContiguousStringArray::GetVoidPointer(vtkIdType valueIdx)
+{
+  return const_cast<char*>(this->GetView(valueIdx).Data);
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::SetVoidArray(void*, vtkIdType, int)
+{
+  vtkErrorMacro("SetVoidArray is not supported, use SetData instead.");
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::SetArrayFreeFunction(void (*)(void*))
+{
+  vtkErrorMacro("SetArrayFreeFunction is not supported, use SetData instead.");
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkContiguousStringArray::GetActualMemorySize() const
+{
+  return this->Characters->GetActualMemorySize() + this->Offsets->GetActualMemorySize();
+}
+
+//------------------------------------------------------------------------------
+vtkArrayIterator* vtkContiguousStringArray::NewIterator()
+{
+  vtkArrayIteratorTemplate<char>* iter = vtkArrayIteratorTemplate<char>::New();
+  iter->Initialize(this->GetCharacters());
+  return iter;
+}
+
+//------------------------------------------------------------------------------
+vtkVariant vtkContiguousStringArray::GetVariantValue(vtkIdType valueIdx)
+{
+  return vtkVariant(this->GetValue(valueIdx));
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::InsertVariantValue(vtkIdType valueIdx, vtkVariant value)
+{
+  this->InsertValue(valueIdx, value.ToString());
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::SetVariantValue(vtkIdType valueIdx, vtkVariant value)
+{
+  this->SetValue(valueIdx, value.ToString());
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::UpdateLookup()
+{
+  if (!this->Lookup)
+  {
+    this->Lookup = new vtkContiguousStringArrayLookup;
+  }
+  if (this->Lookup->Rebuild)
+  {
+    std::vector<vtkIdType>& ids = this->Lookup->SortedIds;
+    ids.resize(static_cast<size_t>(this->GetNumberOfValues()));
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+      ids[i] = static_cast<vtkIdType>(i);
+    }
+    std::stable_sort(ids.begin(), ids.end(),
+      [this](vtkIdType a, vtkIdType b)
+      {
+        const StringView view = this->GetView(b);
+        return ::Compare(this->GetView(a), view.Data, view.Size) < 0;
+      });
+    this->Lookup->Rebuild = false;
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkContiguousStringArray::LookupValue(const char* value, vtkIdType size)
+{
+  this->UpdateLookup();
+  const std::vector<vtkIdType>& ids = this->Lookup->SortedIds;
+  auto found = std::lower_bound(ids.begin(), ids.end(), value,
+    [this, size](vtkIdType id, const char* v) { return ::Compare(this->GetView(id), v, size) < 0; });
+  if (found != ids.end() && ::Compare(this->GetView(*found), value, size) == 0)
+  {
+    return *found;
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::LookupValue(const char* value, vtkIdType size, vtkIdList* valueIds)
+{
+  valueIds->Reset();
+  this->UpdateLookup();
+  const std::vector<vtkIdType>& ids = this->Lookup->SortedIds;
+  auto found = std::lower_bound(ids.begin(), ids.end(), value,
+    [this, size](vtkIdType id, const char* v) { return ::Compare(this->GetView(id), v, size) < 0; });
+  for (; found != ids.end() && ::Compare(this->GetView(*found), value, size) == 0; ++found)
+  {
+    valueIds->InsertNextId(*found);
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkContiguousStringArray::LookupValue(vtkVariant value)
+{
+  const vtkStdString str = value.ToString();
+  return this->LookupValue(str.data(), static_cast<vtkIdType>(str.size()));
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::LookupValue(vtkVariant value, vtkIdList* valueIds)
+{
+  const vtkStdString str = value.ToString();
+  this->LookupValue(str.data(), static_cast<vtkIdType>(str.size()), valueIds);
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::DataChanged()
+{
+  if (this->Lookup)
+  {
+    this->Lookup->Rebuild = true;
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkContiguousStringArray::ClearLookup()
+{
+  delete this->Lookup;
+  this->Lookup = nullptr;
+}
+VTK_ABI_NAMESPACE_END
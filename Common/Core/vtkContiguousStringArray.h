@@ -0,0 +1,327 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkContiguousStringArray
+ * @brief   a vtkAbstractArray subclass for strings stored in a single buffer
+ *
+ * vtkContiguousStringArray stores its strings back to back in a single
+ * character buffer, together with an array of NumberOfValues + 1 offsets where
+ * the string of index i spans the characters [offsets[i], offsets[i + 1]). This
+ * is the layout of the string columns of Apache Arrow. Compared to
+ * vtkStringArray, which stores one vtkStdString per value, there is no heap
+ * allocation per value and the overhead per value is one vtkIdType, which makes
+ * a large difference for columns of many short strings.
+ *
+ * Values can be read without copy with GetView(), which returns a pointer to
+ * the characters of the value and its length. The values are not terminated by
+ * a null character in the buffer. The buffers themselves are accessible with
+ * GetCharacters() and GetOffsets(), and can be set without copy with SetData().
+ *
+ * Appending values with InsertNextValue() or setting values in increasing order
+ * after SetNumberOfValues() runs in linear time. Changing the length of a value
+ * that is followed by non-empty values moves all the characters that follow it.
+ *
+ * The data type of this array is VTK_CONTIGUOUS_STRING. Code that handles
+ * vtkStringArray through its vtkStdString pointer or iterator does not handle
+ * this array, use DeepCopy() or GetTuples() to convert between the two
+ * classes.
+ *
+ * @sa
+ * vtkStringArray
+ */
+
+#ifndef vtkContiguousStringArray_h
+#define vtkContiguousStringArray_h
+
+#include "vtkAbstractArray.h"
+#include "vtkCharArray.h"        // For inline methods
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkIdTypeArray.h"      // For inline methods
+#include "vtkSmartPointer.h"     // For buffers
+#include "vtkStdString.h"        // For GetValue
+
+#include <string> // For InsertNextValue
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkContiguousStringArrayLookup;
+
+class VTKCOMMONCORE_EXPORT vtkContiguousStringArray : public vtkAbstractArray
+{
+public:
+  static vtkContiguousStringArray* New();
+  vtkTypeMacro(vtkContiguousStringArray, vtkAbstractArray);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * A read-only reference to the characters of a value. It is invalidated by
+   * any modification of the array.
+   */
+  struct StringView
+  {
+    const char* Data = "";
+    vtkIdType Size = 0;
+
+    StringView() = default;
+    StringView(const char* data, vtkIdType size)
+      : Data(data)
+      , Size(size)
+    {
+    }
+
+    /**
+     * Return a copy of the characters as a string.
+     */
+    vtkStdString ToString() const
+    {
+      return vtkStdString(this->Data, static_cast<std::string::size_type>(this->Size));
+    }
+  };
+
+  //
+  // Functions required by vtkAbstractArray
+  //
+
+  int GetDataType() const override { return VTK_CONTIGUOUS_STRING; }
+  int IsNumeric() const override { return 0; }
+  void Initialize() override;
+
+  /**
+   * Return the size of a character.
+   */
+  int GetDataTypeSize() const override { return static_cast<int>(sizeof(char)); }
+  int GetElementComponentSize() const override { return static_cast<int>(sizeof(char)); }
+
+  /**
+   * Return the number of characters plus one termination character per value,
+   * which is the size of the values when written as null terminated strings.
+   */
+  vtkIdType GetDataSize() const override;
+
+  vtkTypeBool Allocate(vtkIdType numValues, vtkIdType ext = 1000) override;
+  void Squeeze() override;
+  vtkTypeBool Resize(vtkIdType numTuples) override;
+  void SetNumberOfTuples(vtkIdType numTuples) override
+  {
+    this->SetNumberOfValues(numTuples * this->NumberOfComponents);
+  }
+
+  /**
+   * Set the number of values. Added values are empty strings.
+   */
+  bool SetNumberOfValues(vtkIdType numValues) override;
+
+  ///@{
+  /**
+   * Copy tuples from a source array, which can be a vtkContiguousStringArray,
+   * a vtkStringArray, or any array whose values are converted to strings with
+   * vtkVariant::ToString().
+   */
+  void SetTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx, vtkAbstractArray* source) override;
+  void InsertTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx, vtkAbstractArray* source) override;
+  void InsertTuples(vtkIdList* dstIds, vtkIdList* srcIds, vtkAbstractArray* source) override;
+  void InsertTuplesStartingAt(
+    vtkIdType dstStart, vtkIdList* srcIds, vtkAbstractArray* source) override;
+  void InsertTuples(
+    vtkIdType dstStart, vtkIdType n, vtkIdType srcStart, vtkAbstractArray* source) override;
+  vtkIdType InsertNextTuple(vtkIdType srcTupleIdx, vtkAbstractArray* source) override;
+  ///@}
+
+  ///@{
+  /**
+   * Copy tuples into an output array, which can be a vtkContiguousStringArray,
+   * a vtkStringArray, or any array that accepts variant values.
+   */
+  void GetTuples(vtkIdList* tupleIds, vtkAbstractArray* output) override;
+  void GetTuples(vtkIdType p1, vtkIdType p2, vtkAbstractArray* output) override;
+  ///@}
+
+  ///@{
+  /**
+   * Strings are interpolated by copying the value of the nearest tuple, as
+   * vtkStringArray does.
+   */
+  void InterpolateTuple(vtkIdType dstTupleIdx, vtkIdList* ptIndices, vtkAbstractArray* source,
+    double* weights) override;
+  void InterpolateTuple(vtkIdType dstTupleIdx, vtkIdType srcTupleIdx1, vtkAbstractArray* source1,
+    vtkIdType srcTupleIdx2, vtkAbstractArray* source2, double t) override;
+  ///@}
+
+  /**
+   * Deep copy a vtkContiguousStringArray, a vtkStringArray, or any array whose
+   * values are converted to strings with vtkVariant::ToString().
+   */
+  void DeepCopy(vtkAbstractArray* aa) override;
+
+  /**
+   * Return false: the values are not stored as an array of fixed size
+   * elements.
+   */
+  bool HasStandardMemoryLayout() const override { return false; }
+
+  /**
+   * Return a pointer to the first character of the given value.
+   */
+  void* GetVoidPointer(vtkIdType valueIdx) override;
+
+  ///@{
+  /**
+   * Not supported, use SetData() instead.
+   */
+  void SetVoidArray(void* array, vtkIdType size, int save) override;
+  void SetArrayFreeFunction(void (*callback)(void*)) override;
+  ///@}
+
+  unsigned long GetActualMemorySize() const override;
+
+  /**
+   * Returns a vtkArrayIteratorTemplate<char> over the character buffer.
+   */
+  VTK_NEWINSTANCE vtkArrayIterator* NewIterator() override;
+
+  ///@{
+  /**
+   * Return the indices where a specific value appears. The first call builds a
+   * sorted index of the values, of one vtkIdType per value.
+   */
+  vtkIdType LookupValue(vtkVariant value) override;
+  void LookupValue(vtkVariant value, vtkIdList* valueIds) override;
+  vtkIdType LookupValue(const char* value, vtkIdType size);
+  void LookupValue(const char* value, vtkIdType size, vtkIdList* valueIds);
+  ///@}
+
+  vtkVariant GetVariantValue(vtkIdType valueIdx) override;
+  void InsertVariantValue(vtkIdType valueIdx, vtkVariant value) override;
+  void SetVariantValue(vtkIdType valueIdx, vtkVariant value) override;
+
+  void DataChanged() override;
+  void ClearLookup() override;
+
+  //
+  // String access
+  //
+
+  /**
+   * Return the number of values in the array.
+   */
+  vtkIdType GetNumberOfValues() const { return this->MaxId + 1; }
+
+  /**
+   * Return a reference to the characters of a value, without copy.
+   */
+  StringView GetView(vtkIdType valueIdx) const
+    VTK_EXPECTS(0 <= valueIdx && valueIdx < GetNumberOfValues())
+  {
+    if (valueIdx >= this->NumberOfPackedValues)
+    {
+      return StringView();
+    }
+    const vtkIdType* offsets = this->Offsets->GetPointer(0);
+    return StringView(
+      this->Characters->GetPointer(offsets[valueIdx]), offsets[valueIdx + 1] - offsets[valueIdx]);
+  }
+
+  /**
+   * Return a copy of a value.
+   */
+  vtkStdString GetValue(vtkIdType valueIdx) const
+    VTK_EXPECTS(0 <= valueIdx && valueIdx < GetNumberOfValues())
+  {
+    return this->GetView(valueIdx).ToString();
+  }
+
+  ///@{
+  /**
+   * Set a value. Does not do range checking, use SetNumberOfValues() first.
+   */
+  void SetValue(vtkIdType valueIdx, const char* value, vtkIdType size)
+    VTK_EXPECTS(0 <= valueIdx && valueIdx < GetNumberOfValues());
+  void SetValue(vtkIdType valueIdx, const std::string& value)
+    VTK_EXPECTS(0 <= valueIdx && valueIdx < GetNumberOfValues())
+  {
+    this->SetValue(valueIdx, value.data(), static_cast<vtkIdType>(value.size()));
+  }
+  void SetValue(vtkIdType valueIdx, const char* value)
+    VTK_EXPECTS(0 <= valueIdx && valueIdx < GetNumberOfValues()) VTK_EXPECTS(value != nullptr);
+  ///@}
+
+  ///@{
+  /**
+   * Set a value, growing the array as needed.
+   */
+  void InsertValue(vtkIdType valueIdx, const char* value, vtkIdType size) VTK_EXPECTS(0 <= valueIdx);
+  void InsertValue(vtkIdType valueIdx, const std::string& value) VTK_EXPECTS(0 <= valueIdx)
+  {
+    this->InsertValue(valueIdx, value.data(), static_cast<vtkIdType>(value.size()));
+  }
+  ///@}
+
+  ///@{
+  /**
+   * Append a value to the array. Return its index.
+   */
+  vtkIdType InsertNextValue(const char* value, vtkIdType size);
+  vtkIdType InsertNextValue(const std::string& value)
+  {
+    return this->InsertNextValue(value.data(), static_cast<vtkIdType>(value.size()));
+  }
+  vtkIdType InsertNextValue(const char* value) VTK_EXPECTS(value != nullptr);
+  ///@}
+
+  /**
+   * Reserve memory for the given total number of characters.
+   */
+  void ReserveCharacters(vtkIdType numCharacters);
+
+  /**
+   * Return the number of characters of all the values.
+   */
+  vtkIdType GetNumberOfCharacters() const;
+
+  ///@{
+  /**
+   * Return the buffers of the array: the characters of all the values, and the
+   * NumberOfValues + 1 offsets of the values in the characters. The buffers are
+   * owned by the array and must not be resized.
+   */
+  vtkCharArray* GetCharacters();
+  vtkIdTypeArray* GetOffsets();
+  ///@}
+
+  /**
+   * Use the given buffers as the storage of the array, without copy. The
+   * offsets must start with 0, be non decreasing and end with the number of
+   * characters. The number of values is the number of offsets minus one.
+   * Return false and leave the array unchanged if the offsets are not valid.
+   */
+  bool SetData(vtkCharArray* characters, vtkIdTypeArray* offsets);
+
+protected:
+  vtkContiguousStringArray();
+  ~vtkContiguousStringArray() override;
+
+  /**
+   * Set the offsets of the values that follow the packed values up to the
+   * given value, which are empty.
+   */
+  void PackValues(vtkIdType numValues);
+
+  vtkSmartPointer<vtkCharArray> Characters;
+  vtkSmartPointer<vtkIdTypeArray> Offsets;
+
+  // The values that follow NumberOfPackedValues are empty strings whose
+  // offsets have not been written yet.
+  vtkIdType NumberOfPackedValues = 0;
+
+private:
+  vtkContiguousStringArray(const vtkContiguousStringArray&) = delete;
+  void operator=(const vtkContiguousStringArray&) = delete;
+
+  // Copy value srcIdx of source into value dstIdx
+  void CopyValue(vtkIdType dstIdx, vtkIdType srcIdx, vtkAbstractArray* source);
+
+  vtkContiguousStringArrayLookup* Lookup = nullptr;
+  void UpdateLookup();
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -5,18 +5,22 @@
 
 #ifndef VTK_GDA_TEMPLATE_EXTERN
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkAssume.h"
 #include "vtkDataArray.h"
 #include "vtkDataArrayRange.h"
+#include "vtkDataArraySIMDRange.h"
 #include "vtkMathUtilities.h"
 #include "vtkSMPThreadLocal.h"
 #include "vtkSMPTools.h"
+#include "vtkSOADataArrayTemplate.h"
 #include "vtkTypeTraits.h"
 
 #include <algorithm>
 #include <array>
 #include <cassert> // for assert()
 #include <limits>
+#include <type_traits>
 #include <vector>
 
 namespace vtkDataArrayPrivate
@@ -509,6 +513,185 @@ bool GenericComputeScalarRange(ArrayT* array, RangeValueType* ranges, FiniteValu
   return true;
 }
 
+//----------------------------------------------------------------------------
+// Explicitly vectorized path, see vtkDataArraySIMDRange.h. It handles the
+// contiguous float, double and int buffers of the AOS and SOA arrays; the
+// SIMDCompute* functions return false for any other array so that the callers
+// fall back on the functors above.
+template <typename ValueType>
+struct HasSIMDRange : std::false_type
+{
+};
+template <>
+struct HasSIMDRange<float> : std::true_type
+{
+};
+template <>
+struct HasSIMDRange<double> : std::true_type
+{
+};
+template <>
+struct HasSIMDRange<int> : std::true_type
+{
+};
+
+// Computes the range of one or more buffers of BufferComps interleaved
+// components each: a single buffer for AOS arrays, one buffer per component
+// for SOA arrays.
+template <typename ValueType>
+class SIMDMinAndMax
+{
+private:
+  std::vector<const ValueType*> Buffers;
+  int BufferComps;
+  bool Finite;
+  vtkSMPThreadLocal<std::vector<ValueType>> TLRange;
+  std::vector<ValueType> ReducedRange;
+
+public:
+  SIMDMinAndMax(const std::vector<const ValueType*>& buffers, int bufferComps, bool finite)
+    : Buffers(buffers)
+    , BufferComps(bufferComps)
+    , Finite(finite)
+    , ReducedRange(2 * buffers.size() * bufferComps)
+  {
+    this->InitializeRange(this->ReducedRange);
+  }
+  void InitializeRange(std::vector<ValueType>& range)
+  {
+    for (size_t j = 0; j < range.size(); j += 2)
+    {
+      range[j] = vtkTypeTraits<ValueType>::Max();
+      range[j + 1] = vtkTypeTraits<ValueType>::Min();
+    }
+  }
+  void Initialize()
+  {
+    auto& range = this->TLRange.Local();
+    range.resize(this->ReducedRange.size());
+    this->InitializeRange(range);
+  }
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    auto& range = this->TLRange.Local();
+    for (size_t i = 0; i < this->Buffers.size(); ++i)
+    {
+      SIMDComputeRange(this->Buffers[i] + begin * this->BufferComps, end - begin,
+        this->BufferComps, this->Finite, range.data() + 2 * i * this->BufferComps);
+    }
+  }
+  void Reduce()
+  {
+    for (auto itr = this->TLRange.begin(); itr != this->TLRange.end(); ++itr)
+    {
+      auto& range = *itr;
+      for (size_t j = 0; j < range.size(); j += 2)
+      {
+        this->ReducedRange[j] = detail::min(this->ReducedRange[j], range[j]);
+        this->ReducedRange[j + 1] = detail::max(this->ReducedRange[j + 1], range[j + 1]);
+      }
+    }
+  }
+  template <typename T>
+  void CopyRanges(T* ranges)
+  {
+    for (size_t j = 0; j < this->ReducedRange.size(); ++j)
+    {
+      ranges[j] = static_cast<T>(this->ReducedRange[j]);
+    }
+  }
+};
+
+template <typename ValueType>
+class SIMDMagnitudeMinAndMax : public MinAndMax<double, 1>
+{
+private:
+  using MinAndMaxT = MinAndMax<double, 1>;
+  const ValueType* Buffer;
+  int NumComps;
+  bool Finite;
+
+public:
+  SIMDMagnitudeMinAndMax(const ValueType* buffer, int numComps, bool finite)
+    : MinAndMaxT()
+    , Buffer(buffer)
+    , NumComps(numComps)
+    , Finite(finite)
+  {
+  }
+  // Help vtkSMPTools find Initialize() and Reduce()
+  void Initialize() { MinAndMaxT::Initialize(); }
+  void Reduce() { MinAndMaxT::Reduce(); }
+  template <typename T>
+  void CopyRanges(T* ranges)
+  {
+    MinAndMaxT::CopyRanges(ranges);
+    ranges[0] = std::sqrt(ranges[0]);
+    ranges[1] = std::sqrt(ranges[1]);
+  }
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    auto& range = MinAndMaxT::TLRange.Local();
+    SIMDComputeSquaredMagnitudeRange(this->Buffer + begin * this->NumComps, end - begin,
+      this->NumComps, this->Finite, range.data());
+  }
+};
+
+template <typename ArrayT, typename RangeValueType, typename Tag>
+bool SIMDComputeScalarRange(ArrayT*, RangeValueType*, Tag)
+{
+  return false;
+}
+
+template <typename ValueType, typename RangeValueType, typename Tag>
+typename std::enable_if<HasSIMDRange<ValueType>::value, bool>::type SIMDComputeScalarRange(
+  vtkAOSDataArrayTemplate<ValueType>* array, RangeValueType* ranges, Tag)
+{
+  const bool finite = std::is_same<Tag, FiniteValues>::value;
+  SIMDMinAndMax<ValueType> minmax({ array->GetPointer(0) }, array->GetNumberOfComponents(), finite);
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
+  minmax.CopyRanges(ranges);
+  return true;
+}
+
+template <typename ValueType, typename RangeValueType, typename Tag>
+typename std::enable_if<HasSIMDRange<ValueType>::value, bool>::type SIMDComputeScalarRange(
+  vtkSOADataArrayTemplate<ValueType>* array, RangeValueType* ranges, Tag)
+{
+  if (!array->HasSOAStorage())
+  {
+    return false;
+  }
+  const bool finite = std::is_same<Tag, FiniteValues>::value;
+  std::vector<const ValueType*> buffers(array->GetNumberOfComponents());
+  for (size_t comp = 0; comp < buffers.size(); ++comp)
+  {
+    buffers[comp] = array->GetComponentArrayPointer(static_cast<int>(comp));
+  }
+  SIMDMinAndMax<ValueType> minmax(buffers, 1, finite);
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
+  minmax.CopyRanges(ranges);
+  return true;
+}
+
+template <typename ArrayT, typename RangeValueType, typename Tag>
+bool SIMDComputeVectorRange(ArrayT*, RangeValueType*, Tag)
+{
+  return false;
+}
+
+template <typename ValueType, typename RangeValueType, typename Tag>
+typename std::enable_if<HasSIMDRange<ValueType>::value, bool>::type SIMDComputeVectorRange(
+  vtkAOSDataArrayTemplate<ValueType>* array, RangeValueType range[2], Tag)
+{
+  const bool finite = std::is_same<Tag, FiniteValues>::value;
+  SIMDMagnitudeMinAndMax<ValueType> minmax(
+    array->GetPointer(0), array->GetNumberOfComponents(), finite);
+  vtkSMPTools::For(0, array->GetNumberOfTuples(), minmax);
+  minmax.CopyRanges(range);
+  return true;
+}
+
 //----------------------------------------------------------------------------
 template <typename ArrayT, typename RangeValueType, typename ValueType>
 bool DoComputeScalarRange(ArrayT* array, RangeValueType* ranges, ValueType tag,
@@ -529,6 +712,11 @@ bool DoComputeScalarRange(ArrayT* array, RangeValueType* ranges, ValueType tag,
     return false;
   }
 
+  if (!ghosts && SIMDComputeScalarRange(array, ranges, tag))
+  {
+    return true;
+  }
+
   // Special case for single value scalar range. This is done to help the
   // compiler detect it can perform loop optimizations.
   if (numComp == 1)
@@ -589,6 +777,11 @@ bool DoComputeVectorRange(ArrayT* array, RangeValueType range[2], AllValues,
     return false;
   }
 
+  if (!ghosts && SIMDComputeVectorRange(array, range, AllValues()))
+  {
+    return true;
+  }
+
   // Always compute at double precision for vector magnitudes. This will
   // give precision errors on large 64-bit ints, but magnitudes aren't usually
   // computed for those.
@@ -614,6 +807,11 @@ bool DoComputeVectorRange(ArrayT* array, RangeValueType range[2], FiniteValues,
     return false;
   }
 
+  if (!ghosts && SIMDComputeVectorRange(array, range, FiniteValues()))
+  {
+    return true;
+  }
+
   // Always compute at double precision for vector magnitudes. This will
   // give precision errors on large 64-bit ints, but magnitudes aren't usually
   // computed for those.
@@ -0,0 +1,336 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataArraySIMDRange.h"
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__) ||                                 \
+  (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define VTK_SIMD_RANGE_HAS_SSE2
+#endif
+
+#if !(defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86))
+// The AVX kernels are only built for x86 targets.
+#undef VTK_SIMD_RANGE_HAS_AVX2
+#undef VTK_SIMD_RANGE_HAS_AVX512
+#endif
+
+#if defined(VTK_SIMD_RANGE_HAS_SSE2)
+#include <emmintrin.h>
+#endif
+#if defined(_MSC_VER) && (defined(VTK_SIMD_RANGE_HAS_AVX2) || defined(VTK_SIMD_RANGE_HAS_AVX512))
+#include <immintrin.h> // For _xgetbv
+#include <intrin.h>    // For __cpuid
+#endif
+
+#if defined(VTK_SIMD_RANGE_HAS_SSE2)
+#define VTK_SIMD_RANGE_NAMESPACE sse2
+#else
+#define VTK_SIMD_RANGE_NAMESPACE scalar
+#endif
+#include "vtkDataArraySIMDRangeKernels.txx"
+
+namespace vtkDataArrayPrivate
+{
+VTK_ABI_NAMESPACE_BEGIN
+#if !defined(VTK_SIMD_RANGE_HAS_SSE2)
+namespace scalar
+{
+namespace
+{
+//------------------------------------------------------------------------------
+// Portable fallback: "vectors" of a single value.
+template <typename T>
+struct ScalarTraits
+{
+  using Scalar = T;
+  using Vec = T;
+  static const int Width = 1;
+  using DVec = double;
+  static const int DWidth = 1;
+  static Vec Set1(T value) { return value; }
+  static Vec Load(const T* ptr) { return *ptr; }
+  static void Store(T* ptr, Vec x) { *ptr = x; }
+  static Vec Min(Vec x, Vec acc) { return x < acc ? x : acc; }
+  static Vec Max(Vec x, Vec acc) { return x > acc ? x : acc; }
+  static Vec MinFinite(Vec x, Vec acc) { return Limits<T>::IsInf(x) ? acc : Min(x, acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return Limits<T>::IsInf(x) ? acc : Max(x, acc); }
+  static DVec DSet1(double value) { return value; }
+  static DVec DAdd(DVec a, DVec b) { return a + b; }
+  static DVec DMul(DVec a, DVec b) { return a * b; }
+  static DVec DMin(DVec x, DVec acc) { return x < acc ? x : acc; }
+  static DVec DMax(DVec x, DVec acc) { return x > acc ? x : acc; }
+  static DVec DMinFinite(DVec x, DVec acc)
+  {
+    return Limits<double>::IsInf(x) ? acc : DMin(x, acc);
+  }
+  static DVec DMaxFinite(DVec x, DVec acc)
+  {
+    return Limits<double>::IsInf(x) ? acc : DMax(x, acc);
+  }
+  static void DStore(double* ptr, DVec x) { *ptr = x; }
+  static DVec LoadStridedAsDouble(const T* ptr, int) { return static_cast<double>(*ptr); }
+};
+} // anonymous namespace
+
+vtkDataArraySIMDRangeEntryPointsMacro(ScalarTraits<float>, ScalarTraits<double>, ScalarTraits<int>)
+
+} // end namespace scalar
+#else
+namespace sse2
+{
+namespace
+{
+//------------------------------------------------------------------------------
+// SSE2 has no blend instruction, select with and/andnot/or instead.
+struct DoubleOps
+{
+  using DVec = __m128d;
+  static const int DWidth = 2;
+  static DVec DSet1(double value) { return _mm_set1_pd(value); }
+  static DVec DAdd(DVec a, DVec b) { return _mm_add_pd(a, b); }
+  static DVec DMul(DVec a, DVec b) { return _mm_mul_pd(a, b); }
+  // The second operand is returned when x is NaN.
+  static DVec DMin(DVec x, DVec acc) { return _mm_min_pd(x, acc); }
+  static DVec DMax(DVec x, DVec acc) { return _mm_max_pd(x, acc); }
+  static DVec DMinFinite(DVec x, DVec acc) { return _mm_min_pd(DSelectFinite(x, acc), acc); }
+  static DVec DMaxFinite(DVec x, DVec acc) { return _mm_max_pd(DSelectFinite(x, acc), acc); }
+  static void DStore(double* ptr, DVec x) { _mm_storeu_pd(ptr, x); }
+  static DVec DSelectFinite(DVec x, DVec other)
+  {
+    const DVec abs = _mm_andnot_pd(_mm_set1_pd(-0.0), x);
+    const DVec mask = _mm_cmpneq_pd(abs, _mm_set1_pd(HUGE_VAL));
+    return _mm_or_pd(_mm_and_pd(mask, x), _mm_andnot_pd(mask, other));
+  }
+};
+
+//------------------------------------------------------------------------------
+struct FloatTraits : DoubleOps
+{
+  using Scalar = float;
+  using Vec = __m128;
+  static const int Width = 4;
+  static Vec Set1(float value) { return _mm_set1_ps(value); }
+  static Vec Load(const float* ptr) { return _mm_loadu_ps(ptr); }
+  static void Store(float* ptr, Vec x) { _mm_storeu_ps(ptr, x); }
+  static Vec Min(Vec x, Vec acc) { return _mm_min_ps(x, acc); }
+  static Vec Max(Vec x, Vec acc) { return _mm_max_ps(x, acc); }
+  static Vec MinFinite(Vec x, Vec acc) { return _mm_min_ps(SelectFinite(x, acc), acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return _mm_max_ps(SelectFinite(x, acc), acc); }
+  static Vec SelectFinite(Vec x, Vec other)
+  {
+    const Vec abs = _mm_andnot_ps(_mm_set1_ps(-0.0f), x);
+    const Vec mask = _mm_cmpneq_ps(abs, _mm_set1_ps(HUGE_VALF));
+    return _mm_or_ps(_mm_and_ps(mask, x), _mm_andnot_ps(mask, other));
+  }
+  static DVec LoadStridedAsDouble(const float* ptr, int stride)
+  {
+    return _mm_set_pd(static_cast<double>(ptr[stride]), static_cast<double>(ptr[0]));
+  }
+};
+
+//------------------------------------------------------------------------------
+struct DoubleTraits : DoubleOps
+{
+  using Scalar = double;
+  using Vec = __m128d;
+  static const int Width = 2;
+  static Vec Set1(double value) { return _mm_set1_pd(value); }
+  static Vec Load(const double* ptr) { return _mm_loadu_pd(ptr); }
+  static void Store(double* ptr, Vec x) { _mm_storeu_pd(ptr, x); }
+  static Vec Min(Vec x, Vec acc) { return _mm_min_pd(x, acc); }
+  static Vec Max(Vec x, Vec acc) { return _mm_max_pd(x, acc); }
+  static Vec MinFinite(Vec x, Vec acc) { return DoubleOps::DMinFinite(x, acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return DoubleOps::DMaxFinite(x, acc); }
+  static DVec LoadStridedAsDouble(const double* ptr, int stride)
+  {
+    return _mm_set_pd(ptr[stride], ptr[0]);
+  }
+};
+
+//------------------------------------------------------------------------------
+// SSE2 lacks 32-bit integer min/max, emulate them with a comparison.
+struct IntTraits : DoubleOps
+{
+  using Scalar = int;
+  using Vec = __m128i;
+  static const int Width = 4;
+  static Vec Set1(int value) { return _mm_set1_epi32(value); }
+  static Vec Load(const int* ptr) { return _mm_loadu_si128(reinterpret_cast<const Vec*>(ptr)); }
+  static void Store(int* ptr, Vec x) { _mm_storeu_si128(reinterpret_cast<Vec*>(ptr), x); }
+  static Vec Select(Vec mask, Vec a, Vec b)
+  {
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+  }
+  static Vec Min(Vec x, Vec acc) { return Select(_mm_cmplt_epi32(x, acc), x, acc); }
+  static Vec Max(Vec x, Vec acc) { return Select(_mm_cmpgt_epi32(x, acc), x, acc); }
+  static Vec MinFinite(Vec x, Vec acc) { return Min(x, acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return Max(x, acc); }
+  static DVec LoadStridedAsDouble(const int* ptr, int stride)
+  {
+    return _mm_set_pd(static_cast<double>(ptr[stride]), static_cast<double>(ptr[0]));
+  }
+};
+} // anonymous namespace
+
+vtkDataArraySIMDRangeEntryPointsMacro(FloatTraits, DoubleTraits, IntTraits)
+
+} // end namespace sse2
+#endif
+
+// Entry points of the translation units built with AVX code generation.
+#if defined(VTK_SIMD_RANGE_HAS_AVX2)
+namespace avx2
+{
+void ComputeRange(const float*, vtkIdType, int, bool, float*);
+void ComputeRange(const double*, vtkIdType, int, bool, double*);
+void ComputeRange(const int*, vtkIdType, int, bool, int*);
+void ComputeSquaredMagnitudeRange(const float*, vtkIdType, int, bool, double[2]);
+void ComputeSquaredMagnitudeRange(const double*, vtkIdType, int, bool, double[2]);
+void ComputeSquaredMagnitudeRange(const int*, vtkIdType, int, bool, double[2]);
+}
+#endif
+#if defined(VTK_SIMD_RANGE_HAS_AVX512)
+namespace avx512
+{
+void ComputeRange(const float*, vtkIdType, int, bool, float*);
+void ComputeRange(const double*, vtkIdType, int, bool, double*);
+void ComputeRange(const int*, vtkIdType, int, bool, int*);
+void ComputeSquaredMagnitudeRange(const float*, vtkIdType, int, bool, double[2]);
+void ComputeSquaredMagnitudeRange(const double*, vtkIdType, int, bool, double[2]);
+void ComputeSquaredMagnitudeRange(const int*, vtkIdType, int, bool, double[2]);
+}
+#endif
+
+namespace
+{
+//------------------------------------------------------------------------------
+struct Kernels
+{
+  const char* Name;
+  void (*RangeFloat)(const float*, vtkIdType, int, bool, float*);
+  void (*RangeDouble)(const double*, vtkIdType, int, bool, double*);
+  void (*RangeInt)(const int*, vtkIdType, int, bool, int*);
+  void (*MagnitudeFloat)(const float*, vtkIdType, int, bool, double[2]);
+  void (*MagnitudeDouble)(const double*, vtkIdType, int, bool, double[2]);
+  void (*MagnitudeInt)(const int*, vtkIdType, int, bool, double[2]);
+};
+
+#define vtkDataArraySIMDRangeKernelsMacro(name, ns)                                                \
+  Kernels                                                                                          \
+  {                                                                                                \
+    name, &ns::ComputeRange, &ns::ComputeRange, &ns::ComputeRange,                                 \
+      &ns::ComputeSquaredMagnitudeRange, &ns::ComputeSquaredMagnitudeRange,                        \
+      &ns::ComputeSquaredMagnitudeRange                                                            \
+  }
+
+#if defined(VTK_SIMD_RANGE_HAS_AVX2) || defined(VTK_SIMD_RANGE_HAS_AVX512)
+//------------------------------------------------------------------------------
+// Check both the CPU and the operating system support (saved register state)
+// for AVX2, or AVX-512F if avx512 is true.
+bool CPUSupports(bool avx512)
+{
+#if defined(_MSC_VER) && !defined(__clang__)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7)
+  {
+    return false;
+  }
+  __cpuid(info, 1);
+  const bool osxsave = (info[2] & (1 << 27)) != 0;
+  if (!osxsave)
+  {
+    return false;
+  }
+  const unsigned long long xcr0 = _xgetbv(0);
+  __cpuidex(info, 7, 0);
+  if (avx512)
+  {
+    return (info[1] & (1 << 16)) != 0 && (xcr0 & 0xE6) == 0xE6;
+  }
+  return (info[1] & (1 << 5)) != 0 && (xcr0 & 0x6) == 0x6;
+#else
+  __builtin_cpu_init();
+  return avx512 ? __builtin_cpu_supports("avx512f") != 0 : __builtin_cpu_supports("avx2") != 0;
+#endif
+}
+#endif
+
+//------------------------------------------------------------------------------
+Kernels SelectKernels()
+{
+#if defined(VTK_SIMD_RANGE_HAS_AVX512)
+  if (CPUSupports(true))
+  {
+    return vtkDataArraySIMDRangeKernelsMacro("AVX512", avx512);
+  }
+#endif
+#if defined(VTK_SIMD_RANGE_HAS_AVX2)
+  if (CPUSupports(false))
+  {
+    return vtkDataArraySIMDRangeKernelsMacro("AVX2", avx2);
+  }
+#endif
+#if defined(VTK_SIMD_RANGE_HAS_SSE2)
+  return vtkDataArraySIMDRangeKernelsMacro("SSE2", sse2);
+#else
+  return vtkDataArraySIMDRangeKernelsMacro("Scalar", scalar);
+#endif
+}
+
+//------------------------------------------------------------------------------
+const Kernels& GetKernels()
+{
+  static const Kernels kernels = SelectKernels();
+  return kernels;
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void SIMDComputeRange(
+  const float* values, vtkIdType numTuples, int numComps, bool finite, float* range)
+{
+  GetKernels().RangeFloat(values, numTuples, numComps, finite, range);
+}
+
+//------------------------------------------------------------------------------
+void SIMDComputeRange(
+  const double* values, vtkIdType numTuples, int numComps, bool finite, double* range)
+{
+  GetKernels().RangeDouble(values, numTuples, numComps, finite, range);
+}
+
+//------------------------------------------------------------------------------
+void SIMDComputeRange(const int* values, vtkIdType numTuples, int numComps, bool finite, int* range)
+{
+  GetKernels().RangeInt(values, numTuples, numComps, finite, range);
+}
+
+//------------------------------------------------------------------------------
+void SIMDComputeSquaredMagnitudeRange(
+  const float* values, vtkIdType numTuples, int numComps, bool finite, double range[2])
+{
+  GetKernels().MagnitudeFloat(values, numTuples, numComps, finite, range);
+}
+
+//------------------------------------------------------------------------------
+void SIMDComputeSquaredMagnitudeRange(
+  const double* values, vtkIdType numTuples, int numComps, bool finite, double range[2])
+{
+  GetKernels().MagnitudeDouble(values, numTuples, numComps, finite, range);
+}
+
+//------------------------------------------------------------------------------
+void SIMDComputeSquaredMagnitudeRange(
+  const int* values, vtkIdType numTuples, int numComps, bool finite, double range[2])
+{
+  GetKernels().MagnitudeInt(values, numTuples, numComps, finite, range);
+}
+
+//------------------------------------------------------------------------------
+const char* GetSIMDRangeInstructionSet()
+{
+  return GetKernels().Name;
+}
+
+VTK_ABI_NAMESPACE_END
+} // end namespace vtkDataArrayPrivate
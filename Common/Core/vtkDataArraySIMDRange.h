@@ -0,0 +1,61 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Explicitly vectorized kernels used by vtkDataArrayPrivate.txx to compute the
+// range of contiguous float, double and int values.
+//
+// Each kernel processes a contiguous chunk of array-of-structs values. The
+// instruction set is selected once at runtime among AVX-512, AVX2 and SSE2
+// (x86 only), with a scalar fallback on other architectures. Multi-threading
+// is left to the callers, which split the tuples with vtkSMPTools.
+
+#ifndef vtkDataArraySIMDRange_h
+#define vtkDataArraySIMDRange_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkType.h"
+
+namespace vtkDataArrayPrivate
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+///@{
+/**
+ * Update `range` (interleaved min/max per component, `2 * numComps` values)
+ * with the `numTuples` tuples of `numComps` components stored at `values`.
+ * NaN values are ignored, as are infinities if `finite` is true.
+ */
+VTKCOMMONCORE_EXPORT void SIMDComputeRange(
+  const float* values, vtkIdType numTuples, int numComps, bool finite, float* range);
+VTKCOMMONCORE_EXPORT void SIMDComputeRange(
+  const double* values, vtkIdType numTuples, int numComps, bool finite, double* range);
+VTKCOMMONCORE_EXPORT void SIMDComputeRange(
+  const int* values, vtkIdType numTuples, int numComps, bool finite, int* range);
+///@}
+
+///@{
+/**
+ * Update `range` with the minimum and maximum squared magnitude of the
+ * `numTuples` tuples of `numComps` components stored at `values`. The squared
+ * magnitudes are computed in double precision. NaN values are ignored, as are
+ * infinite squared magnitudes if `finite` is true.
+ */
+VTKCOMMONCORE_EXPORT void SIMDComputeSquaredMagnitudeRange(
+  const float* values, vtkIdType numTuples, int numComps, bool finite, double range[2]);
+VTKCOMMONCORE_EXPORT void SIMDComputeSquaredMagnitudeRange(
+  const double* values, vtkIdType numTuples, int numComps, bool finite, double range[2]);
+VTKCOMMONCORE_EXPORT void SIMDComputeSquaredMagnitudeRange(
+  const int* values, vtkIdType numTuples, int numComps, bool finite, double range[2]);
+///@}
+
+/**
+ * Name of the instruction set used by the kernels: "AVX512", "AVX2", "SSE2"
+ * or "Scalar".
+ */
+VTKCOMMONCORE_EXPORT const char* GetSIMDRangeInstructionSet();
+
+VTK_ABI_NAMESPACE_END
+} // end namespace vtkDataArrayPrivate
+
+#endif
+// VTK-HeaderTest-Exclude: vtkDataArraySIMDRange.h
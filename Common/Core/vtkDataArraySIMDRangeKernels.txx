@@ -0,0 +1,277 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Range kernels shared by the vtkDataArraySIMDRange*.cxx translation units.
+//
+// The kernels are written once against a vector traits class providing the
+// vector type (Vec, Width elements of Scalar) and the intrinsics used to load,
+// compare and store it, plus a double precision vector type (DVec, DWidth
+// elements) for magnitudes. Each translation unit is compiled for a given
+// instruction set and includes this file after defining
+// VTK_SIMD_RANGE_NAMESPACE, so that every instantiation gets a distinct
+// symbol: nothing compiled with AVX flags may be picked by the linker for use
+// in code that runs on older CPUs. For the same reason, the kernels do not call
+// any function from the standard library.
+
+#ifndef VTK_SIMD_RANGE_NAMESPACE
+#error "VTK_SIMD_RANGE_NAMESPACE must be defined before including this file."
+#endif
+
+#include "vtkType.h"
+
+#include <cfloat>  // For FLT_MAX, DBL_MAX
+#include <climits> // For INT_MAX, INT_MIN
+#include <cmath>   // For HUGE_VAL, HUGE_VALF
+
+namespace vtkDataArrayPrivate
+{
+VTK_ABI_NAMESPACE_BEGIN
+namespace VTK_SIMD_RANGE_NAMESPACE
+{
+//------------------------------------------------------------------------------
+template <typename T>
+struct Limits;
+
+template <>
+struct Limits<float>
+{
+  static float Highest() { return FLT_MAX; }
+  static float Lowest() { return -FLT_MAX; }
+  static bool IsInf(float value) { return value == HUGE_VALF || value == -HUGE_VALF; }
+};
+
+template <>
+struct Limits<double>
+{
+  static double Highest() { return DBL_MAX; }
+  static double Lowest() { return -DBL_MAX; }
+  static bool IsInf(double value) { return value == HUGE_VAL || value == -HUGE_VAL; }
+};
+
+template <>
+struct Limits<int>
+{
+  static int Highest() { return INT_MAX; }
+  static int Lowest() { return INT_MIN; }
+  static bool IsInf(int) { return false; }
+};
+
+// Maximum number of accumulator vectors, see ComputeRange.
+const int MaximumNumberOfAccumulators = 16;
+
+//------------------------------------------------------------------------------
+inline int GreatestCommonDivisor(int a, int b)
+{
+  while (b != 0)
+  {
+    const int r = a % b;
+    a = b;
+    b = r;
+  }
+  return a;
+}
+
+//------------------------------------------------------------------------------
+// Comparisons are written so that NaN values never replace the current bounds.
+template <typename T>
+inline void UpdateScalarRange(T value, bool finite, T& min, T& max)
+{
+  if (finite && Limits<T>::IsInf(value))
+  {
+    return;
+  }
+  if (value < min)
+  {
+    min = value;
+  }
+  if (value > max)
+  {
+    max = value;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Values are read as a flat sequence of vectors. Lane j of the k-th vector
+// holds a value of component (k * Width + j) % numComps, a pattern that
+// repeats every numComps / gcd(numComps, Width) vectors. Using that many
+// accumulators, each accumulator lane always sees the same component and the
+// inner loop is free of shuffles whatever the number of components.
+template <typename V>
+void ComputeRange(const typename V::Scalar* values, vtkIdType numTuples, int numComps, bool finite,
+  typename V::Scalar* range)
+{
+  using T = typename V::Scalar;
+  using Vec = typename V::Vec;
+  const vtkIdType numValues = numTuples * numComps;
+  const int numAccumulators = numComps / GreatestCommonDivisor(numComps, V::Width);
+  const vtkIdType blockSize = static_cast<vtkIdType>(numAccumulators) * V::Width;
+
+  vtkIdType valueId = 0;
+  if (numAccumulators <= MaximumNumberOfAccumulators && numValues >= blockSize)
+  {
+    Vec mins[MaximumNumberOfAccumulators];
+    Vec maxs[MaximumNumberOfAccumulators];
+    for (int acc = 0; acc < numAccumulators; ++acc)
+    {
+      mins[acc] = V::Set1(Limits<T>::Highest());
+      maxs[acc] = V::Set1(Limits<T>::Lowest());
+    }
+
+    const vtkIdType end = numValues - numValues % blockSize;
+    if (finite)
+    {
+      for (; valueId < end; valueId += blockSize)
+      {
+        for (int acc = 0; acc < numAccumulators; ++acc)
+        {
+          const Vec x = V::Load(values + valueId + acc * V::Width);
+          mins[acc] = V::MinFinite(x, mins[acc]);
+          maxs[acc] = V::MaxFinite(x, maxs[acc]);
+        }
+      }
+    }
+    else
+    {
+      for (; valueId < end; valueId += blockSize)
+      {
+        for (int acc = 0; acc < numAccumulators; ++acc)
+        {
+          const Vec x = V::Load(values + valueId + acc * V::Width);
+          mins[acc] = V::Min(x, mins[acc]);
+          maxs[acc] = V::Max(x, maxs[acc]);
+        }
+      }
+    }
+
+    T lanes[2][V::Width];
+    for (int acc = 0; acc < numAccumulators; ++acc)
+    {
+      V::Store(lanes[0], mins[acc]);
+      V::Store(lanes[1], maxs[acc]);
+      for (int lane = 0; lane < V::Width; ++lane)
+      {
+        const int comp = (acc * V::Width + lane) % numComps;
+        if (lanes[0][lane] < range[2 * comp])
+        {
+          range[2 * comp] = lanes[0][lane];
+        }
+        if (lanes[1][lane] > range[2 * comp + 1])
+        {
+          range[2 * comp + 1] = lanes[1][lane];
+        }
+      }
+    }
+  }
+
+  // Remaining values. valueId is a multiple of numComps here.
+  for (int comp = 0; valueId < numValues; ++valueId)
+  {
+    UpdateScalarRange(values[valueId], finite, range[2 * comp], range[2 * comp + 1]);
+    comp = comp + 1 == numComps ? 0 : comp + 1;
+  }
+}
+
+//------------------------------------------------------------------------------
+// DWidth tuples are processed at once, component c of each of them being
+// loaded with a strided (gather) load.
+template <typename V>
+void ComputeSquaredMagnitudeRange(const typename V::Scalar* values, vtkIdType numTuples,
+  int numComps, bool finite, double range[2])
+{
+  using DVec = typename V::DVec;
+  const vtkIdType end = numTuples - numTuples % V::DWidth;
+  vtkIdType tupleId = 0;
+  if (end > 0)
+  {
+    DVec min = V::DSet1(DBL_MAX);
+    DVec max = V::DSet1(-DBL_MAX);
+    for (; tupleId < end; tupleId += V::DWidth)
+    {
+      const typename V::Scalar* tuple = values + tupleId * numComps;
+      DVec squaredSum = V::DSet1(0.0);
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        const DVec x = V::LoadStridedAsDouble(tuple + comp, numComps);
+        squaredSum = V::DAdd(squaredSum, V::DMul(x, x));
+      }
+      if (finite)
+      {
+        min = V::DMinFinite(squaredSum, min);
+        max = V::DMaxFinite(squaredSum, max);
+      }
+      else
+      {
+        min = V::DMin(squaredSum, min);
+        max = V::DMax(squaredSum, max);
+      }
+    }
+
+    double lanes[2][V::DWidth];
+    V::DStore(lanes[0], min);
+    V::DStore(lanes[1], max);
+    for (int lane = 0; lane < V::DWidth; ++lane)
+    {
+      if (lanes[0][lane] < range[0])
+      {
+        range[0] = lanes[0][lane];
+      }
+      if (lanes[1][lane] > range[1])
+      {
+        range[1] = lanes[1][lane];
+      }
+    }
+  }
+
+  for (; tupleId < numTuples; ++tupleId)
+  {
+    const typename V::Scalar* tuple = values + tupleId * numComps;
+    double squaredSum = 0.0;
+    for (int comp = 0; comp < numComps; ++comp)
+    {
+      const double x = static_cast<double>(tuple[comp]);
+      squaredSum += x * x;
+    }
+    UpdateScalarRange(squaredSum, finite, range[0], range[1]);
+  }
+}
+
+} // end namespace VTK_SIMD_RANGE_NAMESPACE
+VTK_ABI_NAMESPACE_END
+} // end namespace vtkDataArrayPrivate
+
+// Defines the entry points of a translation unit from the traits classes for
+// float, double and int values. Must be expanded in the namespace the kernels
+// were included for.
+#define vtkDataArraySIMDRangeEntryPointsMacro(FloatTraits, DoubleTraits, IntTraits)                \
+  void ComputeRange(                                                                               \
+    const float* values, vtkIdType numTuples, int numComps, bool finite, float* range)             \
+  {                                                                                                \
+    ComputeRange<FloatTraits>(values, numTuples, numComps, finite, range);                         \
+  }                                                                                                \
+  void ComputeRange(                                                                               \
+    const double* values, vtkIdType numTuples, int numComps, bool finite, double* range)           \
+  {                                                                                                \
+    ComputeRange<DoubleTraits>(values, numTuples, numComps, finite, range);                        \
+  }                                                                                                \
+  void ComputeRange(                                                                               \
+    const int* values, vtkIdType numTuples, int numComps, bool finite, int* range)                 \
+  {                                                                                                \
+    ComputeRange<IntTraits>(values, numTuples, numComps, finite, range);                           \
+  }                                                                                                \
+  void ComputeSquaredMagnitudeRange(                                                               \
+    const float* values, vtkIdType numTuples, int numComps, bool finite, double range[2])          \
+  {                                                                                                \
+    ComputeSquaredMagnitudeRange<FloatTraits>(values, numTuples, numComps, finite, range);         \
+  }                                                                                                \
+  void ComputeSquaredMagnitudeRange(                                                               \
+    const double* values, vtkIdType numTuples, int numComps, bool finite, double range[2])         \
+  {                                                                                                \
+    ComputeSquaredMagnitudeRange<DoubleTraits>(values, numTuples, numComps, finite, range);        \
+  }                                                                                                \
+  void ComputeSquaredMagnitudeRange(                                                               \
+    const int* values, vtkIdType numTuples, int numComps, bool finite, double range[2])            \
+  {                                                                                                \
+    ComputeSquaredMagnitudeRange<IntTraits>(values, numTuples, numComps, finite, range);           \
+  }
+
+// VTK-HeaderTest-Exclude: vtkDataArraySIMDRangeKernels.txx
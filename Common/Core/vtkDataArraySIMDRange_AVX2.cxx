@@ -0,0 +1,123 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// AVX2 range kernels. This file is compiled with AVX2 code generation enabled
+// and its entry points are only called when the CPU supports AVX2.
+
+#define VTK_SIMD_RANGE_NAMESPACE avx2
+#include "vtkDataArraySIMDRangeKernels.txx"
+
+#include <immintrin.h>
+
+namespace vtkDataArrayPrivate
+{
+VTK_ABI_NAMESPACE_BEGIN
+namespace avx2
+{
+namespace
+{
+//------------------------------------------------------------------------------
+struct DoubleOps
+{
+  using DVec = __m256d;
+  static const int DWidth = 4;
+  static DVec DSet1(double value) { return _mm256_set1_pd(value); }
+  static DVec DAdd(DVec a, DVec b) { return _mm256_add_pd(a, b); }
+  static DVec DMul(DVec a, DVec b) { return _mm256_mul_pd(a, b); }
+  // The second operand is returned when x is NaN.
+  static DVec DMin(DVec x, DVec acc) { return _mm256_min_pd(x, acc); }
+  static DVec DMax(DVec x, DVec acc) { return _mm256_max_pd(x, acc); }
+  static DVec DMinFinite(DVec x, DVec acc)
+  {
+    return _mm256_min_pd(_mm256_blendv_pd(acc, x, FiniteMask(x)), acc);
+  }
+  static DVec DMaxFinite(DVec x, DVec acc)
+  {
+    return _mm256_max_pd(_mm256_blendv_pd(acc, x, FiniteMask(x)), acc);
+  }
+  static void DStore(double* ptr, DVec x) { _mm256_storeu_pd(ptr, x); }
+  // All bits set in lanes that are not infinite (NaN lanes included).
+  static DVec FiniteMask(DVec x)
+  {
+    const DVec abs = _mm256_andnot_pd(_mm256_set1_pd(-0.0), x);
+    return _mm256_cmp_pd(abs, _mm256_set1_pd(HUGE_VAL), _CMP_NEQ_UQ);
+  }
+};
+
+//------------------------------------------------------------------------------
+struct FloatTraits : DoubleOps
+{
+  using Scalar = float;
+  using Vec = __m256;
+  static const int Width = 8;
+  static Vec Set1(float value) { return _mm256_set1_ps(value); }
+  static Vec Load(const float* ptr) { return _mm256_loadu_ps(ptr); }
+  static void Store(float* ptr, Vec x) { _mm256_storeu_ps(ptr, x); }
+  static Vec Min(Vec x, Vec acc) { return _mm256_min_ps(x, acc); }
+  static Vec Max(Vec x, Vec acc) { return _mm256_max_ps(x, acc); }
+  static Vec MinFinite(Vec x, Vec acc)
+  {
+    return _mm256_min_ps(_mm256_blendv_ps(acc, x, FiniteMask(x)), acc);
+  }
+  static Vec MaxFinite(Vec x, Vec acc)
+  {
+    return _mm256_max_ps(_mm256_blendv_ps(acc, x, FiniteMask(x)), acc);
+  }
+  static Vec FiniteMask(Vec x)
+  {
+    const Vec abs = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x);
+    return _mm256_cmp_ps(abs, _mm256_set1_ps(HUGE_VALF), _CMP_NEQ_UQ);
+  }
+  static DVec LoadStridedAsDouble(const float* ptr, int stride)
+  {
+    const __m128i index = _mm_setr_epi32(0, stride, 2 * stride, 3 * stride);
+    return _mm256_cvtps_pd(_mm_i32gather_ps(ptr, index, 4));
+  }
+};
+
+//------------------------------------------------------------------------------
+struct DoubleTraits : DoubleOps
+{
+  using Scalar = double;
+  using Vec = __m256d;
+  static const int Width = 4;
+  static Vec Set1(double value) { return _mm256_set1_pd(value); }
+  static Vec Load(const double* ptr) { return _mm256_loadu_pd(ptr); }
+  static void Store(double* ptr, Vec x) { _mm256_storeu_pd(ptr, x); }
+  static Vec Min(Vec x, Vec acc) { return _mm256_min_pd(x, acc); }
+  static Vec Max(Vec x, Vec acc) { return _mm256_max_pd(x, acc); }
+  static Vec MinFinite(Vec x, Vec acc) { return DoubleOps::DMinFinite(x, acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return DoubleOps::DMaxFinite(x, acc); }
+  static DVec LoadStridedAsDouble(const double* ptr, int stride)
+  {
+    const __m128i index = _mm_setr_epi32(0, stride, 2 * stride, 3 * stride);
+    return _mm256_i32gather_pd(ptr, index, 8);
+  }
+};
+
+//------------------------------------------------------------------------------
+struct IntTraits : DoubleOps
+{
+  using Scalar = int;
+  using Vec = __m256i;
+  static const int Width = 8;
+  static Vec Set1(int value) { return _mm256_set1_epi32(value); }
+  static Vec Load(const int* ptr) { return _mm256_loadu_si256(reinterpret_cast<const Vec*>(ptr)); }
+  static void Store(int* ptr, Vec x) { _mm256_storeu_si256(reinterpret_cast<Vec*>(ptr), x); }
+  static Vec Min(Vec x, Vec acc) { return _mm256_min_epi32(x, acc); }
+  static Vec Max(Vec x, Vec acc) { return _mm256_max_epi32(x, acc); }
+  static Vec MinFinite(Vec x, Vec acc) { return _mm256_min_epi32(x, acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return _mm256_max_epi32(x, acc); }
+  static DVec LoadStridedAsDouble(const int* ptr, int stride)
+  {
+    const __m128i index = _mm_setr_epi32(0, stride, 2 * stride, 3 * stride);
+    return _mm256_cvtepi32_pd(_mm_i32gather_epi32(ptr, index, 4));
+  }
+};
+} // anonymous namespace
+
+vtkDataArraySIMDRangeEntryPointsMacro(FloatTraits, DoubleTraits, IntTraits)
+
+} // end namespace avx2
+VTK_ABI_NAMESPACE_END
+} // end namespace vtkDataArrayPrivate
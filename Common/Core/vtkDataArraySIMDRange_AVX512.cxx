@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// AVX-512 range kernels. This file is compiled with AVX-512F code generation
+// enabled and its entry points are only called when the CPU supports AVX-512F.
+
+#define VTK_SIMD_RANGE_NAMESPACE avx512
+#include "vtkDataArraySIMDRangeKernels.txx"
+
+#include <immintrin.h>
+
+namespace vtkDataArrayPrivate
+{
+VTK_ABI_NAMESPACE_BEGIN
+namespace avx512
+{
+namespace
+{
+//------------------------------------------------------------------------------
+struct DoubleOps
+{
+  using DVec = __m512d;
+  static const int DWidth = 8;
+  static DVec DSet1(double value) { return _mm512_set1_pd(value); }
+  static DVec DAdd(DVec a, DVec b) { return _mm512_add_pd(a, b); }
+  static DVec DMul(DVec a, DVec b) { return _mm512_mul_pd(a, b); }
+  // The second operand is returned when x is NaN.
+  static DVec DMin(DVec x, DVec acc) { return _mm512_min_pd(x, acc); }
+  static DVec DMax(DVec x, DVec acc) { return _mm512_max_pd(x, acc); }
+  static DVec DMinFinite(DVec x, DVec acc)
+  {
+    return _mm512_mask_min_pd(acc, FiniteMask(x), x, acc);
+  }
+  static DVec DMaxFinite(DVec x, DVec acc)
+  {
+    return _mm512_mask_max_pd(acc, FiniteMask(x), x, acc);
+  }
+  static void DStore(double* ptr, DVec x) { _mm512_storeu_pd(ptr, x); }
+  // Lanes that are not infinite (NaN lanes included).
+  static __mmask8 FiniteMask(DVec x)
+  {
+    return _mm512_cmp_pd_mask(_mm512_abs_pd(x), _mm512_set1_pd(HUGE_VAL), _CMP_NEQ_UQ);
+  }
+  static __m256i StridedIndex(int stride)
+  {
+    return _mm256_setr_epi32(
+      0, stride, 2 * stride, 3 * stride, 4 * stride, 5 * stride, 6 * stride, 7 * stride);
+  }
+};
+
+//------------------------------------------------------------------------------
+struct FloatTraits : DoubleOps
+{
+  using Scalar = float;
+  using Vec = __m512;
+  static const int Width = 16;
+  static Vec Set1(float value) { return _mm512_set1_ps(value); }
+  static Vec Load(const float* ptr) { return _mm512_loadu_ps(ptr); }
+  static void Store(float* ptr, Vec x) { _mm512_storeu_ps(ptr, x); }
+  static Vec Min(Vec x, Vec acc) { return _mm512_min_ps(x, acc); }
+  static Vec Max(Vec x, Vec acc) { return _mm512_max_ps(x, acc); }
+  static Vec MinFinite(Vec x, Vec acc) { return _mm512_mask_min_ps(acc, FiniteMask(x), x, acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return _mm512_mask_max_ps(acc, FiniteMask(x), x, acc); }
+  static __mmask16 FiniteMask(Vec x)
+  {
+    return _mm512_cmp_ps_mask(_mm512_abs_ps(x), _mm512_set1_ps(HUGE_VALF), _CMP_NEQ_UQ);
+  }
+  static DVec LoadStridedAsDouble(const float* ptr, int stride)
+  {
+    return _mm512_cvtps_pd(_mm256_i32gather_ps(ptr, StridedIndex(stride), 4));
+  }
+};
+
+//------------------------------------------------------------------------------
+struct DoubleTraits : DoubleOps
+{
+  using Scalar = double;
+  using Vec = __m512d;
+  static const int Width = 8;
+  static Vec Set1(double value) { return _mm512_set1_pd(value); }
+  static Vec Load(const double* ptr) { return _mm512_loadu_pd(ptr); }
+  static void Store(double* ptr, Vec x) { _mm512_storeu_pd(ptr, x); }
+  static Vec Min(Vec x, Vec acc) { return _mm512_min_pd(x, acc); }
+  static Vec Max(Vec x, Vec acc) { return _mm512_max_pd(x, acc); }
+  static Vec MinFinite(Vec x, Vec acc) { return DoubleOps::DMinFinite(x, acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return DoubleOps::DMaxFinite(x, acc); }
+  static DVec LoadStridedAsDouble(const double* ptr, int stride)
+  {
+    return _mm512_i32gather_pd(StridedIndex(stride), ptr, 8);
+  }
+};
+
+//------------------------------------------------------------------------------
+struct IntTraits : DoubleOps
+{
+  using Scalar = int;
+  using Vec = __m512i;
+  static const int Width = 16;
+  static Vec Set1(int value) { return _mm512_set1_epi32(value); }
+  static Vec Load(const int* ptr) { return _mm512_loadu_si512(ptr); }
+  static void Store(int* ptr, Vec x) { _mm512_storeu_si512(ptr, x); }
+  static Vec Min(Vec x, Vec acc) { return _mm512_min_epi32(x, acc); }
+  static Vec Max(Vec x, Vec acc) { return _mm512_max_epi32(x, acc); }
+  static Vec MinFinite(Vec x, Vec acc) { return _mm512_min_epi32(x, acc); }
+  static Vec MaxFinite(Vec x, Vec acc) { return _mm512_max_epi32(x, acc); }
+  static DVec LoadStridedAsDouble(const int* ptr, int stride)
+  {
+    return _mm512_cvtepi32_pd(_mm256_i32gather_epi32(ptr, StridedIndex(stride), 4));
+  }
+};
+} // anonymous namespace
+
+vtkDataArraySIMDRangeEntryPointsMacro(FloatTraits, DoubleTraits, IntTraits)
+
+} // end namespace avx512
+VTK_ABI_NAMESPACE_END
+} // end namespace vtkDataArrayPrivate
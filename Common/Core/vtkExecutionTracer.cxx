@@ -0,0 +1,397 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkExecutionTracer.h"
+
+#include "SMP/Common/vtkSMPToolsAPI.h" // For vtkSMPToolsAPI::SetTraceParallelRegions
+#include "vtkLogger.h"
+#include "vtkNumberToString.h"
+
+#include "vtksys/FStream.hxx"
+
+#include <atomic>  // For std::atomic
+#include <chrono>  // For std::chrono
+#include <cmath>   // For std::isfinite
+#include <cstdlib> // For std::getenv
+#include <ctime>   // For clock_gettime
+#include <map>     // For std::map
+#include <mutex>   // For std::mutex
+#include <sstream> // For std::ostringstream
+#include <string>  // For std::string
+#include <thread>  // For std::this_thread
+#include <vector>  // For std::vector
+
+#if defined(_WIN32)
+#include "vtkWindows.h"
+#else
+#include <unistd.h> // For getpid
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// Microseconds of CPU time used by the calling thread, or -1 if unknown.
+double GetThreadCPUTime()
+{
+#if defined(_WIN32)
+  FILETIME creation, exit, kernel, user;
+  if (!GetThreadTimes(GetCurrentThread(), &creation, &exit, &kernel, &user))
+  {
+    return -1.0;
+  }
+  // FILETIME values are in units of 100 ns.
+  const auto toTicks = [](const FILETIME& time)
+  { return (static_cast<vtkTypeUInt64>(time.dwHighDateTime) << 32) | time.dwLowDateTime; };
+  return static_cast<double>(toTicks(kernel) + toTicks(user)) / 10.0;
+#elif defined(CLOCK_THREAD_CPUTIME_ID)
+  struct timespec time;
+  if (clock_gettime(CLOCK_THREAD_CPUTIME_ID, &time) != 0)
+  {
+    return -1.0;
+  }
+  return static_cast<double>(time.tv_sec) * 1e6 + static_cast<double>(time.tv_nsec) / 1e3;
+#else
+  return -1.0;
+#endif
+}
+
+//------------------------------------------------------------------------------
+vtkTypeInt64 GetProcessIdentifier()
+{
+#if defined(_WIN32)
+  return static_cast<vtkTypeInt64>(GetCurrentProcessId());
+#else
+  return static_cast<vtkTypeInt64>(getpid());
+#endif
+}
+
+//------------------------------------------------------------------------------
+void WriteJSONString(ostream& os, const std::string& text)
+{
+  static const char* hexDigits = "0123456789abcdef";
+  os << '"';
+  for (const char c : text)
+  {
+    switch (c)
+    {
+      case '"':
+        os << "\\\"";
+        break;
+      case '\\':
+        os << "\\\\";
+        break;
+      case '\n':
+        os << "\\n";
+        break;
+      case '\t':
+        os << "\\t";
+        break;
+      default:
+        if (static_cast<unsigned char>(c) < 0x20)
+        {
+          os << "\\u00" << hexDigits[c >> 4] << hexDigits[c & 0xf];
+        }
+        else
+        {
+          os << c;
+        }
+    }
+  }
+  os << '"';
+}
+
+//------------------------------------------------------------------------------
+// Append a member to the JSON object of the arguments of an event.
+void AppendArgument(std::string& arguments, const char* key, const std::string& jsonValue)
+{
+  std::ostringstream os;
+  if (!arguments.empty())
+  {
+    os << ',';
+  }
+  ::WriteJSONString(os, key);
+  os << ':' << jsonValue;
+  arguments += os.str();
+}
+
+//------------------------------------------------------------------------------
+struct RecordedEvent
+{
+  std::string Name;
+  std::string Category;
+  std::string Arguments;
+  double Start;
+  double Duration;
+  double CPUStart;
+  double CPUDuration;
+  int Thread;
+};
+
+//------------------------------------------------------------------------------
+// The state of the tracer. Allocated once and never deleted since events may
+// be recorded during static destruction.
+class TracerState
+{
+public:
+  static TracerState& Get()
+  {
+    static TracerState* state = new TracerState;
+    return *state;
+  }
+
+  std::atomic<bool> Enabled{ false };
+
+  double GetTime()
+  {
+    return std::chrono::duration<double, std::micro>(
+      std::chrono::steady_clock::now() - this->Epoch)
+      .count();
+  }
+
+  void Add(RecordedEvent&& event)
+  {
+    const std::thread::id threadId = std::this_thread::get_id();
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto inserted = this->Threads.emplace(threadId, static_cast<int>(this->Threads.size()) + 1);
+    if (inserted.second)
+    {
+      const std::string name = vtkLogger::GetThreadName();
+      this->ThreadNames.emplace_back(
+        inserted.first->second, name.empty() || name == "N/A" ? std::string() : name);
+    }
+    event.Thread = inserted.first->second;
+    this->Events.push_back(std::move(event));
+  }
+
+  void Clear()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Events.clear();
+  }
+
+  vtkIdType GetNumberOfEvents()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    return static_cast<vtkIdType>(this->Events.size());
+  }
+
+  void Write(ostream& os)
+  {
+    const vtkTypeInt64 pid = ::GetProcessIdentifier();
+    const std::ios::fmtflags flags = os.flags();
+    const std::streamsize precision = os.precision();
+    os.setf(std::ios::fixed, std::ios::floatfield);
+    os.precision(3);
+
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    os << "{\"traceEvents\":[\n";
+    os << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << pid
+       << ",\"args\":{\"name\":\"VTK\"}}";
+    for (const auto& thread : this->ThreadNames)
+    {
+      if (!thread.second.empty())
+      {
+        os << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":" << pid
+           << ",\"tid\":" << thread.first << ",\"args\":{\"name\":";
+        ::WriteJSONString(os, thread.second);
+        os << "}}";
+      }
+    }
+    for (const RecordedEvent& event : this->Events)
+    {
+      os << ",\n{\"name\":";
+      ::WriteJSONString(os, event.Name);
+      os << ",\"cat\":";
+      ::WriteJSONString(os, event.Category);
+      os << ",\"ph\":\"X\",\"pid\":" << pid << ",\"tid\":" << event.Thread
+         << ",\"ts\":" << event.Start << ",\"dur\":" << event.Duration;
+      if (event.CPUStart >= 0.0 && event.CPUDuration >= 0.0)
+      {
+        os << ",\"tts\":" << event.CPUStart << ",\"tdur\":" << event.CPUDuration;
+      }
+      os << ",\"args\":{" << event.Arguments << "}}";
+    }
+    os << "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+private:
+  TracerState() = default;
+
+  const std::chrono::steady_clock::time_point Epoch = std::chrono::steady_clock::now();
+  std::mutex Mutex;
+  std::vector<RecordedEvent> Events;
+  std::map<std::thread::id, int> Threads;
+  std::vector<std::pair<int, std::string>> ThreadNames;
+};
+
+//------------------------------------------------------------------------------
+// Enables tracing when VTK_EXECUTION_TRACE is set, and writes the trace to the
+// file it names when the library is unloaded.
+class vtkExecutionTracerEnvironment
+{
+public:
+  vtkExecutionTracerEnvironment()
+  {
+    const char* fileName = std::getenv("VTK_EXECUTION_TRACE");
+    if (fileName && *fileName)
+    {
+      this->FileName = fileName;
+      vtkExecutionTracer::SetEnabled(true);
+    }
+  }
+
+  ~vtkExecutionTracerEnvironment()
+  {
+    if (!this->FileName.empty())
+    {
+      vtkExecutionTracer::WriteTrace(this->FileName.c_str());
+    }
+  }
+
+private:
+  std::string FileName;
+};
+
+vtkExecutionTracerEnvironment ExecutionTracerEnvironment;
+}
+
+//------------------------------------------------------------------------------
+struct vtkExecutionTracer::Scope::EventData
+{
+  RecordedEvent Event;
+};
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::Scope::Begin(const char* name, const char* category)
+{
+  this->End();
+  TracerState& state = TracerState::Get();
+  if (!state.Enabled.load(std::memory_order_relaxed))
+  {
+    return;
+  }
+  this->Event = new EventData;
+  RecordedEvent& event = this->Event->Event;
+  event.Name = name ? name : "";
+  event.Category = category ? category : "";
+  event.CPUStart = ::GetThreadCPUTime();
+  event.Start = state.GetTime();
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::Scope::End()
+{
+  if (!this->Event)
+  {
+    return;
+  }
+  TracerState& state = TracerState::Get();
+  RecordedEvent& event = this->Event->Event;
+  event.Duration = state.GetTime() - event.Start;
+  const double cpuEnd = event.CPUStart >= 0.0 ? ::GetThreadCPUTime() : -1.0;
+  event.CPUDuration = cpuEnd >= 0.0 ? cpuEnd - event.CPUStart : -1.0;
+  // Events ending after tracing was disabled are still recorded so that
+  // enclosing events are complete.
+  state.Add(std::move(event));
+  delete this->Event;
+  this->Event = nullptr;
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::Scope::AddArgument(const char* key, const char* value)
+{
+  if (!this->Event || !key)
+  {
+    return;
+  }
+  std::ostringstream os;
+  ::WriteJSONString(os, value ? value : "");
+  ::AppendArgument(this->Event->Event.Arguments, key, os.str());
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::Scope::AddArgument(const char* key, double value)
+{
+  if (!this->Event || !key)
+  {
+    return;
+  }
+  vtkNumberToString converter;
+  if (!std::isfinite(value))
+  {
+    // Not representable as a JSON number.
+    this->AddArgument(key, converter.Convert(value).c_str());
+    return;
+  }
+  ::AppendArgument(this->Event->Event.Arguments, key, converter.Convert(value));
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::Scope::AddArgument(const char* key, vtkTypeInt64 value)
+{
+  if (!this->Event || !key)
+  {
+    return;
+  }
+  ::AppendArgument(this->Event->Event.Arguments, key, std::to_string(value));
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::SetEnabled(bool enabled)
+{
+  TracerState::Get().Enabled = enabled;
+  vtk::detail::smp::vtkSMPToolsAPI::SetTraceParallelRegions(enabled);
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionTracer::GetEnabled()
+{
+  return TracerState::Get().Enabled.load(std::memory_order_relaxed);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::Clear()
+{
+  TracerState::Get().Clear();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkExecutionTracer::GetNumberOfEvents()
+{
+  return TracerState::Get().GetNumberOfEvents();
+}
+
+//------------------------------------------------------------------------------
+bool vtkExecutionTracer::WriteTrace(const char* fileName)
+{
+  if (!fileName)
+  {
+    return false;
+  }
+  vtksys::ofstream file(fileName, std::ios::out | std::ios::binary);
+  if (!file)
+  {
+    vtkGenericWarningMacro("Cannot open " << fileName << " to write the execution trace.");
+    return false;
+  }
+  vtkExecutionTracer::WriteTrace(file);
+  return static_cast<bool>(file);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::WriteTrace(ostream& os)
+{
+  TracerState::Get().Write(os);
+}
+
+//------------------------------------------------------------------------------
+void vtkExecutionTracer::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Enabled: " << vtkExecutionTracer::GetEnabled() << "\n";
+  os << indent << "NumberOfEvents: " << vtkExecutionTracer::GetNumberOfEvents() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,148 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkExecutionTracer
+ * @brief   record timed events and export them as a Chrome trace.
+ *
+ * vtkExecutionTracer is an opt-in, process wide recorder of timed events that
+ * can be written in the Chrome trace event format, which is read by
+ * `chrome://tracing`, https://ui.perfetto.dev and `speedscope`. When enabled,
+ * VTK records:
+ *
+ * - every pass of a request through an algorithm (REQUEST_DATA_OBJECT,
+ *   REQUEST_INFORMATION, REQUEST_UPDATE_EXTENT, REQUEST_DATA, ...) made by
+ *   the executives, with the wall and CPU time spent in the algorithm, the
+ *   thread and, for REQUEST_DATA, the memory size of the outputs;
+ * - the parallel regions started by vtkSMPTools::For, with the range and
+ *   grain and the SMP backend used.
+ *
+ * Applications and algorithms can add their own events with
+ * vtkExecutionTracer::Scope.
+ *
+ * @code{.cpp}
+ * vtkExecutionTracer::SetEnabled(true);
+ * filter->Update();
+ * vtkExecutionTracer::WriteTrace("pipeline.json");
+ * @endcode
+ *
+ * Tracing can also be enabled without modifying an application by setting the
+ * `VTK_EXECUTION_TRACE` environment variable to the name of the file where the
+ * events are written when the process exits.
+ *
+ * Recording is thread safe. When tracing is disabled, the cost of a scope is
+ * the check of an atomic flag.
+ *
+ * @sa
+ * vtkLogger vtkExecutive vtkSMPTools
+ */
+
+#ifndef vtkExecutionTracer_h
+#define vtkExecutionTracer_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkExecutionTracer : public vtkObject
+{
+public:
+  vtkTypeMacro(vtkExecutionTracer, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  ///@{
+  /**
+   * Enable/disable the recording of events. Disabled by default, unless the
+   * `VTK_EXECUTION_TRACE` environment variable is set.
+   */
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled();
+  ///@}
+
+  /**
+   * Discard the recorded events.
+   */
+  static void Clear();
+
+  /**
+   * Return the number of events recorded since the last call to Clear().
+   */
+  static vtkIdType GetNumberOfEvents();
+
+  ///@{
+  /**
+   * Write the recorded events as a Chrome trace JSON document. Timestamps are
+   * in microseconds since the first use of the tracer. Return false if the file
+   * cannot be written.
+   */
+  static bool WriteTrace(VTK_FILEPATH const char* fileName);
+  static void WriteTrace(ostream& os);
+  ///@}
+
+  /**
+   * An event that lasts for the lifetime of the scope object, or until End()
+   * is called. Nothing is recorded if tracing is disabled when the event
+   * begins.
+   *
+   * @code{.cpp}
+   * {
+   *   vtkExecutionTracer::Scope scope("BuildLocator", "locators");
+   *   scope.AddArgument("cells", numberOfCells);
+   *   // ...
+   * }
+   * @endcode
+   */
+  class VTKCOMMONCORE_EXPORT Scope
+  {
+  public:
+    Scope() = default;
+    Scope(const char* name, const char* category) { this->Begin(name, category); }
+    ~Scope() { this->End(); }
+
+    /**
+     * Start the event, ending the previous one if any.
+     */
+    void Begin(const char* name, const char* category);
+
+    /**
+     * Record the event. Called by the destructor.
+     */
+    void End();
+
+    /**
+     * Return true if the event is being recorded.
+     */
+    bool IsActive() const { return this->Event != nullptr; }
+
+    ///@{
+    /**
+     * Attach a named value to the event, shown in the details of the event by
+     * trace viewers. Ignored if the event is not active.
+     */
+    void AddArgument(const char* key, const char* value);
+    void AddArgument(const char* key, double value);
+    void AddArgument(const char* key, vtkTypeInt64 value);
+    void AddArgument(const char* key, int value)
+    {
+      this->AddArgument(key, static_cast<vtkTypeInt64>(value));
+    }
+    ///@}
+
+  private:
+    Scope(const Scope&) = delete;
+    void operator=(const Scope&) = delete;
+
+    struct EventData;
+    EventData* Event = nullptr;
+  };
+
+protected:
+  vtkExecutionTracer() = default;
+  ~vtkExecutionTracer() override = default;
+
+private:
+  vtkExecutionTracer(const vtkExecutionTracer&) = delete;
+  void operator=(const vtkExecutionTracer&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkExpressionArray_h
+#define vtkExpressionArray_h
+
+#include "vtkExpressionImplicitBackend.h" // for the array backend
+#include "vtkImplicitArray.h"
+
+/**
+ * \var vtkExpressionArray
+ * \brief A utility alias for an implicit array whose values are computed from a
+ * `vtkArrayExpression` over other arrays
+ *
+ * Filters producing simple derived fields (norms, dot products, elevations...) can output
+ * expression arrays instead of computing and storing the values. When such an array is an operand
+ * of another expression, the expressions are fused, so that a chain of such filters does not store
+ * any intermediate values. A consumer that needs all the values at once should prefer
+ * `vtkArrayExpression::Evaluate`, which evaluates the fused expression block by block and in
+ * parallel, to a generic deep copy of the array.
+ *
+ * An example of potential usage:
+ * ```
+ * vtkArrayExpression dot = vtkArrayExpression::Dot(
+ *   vtkArrayExpression::Array(normals), vtkArrayExpression::Array(vectors));
+ * vtkNew<vtkExpressionArray<float>> dotArray;
+ * dotArray->ConstructBackend(dot);
+ * dotArray->SetNumberOfComponents(dot.GetNumberOfComponents());
+ * dotArray->SetNumberOfTuples(dot.GetNumberOfTuples());
+ *
+ * vtkNew<vtkFloatArray> materialized;
+ * dotArray->GetBackend()->Expression.Evaluate(materialized);
+ * ```
+ *
+ * @sa
+ * vtkArrayExpression vtkExpressionImplicitBackend vtkImplicitArray
+ */
+
+VTK_ABI_NAMESPACE_BEGIN
+template <typename T>
+using vtkExpressionArray = vtkImplicitArray<vtkExpressionImplicitBackend<T>>;
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkExpressionArray_h
@@ -0,0 +1,99 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkExpressionImplicitBackend_h
+#define vtkExpressionImplicitBackend_h
+
+/**
+ * \struct vtkExpressionImplicitBackend
+ * \brief A backend for the `vtkImplicitArray` framework computing its values from a
+ * `vtkArrayExpression`
+ *
+ * The values are computed in double precision when accessed and cast to the value type of the
+ * array. The backend stores no values: its memory size is the one of the arrays the expression
+ * refers to.
+ *
+ * An example of potential usage in a `vtkImplicitArray`:
+ * ```
+ * vtkArrayExpression norm = vtkArrayExpression::Norm(vtkArrayExpression::Array(vectors));
+ * vtkNew<vtkImplicitArray<vtkExpressionImplicitBackend<float>>> normArray; // More compact with
+ *                                                                          // `vtkExpressionArray`
+ * normArray->ConstructBackend(norm);
+ * normArray->SetNumberOfComponents(1);
+ * normArray->SetNumberOfTuples(vectors->GetNumberOfTuples());
+ * ```
+ *
+ * @sa
+ * vtkArrayExpression vtkExpressionArray vtkImplicitArray
+ */
+
+#include "vtkArrayExpression.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+template <typename ValueType>
+struct vtkExpressionImplicitBackend final
+{
+  /**
+   * Constructor
+   * @param expression the expression computing the values of the array
+   */
+  vtkExpressionImplicitBackend(const vtkArrayExpression& expression)
+    : Expression(expression)
+    , NumberOfComponents(expression.IsValid() ? expression.GetNumberOfComponents() : 1)
+  {
+  }
+
+  /**
+   * Compute the value at the given AOS index.
+   */
+  ValueType operator()(int idx) const
+  {
+    const int tupleIdx = idx / this->NumberOfComponents;
+    return static_cast<ValueType>(
+      this->Expression.EvaluateComponent(tupleIdx, idx - tupleIdx * this->NumberOfComponents));
+  }
+
+  /**
+   * Compute a component of a tuple.
+   */
+  ValueType mapComponent(int tupleIdx, int comp) const
+  {
+    return static_cast<ValueType>(this->Expression.EvaluateComponent(tupleIdx, comp));
+  }
+
+  /**
+   * Compute all the components of a tuple.
+   */
+  void mapTuple(int tupleIdx, ValueType* tuple) const
+  {
+    double values[16];
+    if (this->NumberOfComponents > 16)
+    {
+      for (int comp = 0; comp < this->NumberOfComponents; ++comp)
+      {
+        tuple[comp] = this->mapComponent(tupleIdx, comp);
+      }
+      return;
+    }
+    this->Expression.EvaluateTuple(tupleIdx, values);
+    for (int comp = 0; comp < this->NumberOfComponents; ++comp)
+    {
+      tuple[comp] = static_cast<ValueType>(values[comp]);
+    }
+  }
+
+  /**
+   * Returns the memory size in KiB of the arrays the expression refers to.
+   */
+  unsigned long getMemorySize() const { return this->Expression.GetActualMemorySize(); }
+
+  /**
+   * The expression computing the values.
+   */
+  const vtkArrayExpression Expression;
+
+private:
+  const int NumberOfComponents;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkExpressionImplicitBackend_h
@@ -304,4 +304,17 @@ void vtkIdList::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Number of Ids: " << this->NumberOfIds << "\n";
 }
+
+//------------------------------------------------------------------------------
+void vtkObjectPoolTraits<vtkIdList>::Recycle(vtkIdList* ids)
+{
+  if (!ids->ManageMemory || ids->Size > 65536)
+  {
+    ids->Initialize();
+  }
+  else
+  {
+    ids->Reset();
+  }
+}
 VTK_ABI_NAMESPACE_END
@@ -14,9 +14,33 @@
 
 #include "vtkCommonCoreModule.h" // For export macro
 #include "vtkObject.h"
+#include "vtkObjectPool.h"    // For vtkObjectPoolTraits
 #include "vtkWrappingHints.h" // For VTK_MARSHALAUTO
 
 VTK_ABI_NAMESPACE_BEGIN
+class vtkIdList;
+
+#ifndef __VTK_WRAP__
+/**
+ * Id lists are poolable, see vtkObjectPool. Recycled lists are reset and keep
+ * their memory, unless it was set with SetArray() or holds more than 65536
+ * ids.
+ */
+template <>
+struct VTKCOMMONCORE_EXPORT vtkObjectPoolTraits<vtkIdList> : std::true_type
+{
+  static void Recycle(vtkIdList* ids);
+};
+
+/**
+ * Thread local id lists are pooled by vtkSMPThreadLocalObject.
+ */
+template <>
+struct vtkObjectPoolThreadLocalTraits<vtkIdList> : std::true_type
+{
+};
+#endif
+
 class VTKCOMMONCORE_EXPORT VTK_MARSHALAUTO vtkIdList : public vtkObject
 {
 public:
@@ -202,6 +226,8 @@ protected:
   bool ManageMemory;
 
 private:
+  friend struct vtkObjectPoolTraits<vtkIdList>;
+
   vtkIdList(const vtkIdList&) = delete;
   void operator=(const vtkIdList&) = delete;
 };
@@ -0,0 +1,347 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkIndexedHeap
+ * @brief   an indexed d-ary min heap of ids with changeable priorities
+ *
+ * vtkIndexedHeap keeps a set of non-negative ids (e.g., point, edge or cell
+ * ids) ordered by priority, where the id at the top of the heap has the
+ * smallest priority. Like vtkPriorityQueue, the heap maps each id to its
+ * location, so that the priority of any id can be queried, changed or the id
+ * deleted in O(log n).
+ *
+ * Compared to vtkPriorityQueue, the heap is a template on the type of the
+ * priorities and on the number of children of each node (4 by default). A
+ * 4-ary heap is half as deep as a binary heap, and the children of a node are
+ * contiguous in memory, so that finding the smallest child of a node reads one
+ * or two cache lines. Popping the top is then cheaper, and inserting or
+ * decreasing a priority, which moves items towards the top, is cheaper still.
+ * UpdatePriority() increases or decreases the priority of an id in place
+ * instead of deleting and reinserting it, and Build() heapifies a set of
+ * items in O(n), which is faster than inserting them one by one.
+ *
+ * Items of equal priority are ordered by increasing id, so that the order in
+ * which ids are popped does not depend on the order of the insertions nor on
+ * the arity of the heap.
+ *
+ * This class is not a vtkObject: it is meant to be used by value as a member
+ * or a local variable of algorithms. It is not thread-safe.
+ *
+ * @sa
+ * vtkPriorityQueue
+ */
+
+#ifndef vtkIndexedHeap_h
+#define vtkIndexedHeap_h
+
+#include "vtkSystemIncludes.h"
+
+#include <algorithm> // For std::min, std::max
+#include <limits>    // For std::numeric_limits
+#include <vector>    // For std::vector
+
+VTK_ABI_NAMESPACE_BEGIN
+template <typename PriorityT = double, int Arity = 4>
+class vtkIndexedHeap
+{
+  static_assert(Arity >= 2, "A heap node has at least two children.");
+
+public:
+  using PriorityType = PriorityT;
+
+  /**
+   * Reserve memory for the given number of items, with ids lower than this
+   * number. The heap grows as needed when more items or larger ids are
+   * inserted.
+   */
+  void Allocate(vtkIdType numberOfIds)
+  {
+    this->Items.reserve(numberOfIds);
+    if (static_cast<vtkIdType>(this->Locations.size()) < numberOfIds)
+    {
+      this->Locations.resize(numberOfIds, -1);
+    }
+  }
+
+  /**
+   * Empty the heap but without releasing memory.
+   */
+  void Reset()
+  {
+    for (const Item& item : this->Items)
+    {
+      this->Locations[item.Id] = -1;
+    }
+    this->Items.clear();
+  }
+
+  /**
+   * Empty the heap and release its memory.
+   */
+  void Initialize()
+  {
+    std::vector<Item>().swap(this->Items);
+    std::vector<vtkIdType>().swap(this->Locations);
+  }
+
+  /**
+   * Return the number of items in the heap.
+   */
+  vtkIdType GetNumberOfItems() const { return static_cast<vtkIdType>(this->Items.size()); }
+
+  /**
+   * Return true when the heap holds no item.
+   */
+  bool IsEmpty() const { return this->Items.empty(); }
+
+  /**
+   * Return true if the id is in the heap.
+   */
+  bool Contains(vtkIdType id) const { return this->GetLocation(id) >= 0; }
+
+  /**
+   * Get the priority of an id. Returns the maximum value of PriorityType if
+   * the id is not in the heap.
+   */
+  PriorityType GetPriority(vtkIdType id) const
+  {
+    const vtkIdType location = this->GetLocation(id);
+    return location >= 0 ? this->Items[location].Priority : MaximumPriority();
+  }
+
+  /**
+   * Insert an id with the priority specified. Nothing is done and false is
+   * returned if the id is already in the heap.
+   */
+  bool Insert(PriorityType priority, vtkIdType id)
+  {
+    if (this->Contains(id))
+    {
+      return false;
+    }
+    if (id >= static_cast<vtkIdType>(this->Locations.size()))
+    {
+      this->Locations.resize(
+        std::max(static_cast<size_t>(id + 1), 2 * this->Locations.size()), -1);
+    }
+    this->Items.push_back(Item{ priority, id });
+    this->SiftUp(this->GetNumberOfItems() - 1);
+    return true;
+  }
+
+  /**
+   * Set the priority of an id, moving it up or down the heap. The id is
+   * inserted if it is not in the heap.
+   */
+  void UpdatePriority(PriorityType priority, vtkIdType id)
+  {
+    const vtkIdType location = this->GetLocation(id);
+    if (location < 0)
+    {
+      this->Insert(priority, id);
+      return;
+    }
+    const Item item{ priority, id };
+    if (Less(item, this->Items[location]))
+    {
+      this->Items[location].Priority = priority;
+      this->SiftUp(location);
+    }
+    else
+    {
+      this->Items[location].Priority = priority;
+      this->SiftDown(location);
+    }
+  }
+
+  ///@{
+  /**
+   * Return the id at the top of the heap, and optionally its priority,
+   * without removing it. Returns -1 if the heap is empty.
+   */
+  vtkIdType Peek(PriorityType& priority) const
+  {
+    if (this->Items.empty())
+    {
+      return -1;
+    }
+    priority = this->Items[0].Priority;
+    return this->Items[0].Id;
+  }
+  vtkIdType Peek() const { return this->Items.empty() ? -1 : this->Items[0].Id; }
+  ///@}
+
+  ///@{
+  /**
+   * Remove the id at the top of the heap and return it, and optionally its
+   * priority. Returns -1 if the heap is empty.
+   */
+  vtkIdType Pop(PriorityType& priority)
+  {
+    if (this->Items.empty())
+    {
+      return -1;
+    }
+    priority = this->Items[0].Priority;
+    return this->RemoveAt(0);
+  }
+  vtkIdType Pop()
+  {
+    PriorityType priority;
+    return this->Pop(priority);
+  }
+  ///@}
+
+  /**
+   * Delete an id from the heap. Returns the priority of the id, or the maximum
+   * value of PriorityType if the id is not in the heap.
+   */
+  PriorityType DeleteId(vtkIdType id)
+  {
+    const vtkIdType location = this->GetLocation(id);
+    if (location < 0)
+    {
+      return MaximumPriority();
+    }
+    const PriorityType priority = this->Items[location].Priority;
+    this->RemoveAt(location);
+    return priority;
+  }
+
+  /**
+   * Replace the content of the heap by a set of items, in O(n). The ids are
+   * given by the ids array, or are 0 to numberOfItems - 1 when ids is
+   * nullptr. The ids must be unique.
+   */
+  void Build(
+    vtkIdType numberOfItems, const PriorityType* priorities, const vtkIdType* ids = nullptr)
+  {
+    this->Reset();
+    this->Items.resize(numberOfItems);
+    vtkIdType maxId = numberOfItems - 1;
+    for (vtkIdType i = 0; i < numberOfItems; ++i)
+    {
+      this->Items[i].Priority = priorities[i];
+      this->Items[i].Id = ids ? ids[i] : i;
+      maxId = std::max(maxId, this->Items[i].Id);
+    }
+    if (maxId >= static_cast<vtkIdType>(this->Locations.size()))
+    {
+      this->Locations.resize(maxId + 1, -1);
+    }
+    for (vtkIdType i = 0; i < numberOfItems; ++i)
+    {
+      this->Locations[this->Items[i].Id] = i;
+    }
+    // Sift down every node that has children, from the bottom of the heap
+    for (vtkIdType i = (numberOfItems - 2) / Arity; i >= 0 && numberOfItems > 1; --i)
+    {
+      this->SiftDown(i);
+    }
+  }
+
+private:
+  struct Item
+  {
+    PriorityType Priority;
+    vtkIdType Id;
+  };
+
+  static PriorityType MaximumPriority() { return std::numeric_limits<PriorityType>::max(); }
+
+  static bool Less(const Item& a, const Item& b)
+  {
+    return a.Priority < b.Priority || (a.Priority == b.Priority && a.Id < b.Id);
+  }
+
+  vtkIdType GetLocation(vtkIdType id) const
+  {
+    return (id >= 0 && id < static_cast<vtkIdType>(this->Locations.size())) ? this->Locations[id]
+                                                                            : -1;
+  }
+
+  // Remove the item at the given location and return its id.
+  vtkIdType RemoveAt(vtkIdType location)
+  {
+    const vtkIdType id = this->Items[location].Id;
+    this->Locations[id] = -1;
+    const Item last = this->Items.back();
+    this->Items.pop_back();
+    if (location < this->GetNumberOfItems())
+    {
+      // Move the last item to the hole, then up or down the heap
+      this->Items[location] = last;
+      this->Locations[last.Id] = location;
+      if (location > 0 && Less(last, this->Items[(location - 1) / Arity]))
+      {
+        this->SiftUp(location);
+      }
+      else
+      {
+        this->SiftDown(location);
+      }
+    }
+    return id;
+  }
+
+  // Move the item at the given location towards the top until its parent is smaller.
+  void SiftUp(vtkIdType location)
+  {
+    const Item item = this->Items[location];
+    while (location > 0)
+    {
+      const vtkIdType parent = (location - 1) / Arity;
+      if (!Less(item, this->Items[parent]))
+      {
+        break;
+      }
+      this->Items[location] = this->Items[parent];
+      this->Locations[this->Items[location].Id] = location;
+      location = parent;
+    }
+    this->Items[location] = item;
+    this->Locations[item.Id] = location;
+  }
+
+  // Move the item at the given location towards the bottom until its children are larger.
+  void SiftDown(vtkIdType location)
+  {
+    const vtkIdType numberOfItems = this->GetNumberOfItems();
+    const Item item = this->Items[location];
+    for (;;)
+    {
+      const vtkIdType firstChild = Arity * location + 1;
+      if (firstChild >= numberOfItems)
+      {
+        break;
+      }
+      const vtkIdType lastChild = std::min(firstChild + Arity, numberOfItems);
+      vtkIdType smallest = firstChild;
+      for (vtkIdType child = firstChild + 1; child < lastChild; ++child)
+      {
+        if (Less(this->Items[child], this->Items[smallest]))
+        {
+          smallest = child;
+        }
+      }
+      if (!Less(this->Items[smallest], item))
+      {
+        break;
+      }
+      this->Items[location] = this->Items[smallest];
+      this->Locations[this->Items[location].Id] = location;
+      location = smallest;
+    }
+    this->Items[location] = item;
+    this->Locations[item.Id] = location;
+  }
+
+  std::vector<Item> Items;
+  // Locations[id] is the location of id in Items, or -1.
+  std::vector<vtkIdType> Locations;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif // vtkIndexedHeap_h
+
+// VTK-HeaderTest-Exclude: vtkIndexedHeap.h
@@ -7,9 +7,11 @@
 #include "vtkMath.h"
 #include "vtkMathConfigure.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkVariantArray.h"
 
+#include <algorithm>
 #include <cassert>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -795,264 +797,144 @@ namespace
 {
 
 //------------------------------------------------------------------------------
-template <class T>
-void vtkLookupTableMapData(vtkLookupTable* self, T* input, unsigned char* output, int length,
-  int inIncr, int outFormat, TableParameters& p)
-{
-  int i = length;
-  const double* range = self->GetTableRange();
-  const unsigned char* cptr;
-
-  // Resize the internal table to hold the special colors at the
-  // end. When this function is called repeatedly with the same size
-  // lookup table, memory reallocation will be done only one the first
-  // call if at all.
+// Values are mapped in blocks: the table indices of a block are computed
+// first, in a loop free of the output format and alpha branches, then the
+// colors of the block are copied to the output.
+constexpr vtkIdType vtkLookupTableBlockSize = 256;
 
-  vtkUnsignedCharArray* lookupTable = self->GetTable();
+// Smaller sets of values are mapped by the calling thread.
+constexpr vtkIdType vtkLookupTableGrainSize = 65536;
 
-  const unsigned char* table = lookupTable->GetPointer(0);
+//------------------------------------------------------------------------------
+// Luminance of a table color, use coeffs of (0.30  0.59  0.11)
+inline unsigned char vtkLookupTableLuminance(const unsigned char* cptr)
+{
+  return static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
+}
 
-  double alpha = self->GetAlpha();
-  if (alpha >= 1.0) // no blending required
+//------------------------------------------------------------------------------
+// Copy the table colors of a block of indices to the output, blending the
+// table opacity with alpha when alpha is less than one.
+void vtkLookupTableCopyColors(const unsigned char* table, const vtkIdType* indices,
+  vtkIdType count, double alpha, int outFormat, unsigned char* output)
+{
+  const bool blend = alpha < 1.0;
+  switch (outFormat)
   {
-    if (self->GetScale() == VTK_SCALE_LOG10)
-    {
-      double val;
-      double logRange[2];
-      vtkLookupTableLogRange(range, logRange);
-      vtkLookupShiftAndScale(logRange, p.NumColors, p.Shift, p.Scale);
-      p.Range[0] = logRange[0];
-      p.Range[1] = logRange[1];
-
-      if (outFormat == VTK_RGBA)
+    case VTK_RGBA:
+      for (vtkIdType i = 0; i < count; ++i, output += 4)
       {
-        while (--i >= 0)
+        const unsigned char* cptr = table + 4 * indices[i];
+        memcpy(output, cptr, 4);
+        if (blend)
         {
-          val = vtkApplyLogScale(*input, range, logRange);
-          vtkIdType idx = vtkLinearLookup(val, p);
-          cptr = table + 4 * idx;
-          memcpy(output, cptr, 4);
-          input += inIncr;
-          output += 4;
+          output[3] = static_cast<unsigned char>(cptr[3] * alpha + 0.5);
         }
       }
-      else if (outFormat == VTK_RGB)
+      break;
+    case VTK_RGB:
+      for (vtkIdType i = 0; i < count; ++i, output += 3)
       {
-        while (--i >= 0)
-        {
-          val = vtkApplyLogScale(*input, range, logRange);
-          vtkIdType idx = vtkLinearLookup(val, p);
-          cptr = table + 4 * idx;
-          memcpy(output, cptr, 3);
-          input += inIncr;
-          output += 3;
-        }
+        memcpy(output, table + 4 * indices[i], 3);
       }
-      else if (outFormat == VTK_LUMINANCE_ALPHA)
+      break;
+    case VTK_LUMINANCE_ALPHA:
+      for (vtkIdType i = 0; i < count; ++i, output += 2)
       {
-        while (--i >= 0)
-        {
-          val = vtkApplyLogScale(*input, range, logRange);
-          vtkIdType idx = vtkLinearLookup(val, p);
-          cptr = table + 4 * idx;
-          output[0] =
-            static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
-          output[1] = cptr[3];
-          input += inIncr;
-          output += 2;
-        }
+        const unsigned char* cptr = table + 4 * indices[i];
+        output[0] = vtkLookupTableLuminance(cptr);
+        output[1] = blend ? static_cast<unsigned char>(cptr[3] * alpha + 0.5) : cptr[3];
       }
-      else // outFormat == VTK_LUMINANCE
+      break;
+    default: // VTK_LUMINANCE
+      for (vtkIdType i = 0; i < count; ++i)
       {
-        while (--i >= 0)
-        {
-          val = vtkApplyLogScale(*input, range, logRange);
-          vtkIdType idx = vtkLinearLookup(val, p);
-          cptr = table + 4 * idx;
-          *output++ =
-            static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
-          input += inIncr;
-        }
+        output[i] = vtkLookupTableLuminance(table + 4 * indices[i]);
       }
-    } // if log scale
+      break;
+  }
+}
 
-    else // not log scale
-    {
-      vtkLookupShiftAndScale(range, p.NumColors, p.Shift, p.Scale);
-      p.Range[0] = range[0];
-      p.Range[1] = range[1];
-      if (outFormat == VTK_RGBA)
-      {
-        while (--i >= 0)
-        {
-          vtkIdType idx = vtkLinearLookup(*input, p);
-          cptr = table + 4 * idx;
-          memcpy(output, cptr, 4);
-          input += inIncr;
-          output += 4;
-        }
-      }
-      else if (outFormat == VTK_RGB)
-      {
-        while (--i >= 0)
-        {
-          vtkIdType idx = vtkLinearLookup(*input, p);
-          cptr = table + 4 * idx;
-          memcpy(output, cptr, 3);
-          input += inIncr;
-          output += 3;
-        }
-      }
-      else if (outFormat == VTK_LUMINANCE_ALPHA)
-      {
-        while (--i >= 0)
-        {
-          vtkIdType idx = vtkLinearLookup(*input, p);
-          cptr = table + 4 * idx;
-          output[0] =
-            static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
-          output[1] = cptr[3];
-          input += inIncr;
-          output += 2;
-        }
-      }
-      else // outFormat == VTK_LUMINANCE
-      {
-        while (--i >= 0)
-        {
-          vtkIdType idx = vtkLinearLookup(*input, p);
-          cptr = table + 4 * idx;
-          *output++ =
-            static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
-          input += inIncr;
-        }
-      }
-    } // if not log lookup
-  }   // if blending not needed
+//------------------------------------------------------------------------------
+// Map a range of values through the table. The table parameters are computed
+// once by vtkLookupTableMapData, so that ranges can be mapped concurrently.
+template <class T>
+struct vtkLookupTableMapFunctor
+{
+  const T* Input;
+  int InputIncrement;
+  unsigned char* Output;
+  int OutputFormat;
+  const unsigned char* Table;
+  double Alpha;
+  bool LogScale;
+  double Range[2];
+  double LogRange[2];
+  TableParameters Parameters;
 
-  else // blend with the specified alpha
+  void operator()(vtkIdType begin, vtkIdType end) const
   {
-    if (self->GetScale() == VTK_SCALE_LOG10)
+    vtkIdType indices[vtkLookupTableBlockSize];
+    for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += vtkLookupTableBlockSize)
     {
-      double val;
-      double logRange[2];
-      vtkLookupTableLogRange(range, logRange);
-      vtkLookupShiftAndScale(logRange, p.NumColors, p.Shift, p.Scale);
-      p.Range[0] = logRange[0];
-      p.Range[1] = logRange[1];
-
-      if (outFormat == VTK_RGBA)
-      {
-        while (--i >= 0)
-        {
-          val = vtkApplyLogScale(*input, range, logRange);
-          vtkIdType idx = vtkLinearLookup(val, p);
-          cptr = table + 4 * idx;
-          output[0] = cptr[0];
-          output[1] = cptr[1];
-          output[2] = cptr[2];
-          output[3] = static_cast<unsigned char>(cptr[3] * alpha + 0.5);
-          input += inIncr;
-          output += 4;
-        }
-      }
-      else if (outFormat == VTK_RGB)
-      {
-        while (--i >= 0)
-        {
-          val = vtkApplyLogScale(*input, range, logRange);
-          vtkIdType idx = vtkLinearLookup(val, p);
-          cptr = table + 4 * idx;
-          memcpy(output, cptr, 3);
-          input += inIncr;
-          output += 3;
-        }
-      }
-      else if (outFormat == VTK_LUMINANCE_ALPHA)
+      const vtkIdType count = std::min(vtkLookupTableBlockSize, end - blockBegin);
+      const T* input = this->Input + blockBegin * this->InputIncrement;
+      const int inIncr = this->InputIncrement;
+      if (this->LogScale)
       {
-        while (--i >= 0)
+        for (vtkIdType i = 0; i < count; ++i)
         {
-          val = vtkApplyLogScale(*input, range, logRange);
-          vtkIdType idx = vtkLinearLookup(val, p);
-          cptr = table + 4 * idx;
-          output[0] =
-            static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
-          output[1] = static_cast<unsigned char>(alpha * cptr[3] + 0.5);
-          input += inIncr;
-          output += 2;
+          const double val = vtkApplyLogScale(input[i * inIncr], this->Range, this->LogRange);
+          indices[i] = vtkLinearLookup(val, this->Parameters);
         }
       }
-      else // outFormat == VTK_LUMINANCE
+      else
       {
-        while (--i >= 0)
+        for (vtkIdType i = 0; i < count; ++i)
         {
-          val = vtkApplyLogScale(*input, range, logRange);
-          vtkIdType idx = vtkLinearLookup(val, p);
-          cptr = table + 4 * idx;
-          *output++ =
-            static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
-          input += inIncr;
+          indices[i] = vtkLinearLookup(input[i * inIncr], this->Parameters);
         }
       }
-    } // log scale with blending
+      vtkLookupTableCopyColors(this->Table, indices, count, this->Alpha, this->OutputFormat,
+        this->Output + blockBegin * this->OutputFormat);
+    }
+  }
+};
 
-    else // no log scale with blending
-    {
-      vtkLookupShiftAndScale(range, p.NumColors, p.Shift, p.Scale);
-      p.Range[0] = range[0];
-      p.Range[1] = range[1];
+//------------------------------------------------------------------------------
+template <class T>
+void vtkLookupTableMapData(vtkLookupTable* self, const T* input, unsigned char* output,
+  vtkIdType length, int inIncr, int outFormat)
+{
+  vtkLookupTableMapFunctor<T> functor;
+  functor.Input = input;
+  functor.InputIncrement = inIncr;
+  functor.Output = output;
+  functor.OutputFormat = outFormat;
+  functor.Table = self->GetTable()->GetPointer(0);
+  functor.Alpha = self->GetAlpha();
+  functor.LogScale = self->GetScale() == VTK_SCALE_LOG10;
 
-      if (outFormat == VTK_RGBA)
-      {
-        while (--i >= 0)
-        {
-          vtkIdType idx = vtkLinearLookup(*input, p);
-          cptr = table + 4 * idx;
-          output[0] = cptr[0];
-          output[1] = cptr[1];
-          output[2] = cptr[2];
-          output[3] = static_cast<unsigned char>(cptr[3] * alpha + 0.5);
-          input += inIncr;
-          output += 4;
-        }
-      }
-      else if (outFormat == VTK_RGB)
-      {
-        while (--i >= 0)
-        {
-          vtkIdType idx = vtkLinearLookup(*input, p);
-          cptr = table + 4 * idx;
-          memcpy(output, cptr, 3);
-          input += inIncr;
-          output += 3;
-        }
-      }
-      else if (outFormat == VTK_LUMINANCE_ALPHA)
-      {
-        while (--i >= 0)
-        {
-          vtkIdType idx = vtkLinearLookup(*input, p);
-          cptr = table + 4 * idx;
-          output[0] =
-            static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
-          output[1] = static_cast<unsigned char>(cptr[3] * alpha + 0.5);
-          input += inIncr;
-          output += 2;
-        }
-      }
-      else // outFormat == VTK_LUMINANCE
-      {
-        while (--i >= 0)
-        {
-          vtkIdType idx = vtkLinearLookup(*input, p);
-          cptr = table + 4 * idx;
-          *output++ =
-            static_cast<unsigned char>(cptr[0] * 0.30 + cptr[1] * 0.59 + cptr[2] * 0.11 + 0.5);
-          input += inIncr;
-        }
-      }
-    } // no log scale
-  }   // alpha blending
+  const double* range = self->GetTableRange();
+  functor.Range[0] = range[0];
+  functor.Range[1] = range[1];
+  TableParameters& p = functor.Parameters;
+  p.NumColors = self->GetNumberOfColors();
+  if (functor.LogScale)
+  {
+    vtkLookupTableLogRange(range, functor.LogRange);
+    vtkLookupShiftAndScale(functor.LogRange, p.NumColors, p.Shift, p.Scale);
+    p.Range[0] = functor.LogRange[0];
+    p.Range[1] = functor.LogRange[1];
+  }
+  else
+  {
+    vtkLookupShiftAndScale(range, p.NumColors, p.Shift, p.Scale);
+    p.Range[0] = range[0];
+    p.Range[1] = range[1];
+  }
+
+  vtkSMPTools::For(0, length, vtkLookupTableGrainSize, functor);
 }
 
 //------------------------------------------------------------------------------
@@ -1224,9 +1106,6 @@ void vtkLookupTable::MapScalarsThroughTable2(void* input, unsigned char* output,
   }
   else
   {
-    TableParameters p;
-    p.NumColors = this->GetNumberOfColors();
-
     switch (inputDataType)
     {
       case VTK_BIT:
@@ -1241,14 +1120,14 @@ void vtkLookupTable::MapScalarsThroughTable2(void* input, unsigned char* output,
           newInput->SetValue(i, bitArray->GetValue(id));
         }
         vtkLookupTableMapData(
-          this, newInput->GetPointer(0), output, numberOfValues, inputIncrement, outputFormat, p);
+          this, newInput->GetPointer(0), output, numberOfValues, inputIncrement, outputFormat);
         newInput->Delete();
         bitArray->Delete();
       }
       break;
 
         vtkTemplateMacro(vtkLookupTableMapData(this, static_cast<VTK_TT*>(input), output,
-          numberOfValues, inputIncrement, outputFormat, p));
+          numberOfValues, inputIncrement, outputFormat));
       default:
         vtkErrorMacro(<< "MapScalarsThroughTable2: Unknown input ScalarType");
         return;
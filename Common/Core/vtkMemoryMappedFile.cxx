@@ -0,0 +1,347 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkMemoryMappedFile.h"
+
+#include "vtkDataArray.h"
+#include "vtkObjectFactory.h"
+
+#include <cstdint> // For SIZE_MAX
+#include <map>     // For std::map
+#include <mutex>   // For std::mutex
+
+#if defined(_WIN32)
+#include "vtkWindows.h"
+#include <vtksys/Encoding.hxx>
+#else
+#include <fcntl.h>    // For open
+#include <sys/mman.h> // For mmap
+#include <sys/stat.h> // For fstat
+#include <unistd.h>   // For close, sysconf
+#endif
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// A range of the address space returned by the system.
+struct Mapping
+{
+  void* Base;
+  std::size_t Length;
+};
+
+//------------------------------------------------------------------------------
+// Mappings in use by arrays, keyed by the pointer given to the array. The
+// buffers of arrays only store a free function, which looks the mapping up to
+// know what to unmap. Allocated once and never deleted since arrays may be
+// released during static destruction.
+class MappingRegistry
+{
+public:
+  static MappingRegistry& Get()
+  {
+    static MappingRegistry* registry = new MappingRegistry;
+    return *registry;
+  }
+
+  void Add(const void* pointer, const Mapping& mapping)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    this->Mappings[pointer] = mapping;
+  }
+
+  bool Remove(const void* pointer, Mapping& mapping)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto it = this->Mappings.find(pointer);
+    if (it == this->Mappings.end())
+    {
+      return false;
+    }
+    mapping = it->second;
+    this->Mappings.erase(it);
+    return true;
+  }
+
+  bool Contains(const void* pointer)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    return this->Mappings.count(pointer) != 0;
+  }
+
+private:
+  std::mutex Mutex;
+  std::map<const void*, Mapping> Mappings;
+};
+
+//------------------------------------------------------------------------------
+// Mapped ranges must start at a multiple of this value.
+vtkTypeInt64 GetMappingGranularity()
+{
+#if defined(_WIN32)
+  SYSTEM_INFO info;
+  GetSystemInfo(&info);
+  return static_cast<vtkTypeInt64>(info.dwAllocationGranularity);
+#else
+  const long pageSize = sysconf(_SC_PAGESIZE);
+  return pageSize > 0 ? static_cast<vtkTypeInt64>(pageSize) : 4096;
+#endif
+}
+
+//------------------------------------------------------------------------------
+void Unmap(const Mapping& mapping)
+{
+#if defined(_WIN32)
+  UnmapViewOfFile(mapping.Base);
+#else
+  munmap(mapping.Base, mapping.Length);
+#endif
+}
+
+//------------------------------------------------------------------------------
+// Free function of the buffers of mapped arrays.
+void FreeMappedRange(void* pointer)
+{
+  Mapping mapping;
+  if (MappingRegistry::Get().Remove(pointer, mapping))
+  {
+    Unmap(mapping);
+  }
+}
+}
+
+//------------------------------------------------------------------------------
+class vtkMemoryMappedFile::vtkInternals
+{
+public:
+#if defined(_WIN32)
+  HANDLE File = INVALID_HANDLE_VALUE;
+  HANDLE ReadOnlyMapping = nullptr;
+  HANDLE CopyOnWriteMapping = nullptr;
+
+  bool IsOpen() const { return this->File != INVALID_HANDLE_VALUE; }
+
+  HANDLE GetMapping(int accessMode)
+  {
+    HANDLE& mapping = accessMode == vtkMemoryMappedFile::READ_ONLY ? this->ReadOnlyMapping
+                                                                   : this->CopyOnWriteMapping;
+    if (!mapping)
+    {
+      const DWORD protection =
+        accessMode == vtkMemoryMappedFile::READ_ONLY ? PAGE_READONLY : PAGE_WRITECOPY;
+      mapping = CreateFileMappingW(this->File, nullptr, protection, 0, 0, nullptr);
+    }
+    return mapping;
+  }
+#else
+  int File = -1;
+
+  bool IsOpen() const { return this->File >= 0; }
+#endif
+
+  bool Map(int accessMode, vtkTypeInt64 offset, std::size_t length, Mapping& mapping)
+  {
+#if defined(_WIN32)
+    HANDLE fileMapping = this->GetMapping(accessMode);
+    if (!fileMapping)
+    {
+      return false;
+    }
+    const DWORD access =
+      accessMode == vtkMemoryMappedFile::READ_ONLY ? FILE_MAP_READ : FILE_MAP_COPY;
+    const auto uoffset = static_cast<vtkTypeUInt64>(offset);
+    mapping.Base = MapViewOfFile(fileMapping, access, static_cast<DWORD>(uoffset >> 32),
+      static_cast<DWORD>(uoffset & 0xffffffff), length);
+    mapping.Length = length;
+    return mapping.Base != nullptr;
+#else
+    const int protection =
+      accessMode == vtkMemoryMappedFile::READ_ONLY ? PROT_READ : (PROT_READ | PROT_WRITE);
+    const int flags = accessMode == vtkMemoryMappedFile::READ_ONLY ? MAP_SHARED : MAP_PRIVATE;
+    void* base = mmap(nullptr, length, protection, flags, this->File, static_cast<off_t>(offset));
+    if (base == MAP_FAILED)
+    {
+      return false;
+    }
+    mapping.Base = base;
+    mapping.Length = length;
+    return true;
+#endif
+  }
+
+  void Close()
+  {
+#if defined(_WIN32)
+    // Views keep a reference on their file mapping, closing the handles does
+    // not affect the arrays.
+    if (this->ReadOnlyMapping)
+    {
+      CloseHandle(this->ReadOnlyMapping);
+      this->ReadOnlyMapping = nullptr;
+    }
+    if (this->CopyOnWriteMapping)
+    {
+      CloseHandle(this->CopyOnWriteMapping);
+      this->CopyOnWriteMapping = nullptr;
+    }
+    if (this->File != INVALID_HANDLE_VALUE)
+    {
+      CloseHandle(this->File);
+      this->File = INVALID_HANDLE_VALUE;
+    }
+#else
+    if (this->File >= 0)
+    {
+      close(this->File);
+      this->File = -1;
+    }
+#endif
+  }
+};
+
+vtkStandardNewMacro(vtkMemoryMappedFile);
+
+//------------------------------------------------------------------------------
+vtkMemoryMappedFile::vtkMemoryMappedFile()
+  : Internals(new vtkInternals)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkMemoryMappedFile::~vtkMemoryMappedFile()
+{
+  this->Internals->Close();
+  delete this->Internals;
+}
+
+//------------------------------------------------------------------------------
+bool vtkMemoryMappedFile::Open(const char* fileName)
+{
+  this->Close();
+  if (!fileName)
+  {
+    vtkErrorMacro("No file name specified.");
+    return false;
+  }
+
+#if defined(_WIN32)
+  HANDLE file = CreateFileW(vtksys::Encoding::ToWindowsExtendedPath(fileName).c_str(),
+    GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+  if (file == INVALID_HANDLE_VALUE)
+  {
+    vtkErrorMacro("Cannot open file " << fileName);
+    return false;
+  }
+  LARGE_INTEGER size;
+  if (!GetFileSizeEx(file, &size))
+  {
+    vtkErrorMacro("Cannot get the size of file " << fileName);
+    CloseHandle(file);
+    return false;
+  }
+  this->Internals->File = file;
+  this->FileSize = static_cast<vtkTypeInt64>(size.QuadPart);
+#else
+  int file = open(fileName, O_RDONLY);
+  if (file < 0)
+  {
+    vtkErrorMacro("Cannot open file " << fileName);
+    return false;
+  }
+  struct stat status;
+  if (fstat(file, &status) != 0)
+  {
+    vtkErrorMacro("Cannot get the size of file " << fileName);
+    close(file);
+    return false;
+  }
+  this->Internals->File = file;
+  this->FileSize = static_cast<vtkTypeInt64>(status.st_size);
+#endif
+
+  this->FileName = fileName;
+  this->Modified();
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryMappedFile::Close()
+{
+  if (this->Internals->IsOpen())
+  {
+    this->Internals->Close();
+    this->FileName.clear();
+    this->FileSize = 0;
+    this->Modified();
+  }
+}
+
+//------------------------------------------------------------------------------
+bool vtkMemoryMappedFile::IsOpen() const
+{
+  return this->Internals->IsOpen();
+}
+
+//------------------------------------------------------------------------------
+const char* vtkMemoryMappedFile::GetFileName() const
+{
+  return this->Internals->IsOpen() ? this->FileName.c_str() : nullptr;
+}
+
+//------------------------------------------------------------------------------
+bool vtkMemoryMappedFile::MapArray(
+  vtkDataArray* array, vtkTypeInt64 offset, vtkIdType numberOfTuples)
+{
+  if (!array || !this->Internals->IsOpen() || offset < 0 || numberOfTuples <= 0 ||
+    array->GetArrayType() != vtkAbstractArray::AoSDataArrayTemplate)
+  {
+    return false;
+  }
+
+  const vtkTypeInt64 valueSize = array->GetDataTypeSize();
+  const vtkIdType numberOfValues = numberOfTuples * array->GetNumberOfComponents();
+  const vtkTypeInt64 size = numberOfValues * valueSize;
+  if (valueSize <= 0 || offset % valueSize != 0 || size < this->MinimumSize ||
+    offset + size > this->FileSize ||
+    static_cast<vtkTypeUInt64>(size) > static_cast<vtkTypeUInt64>(SIZE_MAX))
+  {
+    return false;
+  }
+
+  // Map from the start of the page containing offset.
+  static const vtkTypeInt64 granularity = ::GetMappingGranularity();
+  const vtkTypeInt64 mappingOffset = offset - offset % granularity;
+  const auto length = static_cast<std::size_t>(size + offset - mappingOffset);
+  Mapping mapping;
+  if (!this->Internals->Map(this->AccessMode, mappingOffset, length, mapping))
+  {
+    vtkWarningMacro("Cannot map " << length << " bytes of file " << this->FileName
+                                  << " at offset " << mappingOffset);
+    return false;
+  }
+
+  void* pointer = static_cast<char*>(mapping.Base) + (offset - mappingOffset);
+  MappingRegistry::Get().Add(pointer, mapping);
+  // The array does not own the memory until its free function is set.
+  array->SetVoidArray(pointer, numberOfValues, 1);
+  array->SetArrayFreeFunction(&::FreeMappedRange);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool vtkMemoryMappedFile::IsMapped(const void* pointer)
+{
+  return pointer && MappingRegistry::Get().Contains(pointer);
+}
+
+//------------------------------------------------------------------------------
+void vtkMemoryMappedFile::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "FileName: " << (this->IsOpen() ? this->FileName : "(none)") << "\n";
+  os << indent << "FileSize: " << this->FileSize << "\n";
+  os << indent << "AccessMode: "
+     << (this->AccessMode == READ_ONLY ? "READ_ONLY" : "COPY_ON_WRITE") << "\n";
+  os << indent << "MinimumSize: " << this->MinimumSize << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,140 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkMemoryMappedFile
+ * @brief   give data arrays zero-copy access to the content of a file.
+ *
+ * vtkMemoryMappedFile maps ranges of a file in memory and hands them to
+ * arrays with the standard AOS memory layout, such as vtkFloatArray or
+ * vtkAOSDataArrayTemplate<T>, instead of copying the bytes to heap memory.
+ * The pages of the file are only read when the array values are accessed, and
+ * the operating system can drop them again under memory pressure, which makes
+ * it possible to extract a small part of files larger than the memory.
+ *
+ * A mapped range is owned by the array it is given to, and is unmapped when
+ * the array releases its buffer, so arrays remain valid after the
+ * vtkMemoryMappedFile is closed or deleted. When the array is resized, its
+ * values are copied to regular heap memory.
+ *
+ * Two access modes are supported:
+ * - COPY_ON_WRITE (default): the array can be modified, modified pages are
+ *   privately copied and never written back to the file.
+ * - READ_ONLY: the pages are shared with the file cache and the array must not
+ *   be modified, which crashes the program.
+ *
+ * The bytes are used as they are in the file, so the caller must make sure
+ * that the file stores the values with the native byte order and that the
+ * offset is a multiple of the value size.
+ *
+ * @warning
+ * The file must not be truncated or modified while arrays map it, which
+ * results in undefined values or in a crash when reading the arrays.
+ *
+ * @sa
+ * vtkAOSDataArrayTemplate vtkBuffer
+ */
+
+#ifndef vtkMemoryMappedFile_h
+#define vtkMemoryMappedFile_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <string> // For std::string
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+
+class VTKCOMMONCORE_EXPORT vtkMemoryMappedFile : public vtkObject
+{
+public:
+  static vtkMemoryMappedFile* New();
+  vtkTypeMacro(vtkMemoryMappedFile, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum AccessModes
+  {
+    READ_ONLY = 0,
+    COPY_ON_WRITE = 1
+  };
+
+  /**
+   * Open a file for mapping, closing the previous one if any. Return false if
+   * the file cannot be opened.
+   */
+  bool Open(VTK_FILEPATH const char* fileName);
+
+  /**
+   * Close the file. Arrays that were mapped remain valid.
+   */
+  void Close();
+
+  /**
+   * Return true if a file is open.
+   */
+  bool IsOpen() const;
+
+  /**
+   * Return the name of the open file, or nullptr if no file is open.
+   */
+  VTK_FILEPATH const char* GetFileName() const;
+
+  /**
+   * Return the size of the open file in bytes.
+   */
+  vtkTypeInt64 GetFileSize() const { return this->FileSize; }
+
+  ///@{
+  /**
+   * Set/Get the access mode of the mapped ranges. Default is COPY_ON_WRITE.
+   */
+  vtkSetClampMacro(AccessMode, int, READ_ONLY, COPY_ON_WRITE);
+  vtkGetMacro(AccessMode, int);
+  void SetAccessModeToReadOnly() { this->SetAccessMode(READ_ONLY); }
+  void SetAccessModeToCopyOnWrite() { this->SetAccessMode(COPY_ON_WRITE); }
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the minimum size in bytes of the ranges that MapArray() maps.
+   * Smaller arrays are cheaper to read than to map. Default is 64 KiB.
+   */
+  vtkSetClampMacro(MinimumSize, vtkTypeInt64, 0, VTK_TYPE_INT64_MAX);
+  vtkGetMacro(MinimumSize, vtkTypeInt64);
+  ///@}
+
+  /**
+   * Make @a array use @a numberOfTuples tuples stored in the file starting at
+   * byte @a offset, with the number of components and value type of the
+   * array. Return false and leave the array untouched if the array does not
+   * have the AOS memory layout, if the offset is not a multiple of the value
+   * size, if the range exceeds the file or is smaller than MinimumSize, or if
+   * the mapping fails.
+   */
+  bool MapArray(vtkDataArray* array, vtkTypeInt64 offset, vtkIdType numberOfTuples);
+
+  /**
+   * Return true if @a pointer is the start of a range mapped by MapArray()
+   * that is still in use by an array.
+   */
+  static bool IsMapped(const void* pointer);
+
+protected:
+  vtkMemoryMappedFile();
+  ~vtkMemoryMappedFile() override;
+
+  int AccessMode = COPY_ON_WRITE;
+  vtkTypeInt64 MinimumSize = 65536;
+  vtkTypeInt64 FileSize = 0;
+  std::string FileName;
+
+private:
+  vtkMemoryMappedFile(const vtkMemoryMappedFile&) = delete;
+  void operator=(const vtkMemoryMappedFile&) = delete;
+
+  class vtkInternals;
+  vtkInternals* Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -5,6 +5,7 @@
 #include "vtkDebugLeaks.h"
 #include "vtkDynamicLoader.h"
 #include "vtkObjectFactoryCollection.h"
+#include "vtkObjectPool.h"
 #include "vtkOverrideInformation.h"
 #include "vtkOverrideInformationCollection.h"
 #include "vtkVersion.h"
@@ -305,6 +306,8 @@ void vtkObjectFactory::RegisterFactory(vtkObjectFactory* factory)
 
   vtkObjectFactory::Init();
   vtkObjectFactory::RegisteredFactories->AddItem(factory);
+  // Pooled objects may be of a class that the new factory overrides.
+  vtkObjectPool::Clear();
 }
 
 // print ivars to stream
@@ -337,6 +340,7 @@ void vtkObjectFactory::UnRegisterFactory(vtkObjectFactory* factory)
 {
   void* lib = factory->LibraryHandle;
   vtkObjectFactory::RegisteredFactories->RemoveItem(factory);
+  vtkObjectPool::Clear();
   if (lib)
   {
     vtkDynamicLoader::CloseLibrary(static_cast<vtkLibHandle>(lib));
@@ -366,6 +370,7 @@ void vtkObjectFactory::UnRegisterAllFactories()
   // delete the factory list and its factories
   vtkObjectFactory::RegisteredFactories->Delete();
   vtkObjectFactory::RegisteredFactories = nullptr;
+  vtkObjectPool::Clear();
   // now close the libraries
   for (int i = 0; i < num; i++)
   {
@@ -476,6 +481,7 @@ void vtkObjectFactory::SetEnableFlag(
       }
     }
   }
+  vtkObjectPool::Clear();
 }
 
 // Get the enable flag for a className/subclassName pair
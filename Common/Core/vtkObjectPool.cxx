@@ -0,0 +1,370 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkObjectPool.h"
+
+#include "vtkObjectBase.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm> // For std::min
+#include <atomic>    // For std::atomic
+#include <cstdlib>   // For std::getenv
+#include <cstring>   // For std::strcmp
+#include <map>       // For std::map
+#include <memory>    // For std::unique_ptr
+#include <mutex>     // For std::mutex
+#include <string>    // For std::string
+#include <vector>    // For std::vector
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+std::atomic<bool>& Enabled()
+{
+  static std::atomic<bool> enabled{ [] {
+    const char* value = std::getenv("VTK_OBJECT_POOL");
+    return !value || std::strcmp(value, "0") != 0;
+  }() };
+  return enabled;
+}
+
+//------------------------------------------------------------------------------
+std::atomic<int>& MaximumSize()
+{
+  static std::atomic<int> size{ 64 };
+  return size;
+}
+
+//------------------------------------------------------------------------------
+// Free lists of all the pooled classes, indexed by slot.
+struct FreeLists
+{
+  std::vector<std::vector<vtkObjectBase*>> Lists;
+
+  std::vector<vtkObjectBase*>& Get(int slot)
+  {
+    if (static_cast<size_t>(slot) >= this->Lists.size())
+    {
+      this->Lists.resize(slot + 1);
+    }
+    return this->Lists[slot];
+  }
+
+  void MoveAll(std::vector<vtkObjectBase*>& objects)
+  {
+    for (auto& list : this->Lists)
+    {
+      objects.insert(objects.end(), list.begin(), list.end());
+      list.clear();
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+void DeleteObjects(const std::vector<vtkObjectBase*>& objects)
+{
+  for (vtkObjectBase* object : objects)
+  {
+    object->Delete();
+  }
+}
+
+//------------------------------------------------------------------------------
+// The free lists of a thread are only used by this thread, and by
+// vtkObjectPool::Clear() which empties them from any thread. The mutex is
+// therefore not contended, except while the pools are cleared. When both are
+// needed, the registry mutex is locked first.
+struct ThreadFreeLists : FreeLists
+{
+  std::mutex Mutex;
+  bool InUse = true;
+};
+
+std::atomic<bool> RegistryAlive{ false };
+
+//------------------------------------------------------------------------------
+// Owns the class slots, the shared free lists and the free lists of every
+// thread. Objects still pooled are deleted when the registry is destroyed,
+// which happens before vtkDebugLeaks reports leaks since the registry is
+// created on first use.
+class Registry
+{
+public:
+  Registry() { RegistryAlive = true; }
+  ~Registry()
+  {
+    RegistryAlive = false;
+    std::vector<vtkObjectBase*> objects;
+    this->Shared.MoveAll(objects);
+    for (auto& threadLists : this->Threads)
+    {
+      threadLists->MoveAll(objects);
+    }
+    DeleteObjects(objects);
+  }
+
+  int GetSlot(const char* typeName)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    auto inserted = this->Slots.insert(std::make_pair(std::string(typeName), 0));
+    if (inserted.second)
+    {
+      inserted.first->second = static_cast<int>(this->Slots.size()) - 1;
+    }
+    return inserted.first->second;
+  }
+
+  ThreadFreeLists* AcquireThreadFreeLists()
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    for (auto& threadLists : this->Threads)
+    {
+      if (!threadLists->InUse)
+      {
+        threadLists->InUse = true;
+        return threadLists.get();
+      }
+    }
+    this->Threads.emplace_back(new ThreadFreeLists);
+    return this->Threads.back().get();
+  }
+
+  // Called when a thread exits: its objects go to the shared free lists and
+  // its free lists can be reused by a new thread.
+  void ReleaseThreadFreeLists(ThreadFreeLists* threadLists)
+  {
+    std::vector<vtkObjectBase*> discarded;
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      std::lock_guard<std::mutex> threadLock(threadLists->Mutex);
+      for (size_t slot = 0; slot < threadLists->Lists.size(); ++slot)
+      {
+        this->MoveToShared(static_cast<int>(slot), threadLists->Lists[slot],
+          threadLists->Lists[slot].size(), discarded);
+      }
+      threadLists->InUse = false;
+    }
+    DeleteObjects(discarded);
+  }
+
+  // Move up to count objects from the shared free list of slot to the free
+  // list of the thread, and pop one of them. Return nullptr if there is none.
+  vtkObjectBase* PopFromShared(int slot, ThreadFreeLists& threadLists, size_t count)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    std::lock_guard<std::mutex> threadLock(threadLists.Mutex);
+    auto& shared = this->Shared.Get(slot);
+    auto& list = threadLists.Get(slot);
+    count = std::min(count, shared.size());
+    list.insert(list.end(), shared.end() - count, shared.end());
+    shared.resize(shared.size() - count);
+    if (list.empty())
+    {
+      return nullptr;
+    }
+    vtkObjectBase* object = list.back();
+    list.pop_back();
+    return object;
+  }
+
+  // Push object to the free list of the thread, after moving the objects
+  // exceeding half of maximumSize to the shared free list of slot. Objects
+  // exceeding the capacity of the shared free list are discarded.
+  void PushToShared(int slot, ThreadFreeLists& threadLists, vtkObjectBase* object,
+    size_t maximumSize, std::vector<vtkObjectBase*>& discarded)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    std::lock_guard<std::mutex> threadLock(threadLists.Mutex);
+    auto& list = threadLists.Get(slot);
+    if (list.size() >= maximumSize)
+    {
+      this->MoveToShared(slot, list, list.size() - maximumSize / 2, discarded);
+    }
+    list.push_back(object);
+  }
+
+  int GetNumberOfSharedObjects(int slot)
+  {
+    std::lock_guard<std::mutex> lock(this->Mutex);
+    return static_cast<int>(this->Shared.Get(slot).size());
+  }
+
+  // Delete the objects of the shared free lists and of the free lists of all
+  // the threads. They are deleted once the locks are released, in case their
+  // destructors use the pools.
+  void Clear()
+  {
+    std::vector<vtkObjectBase*> objects;
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Shared.MoveAll(objects);
+      for (auto& threadLists : this->Threads)
+      {
+        std::lock_guard<std::mutex> threadLock(threadLists->Mutex);
+        threadLists->MoveAll(objects);
+      }
+    }
+    DeleteObjects(objects);
+  }
+
+private:
+  // Must be called with Mutex locked.
+  void MoveToShared(int slot, std::vector<vtkObjectBase*>& list, size_t count,
+    std::vector<vtkObjectBase*>& discarded)
+  {
+    auto& shared = this->Shared.Get(slot);
+    const size_t capacity = static_cast<size_t>(MaximumSize().load()) *
+      static_cast<size_t>(vtkSMPTools::GetEstimatedNumberOfThreads());
+    for (size_t i = 0; i < count; ++i)
+    {
+      if (shared.size() < capacity)
+      {
+        shared.push_back(list.back());
+      }
+      else
+      {
+        discarded.push_back(list.back());
+      }
+      list.pop_back();
+    }
+  }
+
+  std::mutex Mutex;
+  std::map<std::string, int> Slots;
+  FreeLists Shared;
+  std::vector<std::unique_ptr<ThreadFreeLists>> Threads;
+};
+
+//------------------------------------------------------------------------------
+Registry& GetRegistry()
+{
+  static Registry registry;
+  return registry;
+}
+
+//------------------------------------------------------------------------------
+struct ThreadFreeListsHolder
+{
+  ThreadFreeLists* Lists = nullptr;
+
+  ~ThreadFreeListsHolder()
+  {
+    // Threads may outlive the registry, e.g. the workers of a static thread
+    // pool, in which case the objects were already deleted.
+    if (this->Lists && RegistryAlive)
+    {
+      GetRegistry().ReleaseThreadFreeLists(this->Lists);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+ThreadFreeLists& GetThreadFreeLists()
+{
+  static VTK_THREAD_LOCAL ThreadFreeListsHolder holder;
+  if (!holder.Lists)
+  {
+    holder.Lists = GetRegistry().AcquireThreadFreeLists();
+  }
+  return *holder.Lists;
+}
+}
+
+//------------------------------------------------------------------------------
+void vtkObjectPool::SetEnabled(bool enabled)
+{
+  Enabled() = enabled;
+}
+
+//------------------------------------------------------------------------------
+bool vtkObjectPool::GetEnabled()
+{
+  return Enabled();
+}
+
+//------------------------------------------------------------------------------
+void vtkObjectPool::SetMaximumSize(int size)
+{
+  MaximumSize() = std::max(size, 0);
+}
+
+//------------------------------------------------------------------------------
+int vtkObjectPool::GetMaximumSize()
+{
+  return MaximumSize();
+}
+
+//------------------------------------------------------------------------------
+void vtkObjectPool::Clear()
+{
+  // Nothing is pooled before the registry is created or after it is destroyed
+  if (RegistryAlive)
+  {
+    GetRegistry().Clear();
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkObjectPool::GetSlot(const char* typeName)
+{
+  return GetRegistry().GetSlot(typeName);
+}
+
+//------------------------------------------------------------------------------
+vtkObjectBase* vtkObjectPool::Pop(int slot)
+{
+  if (!Enabled())
+  {
+    return nullptr;
+  }
+  ThreadFreeLists& threadLists = GetThreadFreeLists();
+  {
+    std::lock_guard<std::mutex> lock(threadLists.Mutex);
+    auto& list = threadLists.Get(slot);
+    if (!list.empty())
+    {
+      vtkObjectBase* object = list.back();
+      list.pop_back();
+      return object;
+    }
+  }
+  const size_t count = static_cast<size_t>(std::max(MaximumSize().load() / 2, 1));
+  return GetRegistry().PopFromShared(slot, threadLists, count);
+}
+
+//------------------------------------------------------------------------------
+bool vtkObjectPool::Push(int slot, vtkObjectBase* object)
+{
+  const size_t maximumSize = static_cast<size_t>(MaximumSize());
+  if (!Enabled() || maximumSize == 0)
+  {
+    return false;
+  }
+  ThreadFreeLists& threadLists = GetThreadFreeLists();
+  {
+    std::lock_guard<std::mutex> lock(threadLists.Mutex);
+    auto& list = threadLists.Get(slot);
+    if (list.size() < maximumSize)
+    {
+      list.push_back(object);
+      return true;
+    }
+  }
+  std::vector<vtkObjectBase*> discarded;
+  GetRegistry().PushToShared(slot, threadLists, object, maximumSize, discarded);
+  DeleteObjects(discarded);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+int vtkObjectPool::GetNumberOfPooledObjects(int slot)
+{
+  ThreadFreeLists& threadLists = GetThreadFreeLists();
+  int count;
+  {
+    std::lock_guard<std::mutex> lock(threadLists.Mutex);
+    count = static_cast<int>(threadLists.Get(slot).size());
+  }
+  return count + GetRegistry().GetNumberOfSharedObjects(slot);
+}
+VTK_ABI_NAMESPACE_END
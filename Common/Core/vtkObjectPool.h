@@ -0,0 +1,248 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkObjectPool
+ * @brief   per-thread free lists of recyclable helper objects.
+ *
+ * Filters create and delete small helper objects such as vtkIdList,
+ * vtkGenericCell or vtkPoints for every execution, and often for every
+ * thread of every execution. Each creation goes through the object factory,
+ * the debug leaks bookkeeping and the memory allocator, and the helper loses
+ * the memory it grew while it was used.
+ *
+ * vtkObjectPool keeps released objects in free lists, one per class and per
+ * thread, from which Acquire() returns them before falling back to T::New().
+ * When the free list of a thread grows larger than GetMaximumSize(), half of
+ * it is moved to a free list shared by all threads, where other threads find
+ * objects when their own list is empty. This handles the common pattern where
+ * objects are created by worker threads but released by the main thread at
+ * the end of an algorithm.
+ *
+ * Only classes for which vtkObjectPoolTraits is specialized are pooled, as
+ * the specialization defines how an object is reset before being reused.
+ * vtkIdList, vtkPoints and vtkGenericCell provide one in their headers. For
+ * other classes, Acquire() and Release() are equivalent to T::New() and
+ * Delete().
+ *
+ * An object is recycled by Release() only when the caller holds the last
+ * reference to it; objects that were stored elsewhere are simply unregistered.
+ * Since objects are created with T::New(), factory overrides are honored. The
+ * pools are emptied whenever the object factories change, so that objects of
+ * an overridden class are not returned once the override is removed.
+ *
+ * vtkPooledObject is a scoped handle acquiring an object on construction and
+ * releasing it on destruction. vtkSMPThreadLocalObject also uses the pools,
+ * when it is not given an exemplar, for the poolable classes that specialize
+ * vtkObjectPoolThreadLocalTraits.
+ *
+ * @warning
+ * Recycled objects keep their observers and their debug flag. Do not pool
+ * objects that are customized beyond what their vtkObjectPoolTraits resets.
+ *
+ * @sa
+ * vtkPooledObject vtkSMPThreadLocalObject vtkObjectFactory
+ */
+
+#ifndef vtkObjectPool_h
+#define vtkObjectPool_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+#include <type_traits> // For std::true_type, std::false_type
+#include <typeinfo>    // For typeid
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkObjectBase;
+
+/**
+ * Specialize this template, deriving from std::true_type, to make a class
+ * poolable. Recycle() is called on each released object and must bring it
+ * back to a state equivalent to a new instance.
+ */
+template <typename T>
+struct vtkObjectPoolTraits : std::false_type
+{
+  static void Recycle(T*) {}
+};
+
+/**
+ * Specialize this template, deriving from std::true_type, to make
+ * vtkSMPThreadLocalObject acquire the objects of a poolable class from
+ * vtkObjectPool and release them to it. This is only worth it for classes
+ * whose thread local objects are temporary helpers, as objects kept by an
+ * algorithm after its thread local is destroyed are not recycled.
+ */
+template <typename T>
+struct vtkObjectPoolThreadLocalTraits : std::false_type
+{
+};
+
+class VTKCOMMONCORE_EXPORT VTK_WRAPEXCLUDE vtkObjectPool
+{
+public:
+  /**
+   * Return an object of class T, either recycled or created with T::New().
+   * The caller owns the returned reference.
+   */
+  template <typename T>
+  static T* Acquire()
+  {
+    return vtkObjectPool::Acquire<T>(vtkObjectPoolTraits<T>());
+  }
+
+  /**
+   * Give back an object, which is recycled if its class is poolable and the
+   * caller holds its last reference, and unregistered otherwise. Does nothing
+   * if object is nullptr.
+   */
+  template <typename T>
+  static void Release(T* object)
+  {
+    vtkObjectPool::Release(object, vtkObjectPoolTraits<T>());
+  }
+
+  ///@{
+  /**
+   * Enable or disable pooling. When disabled, Acquire() and Release() do not
+   * use the free lists, which are left untouched. Default is enabled, unless
+   * the VTK_OBJECT_POOL environment variable is set to 0.
+   */
+  static void SetEnabled(bool enabled);
+  static bool GetEnabled();
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum number of objects of a given class kept in the free
+   * list of a thread. The shared free list keeps up to this number times the
+   * number of threads of vtkSMPTools. Default is 64.
+   */
+  static void SetMaximumSize(int size);
+  static int GetMaximumSize();
+  ///@}
+
+  /**
+   * Delete all the pooled objects, from the free lists of every thread and
+   * from the shared free lists, before returning. This method is safe to call
+   * from any thread. It is called by vtkObjectFactory whenever factories or
+   * overrides change.
+   */
+  static void Clear();
+
+  /**
+   * Number of objects of class T in the free list of the calling thread and
+   * in the shared free list. Mostly useful for testing.
+   */
+  template <typename T>
+  static int GetNumberOfPooledObjects()
+  {
+    return vtkObjectPool::GetNumberOfPooledObjects(vtkObjectPool::GetSlot<T>());
+  }
+
+private:
+  template <typename T>
+  static T* Acquire(std::false_type)
+  {
+    return T::New();
+  }
+  template <typename T>
+  static T* Acquire(std::true_type);
+  template <typename T>
+  static void Release(T* object, std::false_type)
+  {
+    if (object)
+    {
+      object->Delete();
+    }
+  }
+  template <typename T>
+  static void Release(T* object, std::true_type);
+
+  template <typename T>
+  static int GetSlot()
+  {
+    static const int slot = vtkObjectPool::GetSlot(typeid(T).name());
+    return slot;
+  }
+
+  static int GetSlot(const char* typeName);
+  static vtkObjectBase* Pop(int slot);
+  static bool Push(int slot, vtkObjectBase* object);
+  static int GetNumberOfPooledObjects(int slot);
+};
+
+//------------------------------------------------------------------------------
+template <typename T>
+T* vtkObjectPool::Acquire(std::true_type)
+{
+  if (vtkObjectBase* object = vtkObjectPool::Pop(vtkObjectPool::GetSlot<T>()))
+  {
+    return static_cast<T*>(object);
+  }
+  return T::New();
+}
+
+//------------------------------------------------------------------------------
+template <typename T>
+void vtkObjectPool::Release(T* object, std::true_type)
+{
+  if (!object)
+  {
+    return;
+  }
+  if (object->GetReferenceCount() == 1)
+  {
+    vtkObjectPoolTraits<T>::Recycle(object);
+    if (vtkObjectPool::Push(vtkObjectPool::GetSlot<T>(), object))
+    {
+      return;
+    }
+  }
+  object->Delete();
+}
+
+/**
+ * @class   vtkPooledObject
+ * @brief   scoped handle on an object of a vtkObjectPool.
+ *
+ * The object is acquired from vtkObjectPool on construction and released on
+ * destruction, which makes vtkPooledObject a drop-in replacement for vtkNew
+ * for the poolable classes:
+ * \code
+ * vtkPooledObject<vtkGenericCell> cell;
+ * input->GetCell(cellId, cell);
+ * \endcode
+ */
+template <typename T>
+class vtkPooledObject
+{
+public:
+  vtkPooledObject()
+    : Object(vtkObjectPool::Acquire<T>())
+  {
+  }
+  vtkPooledObject(vtkPooledObject&& other) noexcept
+    : Object(other.Object)
+  {
+    other.Object = nullptr;
+  }
+  ~vtkPooledObject() { vtkObjectPool::Release(this->Object); }
+
+  T* Get() const noexcept { return this->Object; }
+  T* GetPointer() const noexcept { return this->Object; }
+  T* operator->() const noexcept { return this->Object; }
+  operator T*() const noexcept { return this->Object; }
+  T& operator*() const noexcept { return *this->Object; }
+
+private:
+  vtkPooledObject(const vtkPooledObject&) = delete;
+  void operator=(const vtkPooledObject&) = delete;
+  void operator=(vtkPooledObject&&) = delete;
+
+  T* Object;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkObjectPool.h
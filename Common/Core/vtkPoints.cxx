@@ -275,4 +275,22 @@ void vtkPoints::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "  Ymin,Ymax: (" << bounds[2] << ", " << bounds[3] << ")\n";
   os << indent << "  Zmin,Zmax: (" << bounds[4] << ", " << bounds[5] << ")\n";
 }
+
+//------------------------------------------------------------------------------
+void vtkObjectPoolTraits<vtkPoints>::Recycle(vtkPoints* points)
+{
+  vtkDataArray* data = points->GetData();
+  if (data->GetReferenceCount() > 1 || data->GetDataType() != VTK_FLOAT)
+  {
+    vtkFloatArray* newData = vtkFloatArray::New();
+    newData->SetNumberOfComponents(3);
+    newData->SetName("Points");
+    points->SetData(newData);
+    newData->Delete();
+  }
+  else
+  {
+    points->Reset();
+  }
+}
 VTK_ABI_NAMESPACE_END
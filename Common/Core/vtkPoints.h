@@ -13,6 +13,7 @@
 
 #include "vtkCommonCoreModule.h" // For export macro
 #include "vtkObject.h"
+#include "vtkObjectPool.h"    // For vtkObjectPoolTraits
 #include "vtkWrappingHints.h" // For VTK_MARSHALAUTO
 
 #include "vtkDataArray.h" // Needed for inline methods
@@ -254,6 +255,19 @@ private:
   void operator=(const vtkPoints&) = delete;
 };
 
+#ifndef __VTK_WRAP__
+/**
+ * Points are poolable, see vtkObjectPool. Recycled points are reset and keep
+ * their memory. Points whose data array is shared or is not a float array get
+ * a new float array, like a new instance.
+ */
+template <>
+struct VTKCOMMONCORE_EXPORT vtkObjectPoolTraits<vtkPoints> : std::true_type
+{
+  static void Recycle(vtkPoints* points);
+};
+#endif
+
 inline void vtkPoints::Reset()
 {
   this->Data->Reset();
@@ -130,14 +130,17 @@ list(APPEND vtk_smp_sources
   "${vtk_smp_common_dir}/vtkSMPToolsAPI.cxx")
 list(APPEND vtk_smp_nowrap_headers
   "${vtk_smp_common_dir}/vtkSMPThreadLocalAPI.h"
+  "${vtk_smp_common_dir}/vtkSMPTaskGraphImpl.h"
   "${vtk_smp_common_dir}/vtkSMPThreadLocalImplAbstract.h"
   "${vtk_smp_common_dir}/vtkSMPToolsAPI.h"
   "${vtk_smp_common_dir}/vtkSMPToolsImpl.h"
   "${vtk_smp_common_dir}/vtkSMPToolsInternal.h")
 
 list(APPEND vtk_smp_sources
+  vtkSMPTaskGraph.cxx
   vtkSMPTools.cxx)
 list(APPEND vtk_smp_headers
+  vtkSMPTaskGraph.h
   vtkSMPTools.h
   vtkSMPThreadLocal.h
   vtkSMPThreadLocalObject.h)
@@ -0,0 +1,67 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkSMPTaskGraph.h"
+
+#include "SMP/Common/vtkSMPTaskGraphImpl.h"
+#include "SMP/Common/vtkSMPToolsAPI.h"
+#include "vtkSetGet.h" // For vtkGenericWarningMacro
+
+VTK_ABI_NAMESPACE_BEGIN
+//------------------------------------------------------------------------------
+vtkSMPTaskGraph::vtkSMPTaskGraph()
+  : Internals(new vtk::detail::smp::vtkSMPTaskGraphImpl)
+{
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGraph::~vtkSMPTaskGraph() = default;
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGraph::TaskId vtkSMPTaskGraph::AddTask(std::function<void()> task)
+{
+  return this->AddTask(std::move(task), std::vector<TaskId>());
+}
+
+//------------------------------------------------------------------------------
+vtkSMPTaskGraph::TaskId vtkSMPTaskGraph::AddTask(
+  std::function<void()> task, const std::vector<TaskId>& dependencies)
+{
+  using Task = vtk::detail::smp::vtkSMPTaskGraphImpl::Task;
+  auto& tasks = this->Internals->Tasks;
+  const TaskId id = tasks.size();
+
+  std::unique_ptr<Task> node(new Task);
+  node->Function = std::move(task);
+  for (TaskId dependency : dependencies)
+  {
+    if (dependency >= id)
+    {
+      vtkGenericWarningMacro("Ignoring invalid task dependency " << dependency << ".");
+      continue;
+    }
+    tasks[dependency]->Successors.push_back(id);
+    ++node->NumberOfDependencies;
+  }
+  tasks.emplace_back(std::move(node));
+  return id;
+}
+
+//------------------------------------------------------------------------------
+void vtkSMPTaskGraph::Wait()
+{
+  if (this->Internals->Tasks.empty())
+  {
+    return;
+  }
+  auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+  SMPToolsAPI.ExecuteTaskGraph(*this->Internals);
+  this->Internals->Tasks.clear();
+}
+
+//------------------------------------------------------------------------------
+std::size_t vtkSMPTaskGraph::GetNumberOfTasks() const
+{
+  return this->Internals->GetNumberOfTasks();
+}
+VTK_ABI_NAMESPACE_END
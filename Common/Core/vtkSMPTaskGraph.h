@@ -0,0 +1,118 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSMPTaskGraph
+ * @brief   Dependency graph of tasks executed by the vtkSMPTools backend.
+ *
+ * vtkSMPTaskGraph complements the fork-join functions of vtkSMPTools (For,
+ * Transform, Fill, Sort) with task parallelism. Independent pieces of work are
+ * spawned with AddTask(), ordering constraints are expressed by listing the
+ * tasks a new task depends on (or with Then() for a single continuation) and
+ * Wait() executes the graph with the backend in use, blocking until all tasks
+ * completed. A task starts as soon as all its dependencies completed, so
+ * independent stages of an algorithm can overlap.
+ *
+ * Usage example:
+ * \code
+ * vtkSMPTaskGraph graph;
+ * auto links = graph.AddTask([&]() { BuildLinks(); });
+ * auto normals = graph.AddTask([&]() { ComputeNormals(); });
+ * graph.AddTask([&]() { Smooth(); }, { links, normals });
+ * graph.Wait();
+ * \endcode
+ *
+ * vtkSMPTools::For() called from inside a task follows the nested parallelism
+ * setting, see vtkSMPTools::SetNestedParallelism(). With the Sequential backend,
+ * tasks are executed one after another in a valid topological order.
+ *
+ * @warning
+ * Tasks must not throw exceptions. vtkSMPTaskGraph itself is not thread safe:
+ * tasks must be added from a single thread and never while Wait() is running.
+ *
+ * @sa
+ * vtkSMPTools
+ */
+
+#ifndef vtkSMPTaskGraph_h
+#define vtkSMPTaskGraph_h
+
+#include "vtkCommonCoreModule.h" // For export macro
+#include "vtkSystemIncludes.h"
+
+#include <cstddef>          // For std::size_t
+#include <functional>       // For std::function
+#include <initializer_list> // For std::initializer_list
+#include <memory>           // For std::unique_ptr
+#include <vector>           // For std::vector
+
+#ifndef DOXYGEN_SHOULD_SKIP_THIS
+namespace vtk
+{
+namespace detail
+{
+namespace smp
+{
+VTK_ABI_NAMESPACE_BEGIN
+class vtkSMPTaskGraphImpl;
+VTK_ABI_NAMESPACE_END
+} // namespace smp
+} // namespace detail
+} // namespace vtk
+#endif // DOXYGEN_SHOULD_SKIP_THIS
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKCOMMONCORE_EXPORT vtkSMPTaskGraph
+{
+public:
+  /**
+   * Identifier of a task, as returned by AddTask().
+   */
+  using TaskId = std::size_t;
+
+  vtkSMPTaskGraph();
+  ~vtkSMPTaskGraph();
+  vtkSMPTaskGraph(const vtkSMPTaskGraph&) = delete;
+  vtkSMPTaskGraph& operator=(const vtkSMPTaskGraph&) = delete;
+
+  ///@{
+  /**
+   * Add a task to the graph. The task will not start before all the tasks
+   * listed in `dependencies` completed. Dependencies must be ids previously
+   * returned by this graph; invalid ids are ignored with a warning.
+   * Execution is deferred to Wait().
+   */
+  TaskId AddTask(std::function<void()> task);
+  TaskId AddTask(std::function<void()> task, const std::vector<TaskId>& dependencies);
+  TaskId AddTask(std::function<void()> task, std::initializer_list<TaskId> dependencies)
+  {
+    return this->AddTask(std::move(task), std::vector<TaskId>(dependencies));
+  }
+  ///@}
+
+  /**
+   * Add a continuation: a task executed once `predecessor` completed.
+   */
+  TaskId Then(TaskId predecessor, std::function<void()> task)
+  {
+    return this->AddTask(std::move(task), std::vector<TaskId>{ predecessor });
+  }
+
+  /**
+   * Execute all the tasks added since the last call, in parallel when their
+   * dependencies allow it, and return once every task completed. The graph is
+   * then emptied so that it can be reused.
+   */
+  void Wait();
+
+  /**
+   * Number of tasks waiting for the next call to Wait().
+   */
+  std::size_t GetNumberOfTasks() const;
+
+private:
+  std::unique_ptr<vtk::detail::smp::vtkSMPTaskGraphImpl> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkSMPTaskGraph.h
@@ -9,6 +9,11 @@
  * - Local() allocates an object of the template argument type using New()
  * - The destructor calls Delete() on all objects created with Local().
  *
+ * When no exemplar is given and vtkObjectPoolThreadLocalTraits is specialized
+ * for the template argument type, as for vtkIdList and vtkGenericCell, objects
+ * are acquired from and released to vtkObjectPool, so that they are reused
+ * from one algorithm execution to the next.
+ *
  * @warning
  * There is absolutely no guarantee to the order in which the local objects
  * will be stored and hence the order in which they will be traversed when
@@ -62,8 +67,11 @@
 #ifndef vtkSMPThreadLocalObject_h
 #define vtkSMPThreadLocalObject_h
 
+#include "vtkObjectPool.h" // For vtkObjectPool
 #include "vtkSMPThreadLocal.h"
 
+#include <type_traits> // For std::integral_constant
+
 VTK_ABI_NAMESPACE_BEGIN
 template <typename T>
 class vtkSMPThreadLocalObject
@@ -97,9 +105,16 @@ public:
     iterator iter = this->begin();
     while (iter != this->end())
     {
-      if (*iter)
+      if (this->Exemplar)
+      {
+        if (*iter)
+        {
+          (*iter)->Delete();
+        }
+      }
+      else
       {
-        (*iter)->Delete();
+        vtkSMPThreadLocalObject::DeleteObject(*iter, UsePool());
       }
       ++iter;
     }
@@ -108,8 +123,9 @@ public:
   ///@{
   /**
    * Returns an object local to the current thread.
-   * This object is allocated with T::New() and will
-   * be deleted in the destructor of vtkSMPThreadLocalObject.
+   * This object is allocated with T::New(), or acquired from vtkObjectPool
+   * for the classes using it, and will be deleted, or released, in the
+   * destructor of vtkSMPThreadLocalObject.
    */
   T*& Local()
   {
@@ -122,7 +138,7 @@ public:
       }
       else
       {
-        vtkobject = T::SafeDownCast(T::New());
+        vtkobject = vtkSMPThreadLocalObject::NewObject(UsePool());
       }
     }
     return vtkobject;
@@ -187,6 +203,21 @@ public:
   }
 
 private:
+  // Whether the objects are acquired from vtkObjectPool, an opt-in of T.
+  using UsePool = std::integral_constant<bool,
+    vtkObjectPoolThreadLocalTraits<T>::value && vtkObjectPoolTraits<T>::value>;
+
+  static T* NewObject(std::true_type) { return vtkObjectPool::Acquire<T>(); }
+  static T* NewObject(std::false_type) { return T::SafeDownCast(T::New()); }
+  static void DeleteObject(T* object, std::true_type) { vtkObjectPool::Release(object); }
+  static void DeleteObject(T* object, std::false_type)
+  {
+    if (object)
+    {
+      object->Delete();
+    }
+  }
+
   TLS Internal;
   T* Exemplar;
 };
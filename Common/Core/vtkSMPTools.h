@@ -25,6 +25,7 @@
 #include "vtkSMPThreadLocal.h" // For Initialized
 
 #include <functional>  // For std::function
+#include <iterator>    // For std::iterator_traits
 #include <type_traits> // For std:::enable_if
 
 #ifndef DOXYGEN_SHOULD_SKIP_THIS
@@ -623,6 +624,104 @@ public:
     auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
     SMPToolsAPI.Sort(begin, end, comp);
   }
+
+  ///@{
+  /**
+   * A convenience method for stable sorting. It is a drop in replacement for
+   * std::stable_sort(): the relative order of equivalent elements is preserved.
+   * Parallel backends sort chunks of the range concurrently and merge them
+   * pairwise, which requires a temporary buffer of the size of the range.
+   */
+  template <typename RandomAccessIterator>
+  static void StableSort(RandomAccessIterator begin, RandomAccessIterator end)
+  {
+    using ValueType = typename std::iterator_traits<RandomAccessIterator>::value_type;
+    vtkSMPTools::StableSort(begin, end, std::less<ValueType>());
+  }
+
+  template <typename RandomAccessIterator, typename Compare>
+  static void StableSort(RandomAccessIterator begin, RandomAccessIterator end, Compare comp)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    SMPToolsAPI.StableSort(begin, end, comp);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * A convenience method computing the inclusive prefix scan of a range. It is a
+   * drop in replacement for C++17 std::inclusive_scan(): the i-th output is the
+   * reduction of the input elements 0 to i. The binary operation defaults to the sum
+   * and must be associative, the input and output ranges may be the same.
+   *
+   * Usage example building cell offsets from cell sizes:
+   * \code
+   * std::vector<vtkIdType> sizes = ...;
+   * std::vector<vtkIdType> offsets(sizes.size() + 1, 0);
+   * vtkSMPTools::InclusiveScan(sizes.begin(), sizes.end(), offsets.begin() + 1);
+   * \endcode
+   */
+  template <typename InputIt, typename OutputIt>
+  static void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin)
+  {
+    using ValueType = typename std::iterator_traits<InputIt>::value_type;
+    vtkSMPTools::InclusiveScan(inBegin, inEnd, outBegin, std::plus<ValueType>());
+  }
+
+  template <typename InputIt, typename OutputIt, typename BinaryOp>
+  static void InclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    SMPToolsAPI.InclusiveScan(inBegin, inEnd, outBegin, op);
+  }
+  ///@}
+
+  ///@{
+  /**
+   * A convenience method computing the exclusive prefix scan of a range. It is a
+   * drop in replacement for C++17 std::exclusive_scan(): the i-th output is the
+   * reduction of `init` and of the input elements 0 to i-1. The binary operation
+   * defaults to the sum and must be associative, the input and output ranges may be
+   * the same. Values are accumulated with the type of `init`.
+   *
+   * Usage example building offsets from per-point counts:
+   * \code
+   * vtkSMPTools::ExclusiveScan(counts, counts + numPts, offsets, vtkIdType(0));
+   * \endcode
+   */
+  template <typename InputIt, typename OutputIt, typename T>
+  static void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init)
+  {
+    vtkSMPTools::ExclusiveScan(inBegin, inEnd, outBegin, init, std::plus<T>());
+  }
+
+  template <typename InputIt, typename OutputIt, typename T, typename BinaryOp>
+  static void ExclusiveScan(InputIt inBegin, InputIt inEnd, OutputIt outBegin, T init, BinaryOp op)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    SMPToolsAPI.ExclusiveScan(inBegin, inEnd, outBegin, init, op);
+  }
+  ///@}
+
+  /**
+   * A convenience method for stream compaction. It is a drop in replacement for
+   * std::copy_if(): the elements for which `pred` returns true are copied, in order,
+   * to the output range and the end of the written output is returned. The input and
+   * output ranges must not overlap. The predicate may be called more than once per
+   * element and should have no side effects.
+   *
+   * Usage example extracting the ids of the kept cells:
+   * \code
+   * auto end = vtkSMPTools::CopyIf(ids.begin(), ids.end(), kept.begin(),
+   *   [&](vtkIdType id) { return insideness[id] != 0; });
+   * \endcode
+   */
+  template <typename InputIt, typename OutputIt, typename Predicate>
+  static OutputIt CopyIf(InputIt inBegin, InputIt inEnd, OutputIt outBegin, Predicate pred)
+  {
+    auto& SMPToolsAPI = vtk::detail::smp::vtkSMPToolsAPI::GetInstance();
+    return SMPToolsAPI.CopyIf(inBegin, inEnd, outBegin, pred);
+  }
 };
 
 VTK_ABI_NAMESPACE_END
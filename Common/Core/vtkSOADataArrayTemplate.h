@@ -179,12 +179,30 @@ public:
    **/
   void SetArrayFreeFunction(int comp, void (*callback)(void*));
 
+  ///@{
+  /**
+   * Set/Get the NUMA placement mode of the memory allocated by this array,
+   * one of vtkBufferPlacement::PlacementModes. The default,
+   * vtkBufferPlacement::USE_GLOBAL, follows vtkBufferPlacement::GetGlobalMode().
+   * The mode applies to subsequent allocations.
+   */
+  void SetPlacementMode(int mode) { this->PlacementMode = mode; }
+  int GetPlacementMode() const { return this->PlacementMode; }
+  ///@}
+
   /**
    * Return a pointer to a contiguous block of memory containing all values for
    * a particular components (ie. a single array of the struct-of-arrays).
    */
   ValueType* GetComponentArrayPointer(int comp);
 
+  /**
+   * Return true if the values are stored in one buffer per component, i.e.
+   * when GetComponentArrayPointer() can be used. GetVoidPointer() switches the
+   * array to a single array-of-structs buffer.
+   */
+  bool HasSOAStorage() const { return this->StorageType == StorageTypeEnum::SOA; }
+
   /**
    * Use of this method is discouraged, it creates a deep copy of the data into
    * a contiguous AoS-ordered buffer and prints a warning.
@@ -252,6 +270,7 @@ protected:
 
   std::vector<vtkBuffer<ValueType>*> Data;
   vtkBuffer<ValueType>* AoSData;
+  int PlacementMode;
 
   /**
    * Because we still need to support GetVoidPointer() for both reading from and writing
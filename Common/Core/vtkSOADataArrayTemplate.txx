@@ -52,6 +52,7 @@ vtkSOADataArrayTemplate<ValueTypeT>::FastDownCast(vtkAbstractArray* source)
 template <class ValueType>
 vtkSOADataArrayTemplate<ValueType>::vtkSOADataArrayTemplate()
   : AoSData(nullptr)
+  , PlacementMode(vtkBufferPlacement::USE_GLOBAL)
   , StorageType(StorageTypeEnum::AOS)
 {
   this->AoSData = vtkBuffer<ValueType>::New();
@@ -350,6 +351,7 @@ bool vtkSOADataArrayTemplate<ValueType>::AllocateTuples(vtkIdType numTuples)
   {
     for (size_t cc = 0, max = this->Data.size(); cc < max; ++cc)
     {
+      this->Data[cc]->SetPlacementMode(this->PlacementMode);
       if (!this->Data[cc]->Allocate(numTuples))
       {
         return false;
@@ -358,6 +360,7 @@ bool vtkSOADataArrayTemplate<ValueType>::AllocateTuples(vtkIdType numTuples)
   }
   else
   {
+    this->AoSData->SetPlacementMode(this->PlacementMode);
     if (!this->AoSData->Allocate(numTuples * this->GetNumberOfComponents()))
     {
       return false;
@@ -374,6 +377,7 @@ bool vtkSOADataArrayTemplate<ValueType>::ReallocateTuples(vtkIdType numTuples)
   {
     for (size_t cc = 0, max = this->Data.size(); cc < max; ++cc)
     {
+      this->Data[cc]->SetPlacementMode(this->PlacementMode);
       if (!this->Data[cc]->Reallocate(numTuples))
       {
         return false;
@@ -382,6 +386,7 @@ bool vtkSOADataArrayTemplate<ValueType>::ReallocateTuples(vtkIdType numTuples)
   }
   else
   {
+    this->AoSData->SetPlacementMode(this->PlacementMode);
     if (!this->AoSData->Reallocate(numTuples * this->GetNumberOfComponents()))
     {
       return false;
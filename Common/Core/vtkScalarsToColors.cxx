@@ -5,6 +5,7 @@
 #include "vtkAbstractArray.h"
 #include "vtkCharArray.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkTemplateAliasMacro.h"
 #include "vtkUnsignedCharArray.h"
@@ -13,6 +14,7 @@
 #include <algorithm>
 #include <cmath>
 #include <list>
+#include <vector>
 
 // A helper list lookups of annotated values.
 // Note you cannot use a map or sort etc as the
@@ -405,10 +407,11 @@ void vtkScalarsToColors::MapVectorsThroughTable(void* input, unsigned char* outp
 
     case vtkScalarsToColors::MAGNITUDE:
     {
-      // convert to magnitude in blocks of 300 values
+      // convert to magnitude in blocks large enough for both the conversion
+      // and the mapping of a block to be split across threads
       int inInc = vtkDataArray::GetDataTypeSize(scalarType) * inComponents;
-      constexpr int blockSize = 300;
-      double magValues[blockSize];
+      constexpr int blockSize = 1 << 20;
+      std::vector<double> magValues(std::min(numValues, blockSize));
       int numBlocks = (numValues + blockSize - 1) / blockSize;
       int lastBlockSize = numValues - blockSize * (numBlocks - 1);
 
@@ -416,8 +419,9 @@ void vtkScalarsToColors::MapVectorsThroughTable(void* input, unsigned char* outp
       {
         int numMagValues = ((i < numBlocks - 1) ? blockSize : lastBlockSize);
         this->MapVectorsToMagnitude(
-          input, magValues, scalarType, numMagValues, inComponents, vectorSize);
-        this->MapScalarsThroughTable(magValues, output, VTK_DOUBLE, numMagValues, 1, outputFormat);
+          input, magValues.data(), scalarType, numMagValues, inComponents, vectorSize);
+        this->MapScalarsThroughTable(
+          magValues.data(), output, VTK_DOUBLE, numMagValues, 1, outputFormat);
         input = static_cast<char*>(input) + numMagValues * inInc;
         output += numMagValues * outputFormat;
       }
@@ -1300,23 +1304,29 @@ void vtkScalarsToColors::MapColorsToColors(void* inPtr, unsigned char* outPtr, i
   delete[] newPtr;
 }
 
+//------------------------------------------------------------------------------
+// Smaller sets of vectors are converted by the calling thread.
+constexpr vtkIdType vtkScalarsToColorsGrainSize = 65536;
+
 //------------------------------------------------------------------------------
 template <class T>
 void vtkScalarsToColorsMapVectorsToMagnitude(
-  const T* inPtr, double* outPtr, int numTuples, int vectorSize, int inInc)
+  const T* inPtr, double* outPtr, int numTuples, int vectorSize, int numComps)
 {
-  do
-  {
-    int n = vectorSize;
-    double v = 0.0;
-    do
-    {
-      double u = static_cast<double>(*inPtr++);
-      v += u * u;
-    } while (--n);
-    *outPtr++ = sqrt(v);
-    inPtr += inInc;
-  } while (--numTuples);
+  vtkSMPTools::For(0, numTuples, vtkScalarsToColorsGrainSize,
+    [inPtr, outPtr, vectorSize, numComps](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const T* vector = inPtr + i * numComps;
+        double v = 0.0;
+        for (int j = 0; j < vectorSize; ++j)
+        {
+          double u = static_cast<double>(vector[j]);
+          v += u * u;
+        }
+        outPtr[i] = sqrt(v);
+      }
+    });
 }
 
 //------------------------------------------------------------------------------
@@ -1340,12 +1350,11 @@ void vtkScalarsToColors::MapVectorsToMagnitude(void* inPtr, double* outPtr, int
   {
     vectorSize = numberOfComponents;
   }
-  int inInc = numberOfComponents - vectorSize;
 
   switch (inputDataType)
   {
     vtkTemplateAliasMacro(vtkScalarsToColorsMapVectorsToMagnitude(
-      static_cast<VTK_TT*>(inPtr), outPtr, numberOfTuples, vectorSize, inInc));
+      static_cast<VTK_TT*>(inPtr), outPtr, numberOfTuples, vectorSize, numberOfComponents));
   }
 
   delete[] newPtr;
@@ -69,7 +69,8 @@
   (((type) == VTK_STRING) ? "string" :                                                             \
   (((type) == VTK_VARIANT) ? "variant" :                                                           \
   (((type) == VTK_OBJECT) ? "object" :                                                             \
-  "Undefined")))))))))))))))))))
+  (((type) == VTK_CONTIGUOUS_STRING) ? "contiguous string" :                                       \
+  "Undefined"))))))))))))))))))))
 // clang-format on
 
 /* Various compiler-specific performance hints. */
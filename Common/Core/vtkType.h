@@ -58,6 +58,9 @@
 // deleted value
 // #define VTK_UNICODE_STRING 22 <==== do not use
 
+/* Strings stored in a single buffer by vtkContiguousStringArray */
+#define VTK_CONTIGUOUS_STRING 23
+
 /*--------------------------------------------------------------------------*/
 /* Define a unique integer identifier for each vtkDataObject type.          */
 /* When adding a new data type here, make sure to update                    */
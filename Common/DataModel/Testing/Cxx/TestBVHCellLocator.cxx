@@ -0,0 +1,285 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check the line intersections of vtkBVHCellLocator, one line at a time and
+// batched, against a brute force intersection with all the cells.
+
+#include "vtkBVHCellLocator.h"
+#include "vtkCellArray.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+constexpr int Resolution = 60;
+
+//------------------------------------------------------------------------------
+// A wavy height field of triangles over [0, Resolution]^2
+vtkSmartPointer<vtkPolyData> MakeSurface()
+{
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  for (int j = 0; j <= Resolution; ++j)
+  {
+    for (int i = 0; i <= Resolution; ++i)
+    {
+      points->InsertNextPoint(i, j, 2.0 * std::sin(0.3 * i) * std::cos(0.2 * j));
+    }
+  }
+  vtkNew<vtkCellArray> polys;
+  for (int j = 0; j < Resolution; ++j)
+  {
+    for (int i = 0; i < Resolution; ++i)
+    {
+      const vtkIdType p0 = j * (Resolution + 1) + i;
+      const vtkIdType tri0[3] = { p0, p0 + 1, p0 + Resolution + 2 };
+      const vtkIdType tri1[3] = { p0, p0 + Resolution + 2, p0 + Resolution + 1 };
+      polys->InsertNextCell(3, tri0);
+      polys->InsertNextCell(3, tri1);
+    }
+  }
+  auto surface = vtkSmartPointer<vtkPolyData>::New();
+  surface->SetPoints(points);
+  surface->SetPolys(polys);
+  return surface;
+}
+
+//------------------------------------------------------------------------------
+// All the intersections of a line with the cells, sorted by t
+std::vector<std::pair<double, vtkIdType>> IntersectBruteForce(
+  vtkPolyData* surface, const double p1[3], const double p2[3], double tol)
+{
+  std::vector<std::pair<double, vtkIdType>> hits;
+  vtkNew<vtkGenericCell> cell;
+  double t, x[3], pcoords[3];
+  int subId;
+  for (vtkIdType cellId = 0; cellId < surface->GetNumberOfCells(); ++cellId)
+  {
+    surface->GetCell(cellId, cell);
+    if (cell->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId))
+    {
+      hits.emplace_back(t, cellId);
+    }
+  }
+  std::sort(hits.begin(), hits.end());
+  return hits;
+}
+
+//------------------------------------------------------------------------------
+void RandomLines(vtkMinimalStandardRandomSequence* random, int numLines, double z1, double z2,
+  vtkPoints* p1s, vtkPoints* p2s)
+{
+  p1s->SetNumberOfPoints(numLines);
+  p2s->SetNumberOfPoints(numLines);
+  for (int i = 0; i < numLines; ++i)
+  {
+    const double x1 = random->GetNextRangeValue(-5, Resolution + 5);
+    const double y1 = random->GetNextRangeValue(-5, Resolution + 5);
+    const double x2 = random->GetNextRangeValue(-5, Resolution + 5);
+    const double y2 = random->GetNextRangeValue(-5, Resolution + 5);
+    p1s->SetPoint(i, x1, y1, z1);
+    p2s->SetPoint(i, x2, y2, z2);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Lines going down through the surface: check the first intersections.
+bool TestFirstHits(vtkPolyData* surface, vtkBVHCellLocator* locator,
+  vtkMinimalStandardRandomSequence* random, double tol)
+{
+  vtkNew<vtkPoints> p1s;
+  vtkNew<vtkPoints> p2s;
+  RandomLines(random, 500, 5.0, -5.0, p1s, p2s);
+
+  vtkNew<vtkIdList> cellIds;
+  vtkNew<vtkDoubleArray> ts;
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  locator->IntersectWithLines(p1s, p2s, tol, cellIds, ts, points);
+
+  vtkNew<vtkGenericCell> cell;
+  int numHits = 0;
+  for (vtkIdType lineId = 0; lineId < p1s->GetNumberOfPoints(); ++lineId)
+  {
+    double p1[3], p2[3];
+    p1s->GetPoint(lineId, p1);
+    p2s->GetPoint(lineId, p2);
+    const auto expected = IntersectBruteForce(surface, p1, p2, tol);
+
+    double t, x[3], pcoords[3];
+    int subId;
+    vtkIdType cellId;
+    const int hit = locator->IntersectWithLine(p1, p2, tol, t, x, pcoords, subId, cellId, cell);
+    if (expected.empty())
+    {
+      if (hit || cellIds->GetId(lineId) != -1 || ts->GetValue(lineId) != -1.0)
+      {
+        vtkLog(ERROR, << "Line " << lineId << " should not intersect the surface.");
+        return false;
+      }
+      continue;
+    }
+    ++numHits;
+    // Several cells may be intersected at the same t on their common edges
+    if (!hit || std::abs(t - expected[0].first) > 1e-9 ||
+      cellIds->GetId(lineId) < 0 || std::abs(ts->GetValue(lineId) - expected[0].first) > 1e-9)
+    {
+      vtkLog(ERROR, << "Wrong first intersection for line " << lineId << ".");
+      return false;
+    }
+    points->GetPoint(lineId, x);
+    for (int i = 0; i < 3; ++i)
+    {
+      if (std::abs(x[i] - (p1[i] + ts->GetValue(lineId) * (p2[i] - p1[i]))) > 1e-6)
+      {
+        vtkLog(ERROR, << "Wrong intersection point for line " << lineId << ".");
+        return false;
+      }
+    }
+  }
+  if (numHits == 0 || numHits == p1s->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, << "The lines should both intersect and miss the surface.");
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Lines going across the surface: check all the intersections.
+bool TestAllHits(vtkPolyData* surface, vtkBVHCellLocator* locator,
+  vtkMinimalStandardRandomSequence* random, double tol)
+{
+  vtkNew<vtkPoints> p1s;
+  vtkNew<vtkPoints> p2s;
+  RandomLines(random, 200, 0.5, -0.5, p1s, p2s);
+
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> cellIds;
+  vtkNew<vtkDoubleArray> ts;
+  locator->IntersectWithLines(p1s, p2s, tol, offsets, cellIds, ts);
+  if (offsets->GetNumberOfValues() != p1s->GetNumberOfPoints() + 1)
+  {
+    vtkLog(ERROR, << "Wrong number of offsets.");
+    return false;
+  }
+
+  vtkNew<vtkIdList> lineCellIds;
+  vtkNew<vtkGenericCell> cell;
+  for (vtkIdType lineId = 0; lineId < p1s->GetNumberOfPoints(); ++lineId)
+  {
+    double p1[3], p2[3];
+    p1s->GetPoint(lineId, p1);
+    p2s->GetPoint(lineId, p2);
+    const auto expected = IntersectBruteForce(surface, p1, p2, tol);
+    std::vector<vtkIdType> expectedIds;
+    for (const auto& hit : expected)
+    {
+      expectedIds.push_back(hit.second);
+    }
+    std::sort(expectedIds.begin(), expectedIds.end());
+
+    const vtkIdType begin = offsets->GetValue(lineId);
+    const vtkIdType end = offsets->GetValue(lineId + 1);
+    std::vector<vtkIdType> ids(cellIds->GetPointer(begin), cellIds->GetPointer(end));
+    for (vtkIdType i = begin + 1; i < end; ++i)
+    {
+      if (ts->GetValue(i) < ts->GetValue(i - 1))
+      {
+        vtkLog(ERROR, << "The intersections of line " << lineId << " are not sorted.");
+        return false;
+      }
+    }
+    std::sort(ids.begin(), ids.end());
+    locator->IntersectWithLine(p1, p2, tol, nullptr, lineCellIds, cell);
+    std::vector<vtkIdType> singleIds(lineCellIds->begin(), lineCellIds->end());
+    std::sort(singleIds.begin(), singleIds.end());
+    if (ids != expectedIds || singleIds != expectedIds)
+    {
+      vtkLog(ERROR, << "Wrong intersected cells for line " << lineId << ".");
+      return false;
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestBVHCellLocator(int, char*[])
+{
+  auto surface = MakeSurface();
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(8675);
+
+  vtkNew<vtkBVHCellLocator> locator;
+  locator->SetDataSet(surface);
+  locator->BuildLocator();
+  if (locator->GetNumberOfNodes() < 2 * surface->GetNumberOfCells() / 4 - 1)
+  {
+    vtkLog(ERROR, << "The tree has too few nodes.");
+    return EXIT_FAILURE;
+  }
+
+  // All the leaves together contain the cells
+  vtkNew<vtkPolyData> representation;
+  locator->GenerateRepresentation(-1, representation);
+  if (representation->GetNumberOfCells() == 0)
+  {
+    vtkLog(ERROR, << "Empty representation.");
+    return EXIT_FAILURE;
+  }
+
+  const double tolerances[] = { 0.0, 1e-3 };
+  for (double tol : tolerances)
+  {
+    if (!TestFirstHits(surface, locator, random, tol) ||
+      !TestAllHits(surface, locator, random, tol))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // A single cell per leaf, and few bins
+  locator->SetNumberOfCellsPerNode(1);
+  locator->SetNumberOfBins(2);
+  locator->BuildLocator();
+  if (locator->GetNumberOfNodes() != 2 * surface->GetNumberOfCells() - 1 ||
+    !TestFirstHits(surface, locator, random, 0.0) || !TestAllHits(surface, locator, random, 0.0))
+  {
+    vtkLog(ERROR, << "Wrong results with single cell leaves.");
+    return EXIT_FAILURE;
+  }
+
+  // The cells within bounds
+  double bbox[6] = { 10.5, 20.5, 30.5, 35.5, -0.5, 0.5 };
+  vtkNew<vtkIdList> cells;
+  locator->FindCellsWithinBounds(bbox, cells);
+  vtkIdType numExpected = 0;
+  for (vtkIdType cellId = 0; cellId < surface->GetNumberOfCells(); ++cellId)
+  {
+    const double* bounds = surface->GetCell(cellId)->GetBounds();
+    if (bounds[0] <= bbox[1] && bounds[1] >= bbox[0] && bounds[2] <= bbox[3] &&
+      bounds[3] >= bbox[2] && bounds[4] <= bbox[5] && bounds[5] >= bbox[4])
+    {
+      ++numExpected;
+    }
+  }
+  if (numExpected == 0 || cells->GetNumberOfIds() != numExpected)
+  {
+    vtkLog(ERROR, << "Wrong cells within bounds.");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -1332,6 +1332,135 @@ void TestLegacySetCells(vtkSmartPointer<vtkCellArray> cellArray)
   validate(2, { 9, 6, 5, 2 });
 }
 
+void TestFixedSizeStorage(vtkSmartPointer<vtkCellArray> cellArray)
+{
+  vtkLogScopeFunction(INFO);
+
+  auto validate = [](vtkCellArray* cells, const vtkIdType cellId,
+                    const std::initializer_list<vtkIdType>& ref) {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    cells->GetCellAtId(cellId, npts, pts);
+    TEST_ASSERT(ref.size() == static_cast<std::size_t>(npts));
+    TEST_ASSERT(std::equal(ref.begin(), ref.end(), pts));
+  };
+
+  const bool is64Bit = cellArray->IsStorage64Bit();
+  cellArray->UseFixedSizeStorage(3);
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->IsStorage64Bit() == is64Bit);
+  TEST_ASSERT(cellArray->GetNumberOfCells() == 0);
+  TEST_ASSERT(cellArray->IsHomogeneous() == 0);
+  TEST_ASSERT(cellArray->IsValid());
+
+  // Cells of the fixed size are inserted without offsets
+  TEST_ASSERT(cellArray->AllocateExact(3, 9));
+  TEST_ASSERT(cellArray->InsertNextCell({ 0, 1, 2 }) == 0);
+  TEST_ASSERT(cellArray->InsertNextCell({ 3, 4, 5 }) == 1);
+  TEST_ASSERT(cellArray->InsertNextCell({ 6, 7, 8 }) == 2);
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+  TEST_ASSERT(cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == 3);
+  TEST_ASSERT(cellArray->GetNumberOfOffsets() == 4);
+  TEST_ASSERT(cellArray->GetNumberOfConnectivityIds() == 9);
+  TEST_ASSERT(cellArray->GetOffset(2) == 6);
+  TEST_ASSERT(cellArray->GetCellSize(1) == 3);
+  TEST_ASSERT(cellArray->IsHomogeneous() == 3);
+  TEST_ASSERT(cellArray->GetMaxCellSize() == 3);
+
+  // Random access, iterators and in-place edition do not need the offsets
+  vtkNew<vtkIdList> ids;
+  cellArray->GetCellAtId(1, ids);
+  TEST_ASSERT(ids->GetNumberOfIds() == 3 && ids->GetId(0) == 3 && ids->GetId(2) == 5);
+  vtkIdType cellId = 0;
+  auto it = vtk::TakeSmartPointer(cellArray->NewIterator());
+  for (it->GoToFirstCell(); !it->IsDoneWithTraversal(); it->GoToNextCell(), ++cellId)
+  {
+    vtkIdType npts;
+    const vtkIdType* pts;
+    it->GetCurrentCell(npts, pts);
+    TEST_ASSERT(npts == 3 && pts[0] == 3 * cellId && pts[2] == 3 * cellId + 2);
+  }
+  TEST_ASSERT(cellId == 3);
+  cellArray->ReverseCellAtId(0);
+  cellArray->ReplaceCellAtId(2, { 8, 7, 6 });
+  validate(cellArray, 0, { 2, 1, 0 });
+  validate(cellArray, 2, { 8, 7, 6 });
+  cellArray->GetCell(4, ids); // legacy location of cell 1
+  TEST_ASSERT(ids->GetNumberOfIds() == 3 && ids->GetId(0) == 3);
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+
+  // Copies and appends of cells of the same size keep fixed size storage
+  vtkNew<vtkCellArray> deep;
+  deep->DeepCopy(cellArray);
+  TEST_ASSERT(deep->IsStorageFixedSize() && deep->GetNumberOfCells() == 3);
+  validate(deep, 2, { 8, 7, 6 });
+  vtkNew<vtkCellArray> shallow;
+  shallow->ShallowCopy(cellArray);
+  TEST_ASSERT(shallow->IsStorageFixedSize() && shallow->GetNumberOfCells() == 3);
+  TEST_ASSERT(shallow->GetConnectivityArray() == cellArray->GetConnectivityArray());
+  vtkNew<vtkCellArray> appended;
+  appended->Append(cellArray, 10);
+  appended->Append(deep);
+  TEST_ASSERT(appended->IsStorageFixedSize() && appended->GetNumberOfCells() == 6);
+  validate(appended, 1, { 13, 14, 15 });
+  validate(appended, 3, { 2, 1, 0 });
+
+  // Conversions between 32- and 64-bit storage keep fixed size storage
+  TEST_ASSERT(is64Bit ? deep->ConvertTo32BitStorage() : deep->ConvertTo64BitStorage());
+  TEST_ASSERT(deep->IsStorageFixedSize() && deep->IsStorage64Bit() != is64Bit);
+  TEST_ASSERT(deep->GetNumberOfCells() == 3 && deep->IsValid());
+  validate(deep, 1, { 3, 4, 5 });
+
+  // Requesting the offsets switches to variable size storage
+  vtkDataArray* offsets = shallow->GetOffsetsArray();
+  TEST_ASSERT(!shallow->IsStorageFixedSize() && shallow->IsValid());
+  TEST_ASSERT(offsets->GetNumberOfValues() == 4 && offsets->GetComponent(3, 0) == 9);
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+
+  // So does a cell of another size
+  TEST_ASSERT(cellArray->InsertNextCell({ 9, 10 }) == 3);
+  TEST_ASSERT(!cellArray->IsStorageFixedSize() && cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == 4 && cellArray->GetOffset(3) == 9);
+  validate(cellArray, 2, { 8, 7, 6 });
+  validate(cellArray, 3, { 9, 10 });
+  TEST_ASSERT(!cellArray->CanConvertToFixedSizeStorage());
+  TEST_ASSERT(!cellArray->ConvertToFixedSizeStorage());
+
+  // Conversions of cells that have the same size
+  vtkNew<vtkIdTypeArray> conn;
+  for (vtkIdType i = 0; i < 12; ++i)
+  {
+    conn->InsertNextValue(i);
+  }
+  TEST_ASSERT(cellArray->SetData(4, conn));
+  TEST_ASSERT(cellArray->IsStorageFixedSize() && cellArray->GetNumberOfCells() == 3);
+  validate(cellArray, 2, { 8, 9, 10, 11 });
+  TEST_ASSERT(cellArray->ConvertToVariableSizeStorage());
+  TEST_ASSERT(!cellArray->IsStorageFixedSize() && cellArray->IsValid());
+  TEST_ASSERT(cellArray->CanConvertToFixedSizeStorage());
+  TEST_ASSERT(cellArray->ConvertToFixedSizeStorage());
+  TEST_ASSERT(cellArray->IsStorageFixedSize() && cellArray->GetNumberOfCells() == 3);
+
+  // Appending to cells of another size generates the offsets
+  vtkNew<vtkCellArray> mixed;
+  mixed->InsertNextCell({ 0, 1 });
+  mixed->Append(cellArray, 2);
+  TEST_ASSERT(!mixed->IsStorageFixedSize() && mixed->IsValid());
+  TEST_ASSERT(mixed->GetNumberOfCells() == 4);
+  validate(mixed, 0, { 0, 1 });
+  validate(mixed, 3, { 10, 11, 12, 13 });
+  TEST_ASSERT(cellArray->IsStorageFixedSize());
+
+  // Reset and Initialize restore variable size storage
+  cellArray->Reset();
+  TEST_ASSERT(!cellArray->IsStorageFixedSize() && cellArray->IsValid());
+  TEST_ASSERT(cellArray->GetNumberOfCells() == 0);
+  appended->Initialize();
+  TEST_ASSERT(!appended->IsStorageFixedSize() && appended->IsValid());
+  TEST_ASSERT(appended->GetNumberOfCells() == 0);
+}
+
 void RunLegacyTests(bool use64BitStorage)
 {
   vtkLogScopeFunction(INFO);
@@ -1389,6 +1518,7 @@ void RunTests(bool use64BitStorage)
   TestAppend32(NewCellArray(use64BitStorage));
   TestAppend64(NewCellArray(use64BitStorage));
   TestLegacyFormatImportExportAppend(NewCellArray(use64BitStorage));
+  TestFixedSizeStorage(NewCellArray(use64BitStorage));
 
   RunLegacyTests(use64BitStorage);
 }
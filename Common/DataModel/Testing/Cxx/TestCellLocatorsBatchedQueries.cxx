@@ -0,0 +1,274 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the batched FindCells() and FindClosestPoints() queries of the
+// cell locators and of vtkCellLocatorStrategy match the queries point by
+// point, and that the locators built in parallel find the right cells.
+
+#include "vtkBVHCellLocator.h"
+#include "vtkCellLocator.h"
+#include "vtkCellLocatorStrategy.h"
+#include "vtkCellTreeLocator.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkLogger.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkStaticCellLocator.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+// Enough cells for the locators to be built by several threads
+constexpr int Resolution = 24;
+
+//------------------------------------------------------------------------------
+// A grid of hexahedra, sheared so that the cells are not aligned with the axes.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid()
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= Resolution; ++k)
+  {
+    for (int j = 0; j <= Resolution; ++j)
+    {
+      for (int i = 0; i <= Resolution; ++i)
+      {
+        points->InsertNextPoint(i + 0.3 * j, j + 0.2 * k, k + 0.1 * i);
+      }
+    }
+  }
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->AllocateExact(Resolution * Resolution * Resolution, 8);
+  const vtkIdType n = Resolution + 1;
+  for (vtkIdType k = 0; k < Resolution; ++k)
+  {
+    for (vtkIdType j = 0; j < Resolution; ++j)
+    {
+      for (vtkIdType i = 0; i < Resolution; ++i)
+      {
+        const vtkIdType p = i + n * (j + n * k);
+        const vtkIdType ids[8] = { p, p + 1, p + 1 + n, p + n, p + n * n, p + 1 + n * n,
+          p + 1 + n + n * n, p + n + n * n };
+        grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
+      }
+    }
+  }
+  return grid;
+}
+
+//------------------------------------------------------------------------------
+// Brute force search of the cells containing the points.
+std::vector<vtkIdType> FindCellsBruteForce(vtkUnstructuredGrid* grid, vtkPoints* points)
+{
+  std::vector<vtkIdType> cellIds(points->GetNumberOfPoints(), -1);
+  vtkNew<vtkGenericCell> cell;
+  double weights[8];
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3], closest[3], pcoords[3], dist2, bounds[6];
+    int subId;
+    points->GetPoint(ptId, x);
+    for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells() && cellIds[ptId] < 0; ++cellId)
+    {
+      grid->GetCellBounds(cellId, bounds);
+      if (x[0] < bounds[0] || x[0] > bounds[1] || x[1] < bounds[2] || x[1] > bounds[3] ||
+        x[2] < bounds[4] || x[2] > bounds[5])
+      {
+        continue;
+      }
+      grid->GetCell(cellId, cell);
+      if (cell->EvaluatePosition(x, closest, subId, pcoords, dist2, weights) == 1)
+      {
+        cellIds[ptId] = cellId;
+      }
+    }
+  }
+  return cellIds;
+}
+
+//------------------------------------------------------------------------------
+// Check the batched results against the expected cells, and check that the
+// weights interpolate the query points.
+bool CheckFindCells(vtkUnstructuredGrid* grid, vtkPoints* points,
+  const std::vector<vtkIdType>& expectedCellIds, vtkIdList* cellIds, vtkDoubleArray* pcoords,
+  vtkDoubleArray* weights, const char* name)
+{
+  vtkNew<vtkGenericCell> cell;
+  vtkIdType numFound = 0;
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3];
+    points->GetPoint(ptId, x);
+    const vtkIdType expected = expectedCellIds[ptId];
+    const vtkIdType cellId = cellIds->GetId(ptId);
+    if ((cellId < 0) != (expected < 0))
+    {
+      vtkLog(ERROR, << name << ": point " << ptId << " found in cell " << cellId << " instead of "
+                    << expected << ".");
+      return false;
+    }
+    if (cellId < 0)
+    {
+      if (pcoords->GetComponent(ptId, 0) != 0.0 || weights->GetComponent(ptId, 0) != 0.0)
+      {
+        vtkLog(ERROR, << name << ": point " << ptId << " outside the grid has coordinates.");
+        return false;
+      }
+      continue;
+    }
+    // Points within the tolerance of a face are in both cells of the face
+    double closest[3], pc[3], dist2, cellWeights[8];
+    int subId;
+    grid->GetCell(cellId, cell);
+    if (cell->EvaluatePosition(x, closest, subId, pc, dist2, cellWeights) != 1)
+    {
+      vtkLog(ERROR, << name << ": point " << ptId << " is not in cell " << cellId << ".");
+      return false;
+    }
+    ++numFound;
+    double interpolated[3] = { 0.0, 0.0, 0.0 };
+    double weightSum = 0.0;
+    for (int i = 0; i < 8; ++i)
+    {
+      const double w = weights->GetComponent(ptId, i);
+      double p[3];
+      cell->GetPoints()->GetPoint(i, p);
+      for (int c = 0; c < 3; ++c)
+      {
+        interpolated[c] += w * p[c];
+      }
+      weightSum += w;
+    }
+    double pcx[3];
+    pcoords->GetTuple(ptId, pcx);
+    if (std::abs(weightSum - 1.0) > 1e-6 ||
+      vtkMath::Distance2BetweenPoints(x, interpolated) > 1e-10 ||
+      vtkMath::Distance2BetweenPoints(pc, pcx) > 1e-10)
+    {
+      vtkLog(ERROR, << name << ": wrong coordinates or weights for point " << ptId << ".");
+      return false;
+    }
+  }
+  if (numFound == 0 || numFound == points->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, << name << ": the query points should be both inside and outside.");
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestLocator(vtkUnstructuredGrid* grid, vtkAbstractCellLocator* locator, vtkPoints* points,
+  const std::vector<vtkIdType>& expectedCellIds, bool closestPointQueries = true)
+{
+  const char* name = locator->GetClassName();
+  locator->SetDataSet(grid);
+  locator->BuildLocator();
+
+  vtkNew<vtkIdList> cellIds;
+  vtkNew<vtkDoubleArray> pcoords;
+  vtkNew<vtkDoubleArray> weights;
+  locator->FindCells(points, 0.0, cellIds, pcoords, weights);
+  if (cellIds->GetNumberOfIds() != points->GetNumberOfPoints() ||
+    pcoords->GetNumberOfComponents() != 3 || weights->GetNumberOfComponents() != 8 ||
+    !CheckFindCells(grid, points, expectedCellIds, cellIds, pcoords, weights, name))
+  {
+    return false;
+  }
+  if (!closestPointQueries)
+  {
+    return true;
+  }
+
+  // Closest points, point by point and batched
+  vtkNew<vtkPoints> closestPoints;
+  closestPoints->SetDataTypeToDouble();
+  vtkNew<vtkDoubleArray> dist2;
+  locator->FindClosestPoints(points, cellIds, closestPoints, dist2);
+  vtkNew<vtkGenericCell> cell;
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3], closest[3], d2;
+    vtkIdType cellId;
+    int subId;
+    points->GetPoint(ptId, x);
+    locator->FindClosestPoint(x, closest, cell, cellId, subId, d2);
+    if (std::abs(d2 - dist2->GetValue(ptId)) > 1e-12 ||
+      vtkMath::Distance2BetweenPoints(closest, closestPoints->GetPoint(ptId)) > 1e-12)
+    {
+      vtkLog(ERROR, << name << ": wrong closest point for point " << ptId << ".");
+      return false;
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestCellLocatorsBatchedQueries(int, char*[])
+{
+  auto grid = MakeGrid();
+
+  // Random query points, some of which are outside of the grid
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(4357);
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  for (int i = 0; i < 1000; ++i)
+  {
+    const double x = random->GetNextRangeValue(-2, Resolution + 9);
+    const double y = random->GetNextRangeValue(-2, Resolution + 6);
+    const double z = random->GetNextRangeValue(-2, Resolution + 4);
+    points->InsertNextPoint(x, y, z);
+  }
+  const auto expectedCellIds = FindCellsBruteForce(grid, points);
+
+  vtkNew<vtkBVHCellLocator> bvhCellLocator;
+  vtkNew<vtkCellLocator> cellLocator;
+  vtkNew<vtkCellTreeLocator> cellTreeLocator;
+  vtkNew<vtkStaticCellLocator> staticCellLocator;
+  // vtkCellTreeLocator does not support closest point queries
+  if (!TestLocator(grid, bvhCellLocator, points, expectedCellIds) ||
+    !TestLocator(grid, cellLocator, points, expectedCellIds) ||
+    !TestLocator(grid, cellTreeLocator, points, expectedCellIds, false) ||
+    !TestLocator(grid, staticCellLocator, points, expectedCellIds))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // The cells of each bucket of vtkCellLocator are sorted
+  for (int bucket = 0; bucket < cellLocator->GetNumberOfBuckets(); ++bucket)
+  {
+    vtkIdList* cells = cellLocator->GetCells(bucket);
+    for (vtkIdType i = 1; cells && i < cells->GetNumberOfIds(); ++i)
+    {
+      if (cells->GetId(i - 1) >= cells->GetId(i))
+      {
+        vtkLog(ERROR, "The cells of bucket " << bucket << " are not sorted.");
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Batched queries through a find cell strategy
+  grid->SetCellLocator(cellTreeLocator);
+  vtkNew<vtkCellLocatorStrategy> strategy;
+  strategy->Initialize(grid);
+  vtkNew<vtkIdList> cellIds;
+  vtkNew<vtkDoubleArray> pcoords;
+  vtkNew<vtkDoubleArray> weights;
+  strategy->FindCells(points, 0.0, cellIds, pcoords, weights);
+  if (!CheckFindCells(
+        grid, points, expectedCellIds, cellIds, pcoords, weights, "vtkCellLocatorStrategy"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
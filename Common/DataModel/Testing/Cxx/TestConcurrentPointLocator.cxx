@@ -0,0 +1,276 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the points inserted concurrently in vtkConcurrentPointLocator are
+// merged like with the sequential locators, and that its queries give the same
+// results as vtkStaticPointLocator.
+
+#include "vtkConcurrentPointLocator.h"
+#include "vtkIdList.h"
+#include "vtkLogger.h"
+#include "vtkMath.h"
+#include "vtkMergePoints.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointLocator.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkStaticPointLocator.h"
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Points on a coarse lattice, so that many of them are equal.
+std::vector<double> LatticePoints(vtkIdType numberOfPoints)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  std::vector<double> coordinates(3 * numberOfPoints);
+  for (double& c : coordinates)
+  {
+    c = std::floor(random->GetNextRangeValue(0.0, 30.0)) * 0.1 - 1.0;
+  }
+  return coordinates;
+}
+
+//------------------------------------------------------------------------------
+// Points jittered around the nodes of a lattice of spacing 1, by less than
+// 0.01 along each axis.
+std::vector<double> ClusteredPoints(vtkIdType numberOfPoints)
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(2);
+  std::vector<double> coordinates(3 * numberOfPoints);
+  for (double& c : coordinates)
+  {
+    c = std::floor(random->GetNextRangeValue(0.0, 8.0)) + random->GetNextRangeValue(-0.01, 0.01);
+  }
+  return coordinates;
+}
+
+//------------------------------------------------------------------------------
+// Insert the points sequentially into locator, and return their ids.
+std::vector<vtkIdType> InsertSequentially(
+  vtkIncrementalPointLocator* locator, const std::vector<double>& coordinates, vtkPoints* points)
+{
+  const double bounds[6] = { -1.0, 9.0, -1.0, 9.0, -1.0, 9.0 };
+  const vtkIdType numberOfPoints = static_cast<vtkIdType>(coordinates.size() / 3);
+  locator->InitPointInsertion(points, bounds, numberOfPoints);
+  std::vector<vtkIdType> ids(numberOfPoints);
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    locator->InsertUniquePoint(&coordinates[3 * i], ids[i]);
+  }
+  return ids;
+}
+
+//------------------------------------------------------------------------------
+// Insert the points concurrently, keyed by their index, then renumber them.
+// Return their final ids.
+std::vector<vtkIdType> InsertConcurrently(
+  double tolerance, const std::vector<double>& coordinates, vtkPoints* points)
+{
+  vtkNew<vtkConcurrentPointLocator> locator;
+  locator->SetTolerance(tolerance);
+  const double bounds[6] = { -1.0, 9.0, -1.0, 9.0, -1.0, 9.0 };
+  const vtkIdType numberOfPoints = static_cast<vtkIdType>(coordinates.size() / 3);
+  locator->InitPointInsertion(points, bounds, numberOfPoints);
+  std::vector<vtkIdType> ids(numberOfPoints);
+  vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      locator->InsertUniquePoint(&coordinates[3 * i], i, ids[i]);
+    }
+  });
+
+  // Every point is found again, with its id
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    if (locator->IsInsertedPoint(&coordinates[3 * i]) != ids[i])
+    {
+      vtkLog(ERROR, << "Point " << i << " is not found.");
+      return std::vector<vtkIdType>();
+    }
+  }
+
+  vtkNew<vtkIdList> newIds;
+  locator->RenumberInsertedPoints(newIds);
+  for (vtkIdType& id : ids)
+  {
+    id = newIds->GetId(id);
+  }
+  return ids;
+}
+
+//------------------------------------------------------------------------------
+bool TestExactMerging()
+{
+  const std::vector<double> coordinates = LatticePoints(100000);
+  vtkNew<vtkMergePoints> mergePoints;
+  vtkNew<vtkPoints> expectedPoints;
+  const std::vector<vtkIdType> expectedIds =
+    InsertSequentially(mergePoints, coordinates, expectedPoints);
+
+  vtkNew<vtkPoints> points;
+  const std::vector<vtkIdType> ids = InsertConcurrently(0.0, coordinates, points);
+  if (ids != expectedIds)
+  {
+    vtkLog(ERROR, << "The ids of the exactly merged points differ from vtkMergePoints.");
+    return false;
+  }
+  if (points->GetNumberOfPoints() != expectedPoints->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, << "Got " << points->GetNumberOfPoints() << " merged points instead of "
+                  << expectedPoints->GetNumberOfPoints() << ".");
+    return false;
+  }
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3], expected[3];
+    points->GetPoint(ptId, x);
+    expectedPoints->GetPoint(ptId, expected);
+    if (x[0] != expected[0] || x[1] != expected[1] || x[2] != expected[2])
+    {
+      vtkLog(ERROR, << "Point " << ptId << " differs from vtkMergePoints.");
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestToleranceMerging()
+{
+  const double tolerance = 0.05;
+  const std::vector<double> coordinates = ClusteredPoints(50000);
+  vtkNew<vtkPointLocator> pointLocator;
+  pointLocator->SetTolerance(tolerance);
+  vtkNew<vtkPoints> expectedPoints;
+  const std::vector<vtkIdType> expectedIds =
+    InsertSequentially(pointLocator, coordinates, expectedPoints);
+
+  // The clusters are well separated, so only the merged coordinates may differ
+  vtkNew<vtkPoints> points;
+  const std::vector<vtkIdType> ids = InsertConcurrently(tolerance, coordinates, points);
+  if (ids != expectedIds || points->GetNumberOfPoints() != expectedPoints->GetNumberOfPoints())
+  {
+    vtkLog(ERROR, << "The points merged with a tolerance differ from vtkPointLocator.");
+    return false;
+  }
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3], expected[3];
+    points->GetPoint(ptId, x);
+    expectedPoints->GetPoint(ptId, expected);
+    if (vtkMath::Distance2BetweenPoints(x, expected) > tolerance * tolerance)
+    {
+      vtkLog(ERROR, << "Point " << ptId << " is too far from the one of vtkPointLocator.");
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Squared distances from x to the points of ids.
+std::vector<double> Distances2(vtkPoints* points, const double x[3], vtkIdList* ids)
+{
+  std::vector<double> distances;
+  for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i)
+  {
+    double y[3];
+    points->GetPoint(ids->GetId(i), y);
+    distances.push_back(vtkMath::Distance2BetweenPoints(x, y));
+  }
+  return distances;
+}
+
+//------------------------------------------------------------------------------
+bool TestQueries()
+{
+  const std::vector<double> coordinates = LatticePoints(20000);
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(static_cast<vtkIdType>(coordinates.size() / 3));
+  for (vtkIdType ptId = 0; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    points->SetPoint(ptId, &coordinates[3 * ptId]);
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+
+  vtkNew<vtkStaticPointLocator> expectedLocator;
+  expectedLocator->SetDataSet(polyData);
+  expectedLocator->BuildLocator();
+  vtkNew<vtkConcurrentPointLocator> locator;
+  locator->SetDataSet(polyData);
+  locator->BuildLocator();
+
+  // Query points inside and outside the bounds of the points
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(3);
+  vtkNew<vtkIdList> ids, expectedIds;
+  for (int q = 0; q < 500; ++q)
+  {
+    double x[3];
+    for (double& c : x)
+    {
+      c = random->GetNextRangeValue(-3.0, 4.0);
+    }
+
+    // Equidistant points may be returned in another order, so compare distances
+    vtkIdType ptId = locator->FindClosestPoint(x);
+    vtkIdType expectedId = expectedLocator->FindClosestPoint(x);
+    double y[3], expected[3];
+    points->GetPoint(ptId, y);
+    points->GetPoint(expectedId, expected);
+    if (vtkMath::Distance2BetweenPoints(x, y) != vtkMath::Distance2BetweenPoints(x, expected))
+    {
+      vtkLog(ERROR, << "FindClosestPoint differs from vtkStaticPointLocator.");
+      return false;
+    }
+
+    double dist2, expectedDist2;
+    ptId = locator->FindClosestPointWithinRadius(0.5, x, dist2);
+    expectedId = expectedLocator->FindClosestPointWithinRadius(0.5, x, expectedDist2);
+    if ((ptId < 0) != (expectedId < 0) || (ptId >= 0 && dist2 != expectedDist2))
+    {
+      vtkLog(ERROR, << "FindClosestPointWithinRadius differs from vtkStaticPointLocator.");
+      return false;
+    }
+
+    locator->FindClosestNPoints(20, x, ids);
+    expectedLocator->FindClosestNPoints(20, x, expectedIds);
+    if (Distances2(points, x, ids) != Distances2(points, x, expectedIds))
+    {
+      vtkLog(ERROR, << "FindClosestNPoints differs from vtkStaticPointLocator.");
+      return false;
+    }
+
+    locator->FindPointsWithinRadius(0.3, x, ids);
+    expectedLocator->FindPointsWithinRadius(0.3, x, expectedIds);
+    std::sort(ids->begin(), ids->end());
+    std::sort(expectedIds->begin(), expectedIds->end());
+    if (ids->GetNumberOfIds() != expectedIds->GetNumberOfIds() ||
+      !std::equal(ids->begin(), ids->end(), expectedIds->begin()))
+    {
+      vtkLog(ERROR, << "FindPointsWithinRadius differs from vtkStaticPointLocator.");
+      return false;
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestConcurrentPointLocator(int, char*[])
+{
+  if (!TestExactMerging() || !TestToleranceMerging() || !TestQueries())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,252 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the batched interpolation of vtkDataSetAttributes, directly, with
+// a field list and deferred, matches the interpolation tuple by tuple.
+
+#include "vtkDataSetAttributes.h"
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkIdList.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkSOADataArrayTemplate.h"
+#include "vtkStringArray.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr vtkIdType NumberOfInputTuples = 1000;
+// Enough output tuples to be interpolated by several threads
+constexpr vtkIdType NumberOfOutputTuples = 50000;
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDataSetAttributes> MakeInput(vtkMinimalStandardRandomSequence* random)
+{
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  vtkNew<vtkFloatArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vtkNew<vtkIntArray> ints;
+  ints->SetName("Ints");
+  ints->SetNumberOfComponents(2);
+  vtkNew<vtkUnsignedCharArray> chars;
+  chars->SetName("Chars");
+  vtkNew<vtkSOADataArrayTemplate<double>> soa;
+  soa->SetName("SOA");
+  soa->SetNumberOfComponents(2);
+  vtkNew<vtkStringArray> strings;
+  strings->SetName("Strings");
+
+  for (vtkIdType i = 0; i < NumberOfInputTuples; ++i)
+  {
+    scalars->InsertNextValue(random->GetNextRangeValue(-10, 10));
+    vectors->InsertNextTuple3(random->GetNextRangeValue(-1, 1), random->GetNextRangeValue(-1, 1),
+      random->GetNextRangeValue(-1, 1));
+    ints->InsertNextTuple2(
+      static_cast<int>(random->GetNextRangeValue(-1000, 1000)), static_cast<int>(i));
+    chars->InsertNextValue(static_cast<unsigned char>(random->GetNextRangeValue(0, 255)));
+    soa->InsertNextTuple2(random->GetNextRangeValue(0, 1), -static_cast<double>(i));
+    strings->InsertNextValue(std::to_string(i));
+  }
+
+  auto input = vtkSmartPointer<vtkDataSetAttributes>::New();
+  input->AddArray(scalars);
+  input->AddArray(vectors);
+  input->AddArray(ints);
+  input->AddArray(chars);
+  input->AddArray(soa);
+  input->AddArray(strings);
+  input->SetActiveScalars("Scalars");
+  input->SetActiveVectors("Vectors");
+  return input;
+}
+
+//------------------------------------------------------------------------------
+// Random interpolation records, of 1 to 8 input tuples, written in a shuffled
+// order of the output tuples.
+struct Records
+{
+  std::vector<vtkIdType> ToIds;
+  std::vector<vtkIdType> Offsets;
+  std::vector<vtkIdType> FromIds;
+  std::vector<double> Weights;
+
+  Records(vtkMinimalStandardRandomSequence* random)
+  {
+    this->Offsets.push_back(0);
+    for (vtkIdType i = 0; i < NumberOfOutputTuples; ++i)
+    {
+      this->ToIds.push_back(i);
+      const int numIds = 1 + static_cast<int>(random->GetNextRangeValue(0, 8));
+      double sum = 0.0;
+      for (int j = 0; j < numIds; ++j)
+      {
+        this->FromIds.push_back(
+          static_cast<vtkIdType>(random->GetNextRangeValue(0, NumberOfInputTuples)));
+        this->Weights.push_back(random->GetNextRangeValue(0, 1));
+        sum += this->Weights.back();
+      }
+      for (int j = 0; j < numIds; ++j)
+      {
+        this->Weights[this->Weights.size() - 1 - j] /= sum;
+      }
+      this->Offsets.push_back(static_cast<vtkIdType>(this->FromIds.size()));
+    }
+    for (vtkIdType i = NumberOfOutputTuples - 1; i > 0; --i)
+    {
+      std::swap(this->ToIds[i],
+        this->ToIds[static_cast<vtkIdType>(random->GetNextRangeValue(0, static_cast<double>(i)))]);
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+bool CheckOutput(vtkDataSetAttributes* expected, vtkDataSetAttributes* output, const char* name)
+{
+  if (expected->GetNumberOfArrays() != output->GetNumberOfArrays())
+  {
+    vtkLog(ERROR, << name << ": wrong number of arrays.");
+    return false;
+  }
+  for (int a = 0; a < expected->GetNumberOfArrays(); ++a)
+  {
+    vtkAbstractArray* expectedArray = expected->GetAbstractArray(a);
+    vtkAbstractArray* array = output->GetAbstractArray(expectedArray->GetName());
+    if (!array || array->GetNumberOfTuples() != expectedArray->GetNumberOfTuples())
+    {
+      vtkLog(ERROR, << name << ": wrong array " << expectedArray->GetName() << ".");
+      return false;
+    }
+    for (vtkIdType i = 0; i < expectedArray->GetNumberOfValues(); ++i)
+    {
+      if (array->GetVariantValue(i) != expectedArray->GetVariantValue(i))
+      {
+        vtkLog(ERROR, << name << ": wrong value " << i << " of array "
+                      << expectedArray->GetName() << ".");
+        return false;
+      }
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestDataSetAttributesInterpolatePoints(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(5489);
+  auto input = MakeInput(random);
+  Records records(random);
+
+  for (int nearest = 0; nearest < 2; ++nearest)
+  {
+    // Nearest neighbor interpolation of the scalars, and no interpolation of the chars
+    auto allocate = [&](vtkDataSetAttributes* output) {
+      output->CopyFieldOff("Chars");
+      output->SetCopyAttribute(vtkDataSetAttributes::SCALARS, nearest ? 2 : 1,
+        vtkDataSetAttributes::INTERPOLATE);
+      output->InterpolateAllocate(input, NumberOfOutputTuples);
+    };
+
+    // Reference interpolation, tuple by tuple
+    vtkNew<vtkDataSetAttributes> expected;
+    allocate(expected);
+    vtkNew<vtkIdList> ids;
+    for (vtkIdType i = 0; i < NumberOfOutputTuples; ++i)
+    {
+      const vtkIdType first = records.Offsets[i];
+      ids->SetNumberOfIds(records.Offsets[i + 1] - first);
+      std::copy(records.FromIds.begin() + first, records.FromIds.begin() + records.Offsets[i + 1],
+        ids->begin());
+      expected->InterpolatePoint(input, records.ToIds[i], ids, &records.Weights[first]);
+    }
+
+    vtkNew<vtkDataSetAttributes> batched;
+    allocate(batched);
+    batched->InterpolatePoints(input, NumberOfOutputTuples, records.ToIds.data(),
+      records.Offsets.data(), records.FromIds.data(), records.Weights.data());
+    if (!CheckOutput(expected, batched, "InterpolatePoints"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    // Records interpolated in two batches with a field list
+    vtkDataSetAttributes::FieldList list;
+    list.InitializeFieldList(input);
+    vtkNew<vtkDataSetAttributes> listBatched;
+    listBatched->CopyFieldOff("Chars");
+    listBatched->SetCopyAttribute(
+      vtkDataSetAttributes::SCALARS, nearest ? 2 : 1, vtkDataSetAttributes::INTERPOLATE);
+    listBatched->InterpolateAllocate(list, NumberOfOutputTuples);
+    const vtkIdType half = NumberOfOutputTuples / 2;
+    listBatched->InterpolatePoints(list, input, 0, half, records.ToIds.data(),
+      records.Offsets.data(), records.FromIds.data(), records.Weights.data());
+    listBatched->InterpolatePoints(list, input, 0, NumberOfOutputTuples - half,
+      records.ToIds.data() + half, records.Offsets.data() + half, records.FromIds.data(),
+      records.Weights.data());
+    vtkNew<vtkDataSetAttributes> listExpected;
+    listExpected->CopyFieldOff("Chars");
+    listExpected->SetCopyAttribute(
+      vtkDataSetAttributes::SCALARS, nearest ? 2 : 1, vtkDataSetAttributes::INTERPOLATE);
+    listExpected->InterpolateAllocate(list, NumberOfOutputTuples);
+    for (vtkIdType i = 0; i < NumberOfOutputTuples; ++i)
+    {
+      const vtkIdType first = records.Offsets[i];
+      ids->SetNumberOfIds(records.Offsets[i + 1] - first);
+      std::copy(records.FromIds.begin() + first, records.FromIds.begin() + records.Offsets[i + 1],
+        ids->begin());
+      listExpected->InterpolatePoint(
+        list, input, 0, records.ToIds[i], ids, &records.Weights[first]);
+    }
+    if (!CheckOutput(listExpected, listBatched, "InterpolatePoints with a field list"))
+    {
+      return EXIT_FAILURE;
+    }
+
+    // Deferred edge and point interpolations, in more than one batch, mixed
+    // with interpolations from other attributes that are not deferred.
+    vtkNew<vtkDataSetAttributes> expectedEdges;
+    allocate(expectedEdges);
+    vtkNew<vtkDataSetAttributes> deferred;
+    allocate(deferred);
+    deferred->BeginDeferredInterpolation(input);
+    auto otherInput = MakeInput(random);
+    const vtkIdType numberOfEdges = 3 * NumberOfOutputTuples;
+    for (vtkIdType i = 0; i < numberOfEdges; ++i)
+    {
+      const vtkIdType p1 = static_cast<vtkIdType>(random->GetNextRangeValue(0, 1000));
+      const vtkIdType p2 = static_cast<vtkIdType>(random->GetNextRangeValue(0, 1000));
+      const double t = i % 10 == 0 ? 0.5 : random->GetNextRangeValue(0, 1);
+      vtkDataSetAttributes* from = i % 7 == 0 ? otherInput.Get() : input.Get();
+      if (i % 3 == 0)
+      {
+        const vtkIdType first = records.Offsets[i % NumberOfOutputTuples];
+        ids->SetNumberOfIds(records.Offsets[i % NumberOfOutputTuples + 1] - first);
+        std::copy(records.FromIds.begin() + first,
+          records.FromIds.begin() + records.Offsets[i % NumberOfOutputTuples + 1], ids->begin());
+        expectedEdges->InterpolatePoint(from, i, ids, &records.Weights[first]);
+        deferred->InterpolatePoint(from, i, ids, &records.Weights[first]);
+      }
+      else
+      {
+        expectedEdges->InterpolateEdge(from, i, p1, p2, t);
+        deferred->InterpolateEdge(from, i, p1, p2, t);
+      }
+    }
+    deferred->EndDeferredInterpolation();
+    if (!CheckOutput(expectedEdges, deferred, "deferred interpolation"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
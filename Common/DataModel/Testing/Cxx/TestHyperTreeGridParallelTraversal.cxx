@@ -0,0 +1,258 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the trees of a hyper tree grid traversed in parallel with super
+// cursors give the same results as a serial traversal, and that reordering the
+// cells along a Morton curve keeps the cell data with its cells.
+
+#include "vtkBitArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkHyperTree.h"
+#include "vtkHyperTreeGridNonOrientedCursor.h"
+#include "vtkHyperTreeGridNonOrientedMooreSuperCursor.h"
+#include "vtkHyperTreeGridNonOrientedVonNeumannSuperCursor.h"
+#include "vtkHyperTreeGridParallelTraversal.h"
+#include "vtkIdList.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkUniformHyperTreeGrid.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+void RecursivelyRefine(vtkHyperTreeGridNonOrientedCursor* cursor, vtkIdType treeIndex)
+{
+  const vtkIdType vertexId = cursor->GetVertexId();
+  if (cursor->GetLevel() == 3 || (treeIndex + 3 * vertexId) % 4 == 1)
+  {
+    // Mask some of the leaves
+    cursor->SetMask(cursor->GetLevel() > 0 && (treeIndex + vertexId) % 5 == 3);
+    return;
+  }
+  cursor->SetMask(false);
+  cursor->SubdivideLeaf();
+  for (unsigned char child = 0; child < cursor->GetNumberOfChildren(); ++child)
+  {
+    cursor->ToChild(child);
+    RecursivelyRefine(cursor, treeIndex);
+    cursor->ToParent();
+  }
+}
+
+//------------------------------------------------------------------------------
+// An octree grid of 4x3x2 trees, one of them missing, with a mask and a cell
+// array.
+void MakeGrid(vtkUniformHyperTreeGrid* htg)
+{
+  htg->SetBranchFactor(2);
+  htg->SetGridScale(1.0);
+  htg->SetOrigin(0.0, 0.0, 0.0);
+  htg->SetDimensions(5, 4, 3);
+  vtkNew<vtkBitArray> mask;
+  htg->SetMask(mask);
+  vtkNew<vtkHyperTreeGridNonOrientedCursor> cursor;
+  for (vtkIdType treeIndex = 0; treeIndex < htg->GetMaxNumberOfTrees(); ++treeIndex)
+  {
+    if (treeIndex == 5)
+    {
+      continue;
+    }
+    htg->InitializeNonOrientedCursor(cursor, treeIndex, true);
+    cursor->SetGlobalIndexStart(htg->GetNumberOfCells());
+    RecursivelyRefine(cursor, treeIndex);
+  }
+
+  // GetNumberOfCells() counts the root of the tree being started, so the
+  // global indices have gaps between the trees
+  vtkNew<vtkDoubleArray> values;
+  values->SetName("Values");
+  values->SetNumberOfTuples(htg->GetGlobalNodeIndexMax() + 1);
+  for (vtkIdType cellId = 0; cellId < values->GetNumberOfTuples(); ++cellId)
+  {
+    values->SetValue(cellId, 0.5 * cellId + 1.0);
+  }
+  htg->GetCellData()->AddArray(values);
+}
+
+//------------------------------------------------------------------------------
+// Sum the values of the unmasked neighbors of the unmasked leaves.
+template <class SuperCursorT>
+double RecursivelySumNeighbors(SuperCursorT* cursor, vtkDataArray* values)
+{
+  if (cursor->IsMasked())
+  {
+    return 0.0;
+  }
+  double sum = 0.0;
+  if (cursor->IsLeaf())
+  {
+    for (unsigned int i = 0; i < cursor->GetNumberOfCursors(); ++i)
+    {
+      if (cursor->HasTree(i) && !cursor->IsMasked(i))
+      {
+        sum += values->GetTuple1(cursor->GetGlobalNodeIndex(i));
+      }
+    }
+    return sum;
+  }
+  for (unsigned char child = 0; child < cursor->GetNumberOfChildren(); ++child)
+  {
+    cursor->ToChild(child);
+    sum += RecursivelySumNeighbors(cursor, values);
+    cursor->ToParent();
+  }
+  return sum;
+}
+
+//------------------------------------------------------------------------------
+template <class SuperCursorT>
+bool TestSuperCursor(vtkHyperTreeGrid* htg, const char* name)
+{
+  vtkDataArray* values = htg->GetCellData()->GetArray("Values");
+  std::vector<double> expected(htg->GetMaxNumberOfTrees(), 0.0);
+  vtkNew<vtkIdList> treeIndices;
+  htg->GetTreeIndices(treeIndices);
+  vtkNew<SuperCursorT> cursor;
+  for (vtkIdType treeIndex : *treeIndices)
+  {
+    cursor->Initialize(htg, treeIndex);
+    expected[treeIndex] = RecursivelySumNeighbors(cursor.Get(), values);
+  }
+
+  std::vector<double> sums(htg->GetMaxNumberOfTrees(), 0.0);
+  vtk::hypertreegrid::ForEachTree<SuperCursorT>(
+    htg, [&](SuperCursorT* treeCursor, vtkIdType treeIndex) {
+      sums[treeIndex] = RecursivelySumNeighbors(treeCursor, values);
+    });
+  if (sums != expected)
+  {
+    vtkLog(ERROR, << "The parallel traversal with the " << name << " differs.");
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// The values and masks of the cells of the trees, in depth-first order.
+void RecursivelyCollect(vtkHyperTreeGridNonOrientedCursor* cursor, vtkDataArray* values,
+  std::vector<double>& collected)
+{
+  const vtkIdType cellId = cursor->GetGlobalNodeIndex();
+  collected.push_back(values->GetTuple1(cellId));
+  collected.push_back(cursor->IsMasked() ? 1.0 : 0.0);
+  if (cursor->IsLeaf())
+  {
+    return;
+  }
+  for (unsigned char child = 0; child < cursor->GetNumberOfChildren(); ++child)
+  {
+    cursor->ToChild(child);
+    RecursivelyCollect(cursor, values, collected);
+    cursor->ToParent();
+  }
+}
+
+//------------------------------------------------------------------------------
+std::vector<double> Collect(vtkHyperTreeGrid* htg)
+{
+  std::vector<double> collected;
+  vtkDataArray* values = htg->GetCellData()->GetArray("Values");
+  vtkNew<vtkIdList> treeIndices;
+  htg->GetTreeIndices(treeIndices);
+  vtkNew<vtkHyperTreeGridNonOrientedCursor> cursor;
+  for (vtkIdType treeIndex : *treeIndices)
+  {
+    htg->InitializeNonOrientedCursor(cursor, treeIndex);
+    RecursivelyCollect(cursor, values, collected);
+  }
+  return collected;
+}
+
+//------------------------------------------------------------------------------
+// The global indices of the cells of a tree, in depth-first order.
+void RecursivelyGetIndices(vtkHyperTreeGridNonOrientedCursor* cursor, std::vector<vtkIdType>& ids)
+{
+  ids.push_back(cursor->GetGlobalNodeIndex());
+  if (!cursor->IsLeaf())
+  {
+    for (unsigned char child = 0; child < cursor->GetNumberOfChildren(); ++child)
+    {
+      cursor->ToChild(child);
+      RecursivelyGetIndices(cursor, ids);
+      cursor->ToParent();
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+bool TestMortonOrder(vtkHyperTreeGrid* htg)
+{
+  const auto expected = Collect(htg);
+  const vtkIdType numberOfCells = htg->GetNumberOfCells();
+  htg->ReorderCellsAlongMortonCurve();
+  if (Collect(htg) != expected)
+  {
+    vtkLog(ERROR, << "The cell data or the mask did not follow the cells.");
+    return false;
+  }
+  if (htg->GetCellData()->GetArray("Values")->GetNumberOfTuples() != numberOfCells ||
+    htg->GetMask()->GetNumberOfTuples() != numberOfCells)
+  {
+    vtkLog(ERROR, << "Wrong number of reordered values.");
+    return false;
+  }
+
+  // The trees at (i, j, k) in {0, 1}^3 come first, in Morton order (tree 5,
+  // at (1, 1, 0), is missing), and the cells of each tree are consecutive.
+  const unsigned int firstTrees[7][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 0, 1, 0 }, { 0, 0, 1 },
+    { 1, 0, 1 }, { 0, 1, 1 }, { 1, 1, 1 } };
+  vtkIdType next = 0;
+  vtkNew<vtkHyperTreeGridNonOrientedCursor> cursor;
+  for (const auto& ijk : firstTrees)
+  {
+    vtkIdType treeIndex;
+    htg->GetIndexFromLevelZeroCoordinates(treeIndex, ijk[0], ijk[1], ijk[2]);
+    htg->InitializeNonOrientedCursor(cursor, treeIndex);
+    std::vector<vtkIdType> ids;
+    RecursivelyGetIndices(cursor, ids);
+    for (vtkIdType id : ids)
+    {
+      if (id != next++)
+      {
+        vtkLog(ERROR, << "Wrong index " << id << " in tree " << treeIndex << ".");
+        return false;
+      }
+    }
+  }
+
+  // Reordering again does not change anything
+  htg->ReorderCellsAlongMortonCurve();
+  if (Collect(htg) != expected)
+  {
+    vtkLog(ERROR, << "Reordering twice failed.");
+    return false;
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestHyperTreeGridParallelTraversal(int, char*[])
+{
+  vtkNew<vtkUniformHyperTreeGrid> htg;
+  MakeGrid(htg);
+
+  if (!TestSuperCursor<vtkHyperTreeGridNonOrientedMooreSuperCursor>(htg, "Moore super cursor") ||
+    !TestSuperCursor<vtkHyperTreeGridNonOrientedVonNeumannSuperCursor>(
+      htg, "von Neumann super cursor") ||
+    !TestMortonOrder(htg) ||
+    !TestSuperCursor<vtkHyperTreeGridNonOrientedMooreSuperCursor>(
+      htg, "Moore super cursor after reordering"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
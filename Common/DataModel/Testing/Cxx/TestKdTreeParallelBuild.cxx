@@ -0,0 +1,187 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the k-d trees built in parallel are the same as the ones built
+// with a single thread, and that the cells are assigned to consistent regions.
+
+#include "vtkBSPCuts.h"
+#include "vtkCellArray.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkKdNode.h"
+#include "vtkKdTree.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// The bounds, data bounds and number of points of the nodes, in depth-first
+// order.
+void CollectNodes(vtkKdNode* node, std::vector<double>& collected)
+{
+  double bounds[6];
+  node->GetBounds(bounds);
+  collected.insert(collected.end(), bounds, bounds + 6);
+  node->GetDataBounds(bounds);
+  collected.insert(collected.end(), bounds, bounds + 6);
+  collected.push_back(node->GetNumberOfPoints());
+  collected.push_back(node->GetDim());
+  if (node->GetLeft())
+  {
+    CollectNodes(node->GetLeft(), collected);
+    CollectNodes(node->GetRight(), collected);
+  }
+}
+
+//------------------------------------------------------------------------------
+void CollectLeaves(vtkKdNode* node, std::vector<vtkKdNode*>& leaves)
+{
+  if (node->GetLeft())
+  {
+    CollectLeaves(node->GetLeft(), leaves);
+    CollectLeaves(node->GetRight(), leaves);
+  }
+  else
+  {
+    leaves.push_back(node);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Build a k-d tree of the cells of dataSet with at most numberOfThreads
+// threads (0 for the default), and return its nodes.
+std::vector<double> BuildFromCells(vtkDataSet* dataSet, int numberOfThreads, std::vector<int>& ids)
+{
+  vtkNew<vtkKdTree> kdTree;
+  kdTree->SetDataSet(dataSet);
+  kdTree->SetMinCells(20);
+  vtkSMPTools::LocalScope(
+    vtkSMPTools::Config(numberOfThreads), [&]() { kdTree->BuildLocator(); });
+  const int* regionIds = kdTree->AllGetRegionContainingCell();
+  ids.assign(regionIds, regionIds + dataSet->GetNumberOfCells());
+  std::vector<double> nodes;
+  CollectNodes(kdTree->GetCuts()->GetKdNodeTree(), nodes);
+
+  // Each cell is in a region, and the regions have as many cells as points
+  std::vector<vtkKdNode*> leaves;
+  CollectLeaves(kdTree->GetCuts()->GetKdNodeTree(), leaves);
+  std::vector<int> counts(leaves.size(), 0);
+  for (int regionId : ids)
+  {
+    if (regionId < 0 || regionId >= static_cast<int>(leaves.size()))
+    {
+      vtkLog(ERROR, << "Wrong region " << regionId << ".");
+      return std::vector<double>();
+    }
+    ++counts[regionId];
+  }
+  for (vtkKdNode* leaf : leaves)
+  {
+    if (counts[leaf->GetID()] != leaf->GetNumberOfPoints())
+    {
+      vtkLog(ERROR, << "Region " << leaf->GetID() << " has " << counts[leaf->GetID()]
+                    << " cells instead of " << leaf->GetNumberOfPoints() << ".");
+      return std::vector<double>();
+    }
+  }
+  return nodes;
+}
+
+//------------------------------------------------------------------------------
+bool TestCells(vtkDataSet* dataSet, const char* name)
+{
+  std::vector<int> expectedIds, ids;
+  const std::vector<double> expected = BuildFromCells(dataSet, 1, expectedIds);
+  const std::vector<double> nodes = BuildFromCells(dataSet, 0, ids);
+  if (expected.empty() || nodes.empty())
+  {
+    return false;
+  }
+  if (nodes != expected || ids != expectedIds)
+  {
+    vtkLog(ERROR, << "The k-d tree of the cells of the " << name << " differs when using "
+                  << vtkSMPTools::GetBackend() << ".");
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestPoints(vtkPoints* points)
+{
+  vtkNew<vtkKdTree> expected;
+  vtkSMPTools::LocalScope(
+    vtkSMPTools::Config(1), [&]() { expected->BuildLocatorFromPoints(points); });
+  vtkNew<vtkKdTree> kdTree;
+  kdTree->BuildLocatorFromPoints(points);
+  if (kdTree->GetNumberOfRegions() != expected->GetNumberOfRegions())
+  {
+    vtkLog(ERROR, << "Wrong number of regions.");
+    return false;
+  }
+  for (int regionId = 0; regionId < kdTree->GetNumberOfRegions(); ++regionId)
+  {
+    vtkIdTypeArray* ids = kdTree->GetPointsInRegion(regionId);
+    vtkIdTypeArray* expectedIds = expected->GetPointsInRegion(regionId);
+    if (ids->GetNumberOfValues() != expectedIds->GetNumberOfValues() ||
+      !std::equal(ids->GetPointer(0), ids->GetPointer(0) + ids->GetNumberOfValues(),
+        expectedIds->GetPointer(0)))
+    {
+      vtkLog(ERROR, << "The points of region " << regionId << " differ.");
+      return false;
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestKdTreeParallelBuild(int, char*[])
+{
+  // Many equal cell centers
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(41, 41, 41);
+  image->SetSpacing(0.5, 1.0, 0.75);
+
+  // Random vertices, with a few duplicates
+  const vtkIdType numberOfPoints = 50000;
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  vtkNew<vtkPoints> points;
+  points->SetNumberOfPoints(numberOfPoints);
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    double x[3];
+    for (int c = 0; c < 3; ++c)
+    {
+      x[c] = random->GetNextRangeValue(-1.0, 1.0);
+    }
+    points->SetPoint(i, x);
+    if (i % 10 == 9)
+    {
+      points->SetPoint(i - 5, x);
+    }
+  }
+  vtkNew<vtkCellArray> verts;
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    verts->InsertNextCell(1, &i);
+  }
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+  polyData->SetVerts(verts);
+
+  if (!TestCells(image, "image") || !TestCells(polyData, "vertices") || !TestPoints(points))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
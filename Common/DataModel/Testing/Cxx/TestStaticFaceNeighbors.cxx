@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the face neighbors cached on a vtkUnstructuredGrid answer the
+// neighborhood queries on faces like the cell links.
+
+#include "vtkCell.h"
+#include "vtkCellArray.h"
+#include "vtkGenericCell.h"
+#include "vtkHexahedron.h"
+#include "vtkIdList.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticFaceNeighbors.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+constexpr int Dimensions[3] = { 5, 4, 3 };
+
+//------------------------------------------------------------------------------
+vtkIdType PointId(int i, int j, int k)
+{
+  return i + (Dimensions[0] + 1) * (j + (Dimensions[1] + 1) * k);
+}
+
+//------------------------------------------------------------------------------
+// A grid of hexahedra, some of them being polyhedra, a few quads on its
+// boundary, and a separate cube split in tetrahedra.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid()
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= Dimensions[2]; ++k)
+  {
+    for (int j = 0; j <= Dimensions[1]; ++j)
+    {
+      for (int i = 0; i <= Dimensions[0]; ++i)
+      {
+        points->InsertNextPoint(i, j, k);
+      }
+    }
+  }
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->AllocateEstimate(1024, 8);
+
+  for (int k = 0; k < Dimensions[2]; ++k)
+  {
+    for (int j = 0; j < Dimensions[1]; ++j)
+    {
+      for (int i = 0; i < Dimensions[0]; ++i)
+      {
+        const vtkIdType hex[8] = { PointId(i, j, k), PointId(i + 1, j, k),
+          PointId(i + 1, j + 1, k), PointId(i, j + 1, k), PointId(i, j, k + 1),
+          PointId(i + 1, j, k + 1), PointId(i + 1, j + 1, k + 1), PointId(i, j + 1, k + 1) };
+        if ((i + j + k) % 3 == 1)
+        {
+          vtkNew<vtkCellArray> faces;
+          for (vtkIdType faceId = 0; faceId < vtkHexahedron::NumberOfFaces; ++faceId)
+          {
+            const vtkIdType* localIds = vtkHexahedron::GetFaceArray(faceId);
+            const vtkIdType face[4] = { hex[localIds[0]], hex[localIds[1]], hex[localIds[2]],
+              hex[localIds[3]] };
+            faces->InsertNextCell(4, face);
+          }
+          grid->InsertNextCell(VTK_POLYHEDRON, 8, hex, faces);
+        }
+        else
+        {
+          grid->InsertNextCell(VTK_HEXAHEDRON, 8, hex);
+        }
+      }
+    }
+  }
+
+  // A cube split in five tetrahedra, away from the hexahedra
+  vtkIdType cube[8];
+  for (int p = 0; p < 8; ++p)
+  {
+    cube[p] = points->InsertNextPoint(
+      Dimensions[0] + 5.0 + ((p + 1) / 2) % 2, (p / 2) % 2, p / 4);
+  }
+  const vtkIdType tets[5][4] = { { cube[0], cube[1], cube[3], cube[4] },
+    { cube[1], cube[2], cube[3], cube[6] }, { cube[1], cube[4], cube[5], cube[6] },
+    { cube[3], cube[4], cube[6], cube[7] }, { cube[1], cube[3], cube[4], cube[6] } };
+  for (const auto& tet : tets)
+  {
+    grid->InsertNextCell(VTK_TETRA, 4, tet);
+  }
+
+  // Quads on the bottom boundary, matching the faces of the cells below
+  for (int i = 0; i < Dimensions[0] - 1; ++i)
+  {
+    const vtkIdType quad[4] = { PointId(i, 0, 0), PointId(i, 1, 0), PointId(i + 1, 1, 0),
+      PointId(i + 1, 0, 0) };
+    grid->InsertNextCell(VTK_QUAD, 4, quad);
+  }
+  return grid;
+}
+
+//------------------------------------------------------------------------------
+// The neighbors of all the faces of the 3D cells, in order.
+std::vector<std::vector<vtkIdType>> GetAllFaceNeighbors(vtkUnstructuredGrid* grid)
+{
+  std::vector<std::vector<vtkIdType>> allNeighbors;
+  vtkNew<vtkGenericCell> cell;
+  vtkNew<vtkIdList> neighbors;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    grid->GetCell(cellId, cell);
+    for (int faceId = 0; faceId < cell->GetNumberOfFaces(); ++faceId)
+    {
+      vtkIdList* facePts = cell->GetFace(faceId)->GetPointIds();
+      grid->GetCellNeighbors(cellId, facePts, neighbors);
+      std::vector<vtkIdType> ids(neighbors->begin(), neighbors->end());
+      std::sort(ids.begin(), ids.end());
+      allNeighbors.push_back(ids);
+
+      vtkIdType neighborCellId;
+      const bool isBoundary = grid->IsCellBoundary(
+        cellId, facePts->GetNumberOfIds(), facePts->GetPointer(0), neighborCellId);
+      if (isBoundary != ids.empty() ||
+        (!isBoundary && std::find(ids.begin(), ids.end(), neighborCellId) == ids.end()))
+      {
+        vtkLog(ERROR, << "IsCellBoundary and GetCellNeighbors disagree for cell " << cellId);
+        allNeighbors.clear();
+        return allNeighbors;
+      }
+    }
+  }
+  return allNeighbors;
+}
+} // anonymous namespace
+
+int TestStaticFaceNeighbors(int, char*[])
+{
+  auto grid = MakeGrid();
+
+  // Reference answers from the cell links
+  const auto expected = GetAllFaceNeighbors(grid);
+  if (expected.empty())
+  {
+    return EXIT_FAILURE;
+  }
+
+  grid->BuildFaceNeighbors();
+  vtkStaticFaceNeighbors* faceNeighbors = grid->GetFaceNeighbors();
+  if (!faceNeighbors || faceNeighbors->GetNumberOfCells() != grid->GetNumberOfCells() ||
+    faceNeighbors->GetNumberOfFaces() != static_cast<vtkIdType>(expected.size()))
+  {
+    vtkLog(ERROR, << "Wrong face neighbors.");
+    return EXIT_FAILURE;
+  }
+
+  // The neighbors stored for each face
+  size_t face = 0;
+  vtkIdType numBoundaryFaces = 0;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    for (vtkIdType faceId = 0; faceId < faceNeighbors->GetNumberOfCellFaces(cellId);
+         ++faceId, ++face)
+    {
+      const vtkIdType neighbor = faceNeighbors->GetFaceNeighbor(cellId, faceId);
+      const auto& ids = expected[face];
+      if ((ids.empty() && neighbor != vtkStaticFaceNeighbors::BOUNDARY_FACE) ||
+        (ids.size() == 1 && neighbor != ids[0]) ||
+        (ids.size() > 1 && neighbor != vtkStaticFaceNeighbors::MULTIPLE_NEIGHBORS))
+      {
+        vtkLog(ERROR, << "Wrong neighbor for face " << faceId << " of cell " << cellId << ".");
+        return EXIT_FAILURE;
+      }
+      numBoundaryFaces += ids.empty() ? 1 : 0;
+    }
+  }
+  if (numBoundaryFaces == 0)
+  {
+    vtkLog(ERROR, << "The grid should have boundary faces.");
+    return EXIT_FAILURE;
+  }
+
+  // The queries answered with the face neighbors
+  if (GetAllFaceNeighbors(grid) != expected)
+  {
+    vtkLog(ERROR, << "The queries with the face neighbors do not match the cell links.");
+    return EXIT_FAILURE;
+  }
+
+  // Shallow copies share the face neighbors
+  vtkNew<vtkUnstructuredGrid> copy;
+  copy->ShallowCopy(grid);
+  if (copy->GetFaceNeighbors() != faceNeighbors)
+  {
+    vtkLog(ERROR, << "The face neighbors should be shared by shallow copies.");
+    return EXIT_FAILURE;
+  }
+
+  // Modifying the cells invalidates the face neighbors
+  grid->GetCells()->Modified();
+  if (grid->GetFaceNeighbors())
+  {
+    vtkLog(ERROR, << "The face neighbors should be out of date.");
+    return EXIT_FAILURE;
+  }
+  grid->BuildFaceNeighbors();
+  if (!grid->GetFaceNeighbors() || grid->GetFaceNeighbors() == faceNeighbors)
+  {
+    vtkLog(ERROR, << "The face neighbors should have been rebuilt.");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
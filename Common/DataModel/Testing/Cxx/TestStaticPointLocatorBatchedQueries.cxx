@@ -0,0 +1,162 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the batched neighbor queries of vtkStaticPointLocator match the
+// queries made one point at a time.
+
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMath.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkStaticPointLocator.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+void RandomPoints(vtkMinimalStandardRandomSequence* random, vtkIdType numPts, double range,
+  vtkPoints* points)
+{
+  points->SetNumberOfPoints(numPts);
+  for (vtkIdType i = 0; i < numPts; ++i)
+  {
+    double x[3];
+    for (int j = 0; j < 3; ++j)
+    {
+      x[j] = random->GetNextRangeValue(-range, range);
+    }
+    points->SetPoint(i, x);
+  }
+}
+
+//------------------------------------------------------------------------------
+// Compare the neighbors of a query with the single point query result. The
+// radius results are not sorted, so they are compared as sets.
+bool CheckNeighbors(vtkPoints* points, const double x[3], vtkIdList* expected,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2, vtkIdType qId,
+  bool sorted, const char* name)
+{
+  vtkIdType begin = offsets->GetValue(qId);
+  vtkIdType end = offsets->GetValue(qId + 1);
+  if (end - begin != expected->GetNumberOfIds())
+  {
+    vtkLog(ERROR, << name << ": wrong number of neighbors for query " << qId << ".");
+    return false;
+  }
+  std::vector<vtkIdType> result(ids->GetPointer(begin), ids->GetPointer(end));
+  std::vector<vtkIdType> reference(expected->begin(), expected->end());
+  if (!sorted)
+  {
+    std::sort(result.begin(), result.end());
+    std::sort(reference.begin(), reference.end());
+  }
+  if (result != reference)
+  {
+    vtkLog(ERROR, << name << ": wrong neighbors for query " << qId << ".");
+    return false;
+  }
+  for (vtkIdType i = begin; i < end; ++i)
+  {
+    double pt[3];
+    points->GetPoint(ids->GetValue(i), pt);
+    if (dist2->GetValue(i) != vtkMath::Distance2BetweenPoints(x, pt))
+    {
+      vtkLog(ERROR, << name << ": wrong distance for query " << qId << ".");
+      return false;
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestStaticPointLocatorBatchedQueries(int, char*[])
+{
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1177);
+
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  RandomPoints(random, 20000, 1.0, points);
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(points);
+
+  // Some of the queries are outside of the locator bounds
+  vtkNew<vtkPoints> queries;
+  RandomPoints(random, 5000, 1.2, queries);
+
+  vtkNew<vtkStaticPointLocator> locator;
+  locator->SetDataSet(polyData);
+  locator->SetNumberOfPointsPerBucket(4);
+  locator->BuildLocator();
+
+  vtkNew<vtkIdTypeArray> offsets;
+  vtkNew<vtkIdTypeArray> ids;
+  vtkNew<vtkDoubleArray> dist2;
+  vtkNew<vtkIdList> expected;
+  double x[3];
+
+  const int numbersOfNeighbors[] = { 1, 10, 33 };
+  for (int N : numbersOfNeighbors)
+  {
+    locator->FindClosestNPoints(N, queries, offsets, ids, dist2);
+    if (offsets->GetNumberOfValues() != queries->GetNumberOfPoints() + 1)
+    {
+      vtkLog(ERROR, << "FindClosestNPoints: wrong number of offsets.");
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType qId = 0; qId < queries->GetNumberOfPoints(); ++qId)
+    {
+      queries->GetPoint(qId, x);
+      locator->FindClosestNPoints(N, x, expected);
+      if (!CheckNeighbors(
+            points, x, expected, offsets, ids, dist2, qId, true, "FindClosestNPoints"))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  const double radii[] = { 0.0, 0.02, 0.15 };
+  for (double R : radii)
+  {
+    locator->FindPointsWithinRadius(R, queries, offsets, ids, dist2);
+    for (vtkIdType qId = 0; qId < queries->GetNumberOfPoints(); ++qId)
+    {
+      queries->GetPoint(qId, x);
+      locator->FindPointsWithinRadius(R, x, expected);
+      if (!CheckNeighbors(
+            points, x, expected, offsets, ids, dist2, qId, false, "FindPointsWithinRadius"))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Asking for more neighbors than there are points returns all the points
+  vtkNew<vtkPoints> fewPoints;
+  RandomPoints(random, 20, 1.0, fewPoints);
+  vtkNew<vtkPolyData> fewPolyData;
+  fewPolyData->SetPoints(fewPoints);
+  locator->SetDataSet(fewPolyData);
+  locator->FindClosestNPoints(50, queries, offsets, ids, dist2);
+  for (vtkIdType qId = 0; qId < queries->GetNumberOfPoints(); ++qId)
+  {
+    queries->GetPoint(qId, x);
+    locator->FindClosestNPoints(50, x, expected);
+    if (expected->GetNumberOfIds() != 20 ||
+      !CheckNeighbors(
+        fewPoints, x, expected, offsets, ids, dist2, qId, true, "FindClosestNPoints (all)"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,316 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the polyhedra bound to the topology cached on a
+// vtkUnstructuredGrid behave like the polyhedra deriving it themselves.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkHexahedron.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMergePoints.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyhedron.h"
+#include "vtkSmartPointer.h"
+#include "vtkStaticPolyhedronTopology.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <vector>
+
+namespace
+{
+constexpr int Dimensions[3] = { 3, 3, 2 };
+
+//------------------------------------------------------------------------------
+vtkIdType PointId(int i, int j, int k)
+{
+  return i + (Dimensions[0] + 1) * (j + (Dimensions[1] + 1) * k);
+}
+
+//------------------------------------------------------------------------------
+// Hexahedra stored as polyhedra, one of them with a dent in its top face,
+// and an open box (missing its top face) away from them.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid()
+{
+  vtkNew<vtkPoints> points;
+  for (int k = 0; k <= Dimensions[2]; ++k)
+  {
+    for (int j = 0; j <= Dimensions[1]; ++j)
+    {
+      for (int i = 0; i <= Dimensions[0]; ++i)
+      {
+        points->InsertNextPoint(i + 0.1 * j, j, k);
+      }
+    }
+  }
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  grid->SetPoints(points);
+  grid->AllocateEstimate(64, 8);
+
+  for (int k = 0; k < Dimensions[2]; ++k)
+  {
+    for (int j = 0; j < Dimensions[1]; ++j)
+    {
+      for (int i = 0; i < Dimensions[0]; ++i)
+      {
+        std::vector<vtkIdType> ids = { PointId(i, j, k), PointId(i + 1, j, k),
+          PointId(i + 1, j + 1, k), PointId(i, j + 1, k), PointId(i, j, k + 1),
+          PointId(i + 1, j, k + 1), PointId(i + 1, j + 1, k + 1), PointId(i, j + 1, k + 1) };
+        vtkNew<vtkCellArray> faces;
+        for (vtkIdType faceId = 0; faceId < vtkHexahedron::NumberOfFaces; ++faceId)
+        {
+          const vtkIdType* localIds = vtkHexahedron::GetFaceArray(faceId);
+          const vtkIdType face[4] = { ids[localIds[0]], ids[localIds[1]], ids[localIds[2]],
+            ids[localIds[3]] };
+          if (faceId == 5 && i == 1 && j == 1 && k == 1)
+          {
+            // The top face goes down to a point inside the hexahedron
+            double center[3] = { 0, 0, 0 };
+            for (int p = 4; p < 8; ++p)
+            {
+              double x[3];
+              points->GetPoint(ids[p], x);
+              center[0] += 0.25 * x[0];
+              center[1] += 0.25 * x[1];
+              center[2] += 0.25 * x[2] - 0.125;
+            }
+            ids.push_back(points->InsertNextPoint(center));
+            for (int p = 0; p < 4; ++p)
+            {
+              const vtkIdType tri[3] = { face[p], face[(p + 1) % 4], ids.back() };
+              faces->InsertNextCell(3, tri);
+            }
+            continue;
+          }
+          faces->InsertNextCell(4, face);
+        }
+        grid->InsertNextCell(
+          VTK_POLYHEDRON, static_cast<vtkIdType>(ids.size()), ids.data(), faces);
+      }
+    }
+  }
+
+  vtkIdType box[8];
+  for (int p = 0; p < 8; ++p)
+  {
+    box[p] = points->InsertNextPoint(10.0 + ((p + 1) / 2) % 2, (p / 2) % 2, p / 4);
+  }
+  vtkNew<vtkCellArray> faces;
+  for (vtkIdType faceId = 0; faceId < vtkHexahedron::NumberOfFaces - 1; ++faceId)
+  {
+    const vtkIdType* localIds = vtkHexahedron::GetFaceArray(faceId);
+    const vtkIdType face[4] = { box[localIds[0]], box[localIds[1]], box[localIds[2]],
+      box[localIds[3]] };
+    faces->InsertNextCell(4, face);
+  }
+  grid->InsertNextCell(VTK_POLYHEDRON, 8, box, faces);
+  return grid;
+}
+
+//------------------------------------------------------------------------------
+std::vector<vtkIdType> GetIds(vtkCell* cell)
+{
+  return std::vector<vtkIdType>(cell->GetPointIds()->begin(), cell->GetPointIds()->end());
+}
+
+//------------------------------------------------------------------------------
+// The output of contouring or clipping a cell, as the coordinates of the
+// output points and the output cells.
+struct CellOutput
+{
+  std::vector<double> Points;
+  std::vector<vtkIdType> Cells;
+
+  bool operator==(const CellOutput& other) const
+  {
+    return this->Points == other.Points && this->Cells == other.Cells;
+  }
+};
+
+//------------------------------------------------------------------------------
+CellOutput ContourOrClip(vtkUnstructuredGrid* grid, vtkPolyhedron* cell, bool clip)
+{
+  vtkNew<vtkDoubleArray> cellScalars;
+  for (vtkIdType i = 0; i < cell->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    cell->GetPoints()->GetPoint(i, x);
+    cellScalars->InsertNextValue(x[0] + 0.6 * x[1] + 0.3 * x[2]);
+  }
+  const double value = 2.0;
+
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkMergePoints> locator;
+  locator->InitPointInsertion(points, grid->GetBounds());
+  vtkNew<vtkPointData> outPd;
+  outPd->InterpolateAllocate(grid->GetPointData());
+  vtkNew<vtkCellData> outCd;
+  outCd->CopyAllocate(grid->GetCellData());
+  vtkNew<vtkCellArray> cells;
+  if (clip)
+  {
+    cell->Clip(value, cellScalars, locator, cells, grid->GetPointData(), outPd,
+      grid->GetCellData(), 0, outCd, 0);
+  }
+  else
+  {
+    cell->Contour(value, cellScalars, locator, nullptr, nullptr, cells, grid->GetPointData(),
+      outPd, grid->GetCellData(), 0, outCd);
+  }
+
+  CellOutput output;
+  for (vtkIdType i = 0; i < points->GetNumberOfPoints(); ++i)
+  {
+    double x[3];
+    points->GetPoint(i, x);
+    output.Points.insert(output.Points.end(), x, x + 3);
+  }
+  vtkNew<vtkIdTypeArray> legacyCells;
+  cells->ExportLegacyFormat(legacyCells);
+  output.Cells.assign(legacyCells->GetPointer(0),
+    legacyCells->GetPointer(0) + legacyCells->GetNumberOfValues());
+  return output;
+}
+
+//------------------------------------------------------------------------------
+bool SameCells(vtkUnstructuredGrid* grid, vtkUnstructuredGrid* reference, vtkIdType cellId,
+  vtkGenericCell* genericCell, vtkGenericCell* referenceGenericCell)
+{
+  grid->GetCell(cellId, genericCell);
+  reference->GetCell(cellId, referenceGenericCell);
+  auto cell = static_cast<vtkPolyhedron*>(genericCell->GetRepresentativeCell());
+  auto referenceCell = static_cast<vtkPolyhedron*>(referenceGenericCell->GetRepresentativeCell());
+  if (!cell->GetTopology() || referenceCell->GetTopology())
+  {
+    vtkLog(ERROR, << "Only the polyhedra of the grid should be bound to a topology.");
+    return false;
+  }
+
+  if (cell->GetNumberOfFaces() != referenceCell->GetNumberOfFaces() ||
+    cell->GetNumberOfEdges() != referenceCell->GetNumberOfEdges() ||
+    cell->IsConvex() != referenceCell->IsConvex())
+  {
+    vtkLog(ERROR, << "Wrong faces, edges or convexity for cell " << cellId << ".");
+    return false;
+  }
+  for (int i = 0; i < cell->GetNumberOfFaces(); ++i)
+  {
+    if (GetIds(cell->GetFace(i)) != GetIds(referenceCell->GetFace(i)))
+    {
+      vtkLog(ERROR, << "Wrong face " << i << " for cell " << cellId << ".");
+      return false;
+    }
+  }
+  for (int i = 0; i < cell->GetNumberOfEdges(); ++i)
+  {
+    if (GetIds(cell->GetEdge(i)) != GetIds(referenceCell->GetEdge(i)))
+    {
+      vtkLog(ERROR, << "Wrong edge " << i << " for cell " << cellId << ".");
+      return false;
+    }
+  }
+  for (vtkIdType i = 0; i < cell->GetNumberOfPoints(); ++i)
+  {
+    const vtkIdType* faceIds;
+    const vtkIdType* referenceFaceIds;
+    const vtkIdType numFaces = cell->GetPointToIncidentFaces(i, faceIds);
+    const vtkIdType referenceNumFaces = referenceCell->GetPointToIncidentFaces(i, referenceFaceIds);
+    if (std::vector<vtkIdType>(faceIds, faceIds + numFaces) !=
+      std::vector<vtkIdType>(referenceFaceIds, referenceFaceIds + referenceNumFaces))
+    {
+      vtkLog(ERROR, << "Wrong incident faces of point " << i << " for cell " << cellId << ".");
+      return false;
+    }
+  }
+
+  if (!(ContourOrClip(grid, cell, false) == ContourOrClip(reference, referenceCell, false)) ||
+    !(ContourOrClip(grid, cell, true) == ContourOrClip(reference, referenceCell, true)))
+  {
+    vtkLog(ERROR, << "Wrong contour or clip for cell " << cellId << ".");
+    return false;
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestStaticPolyhedronTopology(int, char*[])
+{
+  auto grid = MakeGrid();
+  const vtkIdType openBoxId = grid->GetNumberOfCells() - 1;
+
+  // The polyhedra of a copy without topology derive it themselves
+  vtkNew<vtkUnstructuredGrid> reference;
+  reference->DeepCopy(grid);
+
+  grid->BuildPolyhedronTopology();
+  vtkStaticPolyhedronTopology* topology = grid->GetPolyhedronTopology();
+  if (!topology || topology->GetNumberOfPolyhedra() != grid->GetNumberOfCells() ||
+    reference->GetPolyhedronTopology())
+  {
+    vtkLog(ERROR, << "Wrong polyhedron topology.");
+    return EXIT_FAILURE;
+  }
+
+  // The dented hexahedron is not convex, and the open box is neither watertight
+  // nor convex
+  vtkStaticPolyhedronTopology::CellTopology cellTopology;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    if (!topology->GetCellTopology(cellId, cellTopology))
+    {
+      vtkLog(ERROR, << "Missing topology for cell " << cellId << ".");
+      return EXIT_FAILURE;
+    }
+    const bool dented = (cellTopology.NumberOfPoints == 9);
+    const bool convex = (cellTopology.Flags & vtkStaticPolyhedronTopology::CONVEX) != 0;
+    const bool watertight = (cellTopology.Flags & vtkStaticPolyhedronTopology::WATERTIGHT) != 0;
+    if (convex != (!dented && cellId != openBoxId) || watertight == (cellId == openBoxId))
+    {
+      vtkLog(ERROR, << "Wrong flags for cell " << cellId << ".");
+      return EXIT_FAILURE;
+    }
+  }
+
+  vtkNew<vtkGenericCell> genericCell;
+  vtkNew<vtkGenericCell> referenceGenericCell;
+  for (vtkIdType cellId = 0; cellId < openBoxId; ++cellId)
+  {
+    if (!SameCells(grid, reference, cellId, genericCell, referenceGenericCell))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Shallow copies share the topology
+  vtkNew<vtkUnstructuredGrid> copy;
+  copy->ShallowCopy(grid);
+  if (copy->GetPolyhedronTopology() != topology)
+  {
+    vtkLog(ERROR, << "The topology should be shared by shallow copies.");
+    return EXIT_FAILURE;
+  }
+
+  // Moving the points invalidates the topology
+  grid->GetPoints()->Modified();
+  grid->GetCell(0, genericCell);
+  if (grid->GetPolyhedronTopology() ||
+    static_cast<vtkPolyhedron*>(genericCell->GetRepresentativeCell())->GetTopology())
+  {
+    vtkLog(ERROR, << "The topology should be out of date.");
+    return EXIT_FAILURE;
+  }
+  grid->BuildPolyhedronTopology();
+  if (!grid->GetPolyhedronTopology() || grid->GetPolyhedronTopology() == topology)
+  {
+    vtkLog(ERROR, << "The topology should have been rebuilt.");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -6,6 +6,7 @@
 #include "vtkCellArray.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
 #include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
@@ -13,9 +14,13 @@
 #include "vtkObjectFactory.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
+
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
 vtkAbstractCellLocator::vtkAbstractCellLocator()
@@ -258,6 +263,146 @@ vtkIdType vtkAbstractCellLocator::FindCell(
   return returnVal;
 }
 
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindCells(vtkPoints* points, double tol2, vtkIdList* cellIds,
+  vtkDoubleArray* pcoords, vtkDoubleArray* weights)
+{
+  if (!points || !cellIds)
+  {
+    vtkErrorMacro(<< "Points and cell ids must be provided");
+    return;
+  }
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  const bool hasCells = this->DataSet && this->DataSet->GetNumberOfCells() > 0;
+  const int maxCellSize = hasCells ? std::max(this->DataSet->GetMaxCellSize(), 1) : 1;
+  cellIds->SetNumberOfIds(numPts);
+  if (pcoords)
+  {
+    pcoords->SetNumberOfComponents(3);
+    pcoords->SetNumberOfTuples(numPts);
+  }
+  if (weights)
+  {
+    weights->SetNumberOfComponents(maxCellSize);
+    weights->SetNumberOfTuples(numPts);
+  }
+  if (!hasCells)
+  {
+    std::fill(cellIds->begin(), cellIds->end(), -1);
+    if (pcoords)
+    {
+      pcoords->Fill(0.0);
+    }
+    if (weights)
+    {
+      weights->Fill(0.0);
+    }
+    return;
+  }
+
+  // Build the locator, and the cells of the data set, before querying them
+  // from several threads.
+  this->BuildLocator();
+  this->DataSet->GetCell(0, this->GenericCell);
+
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<double>> tlWeights;
+  auto findCells = [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = tlCell.Local();
+    std::vector<double>& cellWeights = tlWeights.Local();
+    cellWeights.resize(maxCellSize);
+    double x[3], pc[3];
+    int subId;
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      points->GetPoint(ptId, x);
+      const vtkIdType cellId = this->FindCell(x, tol2, cell, subId, pc, cellWeights.data());
+      cellIds->SetId(ptId, cellId);
+      if (cellId < 0)
+      {
+        std::fill_n(pc, 3, 0.0);
+      }
+      if (pcoords)
+      {
+        std::copy_n(pc, 3, pcoords->GetPointer(3 * ptId));
+      }
+      if (weights)
+      {
+        double* ptWeights = weights->GetPointer(maxCellSize * ptId);
+        const vtkIdType cellSize = cellId < 0 ? 0 : this->DataSet->GetCellSize(cellId);
+        std::copy_n(cellWeights.data(), cellSize, ptWeights);
+        std::fill(ptWeights + cellSize, ptWeights + maxCellSize, 0.0);
+      }
+    }
+  };
+  if (this->SupportsThreadSafeFindCell())
+  {
+    vtkSMPTools::For(0, numPts, findCells);
+  }
+  else
+  {
+    findCells(0, numPts);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkAbstractCellLocator::FindClosestPoints(
+  vtkPoints* points, vtkIdList* cellIds, vtkPoints* closestPoints, vtkDoubleArray* dist2)
+{
+  if (!points || !cellIds)
+  {
+    vtkErrorMacro(<< "Points and cell ids must be provided");
+    return;
+  }
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  cellIds->SetNumberOfIds(numPts);
+  if (closestPoints)
+  {
+    closestPoints->SetNumberOfPoints(numPts);
+  }
+  if (dist2)
+  {
+    dist2->SetNumberOfComponents(1);
+    dist2->SetNumberOfTuples(numPts);
+  }
+  if (!this->DataSet || this->DataSet->GetNumberOfCells() < 1)
+  {
+    std::fill(cellIds->begin(), cellIds->end(), -1);
+    if (dist2)
+    {
+      dist2->Fill(-1.0);
+    }
+    return;
+  }
+
+  // Build the locator, and the cells of the data set, before querying them
+  // from several threads.
+  this->BuildLocator();
+  this->DataSet->GetCell(0, this->GenericCell);
+
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = tlCell.Local();
+    double x[3], closestPoint[3], d2;
+    vtkIdType cellId;
+    int subId;
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      points->GetPoint(ptId, x);
+      this->FindClosestPoint(x, closestPoint, cell, cellId, subId, d2);
+      cellIds->SetId(ptId, cellId);
+      if (closestPoints)
+      {
+        closestPoints->SetPoint(ptId, closestPoint);
+      }
+      if (dist2)
+      {
+        dist2->SetValue(ptId, d2);
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 bool vtkAbstractCellLocator::InsideCellBounds(double x[3], vtkIdType cell_ID)
 {
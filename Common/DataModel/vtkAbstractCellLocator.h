@@ -34,6 +34,7 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
+class vtkDoubleArray;
 class vtkGenericCell;
 class vtkIdList;
 class vtkPoints;
@@ -287,6 +288,43 @@ public:
     double pcoords[3], double* weights);
   ///@}
 
+  /**
+   * Return true if the FindCell() methods taking a vtkGenericCell are
+   * thread safe, in which case FindCells() locates the points in parallel.
+   * The default implementation of FindCell() falls back to
+   * vtkDataSet::FindCell(), which is not thread safe, so this returns false
+   * unless a subclass overrides it.
+   */
+  virtual bool SupportsThreadSafeFindCell() { return false; }
+
+  /**
+   * Find the cells containing a batch of points, in parallel, with a
+   * vtkGenericCell per thread. For each point, the id of the cell containing
+   * it, or -1, is stored in cellIds. If pcoords is provided, it is filled with
+   * the parametric coordinates of the points in their cell, and if weights is
+   * provided, it is filled with the interpolation weights of the points,
+   * padded with zeros to the maximum cell size of the data set. Points that
+   * are in no cell get null coordinates and weights.
+   *
+   * The points are located in parallel only if SupportsThreadSafeFindCell()
+   * returns true, and one after the other otherwise.
+   *
+   * THIS FUNCTION IS NOT THREAD SAFE.
+   */
+  void FindCells(vtkPoints* points, double tol2, vtkIdList* cellIds,
+    vtkDoubleArray* pcoords = nullptr, vtkDoubleArray* weights = nullptr);
+
+  /**
+   * Find the closest points on the cells of a batch of points, in parallel,
+   * with a vtkGenericCell per thread. For each point, the id of the closest
+   * cell is stored in cellIds and, if they are provided, the closest point is
+   * stored in closestPoints and the squared distance to it in dist2.
+   *
+   * THIS FUNCTION IS NOT THREAD SAFE.
+   */
+  void FindClosestPoints(vtkPoints* points, vtkIdList* cellIds, vtkPoints* closestPoints = nullptr,
+    vtkDoubleArray* dist2 = nullptr);
+
   /**
    * Quickly test if a point is inside the bounds of a particular cell.
    * Some locators cache cell bounds and this function can make use
@@ -0,0 +1,1363 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkBVHCellLocator.h"
+
+#include "vtkCellArray.h"
+#include "vtkDataSet.h"
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkMath.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <queue>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkBVHCellLocator);
+
+//------------------------------------------------------------------------------
+// The tree is an array of nodes, the root being the first one. Each cell is
+// in exactly one leaf: the cells of the leaves are contiguous runs of the
+// CellIds array. The tree is built top down. The nodes of many cells are
+// split first, one at a time, their cells being binned in parallel. The
+// smaller nodes are the roots of subtrees which are then built concurrently
+// (each one serially) and appended to the tree. Since the splits do not
+// depend on how the work is distributed, neither does the tree.
+//
+// Lines are intersected with the tree by packets of PacketSize lines: each
+// node, and each cell, is tested against all the lines of the packet at
+// once, and the cells are only instantiated once for the packet. The lines
+// of a batch are sorted by direction and origin before being grouped in
+// packets, so that the lines of a packet visit mostly the same nodes.
+
+namespace
+{
+// The number of lines traversing the tree together
+constexpr int PacketSize = 8;
+
+//------------------------------------------------------------------------------
+// A node of the tree. The cells of a leaf are CellIds[Index] to
+// CellIds[Index + Count - 1]. The children of an inner node (Count == 0) are
+// Nodes[Index] and Nodes[Index + 1], split along Axis.
+struct BVHNode
+{
+  double Bounds[6];
+  vtkIdType Index;
+  vtkIdType Count;
+  int Axis;
+
+  bool IsLeaf() const { return this->Count > 0; }
+};
+
+//------------------------------------------------------------------------------
+void InitializeBounds(double bounds[6])
+{
+  bounds[0] = bounds[2] = bounds[4] = VTK_DOUBLE_MAX;
+  bounds[1] = bounds[3] = bounds[5] = -VTK_DOUBLE_MAX;
+}
+
+void AddBounds(double bounds[6], const double other[6])
+{
+  for (int i = 0; i < 6; i += 2)
+  {
+    bounds[i] = std::min(bounds[i], other[i]);
+    bounds[i + 1] = std::max(bounds[i + 1], other[i + 1]);
+  }
+}
+
+// Half of the surface area of non empty bounds
+double Area(const double bounds[6])
+{
+  const double dx = bounds[1] - bounds[0];
+  const double dy = bounds[3] - bounds[2];
+  const double dz = bounds[5] - bounds[4];
+  return dx * dy + dy * dz + dz * dx;
+}
+
+bool IsInBounds(const double bounds[6], const double x[3])
+{
+  return bounds[0] <= x[0] && x[0] <= bounds[1] && bounds[2] <= x[1] && x[1] <= bounds[3] &&
+    bounds[4] <= x[2] && x[2] <= bounds[5];
+}
+
+bool BoundsIntersect(const double a[6], const double b[6])
+{
+  return a[0] <= b[1] && b[0] <= a[1] && a[2] <= b[3] && b[2] <= a[3] && a[4] <= b[5] &&
+    b[4] <= a[5];
+}
+
+double Distance2ToBounds(const double x[3], const double bounds[6])
+{
+  double dist2 = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    const double d = std::max(std::max(bounds[2 * i] - x[i], x[i] - bounds[2 * i + 1]), 0.0);
+    dist2 += d * d;
+  }
+  return dist2;
+}
+
+//------------------------------------------------------------------------------
+// The cells whose bounds centers fall in a bin, along one axis.
+struct Bin
+{
+  double Bounds[6];
+  vtkIdType Count;
+
+  void Initialize()
+  {
+    InitializeBounds(this->Bounds);
+    this->Count = 0;
+  }
+};
+
+//------------------------------------------------------------------------------
+// Builds the nodes of the tree. The cells of the node being split are sorted
+// in place in CellIds.
+struct BVHBuilder
+{
+  const double* CellBounds;
+  const double* Centers;
+  vtkIdType* CellIds;
+  int NumberOfBins;
+  vtkIdType LeafSize;
+
+  // Compute the bounds of the cells [begin, end) of CellIds, and the bounds
+  // of their centers.
+  void ComputeBounds(
+    vtkIdType begin, vtkIdType end, bool parallel, double bounds[6], double centerBounds[6]) const
+  {
+    auto compute = [this](vtkIdType first, vtkIdType last, double* b) {
+      for (; first < last; ++first)
+      {
+        const vtkIdType cellId = this->CellIds[first];
+        AddBounds(b, this->CellBounds + 6 * cellId);
+        const double* center = this->Centers + 3 * cellId;
+        const double centerBox[6] = { center[0], center[0], center[1], center[1], center[2],
+          center[2] };
+        AddBounds(b + 6, centerBox);
+      }
+    };
+
+    std::array<double, 12> result;
+    InitializeBounds(result.data());
+    InitializeBounds(result.data() + 6);
+    if (parallel)
+    {
+      vtkSMPThreadLocal<std::array<double, 12>> tlResult(result);
+      vtkSMPTools::For(begin, end,
+        [&](vtkIdType first, vtkIdType last) { compute(first, last, tlResult.Local().data()); });
+      for (auto& local : tlResult)
+      {
+        AddBounds(result.data(), local.data());
+        AddBounds(result.data() + 6, local.data() + 6);
+      }
+    }
+    else
+    {
+      compute(begin, end, result.data());
+    }
+    std::copy_n(result.data(), 6, bounds);
+    std::copy_n(result.data() + 6, 6, centerBounds);
+  }
+
+  // The bin of a center along an axis. scale is the number of bins divided by
+  // the extent of the centers.
+  int GetBin(double center, double min, double scale) const
+  {
+    const int bin = static_cast<int>((center - min) * scale);
+    return std::min(bin, this->NumberOfBins - 1);
+  }
+
+  // Bin the cells [begin, end) of CellIds along the three axes.
+  void FillBins(vtkIdType begin, vtkIdType end, const double centerBounds[6],
+    const double scale[3], bool parallel, std::vector<Bin>& bins) const
+  {
+    const int numBins = this->NumberOfBins;
+    auto fill = [&](vtkIdType first, vtkIdType last, std::vector<Bin>& local) {
+      for (; first < last; ++first)
+      {
+        const vtkIdType cellId = this->CellIds[first];
+        const double* center = this->Centers + 3 * cellId;
+        for (int axis = 0; axis < 3; ++axis)
+        {
+          if (scale[axis] > 0.0)
+          {
+            Bin& bin = local[axis * numBins +
+              this->GetBin(center[axis], centerBounds[2 * axis], scale[axis])];
+            AddBounds(bin.Bounds, this->CellBounds + 6 * cellId);
+            ++bin.Count;
+          }
+        }
+      }
+    };
+
+    bins.resize(3 * numBins);
+    for (Bin& bin : bins)
+    {
+      bin.Initialize();
+    }
+    if (parallel)
+    {
+      vtkSMPThreadLocal<std::vector<Bin>> tlBins(bins);
+      vtkSMPTools::For(
+        begin, end, [&](vtkIdType first, vtkIdType last) { fill(first, last, tlBins.Local()); });
+      for (auto& local : tlBins)
+      {
+        for (int i = 0; i < 3 * numBins; ++i)
+        {
+          AddBounds(bins[i].Bounds, local[i].Bounds);
+          bins[i].Count += local[i].Count;
+        }
+      }
+    }
+    else
+    {
+      fill(begin, end, bins);
+    }
+  }
+
+  // Find the split of the bins minimizing the surface area heuristic: the
+  // cells of the bins up to splitBin go to the first child.
+  bool FindSplit(const std::vector<Bin>& bins, const double scale[3], int& splitAxis,
+    int& splitBin, std::vector<double>& rightCosts) const
+  {
+    const int numBins = this->NumberOfBins;
+    double bestCost = VTK_DOUBLE_MAX;
+    rightCosts.resize(numBins);
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      if (scale[axis] <= 0.0)
+      {
+        continue;
+      }
+      const Bin* axisBins = bins.data() + axis * numBins;
+
+      // Cost of the second child for each split, from the last bin
+      double bounds[6];
+      InitializeBounds(bounds);
+      vtkIdType count = 0;
+      for (int i = numBins - 1; i > 0; --i)
+      {
+        AddBounds(bounds, axisBins[i].Bounds);
+        count += axisBins[i].Count;
+        rightCosts[i] = count > 0 ? Area(bounds) * count : -1.0;
+      }
+
+      // Sweep from the first bin
+      InitializeBounds(bounds);
+      count = 0;
+      for (int i = 0; i < numBins - 1; ++i)
+      {
+        AddBounds(bounds, axisBins[i].Bounds);
+        count += axisBins[i].Count;
+        if (count > 0 && rightCosts[i + 1] >= 0.0)
+        {
+          const double cost = Area(bounds) * count + rightCosts[i + 1];
+          if (cost < bestCost)
+          {
+            bestCost = cost;
+            splitAxis = axis;
+            splitBin = i;
+          }
+        }
+      }
+    }
+    return bestCost < VTK_DOUBLE_MAX;
+  }
+
+  // Compute the bounds of the node n, and split it in two children appended
+  // to the nodes if it has too many cells. Return whether the node was split.
+  bool SplitNode(std::vector<BVHNode>& nodes, vtkIdType n, bool parallel, std::vector<Bin>& bins,
+    std::vector<double>& rightCosts) const
+  {
+    const vtkIdType begin = nodes[n].Index;
+    const vtkIdType end = begin + nodes[n].Count;
+    double centerBounds[6];
+    this->ComputeBounds(begin, end, parallel, nodes[n].Bounds, centerBounds);
+    if (end - begin <= this->LeafSize)
+    {
+      return false;
+    }
+
+    double scale[3];
+    for (int axis = 0; axis < 3; ++axis)
+    {
+      const double extent = centerBounds[2 * axis + 1] - centerBounds[2 * axis];
+      scale[axis] = extent > 0.0 ? this->NumberOfBins / extent : 0.0;
+    }
+
+    int axis = 0, splitBin = 0;
+    vtkIdType mid;
+    this->FillBins(begin, end, centerBounds, scale, parallel, bins);
+    if (this->FindSplit(bins, scale, axis, splitBin, rightCosts))
+    {
+      const double min = centerBounds[2 * axis];
+      vtkIdType* split = std::partition(
+        this->CellIds + begin, this->CellIds + end, [&](vtkIdType cellId) {
+          return this->GetBin(this->Centers[3 * cellId + axis], min, scale[axis]) <= splitBin;
+        });
+      mid = split - this->CellIds;
+    }
+    else
+    {
+      // All the centers are the same: any split will do
+      mid = begin + (end - begin) / 2;
+    }
+
+    const vtkIdType first = static_cast<vtkIdType>(nodes.size());
+    nodes[n].Index = first;
+    nodes[n].Count = 0;
+    nodes[n].Axis = axis;
+    BVHNode child;
+    child.Index = begin;
+    child.Count = mid - begin;
+    nodes.push_back(child);
+    child.Index = mid;
+    child.Count = end - mid;
+    nodes.push_back(child);
+    return true;
+  }
+
+  // Build serially the subtree of the cells [begin, end) of CellIds.
+  void BuildSubtree(vtkIdType begin, vtkIdType end, std::vector<BVHNode>& nodes,
+    std::vector<Bin>& bins, std::vector<double>& rightCosts) const
+  {
+    nodes.clear();
+    BVHNode root;
+    root.Index = begin;
+    root.Count = end - begin;
+    nodes.push_back(root);
+    std::vector<vtkIdType> stack(1, 0);
+    while (!stack.empty())
+    {
+      const vtkIdType n = stack.back();
+      stack.pop_back();
+      if (this->SplitNode(nodes, n, false, bins, rightCosts))
+      {
+        stack.push_back(nodes[n].Index + 1);
+        stack.push_back(nodes[n].Index);
+      }
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+// A packet of lines, stored both by line (to intersect the cells) and by
+// component (to intersect the boxes). The lanes beyond Size are unused, and
+// have a negative TMax so that they never intersect anything.
+struct LinePacket
+{
+  double Origin[3][PacketSize];
+  double InvDir[3][PacketSize];
+  double TMax[PacketSize]; // the largest t of interest for each line
+  double P1[PacketSize][3];
+  double P2[PacketSize][3];
+  vtkIdType LineId[PacketSize];
+  int Size;
+
+  void Clear()
+  {
+    for (int r = 0; r < PacketSize; ++r)
+    {
+      for (int i = 0; i < 3; ++i)
+      {
+        this->Origin[i][r] = 0.0;
+        this->InvDir[i][r] = 1.0;
+      }
+      this->TMax[r] = -1.0;
+    }
+    this->Size = 0;
+  }
+
+  void Add(vtkIdType lineId, const double p1[3], const double p2[3])
+  {
+    const int r = this->Size++;
+    for (int i = 0; i < 3; ++i)
+    {
+      const double dir = p2[i] - p1[i];
+      this->Origin[i][r] = p1[i];
+      // Lines parallel to a slab get a huge inverse so that the slab is
+      // either crossed everywhere or nowhere. The boxes are slightly
+      // inflated so that the lines on their faces are inside.
+      this->InvDir[i][r] = dir != 0.0 ? 1.0 / dir : VTK_DOUBLE_MAX;
+      this->P1[r][i] = p1[i];
+      this->P2[r][i] = p2[i];
+    }
+    this->TMax[r] = 1.0;
+    this->LineId[r] = lineId;
+  }
+
+  // Intersect the lines with a box inflated by tol. Return the mask of the
+  // lanes whose line enters the box before its TMax, and the parametric
+  // coordinates of the entry points in tNear.
+  unsigned int IntersectBox(const double bounds[6], double tol, double tNear[PacketSize]) const
+  {
+    const double lo[3] = { bounds[0] - tol, bounds[2] - tol, bounds[4] - tol };
+    const double hi[3] = { bounds[1] + tol, bounds[3] + tol, bounds[5] + tol };
+    unsigned int mask = 0;
+    for (int r = 0; r < PacketSize; ++r)
+    {
+      double t0 = 0.0;
+      double t1 = this->TMax[r];
+      for (int i = 0; i < 3; ++i)
+      {
+        const double ta = (lo[i] - this->Origin[i][r]) * this->InvDir[i][r];
+        const double tb = (hi[i] - this->Origin[i][r]) * this->InvDir[i][r];
+        t0 = std::max(t0, std::min(ta, tb));
+        t1 = std::min(t1, std::max(ta, tb));
+      }
+      tNear[r] = t0;
+      mask |= static_cast<unsigned int>(t0 <= t1) << r;
+    }
+    return mask;
+  }
+};
+
+//------------------------------------------------------------------------------
+// The first cells intersected by the lines of a packet.
+struct FirstHits
+{
+  vtkIdType CellId[PacketSize];
+  double T[PacketSize];
+  double X[PacketSize][3];
+  double PCoords[PacketSize][3];
+  int SubId[PacketSize];
+};
+
+//------------------------------------------------------------------------------
+// A cell intersected by a line.
+struct LineHit
+{
+  double T;
+  vtkIdType CellId;
+  double X[3];
+
+  bool operator<(const LineHit& other) const
+  {
+    return this->T < other.T || (this->T == other.T && this->CellId < other.CellId);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Interleave the lower 10 bits of an integer with zeros (Morton code).
+uint64_t SpreadBits(uint64_t x)
+{
+  x &= 0x3ff;
+  x = (x | (x << 16)) & 0x30000ff;
+  x = (x | (x << 8)) & 0x300f00f;
+  x = (x | (x << 4)) & 0x30c30c3;
+  x = (x | (x << 2)) & 0x9249249;
+  return x;
+}
+
+// Used to sort the lines by direction octant, then by origin along a Morton curve.
+struct LineKey
+{
+  uint64_t Key;
+  vtkIdType LineId;
+
+  bool operator<(const LineKey& other) const
+  {
+    return this->Key < other.Key || (this->Key == other.Key && this->LineId < other.LineId);
+  }
+};
+
+//------------------------------------------------------------------------------
+void AddBox(const double bounds[6], vtkPoints* points, vtkCellArray* polys)
+{
+  const vtkIdType first = points->GetNumberOfPoints();
+  for (int k = 0; k < 2; ++k)
+  {
+    for (int j = 0; j < 2; ++j)
+    {
+      for (int i = 0; i < 2; ++i)
+      {
+        points->InsertNextPoint(bounds[i], bounds[2 + j], bounds[4 + k]);
+      }
+    }
+  }
+  static const vtkIdType faces[6][4] = { { 0, 4, 6, 2 }, { 1, 3, 7, 5 }, { 0, 1, 5, 4 },
+    { 2, 6, 7, 3 }, { 0, 2, 3, 1 }, { 4, 5, 7, 6 } };
+  for (int f = 0; f < 6; ++f)
+  {
+    const vtkIdType ids[4] = { first + faces[f][0], first + faces[f][1], first + faces[f][2],
+      first + faces[f][3] };
+    polys->InsertNextCell(4, ids);
+  }
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+// The tree, shared by shallow copies of the locator.
+struct vtkBVHCellLocatorTree
+{
+  vtkDataSet* DataSet;
+  std::shared_ptr<std::vector<double>> CellBoundsStorage;
+  const double* CellBounds;
+  std::vector<vtkIdType> CellIds;
+  std::vector<BVHNode> Nodes;
+  int MaxCellSize;
+  // A small fraction of the size of the data set. The boxes are inflated by
+  // it to get robust intersections with lines.
+  double Epsilon;
+
+  void Build(vtkBVHCellLocator* locator);
+
+  template <typename TFunc>
+  void TraversePacket(
+    LinePacket& packet, double tol, std::vector<vtkIdType>& stack, TFunc&& intersectLeaf) const;
+  void IntersectFirst(LinePacket& packet, double tol, vtkGenericCell* cell,
+    std::vector<vtkIdType>& stack, FirstHits& hits) const;
+  void IntersectAll(LinePacket& packet, double tol, vtkGenericCell* cell,
+    std::vector<vtkIdType>& stack, std::vector<LineHit> hits[PacketSize]) const;
+  std::vector<LineKey> SortLines(vtkPoints* p1s, vtkPoints* p2s) const;
+
+  vtkIdType FindCell(
+    const double x[3], vtkGenericCell* cell, int& subId, double pcoords[3], double* weights) const;
+  vtkIdType FindClosestPointWithinRadius(const double x[3], double radius,
+    double closestPoint[3], vtkGenericCell* cell, vtkIdType& closestCellId, int& closestSubId,
+    double& minDist2, int& inside) const;
+  void FindCellsWithinBounds(const double bbox[6], vtkIdList* cells) const;
+  void GenerateRepresentation(int level, vtkPolyData* pd) const;
+};
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocatorTree::Build(vtkBVHCellLocator* locator)
+{
+  const vtkIdType numCells = this->DataSet->GetNumberOfCells();
+  this->MaxCellSize = this->DataSet->GetMaxCellSize();
+
+  // The centers of the cell bounds are used to split the nodes
+  std::vector<double> centers(3 * numCells);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    for (; cellId < endCellId; ++cellId)
+    {
+      const double* bounds = this->CellBounds + 6 * cellId;
+      for (int i = 0; i < 3; ++i)
+      {
+        centers[3 * cellId + i] = 0.5 * (bounds[2 * i] + bounds[2 * i + 1]);
+      }
+    }
+  });
+  this->CellIds.resize(numCells);
+  std::iota(this->CellIds.begin(), this->CellIds.end(), 0);
+
+  BVHBuilder builder;
+  builder.CellBounds = this->CellBounds;
+  builder.Centers = centers.data();
+  builder.CellIds = this->CellIds.data();
+  builder.NumberOfBins = locator->GetNumberOfBins();
+  builder.LeafSize = std::max(locator->GetNumberOfCellsPerNode(), 1);
+
+  // Split the large nodes, binning their cells in parallel. The other nodes
+  // are the roots of the subtrees.
+  const vtkIdType subtreeSize =
+    std::max<vtkIdType>(4096, numCells / (4 * vtkSMPTools::GetEstimatedNumberOfThreads()));
+  std::vector<Bin> bins;
+  std::vector<double> rightCosts;
+  std::vector<vtkIdType> subtreeRoots;
+  this->Nodes.clear();
+  BVHNode root;
+  root.Index = 0;
+  root.Count = numCells;
+  this->Nodes.push_back(root);
+  std::vector<vtkIdType> queue(1, 0);
+  for (size_t i = 0; i < queue.size(); ++i)
+  {
+    const vtkIdType n = queue[i];
+    if (this->Nodes[n].Count <= subtreeSize)
+    {
+      subtreeRoots.push_back(n);
+    }
+    else if (builder.SplitNode(this->Nodes, n, true, bins, rightCosts))
+    {
+      queue.push_back(this->Nodes[n].Index);
+      queue.push_back(this->Nodes[n].Index + 1);
+    }
+  }
+  // Build the subtrees concurrently, then append them to the tree
+  std::vector<std::vector<BVHNode>> subtrees(subtreeRoots.size());
+  vtkSMPThreadLocal<std::vector<Bin>> tlBins;
+  vtkSMPThreadLocal<std::vector<double>> tlRightCosts;
+  vtkSMPTools::For(0, static_cast<vtkIdType>(subtreeRoots.size()), 1,
+    [&](vtkIdType subtree, vtkIdType endSubtree) {
+      for (; subtree < endSubtree; ++subtree)
+      {
+        const BVHNode& subtreeRoot = this->Nodes[subtreeRoots[subtree]];
+        builder.BuildSubtree(subtreeRoot.Index, subtreeRoot.Index + subtreeRoot.Count,
+          subtrees[subtree], tlBins.Local(), tlRightCosts.Local());
+      }
+    });
+  for (size_t subtree = 0; subtree < subtrees.size(); ++subtree)
+  {
+    std::vector<BVHNode>& nodes = subtrees[subtree];
+    const vtkIdType offset = static_cast<vtkIdType>(this->Nodes.size()) - 1;
+    for (BVHNode& node : nodes)
+    {
+      if (!node.IsLeaf())
+      {
+        node.Index += offset;
+      }
+    }
+    this->Nodes[subtreeRoots[subtree]] = nodes[0];
+    this->Nodes.insert(this->Nodes.end(), nodes.begin() + 1, nodes.end());
+    std::vector<BVHNode>().swap(nodes);
+  }
+
+  const double* rootBounds = this->Nodes[0].Bounds;
+  double diagonal2 = 0.0;
+  for (int i = 0; i < 3; ++i)
+  {
+    const double length = rootBounds[2 * i + 1] - rootBounds[2 * i];
+    diagonal2 += length * length;
+  }
+  this->Epsilon = std::max(1.0e-12 * std::sqrt(diagonal2), VTK_DBL_MIN);
+}
+
+//------------------------------------------------------------------------------
+// Traverse the tree with a packet of lines, nearest child first according to
+// the direction of the first line. intersectLeaf(node, mask) is invoked for
+// the leaves entered by the lines of the mask before their TMax.
+template <typename TFunc>
+void vtkBVHCellLocatorTree::TraversePacket(
+  LinePacket& packet, double tol, std::vector<vtkIdType>& stack, TFunc&& intersectLeaf) const
+{
+  double tNear[PacketSize];
+  const double boxTol = tol + this->Epsilon;
+  stack.clear();
+  stack.push_back(0);
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    const unsigned int mask = packet.IntersectBox(node.Bounds, boxTol, tNear);
+    if (!mask)
+    {
+      continue;
+    }
+    if (node.IsLeaf())
+    {
+      intersectLeaf(node, mask);
+    }
+    else if (packet.InvDir[node.Axis][0] >= 0.0)
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+    }
+    else
+    {
+      stack.push_back(node.Index);
+      stack.push_back(node.Index + 1);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Find the first cell intersected by each line of the packet. The TMax of
+// the lines shrink as cells are intersected, pruning the farther nodes.
+void vtkBVHCellLocatorTree::IntersectFirst(LinePacket& packet, double tol, vtkGenericCell* cell,
+  std::vector<vtkIdType>& stack, FirstHits& hits) const
+{
+  std::fill_n(hits.CellId, PacketSize, -1);
+  const double boxTol = tol + this->Epsilon;
+  this->TraversePacket(packet, tol, stack, [&](const BVHNode& leaf, unsigned int mask) {
+    double tNear[PacketSize], t, x[3], pcoords[3];
+    int subId;
+    for (vtkIdType i = leaf.Index; i < leaf.Index + leaf.Count; ++i)
+    {
+      const vtkIdType cellId = this->CellIds[i];
+      unsigned int cellMask =
+        mask & packet.IntersectBox(this->CellBounds + 6 * cellId, boxTol, tNear);
+      if (!cellMask)
+      {
+        continue;
+      }
+      this->DataSet->GetCell(cellId, cell);
+      for (int r = 0; cellMask; ++r, cellMask >>= 1)
+      {
+        if ((cellMask & 1) &&
+          cell->IntersectWithLine(packet.P1[r], packet.P2[r], tol, t, x, pcoords, subId) &&
+          (hits.CellId[r] < 0 || t < hits.T[r]))
+        {
+          hits.CellId[r] = cellId;
+          hits.T[r] = t;
+          std::copy_n(x, 3, hits.X[r]);
+          std::copy_n(pcoords, 3, hits.PCoords[r]);
+          hits.SubId[r] = subId;
+          packet.TMax[r] = std::min(packet.TMax[r], t);
+        }
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Find all the cells intersected by each line of the packet. Without a cell,
+// the intersections with the cell bounds are returned instead. The hits are
+// not sorted.
+void vtkBVHCellLocatorTree::IntersectAll(LinePacket& packet, double tol, vtkGenericCell* cell,
+  std::vector<vtkIdType>& stack, std::vector<LineHit> hits[PacketSize]) const
+{
+  for (int r = 0; r < PacketSize; ++r)
+  {
+    hits[r].clear();
+  }
+  const double boxTol = tol + this->Epsilon;
+  this->TraversePacket(packet, tol, stack, [&](const BVHNode& leaf, unsigned int mask) {
+    double tNear[PacketSize];
+    LineHit hit;
+    int subId;
+    double pcoords[3];
+    for (vtkIdType i = leaf.Index; i < leaf.Index + leaf.Count; ++i)
+    {
+      hit.CellId = this->CellIds[i];
+      unsigned int cellMask =
+        mask & packet.IntersectBox(this->CellBounds + 6 * hit.CellId, boxTol, tNear);
+      if (!cellMask)
+      {
+        continue;
+      }
+      if (cell)
+      {
+        this->DataSet->GetCell(hit.CellId, cell);
+      }
+      for (int r = 0; cellMask; ++r, cellMask >>= 1)
+      {
+        if (!(cellMask & 1))
+        {
+          continue;
+        }
+        if (cell)
+        {
+          if (cell->IntersectWithLine(
+                packet.P1[r], packet.P2[r], tol, hit.T, hit.X, pcoords, subId))
+          {
+            hits[r].push_back(hit);
+          }
+        }
+        else
+        {
+          hit.T = tNear[r];
+          for (int j = 0; j < 3; ++j)
+          {
+            hit.X[j] = packet.P1[r][j] + hit.T * (packet.P2[r][j] - packet.P1[r][j]);
+          }
+          hits[r].push_back(hit);
+        }
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Sort the lines by the octant of their direction, then by the position of
+// their origin along a Morton curve spanning the bounds of the tree.
+std::vector<LineKey> vtkBVHCellLocatorTree::SortLines(vtkPoints* p1s, vtkPoints* p2s) const
+{
+  const vtkIdType numLines = p1s->GetNumberOfPoints();
+  const double* bounds = this->Nodes[0].Bounds;
+  double scale[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    const double length = bounds[2 * i + 1] - bounds[2 * i];
+    scale[i] = length > 0.0 ? 1023.0 / length : 0.0;
+  }
+
+  std::vector<LineKey> keys(numLines);
+  vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+    double p1[3], p2[3];
+    for (; lineId < endLineId; ++lineId)
+    {
+      p1s->GetPoint(lineId, p1);
+      p2s->GetPoint(lineId, p2);
+      uint64_t key = 0;
+      for (int i = 0; i < 3; ++i)
+      {
+        const double q = std::min(std::max((p1[i] - bounds[2 * i]) * scale[i], 0.0), 1023.0);
+        key |= SpreadBits(static_cast<uint64_t>(q)) << i;
+        key |= static_cast<uint64_t>(p2[i] < p1[i]) << (30 + i);
+      }
+      keys[lineId].Key = key;
+      keys[lineId].LineId = lineId;
+    }
+  });
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+  return keys;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocatorTree::FindCell(
+  const double x[3], vtkGenericCell* cell, int& subId, double pcoords[3], double* weights) const
+{
+  std::vector<vtkIdType> stack(1, 0);
+  double dist2;
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    if (!IsInBounds(node.Bounds, x))
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+      continue;
+    }
+    for (vtkIdType i = node.Index; i < node.Index + node.Count; ++i)
+    {
+      const vtkIdType cellId = this->CellIds[i];
+      if (IsInBounds(this->CellBounds + 6 * cellId, x))
+      {
+        this->DataSet->GetCell(cellId, cell);
+        if (cell->EvaluatePosition(x, nullptr, subId, pcoords, dist2, weights) == 1)
+        {
+          return cellId;
+        }
+      }
+    }
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+// Visit the nodes by increasing distance to x, until they are farther than
+// the closest point found.
+vtkIdType vtkBVHCellLocatorTree::FindClosestPointWithinRadius(const double x[3], double radius,
+  double closestPoint[3], vtkGenericCell* cell, vtkIdType& closestCellId, int& closestSubId,
+  double& minDist2, int& inside) const
+{
+  std::vector<double> weights(std::max(this->MaxCellSize, 1));
+  double pcoords[3], point[3], dist2;
+  int subId, stat;
+  vtkIdType retVal = 0;
+
+  using NodeDistance = std::pair<double, vtkIdType>;
+  std::priority_queue<NodeDistance, std::vector<NodeDistance>, std::greater<NodeDistance>> queue;
+  minDist2 = radius * radius;
+  queue.emplace(Distance2ToBounds(x, this->Nodes[0].Bounds), 0);
+  while (!queue.empty() && queue.top().first <= minDist2)
+  {
+    const BVHNode& node = this->Nodes[queue.top().second];
+    queue.pop();
+    if (!node.IsLeaf())
+    {
+      for (vtkIdType child = node.Index; child <= node.Index + 1; ++child)
+      {
+        const double childDist2 = Distance2ToBounds(x, this->Nodes[child].Bounds);
+        if (childDist2 <= minDist2)
+        {
+          queue.emplace(childDist2, child);
+        }
+      }
+      continue;
+    }
+    for (vtkIdType i = node.Index; i < node.Index + node.Count; ++i)
+    {
+      const vtkIdType cellId = this->CellIds[i];
+      if (Distance2ToBounds(x, this->CellBounds + 6 * cellId) < minDist2)
+      {
+        this->DataSet->GetCell(cellId, cell);
+        // stat==(-1) is numerical error; stat==0 means outside; stat=1 means inside.
+        stat = cell->EvaluatePosition(x, point, subId, pcoords, dist2, weights.data());
+        if (stat != -1 && dist2 < minDist2)
+        {
+          retVal = 1;
+          inside = stat;
+          minDist2 = dist2;
+          closestCellId = cellId;
+          closestSubId = subId;
+          std::copy_n(point, 3, closestPoint);
+        }
+      }
+    }
+  }
+  return retVal;
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocatorTree::FindCellsWithinBounds(const double bbox[6], vtkIdList* cells) const
+{
+  std::vector<vtkIdType> stack(1, 0);
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Nodes[stack.back()];
+    stack.pop_back();
+    if (!BoundsIntersect(node.Bounds, bbox))
+    {
+      continue;
+    }
+    if (!node.IsLeaf())
+    {
+      stack.push_back(node.Index + 1);
+      stack.push_back(node.Index);
+      continue;
+    }
+    for (vtkIdType i = node.Index; i < node.Index + node.Count; ++i)
+    {
+      if (BoundsIntersect(this->CellBounds + 6 * this->CellIds[i], bbox))
+      {
+        cells->InsertNextId(this->CellIds[i]);
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocatorTree::GenerateRepresentation(int level, vtkPolyData* pd) const
+{
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkCellArray> polys;
+  std::vector<std::pair<vtkIdType, int>> stack(1, std::make_pair(0, 0));
+  while (!stack.empty())
+  {
+    const BVHNode& node = this->Nodes[stack.back().first];
+    const int depth = stack.back().second;
+    stack.pop_back();
+    if (depth == level || (level < 0 && node.IsLeaf()))
+    {
+      AddBox(node.Bounds, points, polys);
+    }
+    else if (!node.IsLeaf())
+    {
+      stack.emplace_back(node.Index + 1, depth + 1);
+      stack.emplace_back(node.Index, depth + 1);
+    }
+  }
+  pd->SetPoints(points);
+  pd->SetPolys(polys);
+}
+
+//------------------------------------------------------------------------------
+vtkBVHCellLocator::vtkBVHCellLocator()
+{
+  this->NumberOfCellsPerNode = 4;
+  this->NumberOfBins = 16;
+}
+
+//------------------------------------------------------------------------------
+vtkBVHCellLocator::~vtkBVHCellLocator()
+{
+  this->FreeSearchStructure();
+  this->FreeCellBounds();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FreeSearchStructure()
+{
+  this->Tree.reset();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocator()
+{
+  // don't rebuild if build time is newer than modified and dataset modified time
+  if (this->Tree && this->BuildTime > this->MTime && this->BuildTime > this->DataSet->GetMTime())
+  {
+    return;
+  }
+  // don't rebuild if UseExistingSearchStructure is ON and a search structure already exists
+  if (this->Tree && this->UseExistingSearchStructure)
+  {
+    this->BuildTime.Modified();
+    vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
+    return;
+  }
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::ForceBuildLocator()
+{
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::BuildLocatorInternal()
+{
+  if (!this->DataSet || this->DataSet->GetNumberOfCells() < 1)
+  {
+    vtkErrorMacro(<< " No Cells in the data set\n");
+    return;
+  }
+  this->FreeSearchStructure();
+
+  // The tree always needs the cell bounds
+  this->FreeCellBounds();
+  this->StoreCellBounds();
+
+  auto tree = std::make_shared<vtkBVHCellLocatorTree>();
+  tree->DataSet = this->DataSet;
+  tree->CellBoundsStorage = this->CellBoundsSharedPtr;
+  tree->CellBounds = this->CellBounds;
+  tree->Build(this);
+  this->Tree = tree;
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::GetNumberOfNodes()
+{
+  return this->Tree ? static_cast<vtkIdType>(this->Tree->Nodes.size()) : 0;
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  double& t, double x[3], double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell)
+{
+  this->BuildLocator();
+  cellId = -1;
+  if (!this->Tree)
+  {
+    return 0;
+  }
+
+  LinePacket packet;
+  packet.Clear();
+  packet.Add(0, p1, p2);
+  FirstHits hits;
+  std::vector<vtkIdType> stack;
+  this->Tree->IntersectFirst(packet, tol, cell, stack, hits);
+  if (hits.CellId[0] < 0)
+  {
+    return 0;
+  }
+  cellId = hits.CellId[0];
+  t = hits.T[0];
+  std::copy_n(hits.X[0], 3, x);
+  std::copy_n(hits.PCoords[0], 3, pcoords);
+  subId = hits.SubId[0];
+  // The cell may have been overwritten by cells intersected farther
+  this->DataSet->GetCell(cellId, cell);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkBVHCellLocator::IntersectWithLine(const double p1[3], const double p2[3], double tol,
+  vtkPoints* points, vtkIdList* cellIds, vtkGenericCell* cell)
+{
+  if (points)
+  {
+    points->Reset();
+  }
+  if (cellIds)
+  {
+    cellIds->Reset();
+  }
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return 0;
+  }
+
+  LinePacket packet;
+  packet.Clear();
+  packet.Add(0, p1, p2);
+  std::vector<LineHit> hits[PacketSize];
+  std::vector<vtkIdType> stack;
+  this->Tree->IntersectAll(packet, tol, cell, stack, hits);
+  if (hits[0].empty())
+  {
+    return 0;
+  }
+  std::sort(hits[0].begin(), hits[0].end());
+  const vtkIdType numHits = static_cast<vtkIdType>(hits[0].size());
+  if (points)
+  {
+    points->SetNumberOfPoints(numHits);
+    for (vtkIdType i = 0; i < numHits; ++i)
+    {
+      points->SetPoint(i, hits[0][i].X);
+    }
+  }
+  if (cellIds)
+  {
+    cellIds->SetNumberOfIds(numHits);
+    for (vtkIdType i = 0; i < numHits; ++i)
+    {
+      cellIds->SetId(i, hits[0][i].CellId);
+    }
+  }
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::IntersectWithLines(vtkPoints* p1s, vtkPoints* p2s, double tol,
+  vtkIdList* cellIds, vtkDoubleArray* ts, vtkPoints* points)
+{
+  if (!p1s || !p2s || !cellIds || p1s->GetNumberOfPoints() != p2s->GetNumberOfPoints())
+  {
+    vtkErrorMacro(<< "Lines end points of the same size and cell ids must be provided");
+    return;
+  }
+  const vtkIdType numLines = p1s->GetNumberOfPoints();
+  cellIds->SetNumberOfIds(numLines);
+  std::fill(cellIds->begin(), cellIds->end(), -1);
+  if (ts)
+  {
+    ts->SetNumberOfComponents(1);
+    ts->SetNumberOfTuples(numLines);
+    ts->Fill(-1.0);
+  }
+  if (points)
+  {
+    points->DeepCopy(p2s);
+  }
+
+  // Build the locator, and the cells of the data set, before querying them
+  // from several threads.
+  this->BuildLocator();
+  if (!this->Tree || numLines == 0)
+  {
+    return;
+  }
+  this->DataSet->GetCell(0, this->GenericCell);
+
+  const std::vector<LineKey> lines = this->Tree->SortLines(p1s, p2s);
+  const vtkIdType numPackets = (numLines + PacketSize - 1) / PacketSize;
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<vtkIdType>> tlStack;
+  vtkSMPTools::For(0, numPackets, [&](vtkIdType packetId, vtkIdType endPacketId) {
+    vtkGenericCell* cell = tlCell.Local();
+    std::vector<vtkIdType>& stack = tlStack.Local();
+    LinePacket packet;
+    FirstHits hits;
+    double p1[3], p2[3];
+    for (; packetId < endPacketId; ++packetId)
+    {
+      packet.Clear();
+      const vtkIdType end = std::min((packetId + 1) * PacketSize, numLines);
+      for (vtkIdType i = packetId * PacketSize; i < end; ++i)
+      {
+        p1s->GetPoint(lines[i].LineId, p1);
+        p2s->GetPoint(lines[i].LineId, p2);
+        packet.Add(lines[i].LineId, p1, p2);
+      }
+      this->Tree->IntersectFirst(packet, tol, cell, stack, hits);
+      for (int r = 0; r < packet.Size; ++r)
+      {
+        if (hits.CellId[r] < 0)
+        {
+          continue;
+        }
+        const vtkIdType lineId = packet.LineId[r];
+        cellIds->SetId(lineId, hits.CellId[r]);
+        if (ts)
+        {
+          ts->SetValue(lineId, hits.T[r]);
+        }
+        if (points)
+        {
+          points->SetPoint(lineId, hits.X[r]);
+        }
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// The number of cells intersected by each line is not known in advance. Each
+// thread gathers the intersections of its lines in a thread local buffer and
+// records where they are. The offsets are then prefix summed, and the
+// intersections copied into the output arrays.
+void vtkBVHCellLocator::IntersectWithLines(vtkPoints* p1s, vtkPoints* p2s, double tol,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* cellIds, vtkDoubleArray* ts, vtkPoints* points)
+{
+  if (!p1s || !p2s || !offsets || !cellIds ||
+    p1s->GetNumberOfPoints() != p2s->GetNumberOfPoints())
+  {
+    vtkErrorMacro(<< "Lines end points of the same size, offsets and cell ids must be provided");
+    return;
+  }
+  struct LineResults
+  {
+    const std::vector<LineHit>* Buffer;
+    size_t Start;
+  };
+
+  const vtkIdType numLines = p1s->GetNumberOfPoints();
+  offsets->SetNumberOfComponents(1);
+  offsets->SetNumberOfTuples(numLines + 1);
+  offsets->FillValue(0);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  std::vector<LineResults> results(numLines);
+  // The hits of the lines, referenced by results until they are copied to the
+  // outputs
+  vtkSMPThreadLocal<std::vector<LineHit>> tlBuffer;
+
+  // Build the locator, and the cells of the data set, before querying them
+  // from several threads.
+  this->BuildLocator();
+  if (this->Tree && numLines > 0)
+  {
+    this->DataSet->GetCell(0, this->GenericCell);
+
+    const std::vector<LineKey> lines = this->Tree->SortLines(p1s, p2s);
+    const vtkIdType numPackets = (numLines + PacketSize - 1) / PacketSize;
+    vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+    vtkSMPThreadLocal<std::vector<vtkIdType>> tlStack;
+    vtkSMPTools::For(0, numPackets, [&](vtkIdType packetId, vtkIdType endPacketId) {
+      vtkGenericCell* cell = tlCell.Local();
+      std::vector<vtkIdType>& stack = tlStack.Local();
+      std::vector<LineHit>& buffer = tlBuffer.Local();
+      LinePacket packet;
+      std::vector<LineHit> hits[PacketSize];
+      double p1[3], p2[3];
+      for (; packetId < endPacketId; ++packetId)
+      {
+        packet.Clear();
+        const vtkIdType end = std::min((packetId + 1) * PacketSize, numLines);
+        for (vtkIdType i = packetId * PacketSize; i < end; ++i)
+        {
+          p1s->GetPoint(lines[i].LineId, p1);
+          p2s->GetPoint(lines[i].LineId, p2);
+          packet.Add(lines[i].LineId, p1, p2);
+        }
+        this->Tree->IntersectAll(packet, tol, cell, stack, hits);
+        for (int r = 0; r < packet.Size; ++r)
+        {
+          const vtkIdType lineId = packet.LineId[r];
+          std::sort(hits[r].begin(), hits[r].end());
+          results[lineId].Buffer = &buffer;
+          results[lineId].Start = buffer.size();
+          offsetsPtr[lineId + 1] = static_cast<vtkIdType>(hits[r].size());
+          buffer.insert(buffer.end(), hits[r].begin(), hits[r].end());
+        }
+      }
+    });
+  }
+  std::partial_sum(offsetsPtr, offsetsPtr + numLines + 1, offsetsPtr);
+
+  const vtkIdType numHits = offsetsPtr[numLines];
+  cellIds->SetNumberOfComponents(1);
+  cellIds->SetNumberOfTuples(numHits);
+  if (ts)
+  {
+    ts->SetNumberOfComponents(1);
+    ts->SetNumberOfTuples(numHits);
+  }
+  if (points)
+  {
+    points->SetNumberOfPoints(numHits);
+  }
+  vtkSMPTools::For(0, numLines, [&](vtkIdType lineId, vtkIdType endLineId) {
+    for (; lineId < endLineId; ++lineId)
+    {
+      if (offsetsPtr[lineId] == offsetsPtr[lineId + 1])
+      {
+        continue;
+      }
+      const LineHit* hit = results[lineId].Buffer->data() + results[lineId].Start;
+      for (vtkIdType i = offsetsPtr[lineId]; i < offsetsPtr[lineId + 1]; ++i, ++hit)
+      {
+        cellIds->SetValue(i, hit->CellId);
+        if (ts)
+        {
+          ts->SetValue(i, hit->T);
+        }
+        if (points)
+        {
+          points->SetPoint(i, hit->X);
+        }
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindClosestPointWithinRadius(double x[3], double radius,
+  double closestPoint[3], vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2,
+  int& inside)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return 0;
+  }
+  return this->Tree->FindClosestPointWithinRadius(
+    x, radius, closestPoint, cell, cellId, subId, dist2, inside);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::FindCellsWithinBounds(double* bbox, vtkIdList* cells)
+{
+  cells->Reset();
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return;
+  }
+  this->Tree->FindCellsWithinBounds(bbox, cells);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkBVHCellLocator::FindCell(
+  double pos[3], double, vtkGenericCell* cell, int& subId, double pcoords[3], double* weights)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return -1;
+  }
+  return this->Tree->FindCell(pos, cell, subId, pcoords, weights);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::GenerateRepresentation(int level, vtkPolyData* pd)
+{
+  this->BuildLocator();
+  if (!this->Tree)
+  {
+    return;
+  }
+  this->Tree->GenerateRepresentation(level, pd);
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::ShallowCopy(vtkAbstractCellLocator* locator)
+{
+  vtkBVHCellLocator* bvhLocator = vtkBVHCellLocator::SafeDownCast(locator);
+  if (!bvhLocator)
+  {
+    vtkErrorMacro("Cannot cast " << locator->GetClassName() << " to vtkBVHCellLocator.");
+    return;
+  }
+  // we only copy what's actually used by vtkBVHCellLocator
+
+  // vtkLocator parameters
+  this->SetUseExistingSearchStructure(bvhLocator->GetUseExistingSearchStructure());
+
+  // vtkAbstractCellLocator parameters
+  this->SetNumberOfCellsPerNode(bvhLocator->GetNumberOfCellsPerNode());
+  this->CacheCellBounds = bvhLocator->CacheCellBounds;
+  this->CellBoundsSharedPtr = bvhLocator->CellBoundsSharedPtr; // This is important
+  this->CellBounds = this->CellBoundsSharedPtr.get() ? this->CellBoundsSharedPtr->data() : nullptr;
+
+  // vtkBVHCellLocator parameters
+  this->NumberOfBins = bvhLocator->NumberOfBins;
+  this->Tree = bvhLocator->Tree;
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkBVHCellLocator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfBins: " << this->NumberOfBins << "\n";
+  os << indent << "NumberOfNodes: " << this->GetNumberOfNodes() << "\n";
+}
+VTK_ABI_NAMESPACE_END
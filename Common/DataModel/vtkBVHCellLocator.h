@@ -0,0 +1,195 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkBVHCellLocator
+ * @brief   a bounding volume hierarchy of cells, built with the surface area heuristic
+ *
+ * vtkBVHCellLocator is a cell locator organizing the cells into a binary
+ * tree of axis aligned bounding boxes (a bounding volume hierarchy, BVH).
+ * Each cell lies in exactly one leaf of the tree. The nodes are split using
+ * the surface area heuristic (SAH): the cells of a node are binned along the
+ * three axes according to the center of their bounds, and the split
+ * minimizing the sum of the areas of the children boxes weighted by their
+ * number of cells is chosen. This produces trees well suited to ray casting,
+ * even for meshes whose cells have very different sizes.
+ *
+ * The tree is built in parallel using vtkSMPTools: the large nodes near the
+ * root are split one at a time with their cells binned in parallel, then the
+ * subtrees of the smaller nodes are built concurrently. The resulting tree
+ * does not depend on the number of threads.
+ *
+ * In addition to the vtkAbstractCellLocator queries, vtkBVHCellLocator
+ * intersects batches of lines with the cells, in parallel. The lines are
+ * sorted so that similar lines are close to each other, and traverse the tree
+ * in packets of several lines, sharing the node and cell visits.
+ *
+ * vtkBVHCellLocator utilizes the following parent class parameters:
+ * - NumberOfCellsPerNode        (default 4)
+ * - UseExistingSearchStructure  (default false)
+ *
+ * vtkBVHCellLocator does NOT utilize the following parameters (the bounds
+ * of the cells are always stored):
+ * - CacheCellBounds
+ * - Automatic
+ * - Level
+ * - MaxLevel
+ * - Tolerance
+ * - RetainCellLists
+ *
+ * @sa
+ * vtkAbstractCellLocator vtkCellLocator vtkCellTreeLocator vtkStaticCellLocator
+ * vtkModifiedBSPTree vtkOBBTree
+ */
+
+#ifndef vtkBVHCellLocator_h
+#define vtkBVHCellLocator_h
+
+#include "vtkAbstractCellLocator.h"
+#include "vtkCommonDataModelModule.h" // For export macro
+
+#include <memory> // For shared_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDoubleArray;
+class vtkIdTypeArray;
+struct vtkBVHCellLocatorTree;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkBVHCellLocator : public vtkAbstractCellLocator
+{
+public:
+  ///@{
+  /**
+   * Standard methods to print and obtain type-related information.
+   */
+  static vtkBVHCellLocator* New();
+  vtkTypeMacro(vtkBVHCellLocator, vtkAbstractCellLocator);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of bins used along each axis to evaluate the surface
+   * area heuristic when splitting a node. More bins give better splits but
+   * slower builds. Default is 16.
+   */
+  vtkSetClampMacro(NumberOfBins, int, 2, 256);
+  vtkGetMacro(NumberOfBins, int);
+  ///@}
+
+  /**
+   * Return the number of nodes of the tree, or 0 if it is not built.
+   */
+  vtkIdType GetNumberOfNodes();
+
+  // Re-use any superclass signatures that we don't override.
+  using vtkAbstractCellLocator::FindCell;
+  using vtkAbstractCellLocator::FindClosestPointWithinRadius;
+  using vtkAbstractCellLocator::IntersectWithLine;
+
+  /**
+   * Return intersection point (if any) AND the cell which was intersected by
+   * the finite line. The cell is returned as a cell id and as a generic cell.
+   * This method is thread safe if BuildLocator() is called first.
+   */
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, double& t, double x[3],
+    double pcoords[3], int& subId, vtkIdType& cellId, vtkGenericCell* cell) override;
+
+  /**
+   * Take the passed line segment and intersect it with the data set.
+   * The return value of the function is 0 if no intersections were found.
+   * For each intersection with the bounds of a cell or with a cell (if a cell is provided),
+   * the points and cellIds have the relevant information added sorted by t.
+   * If points or cellIds are nullptr pointers, then no information is generated for that list.
+   *
+   * For other IntersectWithLine signatures, see vtkAbstractCellLocator.
+   */
+  int IntersectWithLine(const double p1[3], const double p2[3], double tol, vtkPoints* points,
+    vtkIdList* cellIds, vtkGenericCell* cell) override;
+
+  ///@{
+  /**
+   * Intersect a batch of finite lines, going from p1s to p2s, with the cells,
+   * in parallel. The first method returns, for each line, the first cell
+   * intersected (or -1 if none), and optionally the parametric coordinate t
+   * along the line (or -1 if none) and the intersection point (the end point
+   * of the line if none). The second method returns all the cells intersected
+   * by the lines, sorted by t, in a compressed layout: the cells intersected by
+   * the i-th line are cellIds[offsets[i]] to cellIds[offsets[i+1]-1], with the
+   * matching t and intersection points. The lines traverse the tree by
+   * packets, which is much faster than intersecting them one at a time.
+   */
+  void IntersectWithLines(vtkPoints* p1s, vtkPoints* p2s, double tol, vtkIdList* cellIds,
+    vtkDoubleArray* ts = nullptr, vtkPoints* points = nullptr);
+  void IntersectWithLines(vtkPoints* p1s, vtkPoints* p2s, double tol, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* cellIds, vtkDoubleArray* ts = nullptr, vtkPoints* points = nullptr);
+  ///@}
+
+  /**
+   * Return the closest point within a specified radius and the cell which is
+   * closest to the point x. The closest point is somewhere on a cell, it
+   * need not be one of the vertices of the cell. This method returns 1 if a
+   * point is found within the specified radius. If there are no cells within
+   * the specified radius, the method returns 0 and the values of
+   * closestPoint, cellId, subId, and dist2 are undefined. If a closest point
+   * is found, inside returns the return value of the EvaluatePosition call to
+   * the closest cell; inside(=1) or outside(=0).
+   * This method is thread safe if BuildLocator() is called first.
+   */
+  vtkIdType FindClosestPointWithinRadius(double x[3], double radius, double closestPoint[3],
+    vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2, int& inside) override;
+
+  /**
+   * Return a list of unique cell ids inside of a given bounding box. The
+   * user must provide the vtkIdList to populate.
+   */
+  void FindCellsWithinBounds(double* bbox, vtkIdList* cells) override;
+
+  /**
+   * Return true: FindCell() is thread safe.
+   */
+  bool SupportsThreadSafeFindCell() override { return true; }
+
+  /**
+   * Find the cell containing a given point. returns -1 if no cell found
+   * the cell parameters are copied into the supplied variables, a cell must
+   * be provided to store the information.
+   */
+  vtkIdType FindCell(double pos[3], double vtkNotUsed(tol2), vtkGenericCell* cell, int& subId,
+    double pcoords[3], double* weights) override;
+
+  ///@{
+  /**
+   * Satisfy vtkLocator abstract interface. GenerateRepresentation() returns
+   * the boxes of the nodes at the given depth of the tree, or the boxes of
+   * all the leaves if level is negative.
+   */
+  void FreeSearchStructure() override;
+  void BuildLocator() override;
+  void ForceBuildLocator() override;
+  void GenerateRepresentation(int level, vtkPolyData* pd) override;
+  ///@}
+
+  /**
+   * Shallow copy of a vtkBVHCellLocator. The tree is shared.
+   *
+   * Before you shallow copy, make sure to call SetDataSet()
+   */
+  void ShallowCopy(vtkAbstractCellLocator* locator) override;
+
+protected:
+  vtkBVHCellLocator();
+  ~vtkBVHCellLocator() override;
+
+  void BuildLocatorInternal() override;
+
+  int NumberOfBins;
+
+  std::shared_ptr<vtkBVHCellLocatorTree> Tree;
+
+private:
+  vtkBVHCellLocator(const vtkBVHCellLocator&) = delete;
+  void operator=(const vtkBVHCellLocator&) = delete;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif
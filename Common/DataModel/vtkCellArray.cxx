@@ -30,7 +30,8 @@ struct GetSizeImpl
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells) const
   {
-    return (cells.GetOffsets()->GetSize() + cells.GetConnectivity()->GetSize());
+    const vtkIdType offsetsSize = cells.GetFixedCellSize() > 0 ? 0 : cells.GetOffsets()->GetSize();
+    return (offsetsSize + cells.GetConnectivity()->GetSize());
   }
 };
 
@@ -44,6 +45,15 @@ struct LocationToCellIdFunctor
   {
     using ValueType = typename CellStateT::ValueType;
 
+    const vtkIdType cellSize = cells.GetFixedCellSize();
+    if (cellSize > 0)
+    { // Each cell takes cellSize + 1 values in the legacy format:
+      const vtkIdType cellId = location / (cellSize + 1);
+      const bool valid =
+        location >= 0 && location % (cellSize + 1) == 0 && cellId < cells.GetNumberOfCells();
+      return valid ? cellId : -1;
+    }
+
     const auto offsets = vtk::DataArrayValueRange<1>(cells.GetOffsets());
 
     // Use a binary-search to find the location:
@@ -105,7 +115,7 @@ struct CellIdToLocationFunctor
   {
     // Adding the cellId to the offset of that cell id gives us the cell
     // location in the old-style vtkCellArray connectivity array.
-    return static_cast<vtkIdType>(cells.GetOffsets()->GetValue(cellId)) + cellId;
+    return cells.GetBeginOffset(cellId) + cellId;
   }
 };
 
@@ -116,8 +126,7 @@ struct GetInsertLocationImpl
   {
     // The insert location used to just be the tail of the connectivity array.
     // Compute the equivalent value:
-    return (
-      (cells.GetOffsets()->GetNumberOfValues() - 1) + cells.GetConnectivity()->GetNumberOfValues());
+    return (cells.GetNumberOfCells() + cells.GetConnectivity()->GetNumberOfValues());
   }
 };
 
@@ -151,6 +160,8 @@ struct InitializeImpl
   template <typename CellStateT>
   void operator()(CellStateT& cells) const
   {
+    // Initialize the connectivity first, so that fixed size storage switches
+    // to variable size storage without generating any offset.
     cells.GetConnectivity()->Initialize();
     cells.GetOffsets()->Initialize();
     cells.GetOffsets()->InsertNextValue(0);
@@ -163,7 +174,10 @@ struct SqueezeImpl
   void operator()(CellStateT& cells) const
   {
     cells.GetConnectivity()->Squeeze();
-    cells.GetOffsets()->Squeeze();
+    if (cells.GetFixedCellSize() == 0)
+    {
+      cells.GetOffsets()->Squeeze();
+    }
   }
 };
 
@@ -173,9 +187,17 @@ struct IsValidImpl
   bool operator()(CellStateT& state) const
   {
     using ValueType = typename CellStateT::ValueType;
-    auto* offsetArray = state.GetOffsets();
     auto* connArray = state.GetConnectivity();
 
+    const vtkIdType cellSize = state.GetFixedCellSize();
+    if (cellSize > 0)
+    { // Fixed size storage only holds whole cells
+      return connArray->GetNumberOfComponents() == 1 &&
+        connArray->GetNumberOfValues() % cellSize == 0;
+    }
+
+    auto* offsetArray = state.GetOffsets();
+
     // Both arrays must be single component
     if (offsetArray->GetNumberOfComponents() != 1 || connArray->GetNumberOfComponents() != 1)
     {
@@ -219,14 +241,24 @@ struct CanConvert
 
     // offsets are sorted, so just check the last value, but we have to compute
     // the full range of the connectivity array.
-    auto* off = state.GetOffsets();
-    if (off->GetNumberOfValues() > 0 && !this->CheckValue(off->GetValue(off->GetMaxId())))
+    auto* mutConn = const_cast<ArrayType*>(state.GetConnectivity());
+    if (state.GetFixedCellSize() > 0)
+    { // The last implied offset is the size of the connectivity array
+      if (!this->CheckValue(mutConn->GetNumberOfValues()))
+      {
+        return false;
+      }
+    }
+    else
     {
-      return false;
+      auto* off = state.GetOffsets();
+      if (off->GetNumberOfValues() > 0 && !this->CheckValue(off->GetValue(off->GetMaxId())))
+      {
+        return false;
+      }
     }
 
     std::array<ValueType, 2> connRange;
-    auto* mutConn = const_cast<ArrayType*>(state.GetConnectivity());
     if (mutConn->GetNumberOfValues() > 0)
     {
       mutConn->GetValueRange(connRange.data(), 0);
@@ -251,8 +283,9 @@ struct ExtractAndInitialize
   template <typename CellStateT, typename TargetArrayT>
   bool operator()(CellStateT& state, TargetArrayT* offsets, TargetArrayT* conn) const
   {
-    return (
-      this->Process(state.GetOffsets(), offsets) && this->Process(state.GetConnectivity(), conn));
+    // The offsets of fixed size storage are implied and not extracted
+    return ((state.GetFixedCellSize() > 0 || this->Process(state.GetOffsets(), offsets)) &&
+      this->Process(state.GetConnectivity(), conn));
   }
 
   template <typename SourceArrayT, typename TargetArrayT>
@@ -280,7 +313,6 @@ struct IsHomogeneousImpl
   vtkIdType operator()(CellArraysT& state) const
   {
     using ValueType = typename CellArraysT::ValueType;
-    auto* offsets = state.GetOffsets();
 
     const vtkIdType numCells = state.GetNumberOfCells();
     if (numCells == 0)
@@ -288,6 +320,13 @@ struct IsHomogeneousImpl
       return 0;
     }
 
+    const vtkIdType fixedCellSize = state.GetFixedCellSize();
+    if (fixedCellSize > 0)
+    {
+      return fixedCellSize;
+    }
+    auto* offsets = state.GetOffsets();
+
     // Initialize using the first cell:
     const vtkIdType firstCellSize = state.GetCellSize(0);
 
@@ -310,6 +349,11 @@ struct AllocateExactImpl
   template <typename CellStateT>
   bool operator()(CellStateT& cells, vtkIdType numCells, vtkIdType connectivitySize) const
   {
+    if (cells.GetFixedCellSize() > 0)
+    { // No offsets to allocate
+      return cells.GetConnectivity()->Allocate(connectivitySize);
+    }
+
     const bool result = (cells.GetOffsets()->Allocate(numCells + 1) &&
       cells.GetConnectivity()->Allocate(connectivitySize));
     if (result)
@@ -326,6 +370,11 @@ struct ResizeExactImpl
   template <typename CellStateT>
   bool operator()(CellStateT& cells, vtkIdType numCells, vtkIdType connectivitySize) const
   {
+    if (cells.GetFixedCellSize() > 0 && numCells * cells.GetFixedCellSize() == connectivitySize)
+    { // Resize fixed size storage, without offsets
+      return cells.GetConnectivity()->SetNumberOfValues(connectivitySize);
+    }
+
     return (cells.GetOffsets()->SetNumberOfValues(numCells + 1) &&
       cells.GetConnectivity()->SetNumberOfValues(connectivitySize));
   }
@@ -378,8 +427,9 @@ struct GetActualMemorySizeImpl
   template <typename CellStateT>
   unsigned long operator()(CellStateT& cells) const
   {
-    return (
-      cells.GetOffsets()->GetActualMemorySize() + cells.GetConnectivity()->GetActualMemorySize());
+    const unsigned long offsetsSize =
+      cells.GetFixedCellSize() > 0 ? 0 : cells.GetOffsets()->GetActualMemorySize();
+    return (offsetsSize + cells.GetConnectivity()->GetActualMemorySize());
   }
 };
 
@@ -388,8 +438,15 @@ struct PrintSelfImpl
   template <typename CellStateT>
   void operator()(CellStateT& cells, ostream& os, vtkIndent indent) const
   {
-    os << indent << "Offsets:\n";
-    cells.GetOffsets()->PrintSelf(os, indent.GetNextIndent());
+    if (cells.GetFixedCellSize() > 0)
+    {
+      os << indent << "FixedCellSize: " << cells.GetFixedCellSize() << "\n";
+    }
+    else
+    {
+      os << indent << "Offsets:\n";
+      cells.GetOffsets()->PrintSelf(os, indent.GetNextIndent());
+    }
     os << indent << "Connectivity:\n";
     cells.GetConnectivity()->PrintSelf(os, indent.GetNextIndent());
   }
@@ -400,8 +457,7 @@ struct GetLegacyDataSizeImpl
   template <typename CellStateT>
   vtkIdType operator()(CellStateT& cells) const
   {
-    return (
-      (cells.GetOffsets()->GetNumberOfValues() - 1) + cells.GetConnectivity()->GetNumberOfValues());
+    return (cells.GetNumberOfCells() + cells.GetConnectivity()->GetNumberOfValues());
   }
 };
 
@@ -482,11 +538,38 @@ struct AppendImpl
   template <typename SrcCellStateT, typename DstCellStateT>
   void operator()(SrcCellStateT& src, DstCellStateT& dst, vtkIdType pointOffsets) const
   {
-    this->AppendArrayWithOffset(
-      src.GetOffsets(), dst.GetOffsets(), dst.GetConnectivity()->GetNumberOfValues(), true);
+    const vtkIdType srcCellSize = src.GetFixedCellSize();
+    if (srcCellSize == 0)
+    {
+      this->AppendArrayWithOffset(
+        src.GetOffsets(), dst.GetOffsets(), dst.GetConnectivity()->GetNumberOfValues(), true);
+    }
+    else if (dst.GetFixedCellSize() != srcCellSize)
+    { // Generate the offsets of src, leaving its fixed size storage untouched
+      this->AppendFixedSizeOffsets(
+        srcCellSize, src.GetNumberOfCells(), dst.GetOffsets(), dst.GetConnectivity());
+    }
     this->AppendArrayWithOffset(src.GetConnectivity(), dst.GetConnectivity(), pointOffsets, false);
   }
 
+  // Append the offsets of numCells cells of cellSize points to dstOffsets.
+  template <typename DstArrayT>
+  void AppendFixedSizeOffsets(
+    vtkIdType cellSize, vtkIdType numCells, DstArrayT* dstOffsets, DstArrayT* dstConn) const
+  {
+    using DstValueType = vtk::GetAPIType<DstArrayT>;
+
+    const vtkIdType dstBegin = dstOffsets->GetNumberOfValues();
+    const vtkIdType offset = dstConn->GetNumberOfValues();
+    dstOffsets->InsertValue(dstBegin + numCells - 1, 0);
+
+    auto dstRange = vtk::DataArrayValueRange<1>(dstOffsets, dstBegin, dstBegin + numCells);
+    for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+    {
+      dstRange[cellId] = static_cast<DstValueType>(offset + (cellId + 1) * cellSize);
+    }
+  }
+
   // Assumes both arrays are 1 component. src's data is appended to dst with
   // offset added to each value.
   template <typename SrcArrayT, typename DstArrayT>
@@ -690,6 +773,7 @@ void vtkCellArray::DeepCopy(vtkAbstractCellArray* ca)
     auto& dstStorage = this->Storage.GetArrays64();
     dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
     dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
+    dstStorage.SetFixedCellSize(srcStorage.GetFixedCellSize());
     this->Modified();
   }
   else
@@ -699,6 +783,7 @@ void vtkCellArray::DeepCopy(vtkAbstractCellArray* ca)
     auto& dstStorage = this->Storage.GetArrays32();
     dstStorage.Offsets->DeepCopy(srcStorage.Offsets);
     dstStorage.Connectivity->DeepCopy(srcStorage.Connectivity);
+    dstStorage.SetFixedCellSize(srcStorage.GetFixedCellSize());
     this->Modified();
   }
 }
@@ -716,15 +801,21 @@ void vtkCellArray::ShallowCopy(vtkAbstractCellArray* ca)
     return;
   }
 
+  // The offsets of fixed size storage are implied and not shared
+  const vtkIdType fixedCellSize = other->GetFixedCellSize();
   if (other->Storage.Is64Bit())
   {
     auto& srcStorage = other->Storage.GetArrays64();
-    this->SetData(srcStorage.GetOffsets(), srcStorage.GetConnectivity());
+    this->SetData(srcStorage.Offsets.Get(), srcStorage.GetConnectivity());
   }
   else
   {
     auto& srcStorage = other->Storage.GetArrays32();
-    this->SetData(srcStorage.GetOffsets(), srcStorage.GetConnectivity());
+    this->SetData(srcStorage.Offsets.Get(), srcStorage.GetConnectivity());
+  }
+  if (fixedCellSize > 0)
+  {
+    this->ReleaseOffsets(fixedCellSize);
   }
 }
 
@@ -733,6 +824,10 @@ void vtkCellArray::Append(vtkCellArray* src, vtkIdType pointOffset)
 {
   if (src->GetNumberOfCells() > 0)
   {
+    if (this->GetNumberOfCells() == 0 && src->IsStorageFixedSize())
+    { // Keep the fixed size storage of src
+      this->ReleaseOffsets(src->GetFixedCellSize());
+    }
     this->Visit(AppendImpl{}, src, pointOffset);
   }
 }
@@ -770,6 +865,7 @@ void vtkCellArray::SetData(vtkTypeInt32Array* offsets, vtkTypeInt32Array* connec
   // vtkArrayDownCast to ensure this works when ArrayType32 is vtkIdTypeArray.
   storage.Offsets = vtkArrayDownCast<ArrayType32>(offsets);
   storage.Connectivity = vtkArrayDownCast<ArrayType32>(connectivity);
+  storage.SetFixedCellSize(0);
   this->Modified();
 }
 
@@ -789,6 +885,7 @@ void vtkCellArray::SetData(vtkTypeInt64Array* offsets, vtkTypeInt64Array* connec
   // vtkArrayDownCast to ensure this works when ArrayType64 is vtkIdTypeArray.
   storage.Offsets = vtkArrayDownCast<ArrayType64>(offsets);
   storage.Connectivity = vtkArrayDownCast<ArrayType64>(connectivity);
+  storage.SetFixedCellSize(0);
   this->Modified();
 }
 
@@ -899,22 +996,6 @@ struct SetDataGenericImpl
   }
 };
 
-struct GenerateOffsetsImpl
-{
-  vtkIdType CellSize;
-  vtkIdType ConnectivityArraySize;
-
-  template <typename ArrayT>
-  void operator()(ArrayT* offsets)
-  {
-    for (vtkIdType cc = 0, max = (offsets->GetNumberOfTuples() - 1); cc < max; ++cc)
-    {
-      offsets->SetTypedComponent(cc, 0, cc * this->CellSize);
-    }
-    offsets->SetTypedComponent(offsets->GetNumberOfTuples() - 1, 0, this->ConnectivityArraySize);
-  }
-};
-
 } // end anon namespace
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -956,21 +1037,77 @@ bool vtkCellArray::SetData(vtkIdType cellSize, vtkDataArray* connectivity)
     return false;
   }
 
+  // Set the connectivity with the offsets of an empty cell array, then switch
+  // to fixed size storage where the offsets are implied.
   vtkSmartPointer<vtkDataArray> offsets;
   offsets.TakeReference(connectivity->NewInstance());
-  offsets->SetNumberOfTuples(1 + connectivity->GetNumberOfTuples() / cellSize);
+  offsets->SetNumberOfTuples(1);
+  offsets->SetComponent(0, 0, 0);
+  if (!this->SetData(offsets, connectivity))
+  {
+    return false;
+  }
 
-  GenerateOffsetsImpl worker{ cellSize, connectivity->GetNumberOfTuples() };
-  using SupportedArrays = vtkCellArray::InputArrayList;
-  using Dispatch = vtkArrayDispatch::DispatchByArray<SupportedArrays>;
-  if (!Dispatch::Execute(offsets, worker))
+  this->ReleaseOffsets(cellSize);
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkCellArray::ReleaseOffsets(vtkIdType cellSize)
+{
+  if (this->Storage.Is64Bit())
+  {
+    auto& storage = this->Storage.GetArrays64();
+    storage.Offsets = vtkSmartPointer<ArrayType64>::New();
+    storage.SetFixedCellSize(cellSize);
+  }
+  else
+  {
+    auto& storage = this->Storage.GetArrays32();
+    storage.Offsets = vtkSmartPointer<ArrayType32>::New();
+    storage.SetFixedCellSize(cellSize);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkCellArray::UseFixedSizeStorage(vtkIdType cellSize)
+{
+  if (cellSize <= 0)
+  {
+    vtkErrorMacro("Invalid cellSize " << cellSize << " for fixed size storage.");
+    return;
+  }
+  this->Initialize();
+  this->ReleaseOffsets(cellSize);
+}
+
+//------------------------------------------------------------------------------
+bool vtkCellArray::ConvertToFixedSizeStorage()
+{
+  if (this->IsStorageFixedSize())
+  {
+    return true;
+  }
+  const vtkIdType cellSize = this->IsHomogeneous();
+  if (cellSize <= 0)
   {
-    vtkErrorMacro("Invalid array types passed to SetData: "
-      << "connectivity=" << connectivity->GetClassName());
     return false;
   }
+  this->ReleaseOffsets(cellSize);
+  this->Modified();
+  return true;
+}
 
-  return this->SetData(offsets, connectivity);
+//------------------------------------------------------------------------------
+bool vtkCellArray::ConvertToVariableSizeStorage()
+{
+  if (this->IsStorageFixedSize())
+  {
+    // Generates the offsets
+    this->GetOffsetsArray();
+    this->Modified();
+  }
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -1038,6 +1175,7 @@ bool vtkCellArray::ConvertTo32BitStorage()
   {
     return true;
   }
+  const vtkIdType fixedCellSize = this->GetFixedCellSize();
   vtkNew<ArrayType32> offsets;
   vtkNew<ArrayType32> conn;
   if (!this->Visit(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
@@ -1046,6 +1184,10 @@ bool vtkCellArray::ConvertTo32BitStorage()
   }
 
   this->SetData(offsets, conn);
+  if (fixedCellSize > 0)
+  {
+    this->ReleaseOffsets(fixedCellSize);
+  }
   return true;
 }
 
@@ -1056,6 +1198,7 @@ bool vtkCellArray::ConvertTo64BitStorage()
   {
     return true;
   }
+  const vtkIdType fixedCellSize = this->GetFixedCellSize();
   vtkNew<ArrayType64> offsets;
   vtkNew<ArrayType64> conn;
   if (!this->Visit(ExtractAndInitialize{}, offsets.Get(), conn.Get()))
@@ -1064,6 +1207,10 @@ bool vtkCellArray::ConvertTo64BitStorage()
   }
 
   this->SetData(offsets, conn);
+  if (fixedCellSize > 0)
+  {
+    this->ReleaseOffsets(fixedCellSize);
+  }
   return true;
 }
 
@@ -1105,6 +1252,12 @@ bool vtkCellArray::ResizeExact(vtkIdType numCells, vtkIdType connectivitySize)
 // defining the cell.
 int vtkCellArray::GetMaxCellSize()
 {
+  const vtkIdType fixedCellSize = this->GetFixedCellSize();
+  if (fixedCellSize > 0)
+  {
+    return this->GetNumberOfCells() > 0 ? static_cast<int>(fixedCellSize) : 0;
+  }
+
   const vtkIdType numCells = this->GetNumberOfCells();
   // We use THRESHOLD to test if the data size is small enough
   // to execute the functor serially. This is faster.
@@ -1127,6 +1280,7 @@ void vtkCellArray::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "StorageIs64Bit: " << this->Storage.Is64Bit() << "\n";
+  os << indent << "StorageIsFixedSize: " << this->IsStorageFixedSize() << "\n";
 
   PrintSelfImpl functor;
   this->Visit(functor, os, indent);
@@ -84,6 +84,21 @@
  * - `bool ConvertToDefaultStorage() // Depends on vtkIdType`
  * - `bool ConvertToSmallestStorage() // Depends on current values in arrays`
  *
+ * When all the cells have the same number of points, e.g. a mesh of
+ * tetrahedra or of triangles, the cell array may also use fixed size
+ * storage, that keeps the Connectivity array only: the offset of each cell is
+ * implied by its id and the common cell size. This saves the memory of the
+ * Offsets array and an indirection on every cell access. Fixed size storage
+ * is transparent: inserting a cell of another size, or requesting the
+ * Offsets array, generates the offsets and switches back to variable size
+ * storage. Methods for managing fixed size storage are:
+ *
+ * - `bool IsStorageFixedSize()`
+ * - `void UseFixedSizeStorage(vtkIdType cellSize)`
+ * - `bool CanConvertToFixedSizeStorage()`
+ * - `bool ConvertToFixedSizeStorage()`
+ * - `bool ConvertToVariableSizeStorage()`
+ *
  * Note that some legacy methods are still available that reflect the
  * previous storage format of this data, which embedded the cell sizes into
  * the Connectivity array:
@@ -136,8 +151,10 @@
 #include "vtkTypeInt64Array.h"       // Needed for inline methods
 #include "vtkTypeList.h"             // Needed for ArrayList definition
 
+#include <atomic>           // for std::atomic
 #include <cassert>          // for assert
 #include <initializer_list> // for API
+#include <mutex>            // for std::mutex
 #include <type_traits>      // for std::is_same
 #include <utility>          // for std::forward
 
@@ -295,6 +312,9 @@ public:
    * - The offset array values never decrease.
    * - The connectivity array has as many entries as the last value in the
    *   offset array.
+   *
+   * With fixed size storage, the connectivity array must have one component
+   * and a multiple of the cell size of entries.
    */
   bool IsValid();
 
@@ -305,11 +325,11 @@ public:
   {
     if (this->Storage.Is64Bit())
     {
-      return this->Storage.GetArrays64().Offsets->GetNumberOfValues() - 1;
+      return this->Storage.GetArrays64().GetNumberOfCells();
     }
     else
     {
-      return this->Storage.GetArrays32().Offsets->GetNumberOfValues() - 1;
+      return this->Storage.GetArrays32().GetNumberOfCells();
     }
   }
 
@@ -317,17 +337,7 @@ public:
    * Get the number of elements in the offsets array. This will be the number of
    * cells + 1.
    */
-  vtkIdType GetNumberOfOffsets() const override
-  {
-    if (this->Storage.Is64Bit())
-    {
-      return this->Storage.GetArrays64().Offsets->GetNumberOfValues();
-    }
-    else
-    {
-      return this->Storage.GetArrays32().Offsets->GetNumberOfValues();
-    }
-  }
+  vtkIdType GetNumberOfOffsets() const override { return this->GetNumberOfCells() + 1; }
 
   /**
    * Get the offset (into the connectivity) for a specified cell id.
@@ -336,11 +346,11 @@ public:
   {
     if (this->Storage.Is64Bit())
     {
-      return this->Storage.GetArrays64().Offsets->GetValue(cellId);
+      return this->Storage.GetArrays64().GetBeginOffset(cellId);
     }
     else
     {
-      return this->Storage.GetArrays32().Offsets->GetValue(cellId);
+      return this->Storage.GetArrays32().GetBeginOffset(cellId);
     }
   }
 
@@ -403,8 +413,8 @@ public:
   bool SetData(vtkDataArray* offsets, vtkDataArray* connectivity);
 
   /**
-   * Sets the internal arrays to the supported connectivity array with an
-   * offsets array automatically generated given the fixed cells size.
+   * Sets the internal arrays to the supported connectivity array, using fixed
+   * size storage where the offsets are implied by the fixed cells size.
    *
    * This is a convenience method, and may fail if the following conditions
    * are not met:
@@ -441,6 +451,41 @@ public:
     }
   }
 
+  /**
+   * @return True if the internal storage is using fixed size storage, where
+   * all the cells have the same number of points and the offsets are implied.
+   */
+  bool IsStorageFixedSize() const { return this->GetFixedCellSize() > 0; }
+
+  /**
+   * Initialize internal data structures to use fixed size storage of cells of
+   * @a cellSize points, keeping the 32- or 64-bit storage. Cells of this size
+   * may then be inserted without storing their offsets.
+   *
+   * All existing data is erased.
+   */
+  void UseFixedSizeStorage(vtkIdType cellSize);
+
+  /**
+   * Check if the existing data can use fixed size storage, i.e. if the cell
+   * array holds cells that all have the same number of points.
+   */
+  bool CanConvertToFixedSizeStorage() { return this->IsHomogeneous() > 0; }
+
+  /**
+   * Convert internal data structures to use fixed size storage, releasing
+   * the offsets, or variable size storage, generating the offsets.
+   *
+   * Existing data is preserved.
+   *
+   * @return True on success, false if the cells do not all have the same
+   * number of points.
+   * @{
+   */
+  bool ConvertToFixedSizeStorage();
+  bool ConvertToVariableSizeStorage();
+  /**@}*/
+
   /**
    * Initialize internal data structures to use 32- or 64-bit storage.
    * If selecting default storage, the storage depends on the VTK_USE_64BIT_IDS
@@ -492,6 +537,9 @@ public:
   /**
    * Return the array used to store cell offsets. The 32/64 variants are only
    * valid when IsStorage64Bit() returns the appropriate value.
+   *
+   * With fixed size storage, the offsets are generated and the cell array
+   * switches to variable size storage.
    * @{
    */
   vtkDataArray* GetOffsetsArray()
@@ -505,8 +553,8 @@ public:
       return this->GetOffsetsArray32();
     }
   }
-  ArrayType32* GetOffsetsArray32() { return this->Storage.GetArrays32().Offsets; }
-  ArrayType64* GetOffsetsArray64() { return this->Storage.GetArrays64().Offsets; }
+  ArrayType32* GetOffsetsArray32() { return this->Storage.GetArrays32().GetOffsets(); }
+  ArrayType64* GetOffsetsArray64() { return this->Storage.GetArrays64().GetOffsets(); }
   /**@}*/
 
   /**
@@ -795,6 +843,12 @@ public:
 #ifndef __VTK_WRAP__
 
   // Holds connectivity and offset arrays of the given ArrayType.
+  //
+  // With fixed size storage, the offsets array is empty and the offsets are
+  // implied by the cell size. GetOffsets() then generates the offsets and
+  // switches to variable size storage, so functors that only need the cells'
+  // bounds should use GetBeginOffset(), GetEndOffset(), GetCellSize() or
+  // GetCellRange() instead.
   template <typename ArrayT>
   struct VisitState
   {
@@ -810,8 +864,16 @@ public:
     static constexpr bool ValueTypeIsSameAsIdType = std::is_integral<ValueType>::value &&
       std::is_signed<ValueType>::value && (sizeof(ValueType) == sizeof(vtkIdType));
 
-    ArrayType* GetOffsets() { return this->Offsets; }
-    const ArrayType* GetOffsets() const { return this->Offsets; }
+    ArrayType* GetOffsets()
+    {
+      this->ExpandOffsets();
+      return this->Offsets;
+    }
+    const ArrayType* GetOffsets() const
+    {
+      this->ExpandOffsets();
+      return this->Offsets;
+    }
 
     ArrayType* GetConnectivity() { return this->Connectivity; }
     const ArrayType* GetConnectivity() const { return this->Connectivity; }
@@ -826,6 +888,12 @@ public:
 
     CellRangeType GetCellRange(vtkIdType cellId);
 
+    // Number of points of all the cells with fixed size storage, 0 otherwise.
+    vtkIdType GetFixedCellSize() const
+    {
+      return this->FixedCellSize.load(std::memory_order_acquire);
+    }
+
     friend class vtkCellArray;
 
   protected:
@@ -867,6 +935,24 @@ public:
 #endif
     }
 
+    // Set the number of points of all the cells when the offsets are implied,
+    // or 0 when they are stored. The arrays are left untouched.
+    void SetFixedCellSize(vtkIdType cellSize)
+    {
+      this->FixedCellSize.store(cellSize, std::memory_order_release);
+    }
+
+    // Generate the offsets of fixed size storage and switch to variable size
+    // storage. Concurrent calls are safe, the offsets are generated once.
+    void ExpandOffsets() const
+    {
+      if (this->GetFixedCellSize() > 0)
+      {
+        this->GenerateOffsets();
+      }
+    }
+    void GenerateOffsets() const;
+
     vtkSmartPointer<ArrayType> Connectivity;
     vtkSmartPointer<ArrayType> Offsets;
 
@@ -874,6 +960,8 @@ public:
     VisitState(const VisitState&) = delete;
     VisitState& operator=(const VisitState&) = delete;
     bool IsInMemkind = false;
+    mutable std::atomic<vtkIdType> FixedCellSize{ 0 };
+    mutable std::mutex ExpandMutex;
   };
 
 private: // Helpers that allow Visit to return a value:
@@ -1338,6 +1426,23 @@ protected:
 
   static bool DefaultStorageIs64Bit;
 
+  // Number of points of all the cells with fixed size storage, 0 otherwise.
+  vtkIdType GetFixedCellSize() const
+  {
+    if (this->Storage.Is64Bit())
+    {
+      return this->Storage.GetArrays64().GetFixedCellSize();
+    }
+    else
+    {
+      return this->Storage.GetArrays32().GetFixedCellSize();
+    }
+  }
+
+  // Switch to fixed size storage of cells of cellSize points, releasing the
+  // offsets array, without checking the cells.
+  void ReleaseOffsets(vtkIdType cellSize);
+
 private:
   vtkCellArray(const vtkCellArray&) = delete;
   void operator=(const vtkCellArray&) = delete;
@@ -1346,25 +1451,36 @@ private:
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetNumberOfCells() const
 {
-  return this->Offsets->GetNumberOfValues() - 1;
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  return cellSize > 0 ? this->Connectivity->GetNumberOfValues() / cellSize
+                      : this->Offsets->GetNumberOfValues() - 1;
 }
 
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetBeginOffset(vtkIdType cellId) const
 {
-  return static_cast<vtkIdType>(this->Offsets->GetValue(cellId));
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  return cellSize > 0 ? cellId * cellSize : static_cast<vtkIdType>(this->Offsets->GetValue(cellId));
 }
 
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetEndOffset(vtkIdType cellId) const
 {
-  return static_cast<vtkIdType>(this->Offsets->GetValue(cellId + 1));
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  return cellSize > 0 ? (cellId + 1) * cellSize
+                      : static_cast<vtkIdType>(this->Offsets->GetValue(cellId + 1));
 }
 
 template <typename ArrayT>
 vtkIdType vtkCellArray::VisitState<ArrayT>::GetCellSize(vtkIdType cellId) const
 {
-  return this->GetEndOffset(cellId) - this->GetBeginOffset(cellId);
+  const vtkIdType cellSize = this->GetFixedCellSize();
+  if (cellSize > 0)
+  {
+    return cellSize;
+  }
+  return static_cast<vtkIdType>(this->Offsets->GetValue(cellId + 1)) -
+    static_cast<vtkIdType>(this->Offsets->GetValue(cellId));
 }
 
 template <typename ArrayT>
@@ -1374,6 +1490,25 @@ vtkCellArray::VisitState<ArrayT>::GetCellRange(vtkIdType cellId)
   return vtk::DataArrayValueRange<1>(
     this->GetConnectivity(), this->GetBeginOffset(cellId), this->GetEndOffset(cellId));
 }
+
+template <typename ArrayT>
+void vtkCellArray::VisitState<ArrayT>::GenerateOffsets() const
+{
+  std::lock_guard<std::mutex> lock(this->ExpandMutex);
+  const vtkIdType cellSize = this->FixedCellSize.load(std::memory_order_relaxed);
+  if (cellSize == 0)
+  { // Generated by another thread
+    return;
+  }
+  const vtkIdType numCells = this->Connectivity->GetNumberOfValues() / cellSize;
+  this->Offsets->SetNumberOfValues(numCells + 1);
+  ValueType* offsets = this->Offsets->GetPointer(0);
+  for (vtkIdType cellId = 0; cellId <= numCells; ++cellId)
+  {
+    offsets[cellId] = static_cast<ValueType>(cellId * cellSize);
+  }
+  this->FixedCellSize.store(0, std::memory_order_release);
+}
 VTK_ABI_NAMESPACE_END
 
 namespace vtkCellArray_detail
@@ -1388,6 +1523,18 @@ struct InsertNextCellImpl
   {
     using ValueType = typename CellStateT::ValueType;
     auto* conn = state.GetConnectivity();
+
+    const vtkIdType fixedCellSize = state.GetFixedCellSize();
+    if (fixedCellSize > 0 && npts == fixedCellSize)
+    { // Fixed size storage, the offset is implied
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        conn->InsertNextValue(static_cast<ValueType>(pts[i]));
+      }
+      return conn->GetNumberOfValues() / fixedCellSize - 1;
+    }
+
+    // A cell of another size switches fixed size storage to variable size storage
     auto* offsets = state.GetOffsets();
 
     const vtkIdType cellId = offsets->GetNumberOfValues() - 1;
@@ -1537,8 +1684,10 @@ struct ResetImpl
   template <typename CellStateT>
   void operator()(CellStateT& state)
   {
-    state.GetOffsets()->Reset();
+    // Reset the connectivity first, so that fixed size storage switches to
+    // variable size storage without generating any offset.
     state.GetConnectivity()->Reset();
+    state.GetOffsets()->Reset();
     state.GetOffsets()->InsertNextValue(0);
   }
 };
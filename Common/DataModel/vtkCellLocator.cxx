@@ -9,11 +9,32 @@
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
+#include <numeric>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+//------------------------------------------------------------------------------
+// A cell inserted in a leaf octant, sorted by octant then by cell id.
+struct OctantCellPair
+{
+  vtkIdType Octant;
+  vtkIdType CellId;
+
+  bool operator<(const OctantCellPair& other) const
+  {
+    return this->Octant < other.Octant ||
+      (this->Octant == other.Octant && this->CellId < other.CellId);
+  }
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkCellLocator);
 
@@ -716,14 +737,12 @@ void vtkCellLocator::ForceBuildLocator()
 //  The result is directly addressable and of uniform subdivision.
 void vtkCellLocator::BuildLocatorInternal()
 {
-  double length, cellBounds[6], *cellBoundsPtr;
-  cellBoundsPtr = cellBounds;
+  double length, cellBounds[6];
   vtkIdType numCells;
   int ndivs, product;
-  int i, j, k, ijkMin[3], ijkMax[3];
-  vtkIdType cellId, idx;
+  int i, j, k;
+  vtkIdType idx;
   int parentOffset;
-  vtkSmartPointer<vtkIdList> octant;
   int numCellsPerBucket = this->NumberOfCellsPerNode;
   int prod, numOctants;
   double hTol[3];
@@ -787,54 +806,102 @@ void vtkCellLocator::BuildLocatorInternal()
     hTol[i] = this->H[i] / 100.0;
   }
 
-  //  Insert each cell into the appropriate octant.  Make sure cell
-  //  falls within octant.
+  //  Insert each cell into the leaf octants overlapped by its bounds. The
+  //  (octant, cell) pairs are generated and sorted in parallel, so that the
+  //  cells of each octant are listed by increasing id, then the octants are
+  //  filled in parallel.
   parentOffset = numOctants - (ndivs * ndivs * ndivs);
   product = ndivs * ndivs;
-  auto parentOctant = vtkSmartPointer<vtkIdList>::New(); // This is just a place-holder for parents
-  for (cellId = 0; cellId < numCells; cellId++)
+  if (!this->CacheCellBounds)
   {
-    this->GetCellBounds(cellId, cellBoundsPtr);
-
-    // find min/max locations of bounding box
-    for (i = 0; i < 3; i++)
+    // Initialize the data set so that GetCellBounds() is thread safe
+    this->DataSet->GetCellBounds(0, cellBounds);
+  }
+  auto getOctantRange = [&](vtkIdType cellId, int ijkMin[3], int ijkMax[3]) {
+    double cellBoundsLocal[6], *boundsPtr = cellBoundsLocal;
+    this->GetCellBounds(cellId, boundsPtr);
+    for (int ii = 0; ii < 3; ii++)
     {
-      ijkMin[i] =
-        static_cast<int>((cellBoundsPtr[2 * i] - this->Bounds[2 * i] - hTol[i]) / this->H[i]);
-      ijkMax[i] =
-        static_cast<int>((cellBoundsPtr[2 * i + 1] - this->Bounds[2 * i] + hTol[i]) / this->H[i]);
-
-      if (ijkMin[i] < 0)
-      {
-        ijkMin[i] = 0;
-      }
-      if (ijkMax[i] >= ndivs)
-      {
-        ijkMax[i] = ndivs - 1;
-      }
+      ijkMin[ii] =
+        static_cast<int>((boundsPtr[2 * ii] - this->Bounds[2 * ii] - hTol[ii]) / this->H[ii]);
+      ijkMax[ii] =
+        static_cast<int>((boundsPtr[2 * ii + 1] - this->Bounds[2 * ii] + hTol[ii]) / this->H[ii]);
+      ijkMin[ii] = std::max(ijkMin[ii], 0);
+      ijkMax[ii] = std::min(ijkMax[ii], ndivs - 1);
     }
+  };
 
-    // each octant between min/max point may have cell in it
-    for (k = ijkMin[2]; k <= ijkMax[2]; k++)
+  std::vector<vtkIdType> pairOffsets(numCells + 1, 0);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    int ijkMin[3], ijkMax[3];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
     {
-      for (j = ijkMin[1]; j <= ijkMax[1]; j++)
+      getOctantRange(cellId, ijkMin, ijkMax);
+      pairOffsets[cellId + 1] = static_cast<vtkIdType>(ijkMax[0] - ijkMin[0] + 1) *
+        (ijkMax[1] - ijkMin[1] + 1) * (ijkMax[2] - ijkMin[2] + 1);
+    }
+  });
+  std::partial_sum(pairOffsets.begin(), pairOffsets.end(), pairOffsets.begin());
+
+  const vtkIdType numPairs = pairOffsets[numCells];
+  std::vector<OctantCellPair> pairs(numPairs);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    int ijkMin[3], ijkMax[3];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      getOctantRange(cellId, ijkMin, ijkMax);
+      OctantCellPair* pair = pairs.data() + pairOffsets[cellId];
+      for (int kk = ijkMin[2]; kk <= ijkMax[2]; kk++)
       {
-        for (i = ijkMin[0]; i <= ijkMax[0]; i++)
+        for (int jj = ijkMin[1]; jj <= ijkMax[1]; jj++)
         {
-          idx = parentOffset + i + j * ndivs + k * product;
-          this->MarkParents(parentOctant, i, j, k, ndivs, this->Level);
-          octant = this->Tree[idx];
-          if (!octant)
+          for (int ii = ijkMin[0]; ii <= ijkMax[0]; ii++)
           {
-            octant = vtkSmartPointer<vtkIdList>::New();
-            octant->Allocate(numCellsPerBucket, numCellsPerBucket / 2);
-            this->Tree[idx] = octant;
+            pair->Octant = parentOffset + ii + jj * ndivs + kk * product;
+            pair->CellId = cellId;
+            ++pair;
           }
-          octant->InsertNextId(cellId);
         }
       }
     }
-  } // for all cells
+  });
+  vtkSMPTools::Sort(pairs.begin(), pairs.end());
+
+  // Fill the non-empty leaf octants
+  std::vector<vtkIdType> octantStarts;
+  for (vtkIdType pairId = 0; pairId < numPairs; ++pairId)
+  {
+    if (pairId == 0 || pairs[pairId].Octant != pairs[pairId - 1].Octant)
+    {
+      octantStarts.push_back(pairId);
+    }
+  }
+  octantStarts.push_back(numPairs);
+  const vtkIdType numLeaves = static_cast<vtkIdType>(octantStarts.size()) - 1;
+  vtkSMPTools::For(0, numLeaves, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType leaf = begin; leaf < end; ++leaf)
+    {
+      const vtkIdType first = octantStarts[leaf];
+      auto octant = vtkSmartPointer<vtkIdList>::New();
+      octant->SetNumberOfIds(octantStarts[leaf + 1] - first);
+      for (vtkIdType id = 0; id < octant->GetNumberOfIds(); ++id)
+      {
+        octant->SetId(id, pairs[first + id].CellId);
+      }
+      this->Tree[pairs[first].Octant] = octant;
+    }
+  });
+
+  // Mark the parents of the non-empty leaf octants
+  auto parentOctant = vtkSmartPointer<vtkIdList>::New(); // This is just a place-holder for parents
+  for (vtkIdType leaf = 0; leaf < numLeaves; ++leaf)
+  {
+    idx = pairs[octantStarts[leaf]].Octant - parentOffset;
+    i = static_cast<int>(idx % ndivs);
+    j = static_cast<int>((idx / ndivs) % ndivs);
+    k = static_cast<int>(idx / product);
+    this->MarkParents(parentOctant, i, j, k, ndivs, this->Level);
+  }
 
   this->BuildTime.Modified();
 }
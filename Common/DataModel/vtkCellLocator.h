@@ -13,6 +13,9 @@
  * candidate cells, or intersection with another vtkCellLocator to return
  * candidate cells.
  *
+ * The octree is built in parallel using vtkSMPTools, and the cells of each
+ * octant are listed by increasing id.
+ *
  * @warning
  * vtkCellLocator utilizes the following parent class parameters:
  * - Automatic                   (default true)
@@ -120,6 +123,11 @@ public:
   vtkIdType FindClosestPointWithinRadius(double x[3], double radius, double closestPoint[3],
     vtkGenericCell* cell, vtkIdType& cellId, int& subId, double& dist2, int& inside) override;
 
+  /**
+   * Return true: FindCell() is thread safe.
+   */
+  bool SupportsThreadSafeFindCell() override { return true; }
+
   /**
    * Find the cell containing a given point. returns -1 if no cell found
    * the cell parameters are copied into the supplied variables, a cell must
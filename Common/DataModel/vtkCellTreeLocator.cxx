@@ -10,6 +10,8 @@
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <array>
@@ -319,6 +321,13 @@ private:
         this->Max = max;
       }
     }
+
+    inline void Merge(const Bucket& other)
+    {
+      this->Cnt += other.Cnt;
+      this->Min = std::min(this->Min, other.Min);
+      this->Max = std::max(this->Max, other.Max);
+    }
   };
 
   struct CellInfo
@@ -384,6 +393,9 @@ private:
   std::vector<CellInfo> CellsInfo;
   std::vector<CellTreeNode<T>> Nodes;
   std::stack<SplitInfo> SplitStack;
+  // Nodes of fewer cells are the roots of subtrees built in parallel, while
+  // the cells of larger nodes are binned in parallel.
+  T SubtreeSize;
 
   struct BucketsType : public std::array<std::vector<Bucket>, 3>
   {
@@ -403,11 +415,22 @@ private:
       std::fill((*this)[1].begin(), (*this)[1].end(), Bucket());
       std::fill((*this)[2].begin(), (*this)[2].end(), Bucket());
     }
+
+    void Merge(const BucketsType& other)
+    {
+      for (int d = 0; d < 3; ++d)
+      {
+        for (size_t n = 0; n < (*this)[d].size(); ++n)
+        {
+          (*this)[d][n].Merge(other[d][n]);
+        }
+      }
+    }
   };
   BucketsType Buckets;
 
   // -------------------------------------------------------------------------
-  void FindMinMax(const CellInfo* begin, const CellInfo* end, double* min, double* max)
+  static void FindMinMaxSerial(const CellInfo* begin, const CellInfo* end, double* min, double* max)
   {
     if (begin == end)
     {
@@ -437,10 +460,69 @@ private:
   }
 
   // -------------------------------------------------------------------------
-  void Split(T index, double min[3], double max[3], BucketsType& buckets)
+  void FindMinMax(
+    const CellInfo* begin, const CellInfo* end, double* min, double* max, bool parallel)
   {
-    const T& start = this->Nodes[index].Start();
-    const T& size = this->Nodes[index].Size();
+    if (!parallel || begin == end)
+    {
+      FindMinMaxSerial(begin, end, min, max);
+      return;
+    }
+
+    // A thread may process several chunks, so each chunk is reduced separately
+    // and merged into the thread local bounds
+    const std::array<double, 6> emptyMinMax = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX,
+      -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX, -VTK_DOUBLE_MAX };
+    vtkSMPThreadLocal<std::array<double, 6>> tlMinMax(emptyMinMax);
+    vtkSMPTools::For(0, end - begin, [&](vtkIdType first, vtkIdType last) {
+      double chunkMin[3], chunkMax[3];
+      FindMinMaxSerial(begin + first, begin + last, chunkMin, chunkMax);
+      auto& minMax = tlMinMax.Local();
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        minMax[d] = std::min(minMax[d], chunkMin[d]);
+        minMax[d + 3] = std::max(minMax[d + 3], chunkMax[d]);
+      }
+    });
+    auto iter = tlMinMax.begin();
+    std::copy_n(iter->data(), 3, min);
+    std::copy_n(iter->data() + 3, 3, max);
+    for (++iter; iter != tlMinMax.end(); ++iter)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        min[d] = std::min(min[d], (*iter)[d]);
+        max[d] = std::max(max[d], (*iter)[d + 3]);
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  void FillBuckets(const CellInfo* begin, const CellInfo* end, const double min[3],
+    const double iext[3], BucketsType& buckets) const
+  {
+    for (const CellInfo* pc = begin; pc != end; ++pc)
+    {
+      for (uint8_t d = 0; d < 3; ++d)
+      {
+        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
+        double dblIdx = (cen - min[d]) * iext[d];
+        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
+        size_t ind = static_cast<size_t>(dblIdx);
+
+        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
+      }
+    }
+  }
+
+  // -------------------------------------------------------------------------
+  // Split a node of the given nodes, adding its children to the split stack.
+  // When parallel is true, the cells of the node are binned in parallel.
+  void Split(std::vector<TCellTreeNode>& nodes, std::stack<SplitInfo>& splitStack, T index,
+    double min[3], double max[3], BucketsType& buckets, bool parallel)
+  {
+    const T start = nodes[index].Start();
+    const T size = nodes[index].Size();
 
     if (size < this->NumberOfNodesPerLeaf)
     {
@@ -457,18 +539,21 @@ private:
 
     buckets.Reset();
 
-    for (const CellInfo* pc = begin; pc != end; ++pc)
+    if (parallel)
     {
-      for (uint8_t d = 0; d < 3; ++d)
+      vtkSMPThreadLocal<BucketsType> tlBuckets(BucketsType(this->NumberOfBuckets));
+      vtkSMPTools::For(0, end - begin, [&](vtkIdType first, vtkIdType last) {
+        this->FillBuckets(begin + first, begin + last, min, iext, tlBuckets.Local());
+      });
+      for (const BucketsType& threadBuckets : tlBuckets)
       {
-        double cen = (pc->Min[d] + pc->Max[d]) / 2.0;
-        double dblIdx = (cen - min[d]) * iext[d];
-        dblIdx = vtkMath::ClampValue(dblIdx, 0.0, static_cast<double>(this->NumberOfBuckets - 1));
-        size_t ind = static_cast<size_t>(dblIdx);
-
-        buckets[d][ind].Add(pc->Min[d], pc->Max[d]);
+        buckets.Merge(threadBuckets);
       }
     }
+    else
+    {
+      this->FillBuckets(begin, end, min, iext, buckets);
+    }
 
     double cost = VTK_DOUBLE_MAX;
     double plane = VTK_DOUBLE_MIN; // bad value in case it doesn't get setx
@@ -537,8 +622,8 @@ private:
 
     double lMin[3], lMax[3], rMin[3], rMax[3];
 
-    this->FindMinMax(begin, mid, lMin, lMax);
-    this->FindMinMax(mid, end, rMin, rMax);
+    this->FindMinMax(begin, mid, lMin, lMax, parallel);
+    this->FindMinMax(mid, end, rMin, rMax, parallel);
 
     double clip[2] = { lMax[dim], rMin[dim] };
 
@@ -546,11 +631,11 @@ private:
     child[0].MakeLeaf(begin - this->CellsInfo.data(), mid - begin);
     child[1].MakeLeaf(mid - this->CellsInfo.data(), end - mid);
 
-    this->Nodes[index].MakeNode(static_cast<T>(this->Nodes.size()), dim, clip);
-    this->Nodes.insert(this->Nodes.end(), child, child + 2);
+    nodes[index].MakeNode(static_cast<T>(nodes.size()), dim, clip);
+    nodes.insert(nodes.end(), child, child + 2);
 
-    this->SplitStack.emplace(this->Nodes[index].GetRightChildIndex(), rMin, rMax);
-    this->SplitStack.emplace(this->Nodes[index].GetLeftChildIndex(), lMin, lMax);
+    splitStack.emplace(nodes[index].GetRightChildIndex(), rMin, rMax);
+    splitStack.emplace(nodes[index].GetLeftChildIndex(), lMin, lMax);
   }
 
 public:
@@ -564,36 +649,33 @@ public:
   {
     const auto numberOfCells = static_cast<T>(this->DataSet->GetNumberOfCells());
     this->CellsInfo.resize(static_cast<size_t>(numberOfCells));
-
-    double min[3] = { VTK_DOUBLE_MAX, VTK_DOUBLE_MAX, VTK_DOUBLE_MAX };
-    double max[3] = {
-      -VTK_DOUBLE_MAX,
-      -VTK_DOUBLE_MAX,
-      -VTK_DOUBLE_MAX,
-    };
+    this->SubtreeSize = std::max(static_cast<T>(4096),
+      static_cast<T>(numberOfCells / (4 * vtkSMPTools::GetEstimatedNumberOfThreads())));
 
     double cellBounds[6], *cellBoundsPtr;
     cellBoundsPtr = cellBounds;
-    for (T i = 0; i < numberOfCells; ++i)
+    if (!this->Locator->CacheCellBounds)
     {
-      this->CellsInfo[i].Ind = i;
-      this->Locator->GetCellBounds(i, cellBoundsPtr);
-
-      for (uint8_t d = 0; d < 3; ++d)
+      // Initialize the data set so that GetCellBounds() is thread safe
+      this->Locator->GetCellBounds(0, cellBoundsPtr);
+    }
+    vtkSMPTools::For(0, numberOfCells, [&](T first, T last) {
+      double bounds[6], *boundsPtr = bounds;
+      for (T i = first; i < last; ++i)
       {
-        this->CellsInfo[i].Min[d] = cellBoundsPtr[2 * d + 0];
-        this->CellsInfo[i].Max[d] = cellBoundsPtr[2 * d + 1];
-
-        if (this->CellsInfo[i].Min[d] < min[d])
+        this->CellsInfo[i].Ind = i;
+        this->Locator->GetCellBounds(i, boundsPtr);
+        for (uint8_t d = 0; d < 3; ++d)
         {
-          min[d] = this->CellsInfo[i].Min[d];
-        }
-        if (this->CellsInfo[i].Max[d] > max[d])
-        {
-          max[d] = this->CellsInfo[i].Max[d];
+          this->CellsInfo[i].Min[d] = boundsPtr[2 * d + 0];
+          this->CellsInfo[i].Max[d] = boundsPtr[2 * d + 1];
         }
       }
-    }
+    });
+
+    double min[3], max[3];
+    this->FindMinMax(this->CellsInfo.data(), this->CellsInfo.data() + numberOfCells, min, max,
+      numberOfCells >= this->SubtreeSize);
 
     this->Tree.DataBBox[0] = min[0];
     this->Tree.DataBBox[1] = max[0];
@@ -617,12 +699,61 @@ public:
 
   void operator()()
   {
+    // Split the large nodes one at a time, binning their cells in parallel,
+    // and collect the smaller nodes as the roots of independent subtrees.
     auto& buckets = this->Buckets;
+    std::vector<SplitInfo> subtrees;
     while (!this->SplitStack.empty())
     {
       auto splitInfo = std::move(this->SplitStack.top());
       this->SplitStack.pop();
-      this->Split(splitInfo.Index, splitInfo.Min, splitInfo.Max, buckets);
+      if (this->Nodes[splitInfo.Index].Size() < this->SubtreeSize)
+      {
+        subtrees.push_back(splitInfo);
+        continue;
+      }
+      this->Split(this->Nodes, this->SplitStack, splitInfo.Index, splitInfo.Min, splitInfo.Max,
+        buckets, true);
+    }
+
+    // Build the subtrees in parallel. They split disjoint ranges of cells, and
+    // their nodes are indexed from their root.
+    std::vector<std::vector<TCellTreeNode>> subtreeNodes(subtrees.size());
+    vtkSMPThreadLocal<BucketsType> tlBuckets(BucketsType(this->NumberOfBuckets));
+    const auto numberOfSubtrees = static_cast<vtkIdType>(subtrees.size());
+    vtkSMPTools::For(0, numberOfSubtrees, [&](vtkIdType first, vtkIdType last) {
+      auto& threadBuckets = tlBuckets.Local();
+      std::stack<SplitInfo> splitStack;
+      for (vtkIdType subtree = first; subtree < last; ++subtree)
+      {
+        auto& nodes = subtreeNodes[subtree];
+        nodes.push_back(this->Nodes[subtrees[subtree].Index]);
+        splitStack.emplace(0, subtrees[subtree].Min, subtrees[subtree].Max);
+        while (!splitStack.empty())
+        {
+          auto splitInfo = std::move(splitStack.top());
+          splitStack.pop();
+          this->Split(
+            nodes, splitStack, splitInfo.Index, splitInfo.Min, splitInfo.Max, threadBuckets, false);
+        }
+      }
+    });
+
+    // Append the nodes of the subtrees, but their roots which replace the
+    // nodes they were built from.
+    for (size_t subtree = 0; subtree < subtrees.size(); ++subtree)
+    {
+      auto& nodes = subtreeNodes[subtree];
+      const T offset = static_cast<T>(this->Nodes.size()) - 1;
+      for (auto& node : nodes)
+      {
+        if (node.IsNode())
+        {
+          node.SetChildren(node.GetLeftChildIndex() + offset);
+        }
+      }
+      this->Nodes[subtrees[subtree].Index] = nodes[0];
+      this->Nodes.insert(this->Nodes.end(), nodes.begin() + 1, nodes.end());
     }
   }
 
@@ -644,12 +775,14 @@ public:
       ni->SetChildren(nn - this->Tree.Nodes.begin() - 2);
     }
 
-    const auto numberOfCells = static_cast<size_t>(this->DataSet->GetNumberOfCells());
-    this->Tree.Leaves.resize(numberOfCells);
-    for (size_t i = 0; i < numberOfCells; ++i)
-    {
-      this->Tree.Leaves[i] = this->CellsInfo[i].Ind;
-    }
+    const auto numberOfCells = static_cast<vtkIdType>(this->DataSet->GetNumberOfCells());
+    this->Tree.Leaves.resize(static_cast<size_t>(numberOfCells));
+    vtkSMPTools::For(0, numberOfCells, [&](vtkIdType first, vtkIdType last) {
+      for (vtkIdType i = first; i < last; ++i)
+      {
+        this->Tree.Leaves[i] = this->CellsInfo[i].Ind;
+      }
+    });
     this->CellsInfo.clear();
   }
 };
@@ -1318,7 +1451,7 @@ void vtkCellTreeLocator::BuildLocatorInternal()
 {
   using namespace detail;
   vtkIdType numCells;
-  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells() < 1))
+  if (!this->DataSet || (numCells = this->DataSet->GetNumberOfCells()) < 1)
   {
     vtkErrorMacro(<< " No Cells in the data set\n");
     return;
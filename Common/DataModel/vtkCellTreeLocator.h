@@ -13,6 +13,11 @@
  * Some methods in building and traversing the cell tree in this class were derived
  * from avtCellLocatorBIH class in the VisIT Visualization Tool.
  *
+ * The tree is built in parallel using vtkSMPTools: the nodes of many cells
+ * are split one at a time, their cells being binned in parallel, then the
+ * subtrees of the smaller nodes are built concurrently. The resulting tree
+ * does not depend on the number of threads.
+ *
  * vtkCellTreeLocator utilizes the following parent class parameters:
  * - NumberOfCellsPerNode        (default 8)
  * - CacheCellBounds             (default true)
@@ -139,6 +144,11 @@ public:
     this->Superclass::FindCellsAlongLine(p1, p2, tolerance, cellsIds);
   }
 
+  /**
+   * Return true: FindCell() is thread safe.
+   */
+  bool SupportsThreadSafeFindCell() override { return true; }
+
   /**
    * Find the cell containing a given point. returns -1 if no cell found
    * the cell parameters are copied into the supplied variables, a cell must
@@ -0,0 +1,846 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkConcurrentPointLocator.h"
+
+#include "vtkBoundingBox.h"
+#include "vtkCellArray.h"
+#include "vtkDataSet.h"
+#include "vtkIdList.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkConcurrentPointLocator);
+
+namespace
+{
+//------------------------------------------------------------------------------
+// An inserted point, stored in its bucket.
+struct PointEntry
+{
+  double X[3];
+  vtkIdType Id;
+  vtkIdType Key;
+};
+
+using Bucket = std::vector<PointEntry>;
+
+// A part of the hash table of the buckets, and the mutex protecting it.
+struct Shard
+{
+  std::mutex Mutex;
+  std::unordered_map<vtkIdType, Bucket> Buckets;
+};
+
+// The squared distance and id of a point found by a query. Equidistant points
+// are ordered by id.
+using Candidate = std::pair<double, vtkIdType>;
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+struct vtkConcurrentPointLocator::vtkInternals
+{
+  std::unique_ptr<Shard[]> Shards;
+  vtkIdType NumberOfShards = 0;
+  std::atomic<vtkIdType> NumberOfEntries{ 0 };
+
+  // Copies of the geometry of the buckets
+  double Origin[3] = { 0.0, 0.0, 0.0 };
+  double H[3] = { 1.0, 1.0, 1.0 };
+  int Divisions[3] = { 1, 1, 1 };
+  double Tolerance2 = 0.0;
+
+  // Protects the vtkPoints receiving the inserted points and NextId
+  std::mutex PointsMutex;
+  vtkIdType NextId = 0;
+
+  //----------------------------------------------------------------------------
+  void GetBucketIndices(const double x[3], int ijk[3]) const
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      const double t = std::floor((x[i] - this->Origin[i]) / this->H[i]);
+      ijk[i] = t < 0.0 ? 0
+                       : (t >= this->Divisions[i] ? this->Divisions[i] - 1 : static_cast<int>(t));
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  vtkIdType GetBucketId(int i, int j, int k) const
+  {
+    return i +
+      static_cast<vtkIdType>(this->Divisions[0]) *
+      (j + static_cast<vtkIdType>(k) * this->Divisions[1]);
+  }
+
+  //----------------------------------------------------------------------------
+  vtkIdType GetShardIndex(vtkIdType bucketId) const
+  {
+    const std::uint64_t hash = static_cast<std::uint64_t>(bucketId) * 0x9E3779B97F4A7C15ull;
+    return static_cast<vtkIdType>((hash >> 32) % static_cast<std::uint64_t>(this->NumberOfShards));
+  }
+
+  //----------------------------------------------------------------------------
+  // Add an entry to a bucket, without checking for duplicates.
+  void AddEntry(vtkIdType bucketId, const PointEntry& entry)
+  {
+    Shard& shard = this->Shards[this->GetShardIndex(bucketId)];
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    shard.Buckets[bucketId].push_back(entry);
+    ++this->NumberOfEntries;
+  }
+
+  //----------------------------------------------------------------------------
+  // Give an id to a new point and store it in points.
+  vtkIdType AddPoint(vtkPoints* points, const double x[3])
+  {
+    std::lock_guard<std::mutex> lock(this->PointsMutex);
+    const vtkIdType ptId = this->NextId++;
+    if (points)
+    {
+      points->InsertPoint(ptId, x);
+    }
+    return ptId;
+  }
+
+  //----------------------------------------------------------------------------
+  // Call functor(entry) for each point of a bucket.
+  template <class FunctorT>
+  void VisitBucket(vtkIdType bucketId, FunctorT&& functor)
+  {
+    Shard& shard = this->Shards[this->GetShardIndex(bucketId)];
+    std::lock_guard<std::mutex> lock(shard.Mutex);
+    auto it = shard.Buckets.find(bucketId);
+    if (it != shard.Buckets.end())
+    {
+      for (const PointEntry& entry : it->second)
+      {
+        functor(entry);
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Call functor(entry) for each point of the buckets at Chebyshev distance
+  // r from the bucket ijk.
+  template <class FunctorT>
+  void VisitShell(const int ijk[3], int r, FunctorT&& functor)
+  {
+    int minIjk[3], maxIjk[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      minIjk[i] = std::max(0, ijk[i] - r);
+      maxIjk[i] = std::min(this->Divisions[i] - 1, ijk[i] + r);
+    }
+    for (int k = minIjk[2]; k <= maxIjk[2]; ++k)
+    {
+      const bool kOnShell = std::abs(k - ijk[2]) == r;
+      for (int j = minIjk[1]; j <= maxIjk[1]; ++j)
+      {
+        if (kOnShell || std::abs(j - ijk[1]) == r)
+        {
+          for (int i = minIjk[0]; i <= maxIjk[0]; ++i)
+          {
+            this->VisitBucket(this->GetBucketId(i, j, k), functor);
+          }
+        }
+        else
+        {
+          // Only the two ends of the row are on the shell
+          if (ijk[0] - r >= 0)
+          {
+            this->VisitBucket(this->GetBucketId(ijk[0] - r, j, k), functor);
+          }
+          if (r > 0 && ijk[0] + r < this->Divisions[0])
+          {
+            this->VisitBucket(this->GetBucketId(ijk[0] + r, j, k), functor);
+          }
+        }
+      }
+    }
+  }
+
+  //----------------------------------------------------------------------------
+  // Lower bound of the distance from x to the points of the buckets farther
+  // than r from ijk, or infinity if there are none.
+  double GetShellDistance(const double x[3], const int ijk[3], int r) const
+  {
+    double distance = std::numeric_limits<double>::infinity();
+    for (int i = 0; i < 3; ++i)
+    {
+      // Slightly reduced, since the bucket of a point on a bucket boundary
+      // depends on rounding
+      const double margin = 1e-9 * this->H[i];
+      if (ijk[i] + r + 1 < this->Divisions[i])
+      {
+        distance =
+          std::min(distance, this->Origin[i] + (ijk[i] + r + 1) * this->H[i] - x[i] - margin);
+      }
+      if (ijk[i] - r - 1 >= 0)
+      {
+        distance =
+          std::min(distance, x[i] - (this->Origin[i] + (ijk[i] - r) * this->H[i]) - margin);
+      }
+    }
+    return std::max(distance, 0.0);
+  }
+
+  //----------------------------------------------------------------------------
+  // Visit the buckets shell by shell around x, calling visit(entry) for their
+  // points, until stop(distance) returns true, distance being a lower bound of
+  // the distance to the points not visited yet.
+  template <class VisitT, class StopT>
+  void SearchShells(const double x[3], VisitT&& visit, StopT&& stop)
+  {
+    int ijk[3];
+    this->GetBucketIndices(x, ijk);
+    int maxR = 0;
+    for (int i = 0; i < 3; ++i)
+    {
+      maxR = std::max(maxR, std::max(ijk[i], this->Divisions[i] - 1 - ijk[i]));
+    }
+    for (int r = 0; r <= maxR; ++r)
+    {
+      this->VisitShell(ijk, r, visit);
+      if (stop(this->GetShellDistance(x, ijk, r)))
+      {
+        break;
+      }
+    }
+  }
+};
+
+//------------------------------------------------------------------------------
+vtkConcurrentPointLocator::vtkConcurrentPointLocator()
+  : Internals(new vtkInternals)
+{
+  this->Divisions[0] = this->Divisions[1] = this->Divisions[2] = 50;
+  this->NumberOfPointsPerBucket = 3;
+  this->H[0] = this->H[1] = this->H[2] = 0.0;
+  this->Points = nullptr;
+}
+
+//------------------------------------------------------------------------------
+vtkConcurrentPointLocator::~vtkConcurrentPointLocator()
+{
+  if (this->Points)
+  {
+    this->Points->UnRegister(this);
+    this->Points = nullptr;
+  }
+  this->FreeSearchStructure();
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::FreeSearchStructure()
+{
+  this->Internals->Shards.reset();
+  this->Internals->NumberOfShards = 0;
+  this->Internals->NumberOfEntries = 0;
+  this->Internals->NextId = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::ConfigureBuckets(const double bounds[6], vtkIdType estSize)
+{
+  int ndivs[3];
+  vtkBoundingBox bbox(bounds);
+  if (this->Automatic && estSize > 0)
+  {
+    vtkIdType numBuckets = static_cast<vtkIdType>(
+      static_cast<double>(estSize) / static_cast<double>(this->NumberOfPointsPerBucket));
+    bbox.ComputeDivisions(std::max<vtkIdType>(1, numBuckets), this->Bounds, ndivs);
+  }
+  else
+  {
+    bbox.Inflate(); // make sure non-zero volume
+    bbox.GetBounds(this->Bounds);
+    for (int i = 0; i < 3; i++)
+    {
+      ndivs[i] = (this->Divisions[i] < 1 ? 1 : this->Divisions[i]);
+    }
+  }
+
+  // The buckets must be at least as wide as the tolerance, so that the points
+  // to merge are in neighbor buckets
+  for (int i = 0; i < 3; i++)
+  {
+    const double width = this->Bounds[2 * i + 1] - this->Bounds[2 * i];
+    if (this->Tolerance > 0.0 && width / this->Tolerance < ndivs[i])
+    {
+      ndivs[i] = std::max(1, static_cast<int>(width / this->Tolerance));
+    }
+  }
+
+  this->Divisions[0] = ndivs[0];
+  this->Divisions[1] = ndivs[1];
+  this->Divisions[2] = ndivs[2];
+  this->NumberOfBuckets = static_cast<vtkIdType>(ndivs[0]) * static_cast<vtkIdType>(ndivs[1]) *
+    static_cast<vtkIdType>(ndivs[2]);
+
+  vtkInternals& internals = *this->Internals;
+  for (int i = 0; i < 3; i++)
+  {
+    this->H[i] = (this->Bounds[2 * i + 1] - this->Bounds[2 * i]) / ndivs[i];
+    internals.Origin[i] = this->Bounds[2 * i];
+    internals.H[i] = this->H[i];
+    internals.Divisions[i] = ndivs[i];
+  }
+  internals.Tolerance2 = this->Tolerance * this->Tolerance;
+
+  // A few shards per thread make waiting on a mutex unlikely
+  vtkIdType numberOfShards = 64;
+  while (numberOfShards < 16 * vtkSMPTools::GetEstimatedNumberOfThreads())
+  {
+    numberOfShards *= 2;
+  }
+  internals.Shards.reset(new Shard[numberOfShards]);
+  internals.NumberOfShards = numberOfShards;
+  internals.NumberOfEntries = 0;
+  internals.NextId = 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::BuildLocator()
+{
+  // don't rebuild if build time is newer than modified and dataset modified time
+  if (this->Internals->Shards && this->DataSet && this->BuildTime > this->MTime &&
+    this->BuildTime > this->DataSet->GetMTime())
+  {
+    return;
+  }
+  // don't rebuild if UseExistingSearchStructure is ON and a search structure already exists
+  if (this->Internals->Shards && this->UseExistingSearchStructure)
+  {
+    this->BuildTime.Modified();
+    vtkDebugMacro(<< "BuildLocator exited - UseExistingSearchStructure");
+    return;
+  }
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::ForceBuildLocator()
+{
+  this->BuildLocatorInternal();
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::BuildLocatorInternal()
+{
+  vtkIdType numPts;
+  if (!this->DataSet || (numPts = this->DataSet->GetNumberOfPoints()) < 1)
+  {
+    vtkErrorMacro(<< "No points to locate");
+    return;
+  }
+
+  this->FreeSearchStructure();
+  if (this->Points)
+  {
+    this->Points->UnRegister(this);
+    this->Points = nullptr;
+  }
+  this->ConfigureBuckets(this->DataSet->GetBounds(), numPts);
+
+  // The points of the data set keep their ids, so they are not merged
+  vtkDataSet* dataSet = this->DataSet;
+  vtkInternals& internals = *this->Internals;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    PointEntry entry;
+    int ijk[3];
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      dataSet->GetPoint(ptId, entry.X);
+      entry.Id = entry.Key = ptId;
+      internals.GetBucketIndices(entry.X, ijk);
+      internals.AddEntry(internals.GetBucketId(ijk[0], ijk[1], ijk[2]), entry);
+    }
+  });
+  internals.NextId = numPts;
+
+  this->BuildTime.Modified();
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentPointLocator::InitPointInsertion(vtkPoints* newPts, const double bounds[6])
+{
+  return this->InitPointInsertion(newPts, bounds, 0);
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentPointLocator::InitPointInsertion(
+  vtkPoints* newPts, const double bounds[6], vtkIdType estSize)
+{
+  this->FreeSearchStructure();
+  if (newPts == nullptr)
+  {
+    vtkErrorMacro(<< "Must define points for point insertion");
+    return 0;
+  }
+  if (this->Points != nullptr)
+  {
+    this->Points->UnRegister(this);
+  }
+  this->Points = newPts;
+  this->Points->Register(this);
+
+  this->ConfigureBuckets(bounds, estSize);
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentPointLocator::InsertUniquePoint(const double x[3], vtkIdType& ptId)
+{
+  return this->InsertUniquePointInternal(x, -1, ptId);
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentPointLocator::InsertUniquePoint(const double x[3], vtkIdType key, vtkIdType& ptId)
+{
+  if (key < 0)
+  {
+    vtkErrorMacro(<< "The key of a point must be non-negative.");
+    ptId = -1;
+    return 0;
+  }
+  return this->InsertUniquePointInternal(x, key, ptId);
+}
+
+//------------------------------------------------------------------------------
+int vtkConcurrentPointLocator::InsertUniquePointInternal(
+  const double x[3], vtkIdType key, vtkIdType& ptId)
+{
+  vtkInternals& internals = *this->Internals;
+  int ijk[3];
+  internals.GetBucketIndices(x, ijk);
+  const vtkIdType bucketId = internals.GetBucketId(ijk[0], ijk[1], ijk[2]);
+
+  // Lock the shards of the buckets where x may have been inserted, in
+  // increasing order to avoid deadlocks. The shard of bucketId comes first.
+  vtkIdType bucketIds[27];
+  int numberOfBuckets = 0;
+  bucketIds[numberOfBuckets++] = bucketId;
+  if (this->Tolerance > 0.0)
+  {
+    for (int k = std::max(0, ijk[2] - 1); k <= std::min(internals.Divisions[2] - 1, ijk[2] + 1);
+         ++k)
+    {
+      for (int j = std::max(0, ijk[1] - 1); j <= std::min(internals.Divisions[1] - 1, ijk[1] + 1);
+           ++j)
+      {
+        for (int i = std::max(0, ijk[0] - 1);
+             i <= std::min(internals.Divisions[0] - 1, ijk[0] + 1); ++i)
+        {
+          const vtkIdType neighborId = internals.GetBucketId(i, j, k);
+          if (neighborId != bucketId)
+          {
+            bucketIds[numberOfBuckets++] = neighborId;
+          }
+        }
+      }
+    }
+  }
+  vtkIdType shardIndices[27];
+  for (int b = 0; b < numberOfBuckets; ++b)
+  {
+    shardIndices[b] = internals.GetShardIndex(bucketIds[b]);
+  }
+  std::sort(shardIndices, shardIndices + numberOfBuckets);
+  const int numberOfShards =
+    static_cast<int>(std::unique(shardIndices, shardIndices + numberOfBuckets) - shardIndices);
+  for (int s = 0; s < numberOfShards; ++s)
+  {
+    internals.Shards[shardIndices[s]].Mutex.lock();
+  }
+
+  // Look for the point equal to x, or the closest one within the tolerance
+  PointEntry* found = nullptr;
+  if (this->Tolerance > 0.0)
+  {
+    Candidate closest(internals.Tolerance2, VTK_ID_MAX);
+    for (int b = 0; b < numberOfBuckets; ++b)
+    {
+      Shard& shard = internals.Shards[internals.GetShardIndex(bucketIds[b])];
+      auto it = shard.Buckets.find(bucketIds[b]);
+      if (it == shard.Buckets.end())
+      {
+        continue;
+      }
+      for (PointEntry& entry : it->second)
+      {
+        const Candidate candidate(vtkMath::Distance2BetweenPoints(x, entry.X), entry.Id);
+        if (candidate <= closest)
+        {
+          closest = candidate;
+          found = &entry;
+        }
+      }
+    }
+  }
+  else
+  {
+    Shard& shard = internals.Shards[internals.GetShardIndex(bucketId)];
+    auto it = shard.Buckets.find(bucketId);
+    if (it != shard.Buckets.end())
+    {
+      for (PointEntry& entry : it->second)
+      {
+        if (entry.X[0] == x[0] && entry.X[1] == x[1] && entry.X[2] == x[2])
+        {
+          found = &entry;
+          break;
+        }
+      }
+    }
+  }
+
+  int inserted = 0;
+  if (found)
+  {
+    ptId = found->Id;
+    if (key >= 0 && key < found->Key)
+    {
+      found->Key = key;
+    }
+  }
+  else
+  {
+    ptId = internals.AddPoint(this->Points, x);
+    PointEntry entry{ { x[0], x[1], x[2] }, ptId, key >= 0 ? key : ptId };
+    internals.Shards[internals.GetShardIndex(bucketId)].Buckets[bucketId].push_back(entry);
+    ++internals.NumberOfEntries;
+    inserted = 1;
+  }
+
+  for (int s = numberOfShards - 1; s >= 0; --s)
+  {
+    internals.Shards[shardIndices[s]].Mutex.unlock();
+  }
+  return inserted;
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::InsertPoint(vtkIdType ptId, const double x[3])
+{
+  vtkInternals& internals = *this->Internals;
+  int ijk[3];
+  internals.GetBucketIndices(x, ijk);
+  internals.AddEntry(
+    internals.GetBucketId(ijk[0], ijk[1], ijk[2]), PointEntry{ { x[0], x[1], x[2] }, ptId, ptId });
+
+  std::lock_guard<std::mutex> lock(internals.PointsMutex);
+  internals.NextId = std::max(internals.NextId, ptId + 1);
+  if (this->Points)
+  {
+    this->Points->InsertPoint(ptId, x);
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentPointLocator::InsertNextPoint(const double x[3])
+{
+  vtkInternals& internals = *this->Internals;
+  const vtkIdType ptId = internals.AddPoint(this->Points, x);
+  int ijk[3];
+  internals.GetBucketIndices(x, ijk);
+  internals.AddEntry(
+    internals.GetBucketId(ijk[0], ijk[1], ijk[2]), PointEntry{ { x[0], x[1], x[2] }, ptId, ptId });
+  return ptId;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentPointLocator::IsInsertedPoint(double x, double y, double z)
+{
+  const double xyz[3] = { x, y, z };
+  return this->IsInsertedPoint(xyz);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentPointLocator::IsInsertedPoint(const double x[3])
+{
+  vtkInternals& internals = *this->Internals;
+  if (!internals.Shards)
+  {
+    return -1;
+  }
+  if (this->Tolerance > 0.0)
+  {
+    double dist2;
+    return this->FindClosestPointWithinRadius(this->Tolerance, x, dist2);
+  }
+
+  int ijk[3];
+  internals.GetBucketIndices(x, ijk);
+  vtkIdType ptId = -1;
+  internals.VisitBucket(internals.GetBucketId(ijk[0], ijk[1], ijk[2]), [&](const PointEntry& e) {
+    if (ptId < 0 && e.X[0] == x[0] && e.X[1] == x[1] && e.X[2] == x[2])
+    {
+      ptId = e.Id;
+    }
+  });
+  return ptId;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentPointLocator::FindClosestInsertedPoint(const double x[3])
+{
+  vtkInternals& internals = *this->Internals;
+  if (!internals.Shards || internals.NumberOfEntries == 0)
+  {
+    return -1;
+  }
+  Candidate closest(std::numeric_limits<double>::infinity(), -1);
+  internals.SearchShells(
+    x,
+    [&](const PointEntry& entry) {
+      closest = std::min(closest, Candidate(vtkMath::Distance2BetweenPoints(x, entry.X), entry.Id));
+    },
+    [&](double distance) { return closest.second >= 0 && closest.first <= distance * distance; });
+  return closest.second;
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::RenumberInsertedPoints(vtkIdList* newIds)
+{
+  vtkInternals& internals = *this->Internals;
+  std::vector<PointEntry*> entries;
+  entries.reserve(internals.NumberOfEntries);
+  for (vtkIdType s = 0; s < internals.NumberOfShards; ++s)
+  {
+    for (auto& bucket : internals.Shards[s].Buckets)
+    {
+      for (PointEntry& entry : bucket.second)
+      {
+        entries.push_back(&entry);
+      }
+    }
+  }
+  vtkSMPTools::Sort(entries.begin(), entries.end(), [](const PointEntry* a, const PointEntry* b) {
+    if (a->Key != b->Key)
+    {
+      return a->Key < b->Key;
+    }
+    return std::lexicographical_compare(a->X, a->X + 3, b->X, b->X + 3) ||
+      (std::equal(a->X, a->X + 3, b->X) && a->Id < b->Id);
+  });
+
+  const vtkIdType numberOfPoints = static_cast<vtkIdType>(entries.size());
+  if (newIds)
+  {
+    newIds->SetNumberOfIds(internals.NextId);
+    vtkSMPTools::Fill(newIds->begin(), newIds->end(), -1);
+  }
+  if (this->Points)
+  {
+    this->Points->SetNumberOfPoints(numberOfPoints);
+  }
+  vtkPoints* points = this->Points;
+  vtkSMPTools::For(0, numberOfPoints, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      PointEntry* entry = entries[ptId];
+      if (newIds)
+      {
+        newIds->SetId(entry->Id, ptId);
+      }
+      if (points)
+      {
+        points->SetPoint(ptId, entry->X);
+      }
+      entry->Id = ptId;
+    }
+  });
+  internals.NextId = numberOfPoints;
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentPointLocator::FindClosestPoint(const double x[3])
+{
+  if (this->DataSet)
+  {
+    this->BuildLocator(); // will subdivide if modified; otherwise returns
+  }
+  return this->FindClosestInsertedPoint(x);
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkConcurrentPointLocator::FindClosestPointWithinRadius(
+  double radius, const double x[3], double& dist2)
+{
+  if (this->DataSet)
+  {
+    this->BuildLocator(); // will subdivide if modified; otherwise returns
+  }
+  vtkInternals& internals = *this->Internals;
+  dist2 = -1.0;
+  if (!internals.Shards || internals.NumberOfEntries == 0)
+  {
+    return -1;
+  }
+  const double radius2 = radius * radius;
+  Candidate closest(std::numeric_limits<double>::infinity(), -1);
+  internals.SearchShells(
+    x,
+    [&](const PointEntry& entry) {
+      const Candidate candidate(vtkMath::Distance2BetweenPoints(x, entry.X), entry.Id);
+      if (candidate.first <= radius2)
+      {
+        closest = std::min(closest, candidate);
+      }
+    },
+    [&](double distance) {
+      return distance > radius || (closest.second >= 0 && closest.first <= distance * distance);
+    });
+  if (closest.second >= 0)
+  {
+    dist2 = closest.first;
+  }
+  return closest.second;
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::FindClosestNPoints(int N, const double x[3], vtkIdList* result)
+{
+  if (this->DataSet)
+  {
+    this->BuildLocator(); // will subdivide if modified; otherwise returns
+  }
+  result->Reset();
+  vtkInternals& internals = *this->Internals;
+  if (N < 1 || !internals.Shards || internals.NumberOfEntries == 0)
+  {
+    return;
+  }
+  const std::size_t n = static_cast<std::size_t>(N);
+  std::vector<Candidate> candidates;
+  internals.SearchShells(
+    x,
+    [&](const PointEntry& entry) {
+      candidates.emplace_back(vtkMath::Distance2BetweenPoints(x, entry.X), entry.Id);
+    },
+    [&](double distance) {
+      if (candidates.size() < n)
+      {
+        return false;
+      }
+      std::nth_element(candidates.begin(), candidates.begin() + (n - 1), candidates.end());
+      return candidates[n - 1].first <= distance * distance;
+    });
+  const std::size_t numberOfIds = std::min(n, candidates.size());
+  std::partial_sort(candidates.begin(), candidates.begin() + numberOfIds, candidates.end());
+  result->SetNumberOfIds(static_cast<vtkIdType>(numberOfIds));
+  for (std::size_t i = 0; i < numberOfIds; ++i)
+  {
+    result->SetId(static_cast<vtkIdType>(i), candidates[i].second);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::FindPointsWithinRadius(
+  double R, const double x[3], vtkIdList* result)
+{
+  if (this->DataSet)
+  {
+    this->BuildLocator(); // will subdivide if modified; otherwise returns
+  }
+  result->Reset();
+  vtkInternals& internals = *this->Internals;
+  if (!internals.Shards || internals.NumberOfEntries == 0)
+  {
+    return;
+  }
+  const double R2 = R * R;
+  const double minX[3] = { x[0] - R, x[1] - R, x[2] - R };
+  const double maxX[3] = { x[0] + R, x[1] + R, x[2] + R };
+  int minIjk[3], maxIjk[3];
+  internals.GetBucketIndices(minX, minIjk);
+  internals.GetBucketIndices(maxX, maxIjk);
+  for (int k = minIjk[2]; k <= maxIjk[2]; ++k)
+  {
+    for (int j = minIjk[1]; j <= maxIjk[1]; ++j)
+    {
+      for (int i = minIjk[0]; i <= maxIjk[0]; ++i)
+      {
+        internals.VisitBucket(internals.GetBucketId(i, j, k), [&](const PointEntry& entry) {
+          if (vtkMath::Distance2BetweenPoints(x, entry.X) <= R2)
+          {
+            result->InsertNextId(entry.Id);
+          }
+        });
+      }
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+// Generate the faces of the non-empty buckets.
+void vtkConcurrentPointLocator::GenerateRepresentation(int vtkNotUsed(level), vtkPolyData* pd)
+{
+  vtkInternals& internals = *this->Internals;
+  vtkNew<vtkPoints> pts;
+  vtkNew<vtkCellArray> polys;
+  const vtkIdType sliceSize = static_cast<vtkIdType>(this->Divisions[0]) * this->Divisions[1];
+  for (vtkIdType s = 0; s < internals.NumberOfShards; ++s)
+  {
+    for (const auto& bucket : internals.Shards[s].Buckets)
+    {
+      if (bucket.second.empty())
+      {
+        continue;
+      }
+      const vtkIdType bucketId = bucket.first;
+      const int ijk[3] = { static_cast<int>(bucketId % this->Divisions[0]),
+        static_cast<int>((bucketId / this->Divisions[0]) % this->Divisions[1]),
+        static_cast<int>(bucketId / sliceSize) };
+      const vtkIdType offset = pts->GetNumberOfPoints();
+      for (int corner = 0; corner < 8; ++corner)
+      {
+        double x[3];
+        for (int i = 0; i < 3; ++i)
+        {
+          x[i] = this->Bounds[2 * i] + (ijk[i] + ((corner >> i) & 1)) * this->H[i];
+        }
+        pts->InsertNextPoint(x);
+      }
+      static const vtkIdType faces[6][4] = { { 0, 2, 6, 4 }, { 1, 5, 7, 3 }, { 0, 4, 5, 1 },
+        { 2, 3, 7, 6 }, { 0, 1, 3, 2 }, { 4, 6, 7, 5 } };
+      for (const auto& face : faces)
+      {
+        const vtkIdType ids[4] = { offset + face[0], offset + face[1], offset + face[2],
+          offset + face[3] };
+        polys->InsertNextCell(4, ids);
+      }
+    }
+  }
+  pd->SetPoints(pts);
+  pd->SetPolys(polys);
+}
+
+//------------------------------------------------------------------------------
+void vtkConcurrentPointLocator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Number of Points Per Bucket: " << this->NumberOfPointsPerBucket << "\n";
+  os << indent << "Divisions: (" << this->Divisions[0] << ", " << this->Divisions[1] << ", "
+     << this->Divisions[2] << ")\n";
+  os << indent << "H: (" << this->H[0] << ", " << this->H[1] << ", " << this->H[2] << ")\n";
+  os << indent << "Points: " << this->Points << "\n";
+  os << indent << "Number Of Shards: " << this->Internals->NumberOfShards << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,209 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkConcurrentPointLocator
+ * @brief   merge points inserted concurrently from several threads
+ *
+ * vtkConcurrentPointLocator is an incremental point locator whose insertion
+ * methods can be called simultaneously from several threads, e.g. from the
+ * functors of vtkSMPTools::For(). Like vtkPointLocator, it divides a region of
+ * space into a regular array of cuboid buckets. The buckets are stored in a
+ * hash table split in shards, each shard being protected by its own mutex, so
+ * that the threads inserting points in different regions of space rarely wait
+ * on each other. Only the insertion of a new point in the vtkPoints given to
+ * InitPointInsertion() is serialized.
+ *
+ * InsertUniquePoint() merges the points that are exactly equal when the
+ * Tolerance is 0, like vtkMergePoints, and the points closer than the
+ * Tolerance otherwise, like vtkPointLocator.
+ *
+ * When points are inserted concurrently, the ids they receive depend on the
+ * scheduling of the threads. InsertUniquePoint() accepts a key, for instance
+ * the id of the input edge or cell a point is generated from, and
+ * RenumberInsertedPoints() renumbers the points by increasing key, the key of
+ * a point being the smallest key it was inserted with. With exact merging and
+ * keys that do not depend on the scheduling, the resulting ids and points are
+ * deterministic; they are the ones a sequential vtkMergePoints gives when the
+ * keys are the insertion order.
+ *
+ * The locator can also be built from the points of a data set with
+ * BuildLocator(), the points being inserted in parallel, and then be queried
+ * like the other point locators.
+ *
+ * @warning
+ * The insertion and query methods are thread safe once InitPointInsertion()
+ * or BuildLocator() has been called. InitPointInsertion(), BuildLocator(),
+ * RenumberInsertedPoints(), FreeSearchStructure() and the setters are not.
+ * The vtkPoints given to InitPointInsertion() must not be read while points
+ * are being inserted concurrently, since it may be reallocated.
+ *
+ * @warning
+ * With a non-zero Tolerance, which points are merged together may depend on
+ * the insertion order, when clusters of points are wider than the Tolerance.
+ *
+ * @sa
+ * vtkMergePoints vtkPointLocator vtkIncrementalPointLocator vtkStaticPointLocator
+ */
+
+#ifndef vtkConcurrentPointLocator_h
+#define vtkConcurrentPointLocator_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkIncrementalPointLocator.h"
+
+#include <memory> // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkIdList;
+class vtkPoints;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkConcurrentPointLocator : public vtkIncrementalPointLocator
+{
+public:
+  /**
+   * Construct with automatic computation of divisions, averaging
+   * 3 points per bucket.
+   */
+  static vtkConcurrentPointLocator* New();
+
+  ///@{
+  /**
+   * Standard methods for type management and printing.
+   */
+  vtkTypeMacro(vtkConcurrentPointLocator, vtkIncrementalPointLocator);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  ///@{
+  /**
+   * Set the number of divisions in x-y-z directions, used when Automatic is
+   * off. With a non-zero Tolerance, the divisions are reduced so that the
+   * buckets are at least as wide as the Tolerance.
+   */
+  vtkSetVector3Macro(Divisions, int);
+  vtkGetVectorMacro(Divisions, int, 3);
+  ///@}
+
+  ///@{
+  /**
+   * Specify the average number of points in each bucket, used to compute the
+   * divisions when Automatic is on.
+   */
+  vtkSetClampMacro(NumberOfPointsPerBucket, int, 1, VTK_INT_MAX);
+  vtkGetMacro(NumberOfPointsPerBucket, int);
+  ///@}
+
+  ///@{
+  /**
+   * Initialize the point insertion process. newPts receives the inserted
+   * points, from id 0. bounds is the box the points are expected to lie in
+   * (points outside are still merged correctly, but less efficiently), and
+   * estSize the expected number of points.
+   */
+  int InitPointInsertion(vtkPoints* newPts, const double bounds[6]) override;
+  int InitPointInsertion(vtkPoints* newPts, const double bounds[6], vtkIdType estSize) override;
+  ///@}
+
+  /**
+   * Insert x unless a point equal to it (or within the Tolerance) has been
+   * inserted. Return 1 and the id of the new point in ptId if x is inserted,
+   * 0 and the id of the existing point otherwise. Thread safe.
+   */
+  int InsertUniquePoint(const double x[3], vtkIdType& ptId) override;
+
+  /**
+   * Same as InsertUniquePoint(x, ptId), key being used to order the points by
+   * RenumberInsertedPoints(). key must be non-negative. Thread safe.
+   */
+  int InsertUniquePoint(const double x[3], vtkIdType key, vtkIdType& ptId);
+
+  /**
+   * Insert x with the given id, without checking whether it has already been
+   * inserted. Thread safe, as long as the ids are distinct.
+   */
+  void InsertPoint(vtkIdType ptId, const double x[3]) override;
+
+  /**
+   * Insert x with a new id, without checking whether it has already been
+   * inserted. Return the id of x. Thread safe.
+   */
+  vtkIdType InsertNextPoint(const double x[3]) override;
+
+  ///@{
+  /**
+   * Return the id of the point equal to x (or the closest one within the
+   * Tolerance), or -1 if there is none. Thread safe.
+   */
+  vtkIdType IsInsertedPoint(double x, double y, double z) override;
+  vtkIdType IsInsertedPoint(const double x[3]) override;
+  ///@}
+
+  /**
+   * Return the id of the inserted point closest to x, or -1 if no point has
+   * been inserted. Thread safe.
+   */
+  vtkIdType FindClosestInsertedPoint(const double x[3]) override;
+
+  /**
+   * Renumber the inserted points by increasing key, then coordinates, and
+   * reorder the points of the vtkPoints given to InitPointInsertion()
+   * accordingly. newIds receives the new id of each id returned by the
+   * insertion methods, to update the connectivity and point data built with
+   * them. The key of the points inserted without a key is their initial id.
+   * Must be called once all the points are inserted.
+   */
+  void RenumberInsertedPoints(vtkIdList* newIds);
+
+  ///@{
+  /**
+   * Point queries, on the points of the data set once BuildLocator() has
+   * been called, or on the inserted points. Thread safe. Equidistant points
+   * are ordered by increasing id.
+   */
+  using vtkAbstractPointLocator::FindClosestNPoints;
+  using vtkAbstractPointLocator::FindClosestPoint;
+  using vtkAbstractPointLocator::FindPointsWithinRadius;
+  vtkIdType FindClosestPoint(const double x[3]) override;
+  vtkIdType FindClosestPointWithinRadius(double radius, const double x[3], double& dist2) override;
+  void FindClosestNPoints(int N, const double x[3], vtkIdList* result) override;
+  void FindPointsWithinRadius(double R, const double x[3], vtkIdList* result) override;
+  ///@}
+
+  ///@{
+  /**
+   * See vtkLocator interface documentation. BuildLocator() inserts the points
+   * of the data set with vtkSMPTools, keeping their ids.
+   */
+  void FreeSearchStructure() override;
+  void BuildLocator() override;
+  void ForceBuildLocator() override;
+  void GenerateRepresentation(int level, vtkPolyData* pd) override;
+  ///@}
+
+protected:
+  vtkConcurrentPointLocator();
+  ~vtkConcurrentPointLocator() override;
+
+  void BuildLocatorInternal() override;
+
+  // Compute the divisions and bucket widths for the given bounds
+  void ConfigureBuckets(const double bounds[6], vtkIdType estSize);
+
+  // Insert x unless already present; key < 0 stands for the id of the point
+  int InsertUniquePointInternal(const double x[3], vtkIdType key, vtkIdType& ptId);
+
+  int Divisions[3];
+  int NumberOfPointsPerBucket;
+  double H[3];
+  vtkPoints* Points;
+
+private:
+  vtkConcurrentPointLocator(const vtkConcurrentPointLocator&) = delete;
+  void operator=(const vtkConcurrentPointLocator&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
@@ -5,6 +5,9 @@
 #include "vtkArrayDispatch.h"
 #include "vtkArrayIteratorIncludes.h"
 #include "vtkDataArrayRange.h"
+#include "vtkIdList.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
@@ -12,6 +15,7 @@
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <memory>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -53,6 +57,53 @@ const char vtkDataSetAttributes::LongAttributeNames[vtkDataSetAttributes::NUM_AT
   "vtkDataSetAttributes::PROCESSIDS",
 };
 
+namespace
+{
+// Deferred interpolations are performed in batches of this many tuples, which
+// bounds the memory used by the records.
+constexpr vtkIdType DeferredInterpolationBatchSize = 65536;
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+struct vtkDataSetAttributes::vtkDeferredInterpolation
+{
+  vtkDataSetAttributes* Source = nullptr;
+  std::vector<vtkIdType> ToIds;
+  std::vector<vtkIdType> Offsets;
+  std::vector<vtkIdType> FromIds;
+  std::vector<double> Weights;
+
+  // Record the interpolation of a tuple, and perform the recorded
+  // interpolations when there are enough of them.
+  void Add(vtkDataSetAttributes* target, vtkIdType toId, vtkIdType numIds, const vtkIdType* ids,
+    const double* weights)
+  {
+    this->ToIds.push_back(toId);
+    this->FromIds.insert(this->FromIds.end(), ids, ids + numIds);
+    this->Weights.insert(this->Weights.end(), weights, weights + numIds);
+    this->Offsets.push_back(static_cast<vtkIdType>(this->FromIds.size()));
+    if (static_cast<vtkIdType>(this->ToIds.size()) >= DeferredInterpolationBatchSize)
+    {
+      this->Flush(target);
+    }
+  }
+
+  void Flush(vtkDataSetAttributes* target)
+  {
+    target->InterpolatePoints(this->Source, static_cast<vtkIdType>(this->ToIds.size()),
+      this->ToIds.data(), this->Offsets.data(), this->FromIds.data(), this->Weights.data());
+    this->Reset();
+  }
+
+  void Reset()
+  {
+    this->ToIds.clear();
+    this->Offsets.assign(1, 0);
+    this->FromIds.clear();
+    this->Weights.clear();
+  }
+};
+
 //------------------------------------------------------------------------------
 // Construct object with copying turned on for all data.
 vtkDataSetAttributes::vtkDataSetAttributes()
@@ -79,6 +130,7 @@ vtkDataSetAttributes::vtkDataSetAttributes()
   this->CopyAttributeFlags[INTERPOLATE][PROCESSIDS] = 0;
 
   this->TargetIndices = nullptr;
+  this->DeferredInterpolation = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -88,6 +140,7 @@ vtkDataSetAttributes::~vtkDataSetAttributes()
   this->Initialize();
   delete[] this->TargetIndices;
   this->TargetIndices = nullptr;
+  delete this->DeferredInterpolation;
 }
 
 //------------------------------------------------------------------------------
@@ -1109,12 +1162,133 @@ void vtkDataSetAttributes::InterpolateAllocate(
   this->InternalCopyAllocate(pd, INTERPOLATE, sze, ext, shallowCopyArrays);
 }
 
+namespace
+{
+// Batches of more tuples are split across threads, in ranges of this many tuples.
+constexpr vtkIdType InterpolationGrainSize = 16384;
+// The arrays are interpolated one after the other over blocks of this many
+// tuples, so that the ids and weights of a block stay in cache.
+constexpr vtkIdType InterpolationBlockSize = 1024;
+
+//==============================================================================
+// Typed interpolation of a range of the tuples of a batch, for a pair of arrays.
+struct InterpolateTuplesWorker
+{
+  template <typename FromArrayT, typename ToArrayT>
+  void operator()(FromArrayT* fromArray, ToArrayT* toArray, bool nearest, vtkIdType begin,
+    vtkIdType end, const vtkIdType* toIds, const vtkIdType* offsets, const vtkIdType* fromIds,
+    const double* weights)
+  {
+    using ValueType = vtk::GetAPIType<ToArrayT>;
+    const auto fromTuples = vtk::DataArrayTupleRange(fromArray);
+    auto toTuples = vtk::DataArrayTupleRange(toArray);
+    const int numComps = toTuples.GetTupleSize();
+
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      auto toTuple = toTuples[toIds ? toIds[i] : i];
+      const vtkIdType first = offsets[i];
+      const vtkIdType last = offsets[i + 1];
+      if (nearest && first < last)
+      {
+        // Copy the first tuple of largest weight
+        vtkIdType maxId = fromIds[first];
+        double maxWeight = 0.0;
+        for (vtkIdType j = first; j < last; ++j)
+        {
+          if (weights[j] > maxWeight)
+          {
+            maxWeight = weights[j];
+            maxId = fromIds[j];
+          }
+        }
+        const auto fromTuple = fromTuples[maxId];
+        for (int c = 0; c < numComps; ++c)
+        {
+          toTuple[c] = static_cast<ValueType>(fromTuple[c]);
+        }
+      }
+      else
+      {
+        for (int c = 0; c < numComps; ++c)
+        {
+          double value = 0.0;
+          for (vtkIdType j = first; j < last; ++j)
+          {
+            value += weights[j] * static_cast<double>(fromTuples[fromIds[j]][c]);
+          }
+          ValueType typedValue;
+          vtkMath::RoundDoubleToIntegralIfNecessary(value, &typedValue);
+          toTuple[c] = typedValue;
+        }
+      }
+    }
+  }
+};
+
+//==============================================================================
+// This worker interpolates a batch of tuples for a collection of pairs of data
+// arrays.
+struct InterpolateArraysWorker
+{
+  InterpolateArraysWorker(const std::vector<vtkDataArray*>& fromArrays,
+    const std::vector<vtkDataArray*>& toArrays, const std::vector<bool>& nearest,
+    const vtkIdType* toIds, const vtkIdType* offsets, const vtkIdType* fromIds,
+    const double* weights)
+    : FromArrays(fromArrays)
+    , ToArrays(toArrays)
+    , Nearest(nearest)
+    , ToIds(toIds)
+    , Offsets(offsets)
+    , FromIds(fromIds)
+    , Weights(weights)
+  {
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    InterpolateTuplesWorker worker;
+    for (vtkIdType blockBegin = begin; blockBegin < end; blockBegin += InterpolationBlockSize)
+    {
+      const vtkIdType blockEnd = std::min(blockBegin + InterpolationBlockSize, end);
+      for (size_t i = 0; i < this->FromArrays.size(); ++i)
+      {
+        vtkDataArray* fromArray = this->FromArrays[i];
+        vtkDataArray* toArray = this->ToArrays[i];
+        const bool nearest = this->Nearest[i];
+        if (!vtkArrayDispatch::Dispatch2SameValueType::Execute(fromArray, toArray, worker, nearest,
+              blockBegin, blockEnd, this->ToIds, this->Offsets, this->FromIds, this->Weights))
+        {
+          worker(fromArray, toArray, nearest, blockBegin, blockEnd, this->ToIds, this->Offsets,
+            this->FromIds, this->Weights);
+        }
+      }
+    }
+  }
+
+  const std::vector<vtkDataArray*>& FromArrays;
+  const std::vector<vtkDataArray*>& ToArrays;
+  const std::vector<bool>& Nearest;
+  const vtkIdType* ToIds;
+  const vtkIdType* Offsets;
+  const vtkIdType* FromIds;
+  const double* Weights;
+};
+} // anonymous namespace
+
 //------------------------------------------------------------------------------
 // Interpolate data from points and interpolation weights. Make sure that the
 // method InterpolateAllocate() has been invoked before using this method.
 void vtkDataSetAttributes::InterpolatePoint(
   vtkDataSetAttributes* fromPd, vtkIdType toId, vtkIdList* ptIds, double* weights)
 {
+  if (this->DeferredInterpolation && this->DeferredInterpolation->Source == fromPd)
+  {
+    this->DeferredInterpolation->Add(
+      this, toId, ptIds->GetNumberOfIds(), ptIds->GetPointer(0), weights);
+    return;
+  }
+
   for (const auto& i : this->RequiredArrays)
   {
     vtkAbstractArray* fromArray = fromPd->Data[i];
@@ -1126,7 +1300,7 @@ void vtkDataSetAttributes::InterpolatePoint(
     {
       vtkIdType numIds = ptIds->GetNumberOfIds();
       vtkIdType maxId = ptIds->GetId(0);
-      vtkIdType maxWeight = 0;
+      double maxWeight = 0;
       for (int j = 0; j < numIds; ++j)
       {
         if (weights[j] > maxWeight)
@@ -1152,6 +1326,16 @@ void vtkDataSetAttributes::InterpolatePoint(
 void vtkDataSetAttributes::InterpolateEdge(
   vtkDataSetAttributes* fromPd, vtkIdType toId, vtkIdType p1, vtkIdType p2, double t)
 {
+  if (this->DeferredInterpolation && this->DeferredInterpolation->Source == fromPd)
+  {
+    // p2 comes first so that nearest neighbor interpolation, which keeps the
+    // first tuple of largest weight, picks p2 for t = 0.5 like below.
+    const vtkIdType ids[2] = { p2, p1 };
+    const double weights[2] = { t, 1.0 - t };
+    this->DeferredInterpolation->Add(this, toId, 2, ids, weights);
+    return;
+  }
+
   for (const auto& i : this->RequiredArrays)
   {
     vtkAbstractArray* fromArray = fromPd->Data[i];
@@ -1177,6 +1361,134 @@ void vtkDataSetAttributes::InterpolateEdge(
   }
 }
 
+//------------------------------------------------------------------------------
+// Interpolate a batch of tuples. Make sure that the method
+// InterpolateAllocate() has been invoked before using this method.
+void vtkDataSetAttributes::InterpolatePoints(vtkDataSetAttributes* fromPd,
+  vtkIdType numberOfTuples, const vtkIdType* toIds, const vtkIdType* offsets,
+  const vtkIdType* fromIds, const double* weights)
+{
+  std::vector<vtkAbstractArray*> fromArrays;
+  std::vector<vtkAbstractArray*> toArrays;
+  std::unique_ptr<bool[]> nearest(new bool[this->RequiredArrays.GetListSize()]);
+  for (const auto& i : this->RequiredArrays)
+  {
+    // check if the destination array needs nearest neighbor interpolation
+    int attributeIndex = this->IsArrayAnAttribute(this->TargetIndices[i]);
+    nearest[fromArrays.size()] =
+      attributeIndex != -1 && this->CopyAttributeFlags[INTERPOLATE][attributeIndex] == 2;
+    fromArrays.push_back(fromPd->Data[i]);
+    toArrays.push_back(this->Data[this->TargetIndices[i]]);
+  }
+  vtkDataSetAttributes::InterpolateArrays(static_cast<int>(fromArrays.size()), fromArrays.data(),
+    toArrays.data(), nearest.get(), numberOfTuples, toIds, offsets, fromIds, weights);
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::InterpolateArrays(int numberOfArrays,
+  vtkAbstractArray* const* fromArrays, vtkAbstractArray* const* toArrays, const bool* nearest,
+  vtkIdType numberOfTuples, const vtkIdType* toIds, const vtkIdType* offsets,
+  const vtkIdType* fromIds, const double* weights)
+{
+  if (numberOfTuples <= 0 || numberOfArrays == 0)
+  {
+    return;
+  }
+
+  const vtkIdType numberOfOutputTuples =
+    toIds ? 1 + *std::max_element(toIds, toIds + numberOfTuples) : numberOfTuples;
+  std::vector<vtkDataArray*> fromDataArrays;
+  std::vector<vtkDataArray*> toDataArrays;
+  std::vector<bool> dataArraysNearest;
+  vtkNew<vtkIdList> ids;
+  for (int i = 0; i < numberOfArrays; ++i)
+  {
+    vtkAbstractArray* fromArray = fromArrays[i];
+    vtkAbstractArray* toArray = toArrays[i];
+    vtkDataArray* fromDataArray = vtkArrayDownCast<vtkDataArray>(fromArray);
+    vtkDataArray* toDataArray = vtkArrayDownCast<vtkDataArray>(toArray);
+    if (!fromDataArray || !toDataArray ||
+      fromArray->GetNumberOfComponents() != toArray->GetNumberOfComponents())
+    {
+      // Other arrays are interpolated tuple by tuple, by the arrays themselves
+      for (vtkIdType t = 0; t < numberOfTuples; ++t)
+      {
+        const vtkIdType toId = toIds ? toIds[t] : t;
+        const vtkIdType first = offsets[t];
+        const vtkIdType last = offsets[t + 1];
+        if (nearest[i] && first < last)
+        {
+          vtkIdType maxId = fromIds[first];
+          double maxWeight = 0;
+          for (vtkIdType j = first; j < last; ++j)
+          {
+            if (weights[j] > maxWeight)
+            {
+              maxWeight = weights[j];
+              maxId = fromIds[j];
+            }
+          }
+          toArray->InsertTuple(toId, maxId, fromArray);
+        }
+        else
+        {
+          ids->SetArray(const_cast<vtkIdType*>(fromIds) + first, last - first, false);
+          toArray->InterpolateTuple(toId, ids, fromArray, const_cast<double*>(weights) + first);
+        }
+      }
+      continue;
+    }
+
+    // This ensures thread safetiness of the interpolation performed in parallel.
+    const vtkIdType size = toArray->GetSize() / toArray->GetNumberOfComponents();
+    if (numberOfOutputTuples > size)
+    {
+      // this preserves already existing data, and grows the array geometrically
+      // for the successive batches of deferred interpolations
+      toArray->Resize(std::max(numberOfOutputTuples, 2 * size));
+    }
+    if (numberOfOutputTuples > toArray->GetNumberOfTuples())
+    {
+      toArray->SetNumberOfTuples(numberOfOutputTuples); // this sets MaxId
+    }
+    fromDataArrays.push_back(fromDataArray);
+    toDataArrays.push_back(toDataArray);
+    dataArraysNearest.push_back(nearest[i]);
+  }
+  // The ids are not owned by the list
+  ids->SetArray(nullptr, 0);
+
+  if (!fromDataArrays.empty())
+  {
+    InterpolateArraysWorker worker(
+      fromDataArrays, toDataArrays, dataArraysNearest, toIds, offsets, fromIds, weights);
+    vtkSMPTools::For(0, numberOfTuples, InterpolationGrainSize, worker);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::BeginDeferredInterpolation(vtkDataSetAttributes* fromPd)
+{
+  this->EndDeferredInterpolation();
+  if (!this->DeferredInterpolation)
+  {
+    this->DeferredInterpolation = new vtkDeferredInterpolation;
+  }
+  this->DeferredInterpolation->Source = fromPd;
+  this->DeferredInterpolation->Reset();
+}
+
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::EndDeferredInterpolation()
+{
+  vtkDeferredInterpolation* deferred = this->DeferredInterpolation;
+  if (deferred && deferred->Source)
+  {
+    deferred->Flush(this);
+    deferred->Source = nullptr;
+  }
+}
+
 //------------------------------------------------------------------------------
 // Interpolate data from the two points p1,p2 (forming an edge) and an
 // interpolation factor, t, along the edge. The weight ranges from (0,1),
@@ -2032,6 +2344,14 @@ void vtkDataSetAttributes::InterpolatePoint(vtkDataSetAttributes::FieldList& lis
   list.InterpolatePoint(idx, fromPd, ptIds, weights, this, toId);
 }
 
+//------------------------------------------------------------------------------
+void vtkDataSetAttributes::InterpolatePoints(vtkDataSetAttributes::FieldList& list,
+  vtkDataSetAttributes* fromPd, int idx, vtkIdType numberOfTuples, const vtkIdType* toIds,
+  const vtkIdType* offsets, const vtkIdType* fromIds, const double* weights)
+{
+  list.InterpolatePoints(idx, fromPd, numberOfTuples, toIds, offsets, fromIds, weights, this);
+}
+
 //------------------------------------------------------------------------------
 const char* vtkDataSetAttributes::GetAttributeTypeAsString(int attributeType)
 {
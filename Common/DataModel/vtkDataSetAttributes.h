@@ -598,6 +598,41 @@ public:
   void InterpolateEdge(
     vtkDataSetAttributes* fromPd, vtkIdType toId, vtkIdType p1, vtkIdType p2, double t);
 
+  /**
+   * Interpolate a batch of tuples from other data set attributes. The output
+   * tuple toIds[i] (or i when toIds is nullptr) is interpolated from the input
+   * tuples fromIds[offsets[i]] to fromIds[offsets[i + 1] - 1] with the
+   * matching weights, so that offsets holds numberOfTuples + 1 values. This is
+   * equivalent to calling InterpolatePoint() for each output tuple, but all the
+   * arrays are interpolated by typed loops over blocks of tuples, without
+   * virtual calls per tuple, and large batches are split across threads.
+   * The output ids of a batch must be unique, and output arrays are extended
+   * as needed. Batches writing different tuples of output arrays that are
+   * already large enough can be interpolated concurrently. Make sure that the
+   * method InterpolateAllocate() has been invoked before using this method.
+   * If the INTERPOLATION copy flag is set to 0 for an array, interpolation
+   * is prevented. If the flag is set to 1, weighted interpolation occurs.
+   * If the flag is set to 2, nearest neighbor interpolation is used.
+   */
+  void InterpolatePoints(vtkDataSetAttributes* fromPd, vtkIdType numberOfTuples,
+    const vtkIdType* toIds, const vtkIdType* offsets, const vtkIdType* fromIds,
+    const double* weights);
+
+  ///@{
+  /**
+   * Defer the interpolations from fromPd. Between these calls,
+   * InterpolatePoint() and InterpolateEdge() only record the interpolations
+   * from fromPd, which are then performed in batches with InterpolatePoints(),
+   * the last one by EndDeferredInterpolation(). Algorithms whose
+   * interpolations are made cell by cell, such as vtkCell::Contour() and
+   * vtkCell::Clip(), can so interpolate all the arrays at once. The output
+   * arrays must not be read before EndDeferredInterpolation() is called.
+   * Interpolations from other data set attributes are performed immediately.
+   */
+  void BeginDeferredInterpolation(vtkDataSetAttributes* fromPd);
+  void EndDeferredInterpolation();
+  ///@}
+
   /**
    * Interpolate data from the same id (point or cell) at different points
    * in time (parameter t). Two input data set attributes objects are input.
@@ -652,6 +687,15 @@ public:
   void InterpolatePoint(vtkDataSetAttributes::FieldList& list, vtkDataSetAttributes* fromPd,
     int idx, vtkIdType toId, vtkIdList* ids, double* weights);
 
+  /**
+   * A special form of InterpolatePoints() to be used with FieldLists. Make
+   * sure that special form of InterpolateAllocate() that accepts FieldList has
+   * been used.
+   */
+  void InterpolatePoints(vtkDataSetAttributes::FieldList& list, vtkDataSetAttributes* fromPd,
+    int idx, vtkIdType numberOfTuples, const vtkIdType* toIds, const vtkIdType* offsets,
+    const vtkIdType* fromIds, const double* weights);
+
 protected:
   vtkDataSetAttributes();
   ~vtkDataSetAttributes() override;
@@ -681,6 +725,18 @@ private:
 
   vtkFieldData::BasicIterator ComputeRequiredArrays(vtkDataSetAttributes* pd, int ctype);
 
+  // Interpolate a batch of tuples of pairs of arrays, see InterpolatePoints().
+  // nearest[i] is true for the pairs using nearest neighbor interpolation.
+  static void InterpolateArrays(int numberOfArrays, vtkAbstractArray* const* fromArrays,
+    vtkAbstractArray* const* toArrays, const bool* nearest, vtkIdType numberOfTuples,
+    const vtkIdType* toIds, const vtkIdType* offsets, const vtkIdType* fromIds,
+    const double* weights);
+
+  // Interpolations recorded between BeginDeferredInterpolation() and
+  // EndDeferredInterpolation().
+  struct vtkDeferredInterpolation;
+  vtkDeferredInterpolation* DeferredInterpolation;
+
   vtkDataSetAttributes(const vtkDataSetAttributes&) = delete;
   void operator=(const vtkDataSetAttributes&) = delete;
 
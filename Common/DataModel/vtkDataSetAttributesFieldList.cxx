@@ -14,6 +14,7 @@
 #include <array>
 #include <functional>
 #include <map>
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -703,7 +704,7 @@ void vtkDataSetAttributesFieldList::InterpolatePoint(int inputIndex, vtkDataSetA
       {
         vtkIdType numIds = inputIds->GetNumberOfIds();
         vtkIdType maxId = inputIds->GetId(0);
-        vtkIdType maxWeight = 0.;
+        double maxWeight = 0.;
         for (int j = 0; j < numIds; j++)
         {
           if (weights[j] > maxWeight)
@@ -722,6 +723,37 @@ void vtkDataSetAttributesFieldList::InterpolatePoint(int inputIndex, vtkDataSetA
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkDataSetAttributesFieldList::InterpolatePoints(int inputIndex, vtkDataSetAttributes* input,
+  vtkIdType numberOfTuples, const vtkIdType* toIds, const vtkIdType* offsets,
+  const vtkIdType* inputIds, const double* weights, vtkDataSetAttributes* output) const
+{
+  auto& internals = *this->Internals;
+  std::vector<vtkAbstractArray*> fromArrays;
+  std::vector<vtkAbstractArray*> toArrays;
+  std::unique_ptr<bool[]> nearest(new bool[internals.Fields.size()]);
+  for (auto& pair : internals.Fields)
+  {
+    auto& fieldInfo = pair.second;
+    if (inputIndex < 0 || inputIndex > static_cast<int>(fieldInfo.Location.size()))
+    {
+      vtkGenericWarningMacro("Incorrect/unknown inputIndex specified : " << inputIndex);
+      return;
+    }
+    else if (fieldInfo.OutputLocation != -1 && fieldInfo.Location[inputIndex] != -1)
+    {
+      // check if the destination array needs nearest neighbor interpolation.
+      int attrIndex = input->IsArrayAnAttribute(fieldInfo.Location[inputIndex]);
+      nearest[fromArrays.size()] = attrIndex != -1 &&
+        output->GetCopyAttribute(attrIndex, vtkDataSetAttributes::INTERPOLATE) == 2;
+      fromArrays.push_back(input->GetAbstractArray(fieldInfo.Location[inputIndex]));
+      toArrays.push_back(output->GetAbstractArray(fieldInfo.OutputLocation));
+    }
+  }
+  vtkDataSetAttributes::InterpolateArrays(static_cast<int>(fromArrays.size()), fromArrays.data(),
+    toArrays.data(), nearest.get(), numberOfTuples, toIds, offsets, inputIds, weights);
+}
+
 //------------------------------------------------------------------------------
 void vtkDataSetAttributesFieldList::TransformData(int inputIndex, vtkDataSetAttributes* input,
   vtkDataSetAttributes* output, std::function<void(vtkAbstractArray*, vtkAbstractArray*)> op) const
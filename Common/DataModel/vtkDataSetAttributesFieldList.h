@@ -105,6 +105,9 @@ public:
     vtkIdType numValues, vtkDataSetAttributes* output, vtkIdType outStart) const;
   void InterpolatePoint(int inputIndex, vtkDataSetAttributes* input, vtkIdList* inputIds,
     double* weights, vtkDataSetAttributes* output, vtkIdType toId) const;
+  void InterpolatePoints(int inputIndex, vtkDataSetAttributes* input, vtkIdType numberOfTuples,
+    const vtkIdType* toIds, const vtkIdType* offsets, const vtkIdType* inputIds,
+    const double* weights, vtkDataSetAttributes* output) const;
   ///@}
 
   /**
@@ -2,8 +2,19 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkFindCellStrategy.h"
 
+#include "vtkDoubleArray.h"
+#include "vtkGenericCell.h"
+#include "vtkIdList.h"
 #include "vtkLogger.h"
+#include "vtkNew.h"
 #include "vtkPointSet.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <vector>
 
 //------------------------------------------------------------------------------
 VTK_ABI_NAMESPACE_BEGIN
@@ -34,6 +45,89 @@ int vtkFindCellStrategy::Initialize(vtkPointSet* ps)
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkFindCellStrategy::FindCells(vtkPoints* points, double tol2, vtkIdList* cellIds,
+  vtkDoubleArray* pcoords, vtkDoubleArray* weights)
+{
+  if (!points || !cellIds || !this->PointSet)
+  {
+    vtkLog(ERROR, "FindCells must be called with points and cell ids on an initialized strategy");
+    return;
+  }
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  const bool hasCells = this->PointSet->GetNumberOfCells() > 0;
+  const int maxCellSize = hasCells ? std::max(this->PointSet->GetMaxCellSize(), 1) : 1;
+  cellIds->SetNumberOfIds(numPts);
+  if (pcoords)
+  {
+    pcoords->SetNumberOfComponents(3);
+    pcoords->SetNumberOfTuples(numPts);
+  }
+  if (weights)
+  {
+    weights->SetNumberOfComponents(maxCellSize);
+    weights->SetNumberOfTuples(numPts);
+  }
+  if (!hasCells)
+  {
+    std::fill(cellIds->begin(), cellIds->end(), -1);
+    if (pcoords)
+    {
+      pcoords->Fill(0.0);
+    }
+    if (weights)
+    {
+      weights->Fill(0.0);
+    }
+    return;
+  }
+
+  // Build the cells of the point set before querying them from several threads
+  vtkNew<vtkGenericCell> cell0;
+  this->PointSet->GetCell(0, cell0);
+
+  // Each thread uses its own copy of the strategy, which shares the locator
+  vtkSMPThreadLocal<vtkSmartPointer<vtkFindCellStrategy>> tlStrategy;
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPThreadLocal<std::vector<double>> tlWeights;
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    vtkSmartPointer<vtkFindCellStrategy>& strategy = tlStrategy.Local();
+    if (!strategy)
+    {
+      strategy = vtk::TakeSmartPointer(this->NewInstance());
+      strategy->CopyParameters(this);
+      strategy->Initialize(this->PointSet);
+    }
+    vtkGenericCell* cell = tlCell.Local();
+    std::vector<double>& cellWeights = tlWeights.Local();
+    cellWeights.resize(maxCellSize);
+    double x[3], pc[3];
+    int subId;
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      points->GetPoint(ptId, x);
+      const vtkIdType cellId =
+        strategy->FindCell(x, nullptr, cell, -1, tol2, subId, pc, cellWeights.data());
+      cellIds->SetId(ptId, cellId);
+      if (cellId < 0)
+      {
+        std::fill_n(pc, 3, 0.0);
+      }
+      if (pcoords)
+      {
+        std::copy_n(pc, 3, pcoords->GetPointer(3 * ptId));
+      }
+      if (weights)
+      {
+        double* ptWeights = weights->GetPointer(maxCellSize * ptId);
+        const vtkIdType cellSize = cellId < 0 ? 0 : this->PointSet->GetCellSize(cellId);
+        std::copy_n(cellWeights.data(), cellSize, ptWeights);
+        std::fill(ptWeights + cellSize, ptWeights + maxCellSize, 0.0);
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 void vtkFindCellStrategy::CopyParameters(vtkFindCellStrategy* from)
 {
@@ -41,8 +41,11 @@
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCell;
+class vtkDoubleArray;
 class vtkGenericCell;
+class vtkIdList;
 class vtkPointSet;
+class vtkPoints;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkFindCellStrategy : public vtkObject
 {
@@ -75,6 +78,17 @@ public:
   virtual vtkIdType FindCell(double x[3], vtkCell* cell, vtkGenericCell* gencell, vtkIdType cellId,
     double tol2, int& subId, double pcoords[3], double* weights) = 0;
 
+  /**
+   * Find the cells containing a batch of points, in parallel, with a copy of
+   * this strategy and a vtkGenericCell per thread. The strategy must have
+   * been initialized. For each point, the id of the cell containing it, or -1,
+   * is stored in cellIds, and the parametric coordinates and the interpolation
+   * weights of the points are stored in pcoords and weights if they are
+   * provided, as vtkAbstractCellLocator::FindCells() does.
+   */
+  void FindCells(vtkPoints* points, double tol2, vtkIdList* cellIds,
+    vtkDoubleArray* pcoords = nullptr, vtkDoubleArray* weights = nullptr);
+
   /**
    * Return the closest point within a specified radius and the cell which is
    * closest to the point x. The closest point is somewhere on a cell, it
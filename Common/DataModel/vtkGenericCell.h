@@ -20,6 +20,7 @@
 
 #include "vtkCell.h"
 #include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObjectPool.h"            // For vtkObjectPoolTraits
 
 VTK_ABI_NAMESPACE_BEGIN
 class VTKCOMMONDATAMODEL_EXPORT vtkGenericCell : public vtkCell
@@ -181,5 +182,25 @@ private:
   void operator=(const vtkGenericCell&) = delete;
 };
 
+#ifndef __VTK_WRAP__
+/**
+ * Generic cells are poolable, see vtkObjectPool. Recycled cells are set back
+ * to an empty cell and keep the cells they already instantiated.
+ */
+template <>
+struct vtkObjectPoolTraits<vtkGenericCell> : std::true_type
+{
+  static void Recycle(vtkGenericCell* cell) { cell->SetCellTypeToEmptyCell(); }
+};
+
+/**
+ * Thread local generic cells are pooled by vtkSMPThreadLocalObject.
+ */
+template <>
+struct vtkObjectPoolThreadLocalTraits<vtkGenericCell> : std::true_type
+{
+};
+#endif
+
 VTK_ABI_NAMESPACE_END
 #endif
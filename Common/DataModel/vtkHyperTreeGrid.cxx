@@ -2,10 +2,12 @@
 // SPDX-License-Identifier: BSD-3-Clause
 #include "vtkHyperTreeGrid.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkBitArray.h"
 #include "vtkBoundingBox.h"
 #include "vtkCellData.h"
 #include "vtkCollection.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDoubleArray.h"
 #include "vtkFieldData.h"
 #include "vtkGenericCell.h"
@@ -31,13 +33,19 @@
 #include "vtkMath.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkStructuredData.h"
 #include "vtkUnsignedCharArray.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
+#include <cstdint>
 #include <deque>
+#include <utility>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkInformationKeyMacro(vtkHyperTreeGrid, LEVELS, Integer);
@@ -1616,6 +1624,223 @@ void vtkHyperTreeGrid::InitializeLocalIndexNode()
   } // it
 }
 
+//------------------------------------------------------------------------------
+void vtkHyperTreeGrid::GetTreeIndices(vtkIdList* indices)
+{
+  indices->Reset();
+  indices->Allocate(static_cast<vtkIdType>(this->HyperTrees.size()));
+  vtkIdType index;
+  vtkHyperTreeGridIterator it;
+  this->InitializeTreeIterator(it);
+  while (it.GetNextTree(index))
+  {
+    indices->InsertNextId(index);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkHyperTreeGrid::PrepareForConcurrentTraversal()
+{
+  // The scales of each level are computed the first time they are requested
+  const unsigned int numberOfLevels = this->GetNumberOfLevels();
+  vtkHyperTreeGridIterator it;
+  this->InitializeTreeIterator(it);
+  while (vtkHyperTree* tree = it.GetNextTree())
+  {
+    if (tree->HasScales() && numberOfLevels > 0)
+    {
+      tree->GetScales()->GetScale(numberOfLevels - 1);
+    }
+  }
+
+  if (this->HasMask() || this->HasInterface)
+  {
+    this->GetPureMask();
+  }
+  this->GetTreeGhostArray();
+}
+
+//------------------------------------------------------------------------------
+// Helpers for vtkHyperTreeGrid::ReorderCellsAlongMortonCurve()
+namespace
+{
+//------------------------------------------------------------------------------
+// Spread the 21 lower bits of x so that two zero bits separate each of them.
+uint64_t SpreadBits(uint64_t x)
+{
+  x &= 0x1fffff;
+  x = (x | x << 32) & 0x1f00000000ffffULL;
+  x = (x | x << 16) & 0x1f0000ff0000ffULL;
+  x = (x | x << 8) & 0x100f00f00f00f00fULL;
+  x = (x | x << 4) & 0x10c30c30c30c30c3ULL;
+  x = (x | x << 2) & 0x1249249249249249ULL;
+  return x;
+}
+
+//------------------------------------------------------------------------------
+// Number the cells of a tree in depth-first order, children in the order of
+// their index (i fastest, then j, then k), which is the Morton order.
+void RecursivelyNumberCells(vtkHyperTreeGridNonOrientedCursor* cursor, vtkIdType& next,
+  vtkIdType* newToOld, std::vector<vtkIdType>& newIndices)
+{
+  newToOld[next] = cursor->GetGlobalNodeIndex();
+  newIndices[cursor->GetVertexId()] = next++;
+  if (cursor->IsLeaf())
+  {
+    return;
+  }
+  for (unsigned char child = 0; child < cursor->GetNumberOfChildren(); ++child)
+  {
+    cursor->ToChild(child);
+    ::RecursivelyNumberCells(cursor, next, newToOld, newIndices);
+    cursor->ToParent();
+  }
+}
+
+//------------------------------------------------------------------------------
+struct PermuteTuplesWorker
+{
+  template <typename InArrayT, typename OutArrayT>
+  void operator()(InArrayT* input, OutArrayT* output, const vtkIdType* newToOld)
+  {
+    const auto inTuples = vtk::DataArrayTupleRange(input);
+    auto outTuples = vtk::DataArrayTupleRange(output);
+    vtkSMPTools::For(0, output->GetNumberOfTuples(), [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType tupleId = begin; tupleId < end; ++tupleId)
+      {
+        outTuples[tupleId] = inTuples[newToOld[tupleId]];
+      }
+    });
+  }
+};
+
+//------------------------------------------------------------------------------
+// Return the array whose tuple i is the tuple newToOld[i] of the input.
+vtkSmartPointer<vtkAbstractArray> PermuteTuples(
+  vtkAbstractArray* input, const vtkIdType* newToOld, vtkIdType numberOfTuples)
+{
+  auto output = vtk::TakeSmartPointer(input->NewInstance());
+  output->SetName(input->GetName());
+  output->SetNumberOfComponents(input->GetNumberOfComponents());
+  output->SetNumberOfTuples(numberOfTuples);
+  if (input->HasInformation())
+  {
+    output->CopyInformation(input->GetInformation(), /*deep=*/1);
+  }
+  vtkDataArray* inputData = vtkDataArray::SafeDownCast(input);
+  vtkDataArray* outputData = vtkDataArray::SafeDownCast(output);
+  PermuteTuplesWorker worker;
+  if (!inputData || !outputData ||
+    !vtkArrayDispatch::Dispatch2SameValueType::Execute(inputData, outputData, worker, newToOld))
+  {
+    // Bit, string and variant arrays
+    for (vtkIdType tupleId = 0; tupleId < numberOfTuples; ++tupleId)
+    {
+      output->SetTuple(tupleId, newToOld[tupleId], input);
+    }
+  }
+  return output;
+}
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkHyperTreeGrid::ReorderCellsAlongMortonCurve()
+{
+  vtkNew<vtkIdList> treeIndices;
+  this->GetTreeIndices(treeIndices);
+  const vtkIdType numberOfTrees = treeIndices->GetNumberOfIds();
+  if (numberOfTrees == 0)
+  {
+    return;
+  }
+  const vtkIdType oldSize = this->GetGlobalNodeIndexMax() + 1;
+
+  // Order the trees along the curve
+  std::vector<std::pair<uint64_t, vtkIdType>> treeCodes(numberOfTrees);
+  vtkSMPTools::For(0, numberOfTrees, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      unsigned int ijk[3];
+      const vtkIdType index = treeIndices->GetId(i);
+      this->GetLevelZeroCoordinatesFromIndex(index, ijk[0], ijk[1], ijk[2]);
+      treeCodes[i].first = ::SpreadBits(ijk[0]) | ::SpreadBits(ijk[1]) << 1 |
+        ::SpreadBits(ijk[2]) << 2;
+      treeCodes[i].second = index;
+    }
+  });
+  vtkSMPTools::Sort(treeCodes.begin(), treeCodes.end());
+
+  std::vector<vtkIdType> treeOffsets(numberOfTrees + 1, 0);
+  for (vtkIdType i = 0; i < numberOfTrees; ++i)
+  {
+    treeOffsets[i + 1] =
+      treeOffsets[i] + this->GetTree(treeCodes[i].second)->GetNumberOfVertices();
+  }
+  const vtkIdType numberOfCells = treeOffsets.back();
+
+  // Number the cells of each tree along the curve, and switch the trees to
+  // explicit global indices. The trees are independent of each other.
+  std::vector<vtkIdType> newToOld(numberOfCells);
+  vtkSMPThreadLocalObject<vtkHyperTreeGridNonOrientedCursor> tlCursor;
+  vtkSMPTools::For(0, numberOfTrees, [&](vtkIdType begin, vtkIdType end) {
+    vtkHyperTreeGridNonOrientedCursor* cursor = tlCursor.Local();
+    std::vector<vtkIdType> newIndices;
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      cursor->Initialize(this, treeCodes[i].second);
+      vtkHyperTree* tree = cursor->GetTree();
+      newIndices.resize(tree->GetNumberOfVertices());
+      vtkIdType next = treeOffsets[i];
+      ::RecursivelyNumberCells(cursor, next, newToOld.data(), newIndices);
+      if (tree->GetGlobalIndexStart() >= 0)
+      {
+        tree->SetGlobalIndexStart(-1);
+      }
+      // Backward so that the mapping is resized once
+      for (vtkIdType vertexId = tree->GetNumberOfVertices() - 1; vertexId >= 0; --vertexId)
+      {
+        tree->SetGlobalIndexFromLocal(vertexId, newIndices[vertexId]);
+      }
+    }
+  });
+
+  // Permute the cell arrays, replaced in place by AddArray() which matches
+  // them by name
+  vtkCellData* cellData = this->GetCellData();
+  for (int arrayId = 0; arrayId < cellData->GetNumberOfArrays(); ++arrayId)
+  {
+    vtkAbstractArray* array = cellData->GetAbstractArray(arrayId);
+    if (!array->GetName() || array->GetNumberOfTuples() < oldSize)
+    {
+      vtkWarningMacro(
+        "Cell array " << (array->GetName() ? array->GetName() : "") << " was not reordered.");
+      continue;
+    }
+    cellData->AddArray(::PermuteTuples(array, newToOld.data(), numberOfCells));
+  }
+  this->TreeGhostArrayCached = false;
+
+  if (this->HasMask())
+  {
+    // The mask may omit the last cells, which are then not masked
+    vtkNew<vtkBitArray> mask;
+    mask->SetName(this->Mask->GetName());
+    mask->SetNumberOfTuples(numberOfCells);
+    const vtkIdType maskSize = this->Mask->GetNumberOfTuples();
+    for (vtkIdType cellId = 0; cellId < numberOfCells; ++cellId)
+    {
+      const vtkIdType oldId = newToOld[cellId];
+      mask->SetValue(cellId, oldId < maskSize ? this->Mask->GetValue(oldId) : 0);
+    }
+    this->SetMask(mask);
+  }
+  else
+  {
+    this->CleanPureMask();
+  }
+  this->Modified();
+}
+
 //=============================================================================
 // Hyper tree grid iterator
 // Implemented here because it needs access to the internal classes.
@@ -75,6 +75,7 @@ class vtkHyperTreeGridNonOrientedMooreSuperCursorLight;
 class vtkHyperTreeGridNonOrientedUnlimitedMooreSuperCursor;
 class vtkDoubleArray;
 class vtkDataSetAttributes;
+class vtkIdList;
 class vtkIdTypeArray;
 class vtkLine;
 class vtkPixel;
@@ -651,6 +652,32 @@ public:
    */
   void InitializeLocalIndexNode();
 
+  /**
+   * Fill the list with the indices of the trees of the grid, in increasing order.
+   */
+  void GetTreeIndices(vtkIdList* indices);
+
+  /**
+   * Compute what the grid and its trees otherwise compute lazily, when first
+   * accessed: the scales of the trees down to the deepest level of the grid,
+   * the pure mask when the grid has a mask or an interface, and the cached
+   * ghost array. After this call, any number of cursors can traverse the
+   * trees concurrently, as long as the grid is not modified.
+   * Called by vtk::hypertreegrid::ForEachTree().
+   */
+  void PrepareForConcurrentTraversal();
+
+  /**
+   * Renumber the cells of the grid along a Morton (Z-order) curve, and
+   * permute the cell data and the mask accordingly: the trees are ordered by
+   * the Morton code of their level zero coordinates, and the cells of each
+   * tree in depth-first order, so that cells close in space are close in the
+   * cell data arrays. Every tree then uses an explicit global index mapping
+   * (see vtkHyperTree::SetGlobalIndexFromLocal()). Cell arrays with fewer
+   * tuples than GetGlobalNodeIndexMax() + 1 are left unchanged.
+   */
+  void ReorderCellsAlongMortonCurve();
+
   /**
    * Returns true if a ghost cell array is defined.
    */
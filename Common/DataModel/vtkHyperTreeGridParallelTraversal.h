@@ -0,0 +1,63 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @file   vtkHyperTreeGridParallelTraversal.h
+ * @brief  Traverse the trees of a vtkHyperTreeGrid in parallel
+ *
+ * vtk::hypertreegrid::ForEachTree() traverses the trees of a grid with
+ * vtkSMPTools, each tree being a task. Each thread owns a cursor of type
+ * CursorT, any cursor or super cursor of vtkHyperTreeGrid (for instance
+ * vtkHyperTreeGridNonOrientedMooreSuperCursor or
+ * vtkHyperTreeGridNonOrientedVonNeumannSuperCursor), which is initialized on
+ * each tree before calling functor(cursor, treeIndex). The functor must only
+ * read the grid, and write to the cells of the tree it is given or to thread
+ * local storage (see vtkSMPThreadLocal). The grid is first prepared for
+ * concurrent traversal (see vtkHyperTreeGrid::PrepareForConcurrentTraversal()).
+ *
+ * @code
+ * using CursorT = vtkHyperTreeGridNonOrientedMooreSuperCursor;
+ * vtk::hypertreegrid::ForEachTree<CursorT>(grid,
+ *   [&](CursorT* cursor, vtkIdType treeIndex) { this->RecursivelyProcessTree(cursor); });
+ * @endcode
+ */
+
+#ifndef vtkHyperTreeGridParallelTraversal_h
+#define vtkHyperTreeGridParallelTraversal_h
+
+#include "vtkABINamespace.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkIdList.h"
+#include "vtkNew.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+namespace vtk
+{
+namespace hypertreegrid
+{
+VTK_ABI_NAMESPACE_BEGIN
+
+template <class CursorT, class FunctorT>
+void ForEachTree(vtkHyperTreeGrid* grid, FunctorT&& functor)
+{
+  vtkNew<vtkIdList> treeIndices;
+  grid->GetTreeIndices(treeIndices);
+  grid->PrepareForConcurrentTraversal();
+  vtkSMPThreadLocalObject<CursorT> cursors;
+  vtkSMPTools::For(0, treeIndices->GetNumberOfIds(), [&](vtkIdType begin, vtkIdType end) {
+    CursorT* cursor = cursors.Local();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType treeIndex = treeIndices->GetId(i);
+      cursor->Initialize(grid, treeIndex);
+      functor(cursor, treeIndex);
+    }
+  });
+}
+
+VTK_ABI_NAMESPACE_END
+} // namespace hypertreegrid
+} // namespace vtk
+
+#endif // vtkHyperTreeGridParallelTraversal_h
+// VTK-HeaderTest-Exclude: vtkHyperTreeGridParallelTraversal.h
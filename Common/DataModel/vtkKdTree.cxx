@@ -12,26 +12,36 @@
 #include "vtkDataSetCollection.h"
 #include "vtkFloatArray.h"
 #include "vtkGarbageCollector.h"
+#include "vtkGenericCell.h"
 #include "vtkIdList.h"
 #include "vtkIdTypeArray.h"
 #include "vtkImageData.h"
 #include "vtkIntArray.h"
 #include "vtkKdNode.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
 #include "vtkRectilinearGrid.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkTimerLog.h"
 #include "vtkUniformGrid.h"
 #include "vtkUnsignedCharArray.h"
 
 #include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <limits>
 #include <list>
 #include <map>
+#include <numeric>
 #include <queue>
 #include <set>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -172,6 +182,185 @@ private:
 };
 }
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Regions with fewer points are not worth dividing with ParallelDivide().
+constexpr int ParallelDivideMinimumSize = 1 << 15;
+
+// Number of points processed together by ParallelDivide().
+constexpr vtkIdType ParallelDivideChunkSize = 1 << 14;
+
+//------------------------------------------------------------------------------
+// Map a float to an unsigned integer with the same order, so that the values
+// can be histogrammed digit by digit. -0 and +0 have the same key.
+inline std::uint32_t OrderedKey(float value)
+{
+  if (value == 0.0f)
+  {
+    value = 0.0f;
+  }
+  std::uint32_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  return (bits & 0x80000000u) ? ~bits : (bits | 0x80000000u);
+}
+
+//------------------------------------------------------------------------------
+inline float KeyValue(std::uint32_t key)
+{
+  const std::uint32_t bits = (key & 0x80000000u) ? (key & 0x7fffffffu) : ~key;
+  float value;
+  std::memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+//------------------------------------------------------------------------------
+// Divide the region kd, whose points are c1, in two along dim using
+// vtkSMPTools. This produces the same children as vtkKdTree::Select() followed
+// by vtkKdTree::AddNewRegions(): the value T of rank nvals / 2 is found with a
+// parallel radix selection, then the points are stably partitioned about T
+// into scratch, the points lower than T coming first. Only the order of the
+// points in the children differs from the sequential build. Returns false,
+// leaving c1 unchanged, if the region cannot be divided along dim.
+bool ParallelDivide(vtkKdNode* kd, float* c1, float* scratch, int dim)
+{
+  const vtkIdType nvals = kd->GetNumberOfPoints();
+  const vtkIdType rank = nvals / 2;
+
+  // Find the key of rank nvals / 2, 11, 11 and 10 bits at a time, and count
+  // the keys lower than it
+  std::uint32_t prefix = 0;
+  vtkIdType nlower = 0;
+  const int shifts[3] = { 21, 10, 0 };
+  for (int pass = 0; pass < 3; ++pass)
+  {
+    const int shift = shifts[pass];
+    const int highShift = pass == 0 ? 32 : shifts[pass - 1];
+    const std::uint32_t digitMask = (1u << (highShift - shift)) - 1;
+    vtkSMPThreadLocal<std::vector<vtkIdType>> localHistograms;
+    vtkSMPTools::For(0, nvals, ParallelDivideChunkSize, [&](vtkIdType begin, vtkIdType end) {
+      std::vector<vtkIdType>& histogram = localHistograms.Local();
+      histogram.resize(digitMask + 1, 0);
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const std::uint64_t key = OrderedKey(c1[3 * i + dim]);
+        if ((key >> highShift) == prefix)
+        {
+          ++histogram[(key >> shift) & digitMask];
+        }
+      }
+    });
+    std::vector<vtkIdType> histogram(digitMask + 1, 0);
+    for (const std::vector<vtkIdType>& localHistogram : localHistograms)
+    {
+      for (std::size_t digit = 0; digit < localHistogram.size(); ++digit)
+      {
+        histogram[digit] += localHistogram[digit];
+      }
+    }
+    std::uint32_t digit = 0;
+    while (nlower + histogram[digit] <= rank)
+    {
+      nlower += histogram[digit++];
+    }
+    prefix = (prefix << (highShift - shift)) | digit;
+  }
+
+  if (nlower == 0)
+  {
+    return false; // all the values up to the median are equal
+  }
+  const float T = KeyValue(prefix);
+
+  // Count the points lower than T in each chunk, and get the range of the
+  // children along dim
+  const vtkIdType numberOfChunks = (nvals + ParallelDivideChunkSize - 1) / ParallelDivideChunkSize;
+  std::vector<vtkIdType> offsets(numberOfChunks + 1, 0);
+  std::vector<float> leftMin(numberOfChunks, std::numeric_limits<float>::max());
+  std::vector<float> leftMax(numberOfChunks, std::numeric_limits<float>::lowest());
+  std::vector<float> rightMax(numberOfChunks, std::numeric_limits<float>::lowest());
+  vtkSMPTools::For(0, numberOfChunks, 1, [&](vtkIdType beginChunk, vtkIdType endChunk) {
+    for (vtkIdType chunk = beginChunk; chunk < endChunk; ++chunk)
+    {
+      const vtkIdType end = std::min(nvals, (chunk + 1) * ParallelDivideChunkSize);
+      for (vtkIdType i = chunk * ParallelDivideChunkSize; i < end; ++i)
+      {
+        const float value = c1[3 * i + dim];
+        if (value < T)
+        {
+          ++offsets[chunk + 1];
+          leftMin[chunk] = std::min(leftMin[chunk], value);
+          leftMax[chunk] = std::max(leftMax[chunk], value);
+        }
+        else
+        {
+          rightMax[chunk] = std::max(rightMax[chunk], value);
+        }
+      }
+    }
+  });
+  for (vtkIdType chunk = 0; chunk < numberOfChunks; ++chunk)
+  {
+    offsets[chunk + 1] += offsets[chunk];
+  }
+  const float maxLeft = *std::max_element(leftMax.begin(), leftMax.end());
+  const float minLeft = *std::min_element(leftMin.begin(), leftMin.end());
+  const float maxRight = *std::max_element(rightMax.begin(), rightMax.end());
+
+  // Stable partition into scratch, then back into c1
+  vtkSMPTools::For(0, numberOfChunks, 1, [&](vtkIdType beginChunk, vtkIdType endChunk) {
+    for (vtkIdType chunk = beginChunk; chunk < endChunk; ++chunk)
+    {
+      const vtkIdType begin = chunk * ParallelDivideChunkSize;
+      const vtkIdType end = std::min(nvals, begin + ParallelDivideChunkSize);
+      vtkIdType left = offsets[chunk];
+      vtkIdType right = nlower + begin - offsets[chunk];
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        const vtkIdType j = c1[3 * i + dim] < T ? left++ : right++;
+        std::copy(c1 + 3 * i, c1 + 3 * i + 3, scratch + 3 * j);
+      }
+    }
+  });
+  vtkSMPTools::For(0, nvals, ParallelDivideChunkSize, [&](vtkIdType begin, vtkIdType end) {
+    std::copy(scratch + 3 * begin, scratch + 3 * end, c1 + 3 * begin);
+  });
+
+  // Same children as vtkKdTree::AddNewRegions(), whose data bounds along dim
+  // are the ranges found above
+  const double coord = (static_cast<double>(T) + static_cast<double>(maxLeft)) / 2.0;
+  kd->SetDim(dim);
+
+  vtkKdNode* left = vtkKdNode::New();
+  vtkKdNode* right = vtkKdNode::New();
+  kd->AddChildNodes(left, right);
+
+  double bounds[6], dataBounds[6];
+  kd->GetBounds(bounds);
+  kd->GetDataBounds(dataBounds);
+
+  double childBounds[6];
+  std::copy(bounds, bounds + 6, childBounds);
+  childBounds[2 * dim + 1] = coord;
+  left->SetBounds(childBounds);
+  left->SetNumberOfPoints(nlower);
+  childBounds[2 * dim + 1] = bounds[2 * dim + 1];
+  childBounds[2 * dim] = coord;
+  right->SetBounds(childBounds);
+  right->SetNumberOfPoints(nvals - nlower);
+
+  dataBounds[2 * dim] = minLeft;
+  dataBounds[2 * dim + 1] = maxLeft;
+  left->SetDataBounds(dataBounds[0], dataBounds[1], dataBounds[2], dataBounds[3], dataBounds[4],
+    dataBounds[5]);
+  dataBounds[2 * dim] = T;
+  dataBounds[2 * dim + 1] = maxRight;
+  right->SetDataBounds(dataBounds[0], dataBounds[1], dataBounds[2], dataBounds[3], dataBounds[4],
+    dataBounds[5]);
+  return true;
+}
+}
+
 //------------------------------------------------------------------------------
 vtkStandardNewMacro(vtkKdTree);
 
@@ -619,72 +808,67 @@ float* vtkKdTree::ComputeCellCenters(vtkDataSet* set)
     return nullptr;
   }
 
-  int maxCellSize = 0;
-
   if (set)
   {
-    maxCellSize = set->GetMaxCellSize();
+    this->ComputeCellCenters(set, center, 0, totalCells);
   }
   else
   {
+    float* cptr = center;
+    vtkIdType offset = 0;
     vtkCollectionSimpleIterator cookie;
     this->DataSets->InitTraversal(cookie);
     for (vtkDataSet* iset = this->DataSets->GetNextDataSet(cookie); iset != nullptr;
          iset = this->DataSets->GetNextDataSet(cookie))
     {
-      int cellSize = iset->GetMaxCellSize();
-      maxCellSize = (cellSize > maxCellSize) ? cellSize : maxCellSize;
+      this->ComputeCellCenters(iset, cptr, offset, totalCells);
+      offset += iset->GetNumberOfCells();
+      cptr += 3 * iset->GetNumberOfCells();
     }
   }
 
-  double* weights = new double[maxCellSize];
-
-  float* cptr = center;
-  double dcenter[3];
+  this->UpdateSubOperationProgress(1.0);
+  return center;
+}
 
-  if (set)
+//------------------------------------------------------------------------------
+void vtkKdTree::ComputeCellCenters(
+  vtkDataSet* set, float* centers, vtkIdType progressOffset, vtkIdType progressTotal)
+{
+  const vtkIdType numberOfCells = set->GetNumberOfCells();
+  if (numberOfCells == 0)
   {
-    for (int j = 0; j < totalCells; j++)
-    {
-      this->ComputeCellCenter(set->GetCell(j), dcenter, weights);
+    return;
+  }
+
+  // Make the data set build its cells so that GetCell() is thread safe
+  vtkNew<vtkGenericCell> firstCell;
+  set->GetCell(0, firstCell);
+
+  const int maxCellSize = set->GetMaxCellSize();
+  vtkSMPThreadLocalObject<vtkGenericCell> cells;
+  vtkSMPThreadLocal<std::vector<double>> weights;
+  vtkSMPTools::For(0, numberOfCells, [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = cells.Local();
+    std::vector<double>& cellWeights = weights.Local();
+    cellWeights.resize(maxCellSize);
+    const bool isFirst = vtkSMPTools::GetSingleThread();
+    double dcenter[3];
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      set->GetCell(cellId, cell);
+      this->ComputeCellCenter(cell, dcenter, cellWeights.data());
+      float* cptr = centers + 3 * cellId;
       cptr[0] = static_cast<float>(dcenter[0]);
       cptr[1] = static_cast<float>(dcenter[1]);
       cptr[2] = static_cast<float>(dcenter[2]);
-      cptr += 3;
-      if (j % 1000 == 0)
-      {
-        this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-      }
-    }
-  }
-  else
-  {
-    vtkCollectionSimpleIterator cookie;
-    this->DataSets->InitTraversal(cookie);
-    for (vtkDataSet* iset = this->DataSets->GetNextDataSet(cookie); iset != nullptr;
-         iset = this->DataSets->GetNextDataSet(cookie))
-    {
-      int nCells = iset->GetNumberOfCells();
-
-      for (int j = 0; j < nCells; j++)
+      if (isFirst && cellId % 1000 == 0)
       {
-        this->ComputeCellCenter(iset->GetCell(j), dcenter, weights);
-        cptr[0] = static_cast<float>(dcenter[0]);
-        cptr[1] = static_cast<float>(dcenter[1]);
-        cptr[2] = static_cast<float>(dcenter[2]);
-        cptr += 3;
-        if (j % 1000 == 0)
-        {
-          this->UpdateSubOperationProgress(static_cast<double>(j) / totalCells);
-        }
+        this->UpdateSubOperationProgress(
+          static_cast<double>(progressOffset + cellId) / progressTotal);
       }
     }
-  }
-
-  delete[] weights;
-
-  this->UpdateSubOperationProgress(1.0);
-  return center;
+  });
 }
 
 //------------------------------------------------------------------------------
@@ -1255,13 +1439,77 @@ int vtkKdTree::DivideTest(int size, int level)
 }
 
 //------------------------------------------------------------------------------
+// Divide the regions level by level, the regions of a level being divided in
+// parallel. While there are fewer regions than threads, the large regions of
+// cell centers are rather divided one at a time with ParallelDivide(), the
+// order of the cell centers in a region being discarded after the build. The
+// points given with ids are always divided with Select(), so that the order
+// of the points in the regions does not depend on the number of threads.
 int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
+{
+  struct Region
+  {
+    vtkKdNode* Node;
+    float* Points;
+    int* Ids;
+  };
+
+  const int numberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  std::vector<float> scratch;
+  std::vector<Region> regions(1, Region{ kd, c1, ids });
+  for (; !regions.empty(); ++level)
+  {
+    if (!ids && static_cast<int>(regions.size()) < numberOfThreads)
+    {
+      for (const Region& region : regions)
+      {
+        float* regionScratch = nullptr;
+        if (region.Node->GetNumberOfPoints() >= ::ParallelDivideMinimumSize)
+        {
+          scratch.resize(3 * static_cast<std::size_t>(kd->GetNumberOfPoints()));
+          regionScratch = scratch.data();
+        }
+        this->DivideRegionOnce(region.Node, region.Points, nullptr, level, regionScratch);
+      }
+    }
+    else
+    {
+      vtkSMPTools::For(0, static_cast<vtkIdType>(regions.size()),
+        [&](vtkIdType begin, vtkIdType end) {
+          for (vtkIdType i = begin; i < end; ++i)
+          {
+            const Region& region = regions[i];
+            this->DivideRegionOnce(region.Node, region.Points, region.Ids, level, nullptr);
+          }
+        });
+    }
+
+    std::vector<Region> children;
+    for (const Region& region : regions)
+    {
+      if (region.Node->GetLeft() == nullptr)
+      {
+        continue; // unable to divide region further
+      }
+      int nleft = region.Node->GetLeft()->GetNumberOfPoints();
+      children.push_back(Region{ region.Node->GetLeft(), region.Points, region.Ids });
+      children.push_back(Region{ region.Node->GetRight(), region.Points + nleft * 3,
+        region.Ids ? region.Ids + nleft : nullptr });
+    }
+    regions.swap(children);
+  }
+
+  return 0;
+}
+
+//------------------------------------------------------------------------------
+void vtkKdTree::DivideRegionOnce(vtkKdNode* kd, float* c1, int* ids, int level, float* scratch)
 {
   int ok = this->DivideTest(kd->GetNumberOfPoints(), level);
 
   if (!ok)
   {
-    return 0;
+    return;
   }
 
   int maxdim = this->SelectCutDirection(kd);
@@ -1308,23 +1556,20 @@ int vtkKdTree::DivideRegion(vtkKdNode* kd, float* c1, int* ids, int level)
     }
   }
 
-  this->DoMedianFind(kd, c1, ids, dim1, dim2, dim3);
-
-  if (kd->GetLeft() == nullptr)
+  if (scratch)
   {
-    return 0; // unable to divide region further
+    for (int dim : { dim1, dim2, dim3 })
+    {
+      if (dim < 0 || ::ParallelDivide(kd, c1, scratch, dim))
+      {
+        break;
+      }
+    }
+  }
+  else
+  {
+    this->DoMedianFind(kd, c1, ids, dim1, dim2, dim3);
   }
-
-  int nleft = kd->GetLeft()->GetNumberOfPoints();
-
-  int* leftIds = ids;
-  int* rightIds = ids ? ids + nleft : nullptr;
-
-  this->DivideRegion(kd->GetLeft(), c1, leftIds, level + 1);
-
-  this->DivideRegion(kd->GetRight(), c1 + nleft * 3, rightIds, level + 1);
-
-  return 0;
 }
 
 //------------------------------------------------------------------------------
@@ -1850,24 +2095,26 @@ void vtkKdTree::BuildLocatorFromPoints(vtkPoints** ptArrays, int numPtArrays)
       // Hopefully point arrays are usually floats.  This conversion will
       // really slow things down.
 
-      for (vtkIdType ii = 0; ii < npoints; ii++)
-      {
-        double* pt = ptArrays[i]->GetPoint(ii);
+      vtkPoints* ptArray = ptArrays[i];
+      float* ptArrayPoints = points + ptId;
+      vtkSMPTools::For(0, npoints, [&](vtkIdType begin, vtkIdType end) {
+        double pt[3];
+        for (vtkIdType ii = begin; ii < end; ii++)
+        {
+          ptArray->GetPoint(ii, pt);
 
-        points[ptId++] = static_cast<float>(pt[0]);
-        points[ptId++] = static_cast<float>(pt[1]);
-        points[ptId++] = static_cast<float>(pt[2]);
-      }
+          ptArrayPoints[3 * ii] = static_cast<float>(pt[0]);
+          ptArrayPoints[3 * ii + 1] = static_cast<float>(pt[1]);
+          ptArrayPoints[3 * ii + 2] = static_cast<float>(pt[2]);
+        }
+      });
+      ptId += nvals;
     }
   }
 
-  for (ptId = 0; ptId < totalNumPoints; ptId++)
-  {
-    // Select_ dominates DivideRegion algorithm, operating on
-    // ints is much fast than operating on long longs
-
-    ptIds[ptId] = ptId;
-  }
+  // Select_ dominates DivideRegion algorithm, operating on
+  // ints is much fast than operating on long longs
+  std::iota(ptIds, ptIds + totalNumPoints, 0);
 
   TIMERDONE("Set up to build k-d tree");
 
@@ -4194,14 +4441,13 @@ int* vtkKdTree::AllGetRegionContainingCell()
 
     float* centers = this->ComputeCellCenters(iset);
 
-    float* pt = centers;
-
-    for (int cellId = 0; cellId < setCells; cellId++)
-    {
-      listPtr[cellId] = this->GetRegionContainingPoint(pt[0], pt[1], pt[2]);
-
-      pt += 3;
-    }
+    vtkSMPTools::For(0, setCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cellId = begin; cellId < end; cellId++)
+      {
+        const float* pt = centers + 3 * cellId;
+        listPtr[cellId] = this->GetRegionContainingPoint(pt[0], pt[1], pt[2]);
+      }
+    });
 
     listPtr += setCells;
 
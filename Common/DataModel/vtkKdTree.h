@@ -719,6 +719,14 @@ protected:
   float* ComputeCellCenters(int set);
   float* ComputeCellCenters(vtkDataSet* set);
 
+  /**
+   * Compute the cell centers of one data set into centers, in parallel.
+   * progressOffset and progressTotal place the cells of the data set in the
+   * progress of the enclosing ComputeCellCenters().
+   */
+  void ComputeCellCenters(
+    vtkDataSet* set, float* centers, vtkIdType progressOffset, vtkIdType progressTotal);
+
   vtkDataSetCollection* DataSets;
 
   /**
@@ -768,6 +776,10 @@ protected:
 
   int DivideRegion(vtkKdNode* kd, float* c1, int* ids, int nlevels);
 
+  // Divide a single region in two, without dividing its children. The median
+  // is found with vtkSMPTools if scratch, of the size of c1, is not nullptr.
+  void DivideRegionOnce(vtkKdNode* kd, float* c1, int* ids, int level, float* scratch);
+
   void DoMedianFind(vtkKdNode* kd, float* c1, int* ids, int d1, int d2, int d3);
 
   void SelfRegister(vtkKdNode* kd);
@@ -22,6 +22,7 @@
 #include "vtkTriangle.h"
 #include "vtkVector.h"
 
+#include <algorithm>
 #include <cmath>
 #include <functional>
 #include <map>
@@ -199,21 +200,14 @@ vtkPolyhedron::vtkPolyhedron()
   this->CellIds = vtkIdList::New();
   this->Cell = vtkGenericCell::New();
 
+  this->PointToIncidentFaces = nullptr;
   this->ValenceAtPoint = nullptr;
 }
 
 //------------------------------------------------------------------------------
 vtkPolyhedron::~vtkPolyhedron()
 {
-  if (this->ValenceAtPoint != nullptr)
-  {
-    delete this->ValenceAtPoint;
-    for (int i = 0; i < this->GetNumberOfPoints(); i++)
-    {
-      delete this->PointToIncidentFaces[i];
-    }
-    delete this->PointToIncidentFaces;
-  }
+  this->ClearPointToIncidentFacesAndValenceAtPoint();
   this->Line->Delete();
   this->Triangle->Delete();
   this->Quad->Delete();
@@ -356,6 +350,26 @@ void vtkPolyhedron::Initialize()
   // No supplemental geometric stuff created
   this->PolyDataConstructed = 0;
   this->LocatorConstructed = 0;
+
+  // The faces incident to the points have to be regenerated
+  this->ClearPointToIncidentFacesAndValenceAtPoint();
+
+  // The topology has to be bound again
+  this->Topology = nullptr;
+}
+
+//------------------------------------------------------------------------------
+bool vtkPolyhedron::BindTopology(vtkStaticPolyhedronTopology* topology, vtkIdType cellId)
+{
+  this->Topology = nullptr;
+  if (!topology || !topology->GetCellTopology(cellId, this->BoundTopology) ||
+    this->BoundTopology.NumberOfPoints != this->PointIds->GetNumberOfIds() ||
+    this->BoundTopology.NumberOfFaces != this->GlobalFaces->GetNumberOfCells())
+  {
+    return false;
+  }
+  this->Topology = topology;
+  return true;
 }
 
 //------------------------------------------------------------------------------
@@ -416,6 +430,20 @@ int vtkPolyhedron::GenerateEdges()
     return 0;
   }
 
+  // A bound topology already has the edges (but the edge table is left empty)
+  if (this->Topology)
+  {
+    const vtkIdType numEdges = this->BoundTopology.NumberOfEdges;
+    this->Edges->SetNumberOfTuples(numEdges);
+    this->EdgeFaces->SetNumberOfTuples(numEdges);
+    std::copy(this->BoundTopology.Edges, this->BoundTopology.Edges + 2 * numEdges,
+      this->Edges->GetPointer(0));
+    std::copy(this->BoundTopology.EdgeFaces, this->BoundTopology.EdgeFaces + 2 * numEdges,
+      this->EdgeFaces->GetPointer(0));
+    this->EdgesGenerated = 1;
+    return numEdges;
+  }
+
   vtkNew<vtkIdList> tmpface;
   vtkIdType nfaces = 0;
   const vtkIdType* face;
@@ -481,6 +509,22 @@ void vtkPolyhedron::GenerateFaces()
     return;
   }
 
+  // A bound topology already has the faces in canonical ids
+  if (this->Topology)
+  {
+    const vtkIdType numFaces = this->BoundTopology.NumberOfFaces;
+    const vtkIdType* offsets = this->BoundTopology.FaceOffsets;
+    this->Faces->Reset();
+    this->Faces->AllocateExact(numFaces, offsets[numFaces]);
+    for (vtkIdType faceId = 0; faceId < numFaces; ++faceId)
+    {
+      this->Faces->InsertNextCell(offsets[faceId + 1] - offsets[faceId],
+        this->BoundTopology.FaceConnectivity + offsets[faceId]);
+    }
+    this->FacesGenerated = 1;
+    return;
+  }
+
   // Basically we just run through the faces and change the global ids to the
   // canonical ids using the PointIdMap.
   this->Faces->DeepCopy(this->GlobalFaces);
@@ -846,6 +890,11 @@ int vtkPolyhedron::IsInside(const double x[3], double tolerance)
 // December 1998, Pages 187 - 208.
 bool vtkPolyhedron::IsConvex()
 {
+  if (this->Topology)
+  {
+    return (this->BoundTopology.Flags & vtkStaticPolyhedronTopology::CONVEX) != 0;
+  }
+
   double x[2][3], n[3], c[3], c0[3], c1[3], c0p[3], c1p[3], n0[3], n1[3];
   double np[3], tmp0, tmp1;
   vtkIdType i, w[2], edgeId, edgeFaces[2], v, r = 0;
@@ -1347,10 +1396,28 @@ int vtkPolyhedron::TriangulateFaces(vtkCellArray* newFaces)
   return 1;
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyhedron::ClearPointToIncidentFacesAndValenceAtPoint()
+{
+  if (this->ValenceAtPoint != nullptr)
+  {
+    delete[] this->ValenceAtPoint;
+    for (vtkIdType i = 0; i < this->NumberOfPointsWithValence; i++)
+    {
+      delete[] this->PointToIncidentFaces[i];
+    }
+    delete[] this->PointToIncidentFaces;
+    this->ValenceAtPoint = nullptr;
+    this->PointToIncidentFaces = nullptr;
+    this->NumberOfPointsWithValence = 0;
+  }
+}
+
 //------------------------------------------------------------------------------
 void vtkPolyhedron::GeneratePointToIncidentFacesAndValenceAtPoint()
 {
   // Allocate memory
+  this->NumberOfPointsWithValence = this->GetNumberOfPoints();
   this->PointToIncidentFaces = new vtkIdType*[this->GetNumberOfPoints()];
   this->ValenceAtPoint = new vtkIdType[this->GetNumberOfPoints()];
   // Add the faces that hold each cell local point id
@@ -1386,6 +1453,12 @@ void vtkPolyhedron::GeneratePointToIncidentFacesAndValenceAtPoint()
 vtkIdType vtkPolyhedron::GetPointToIncidentFaces(vtkIdType pointId, const vtkIdType*& faceIds)
 {
   assert(pointId < this->GetNumberOfPoints() && "pointId too large");
+  if (this->Topology)
+  {
+    const vtkIdType* offsets = this->BoundTopology.PointFaceOffsets;
+    faceIds = this->BoundTopology.PointFaces + offsets[pointId];
+    return offsets[pointId + 1] - offsets[pointId];
+  }
   if (this->ValenceAtPoint == nullptr)
   {
     this->GeneratePointToIncidentFacesAndValenceAtPoint();
@@ -1757,6 +1830,7 @@ bool CheckNonManifoldTriangulation(EdgeFaceSetMap& edgeFaceMap)
 
 bool GetContourPoints(double value, vtkPolyhedron* cell,
   vtkPolyhedron::vtkPointIdMap* pointIdMap, // from global id to local cell id
+  const vtkStaticPolyhedronTopology::CellTopology* topology, // nullptr if unbound
   FaceEdgesVector& faceEdgesVector, EdgeFaceSetMap& edgeFaceMap, EdgeSet& originalEdges,
   std::vector<std::vector<vtkIdType>>& oririginalFaceTriFaceMap,
   PointIndexEdgeMultiMap& contourPointEdgeMultiMap, EdgePointIndexMap& edgeContourPointMap,
@@ -1770,30 +1844,56 @@ bool GetContourPoints(double value, vtkPolyhedron* cell,
   // that will be contoured.
   FaceVector faces;
 
-  if (!CheckWatertightNonManifoldPolyhedron(cell, originalEdges))
+  if (topology && (topology->Flags & vtkStaticPolyhedronTopology::WATERTIGHT))
   {
-    return false;
+    // the edges and the triangulated faces are read from the bound topology,
+    // where they are in canonical id space.
+    vtkIdList* pointIds = cell->GetPointIds();
+    for (vtkIdType i = 0; i < topology->NumberOfEdges; ++i)
+    {
+      const vtkIdType* edge = topology->Edges + 2 * i;
+      originalEdges.insert(Edge(pointIds->GetId(edge[0]), pointIds->GetId(edge[1])));
+    }
+    for (vtkIdType i = 0; i < nFaces; ++i)
+    {
+      std::vector<vtkIdType> trisOfFace;
+      for (vtkIdType j = topology->TriangleOffsets[i]; j < topology->TriangleOffsets[i + 1]; ++j)
+      {
+        const vtkIdType* tri = topology->Triangles + 3 * j;
+        trisOfFace.push_back(static_cast<vtkIdType>(faces.size()));
+        faces.push_back(
+          Face{ pointIds->GetId(tri[0]), pointIds->GetId(tri[1]), pointIds->GetId(tri[2]) });
+      }
+      oririginalFaceTriFaceMap.push_back(trisOfFace);
+    }
   }
-
-  // temporaries for triangulation
-  vtkNew<vtkIdList> triIds;
-
-  for (vtkIdType i = 0; i < nFaces; ++i)
+  else
   {
-    vtkCell* face = cell->GetFace(i);
-    if (!face)
+    if (!CheckWatertightNonManifoldPolyhedron(cell, originalEdges))
     {
       return false;
     }
 
-    size_t nTris = faces.size();
-    TriangulateFace(face, faces, triIds, cell->GetPoints(), pointIdMap);
-    std::vector<vtkIdType> trisOfFace;
-    for (size_t j = nTris; j < faces.size(); ++j)
+    // temporaries for triangulation
+    vtkNew<vtkIdList> triIds;
+
+    for (vtkIdType i = 0; i < nFaces; ++i)
     {
-      trisOfFace.push_back((vtkIdType)j);
+      vtkCell* face = cell->GetFace(i);
+      if (!face)
+      {
+        return false;
+      }
+
+      size_t nTris = faces.size();
+      TriangulateFace(face, faces, triIds, cell->GetPoints(), pointIdMap);
+      std::vector<vtkIdType> trisOfFace;
+      for (size_t j = nTris; j < faces.size(); ++j)
+      {
+        trisOfFace.push_back((vtkIdType)j);
+      }
+      oririginalFaceTriFaceMap.push_back(trisOfFace);
     }
-    oririginalFaceTriFaceMap.push_back(trisOfFace);
   }
 
   // because of the triangulation performed above,
@@ -2010,6 +2110,31 @@ int CreateContours(EdgeFaceSetMap& edgeFaceMap, FaceEdgesVector& faceEdgesVector
   return EXIT_SUCCESS;
 }
 
+//------------------------------------------------------------------------------
+void vtkPolyhedron::TriangulateContourFaces(vtkIdList* offsets, vtkIdList* triangles)
+{
+  offsets->Reset();
+  triangles->Reset();
+  offsets->InsertNextId(0);
+
+  FaceVector faces;
+  vtkNew<vtkIdList> triIds;
+  const int nFaces = this->GetNumberOfFaces();
+  for (int i = 0; i < nFaces; ++i)
+  {
+    faces.clear();
+    TriangulateFace(this->GetFace(i), faces, triIds, this->Points, this->PointIdMap);
+    for (const Face& tri : faces)
+    {
+      for (vtkIdType globalId : tri)
+      {
+        triangles->InsertNextId(this->PointIdMap->find(globalId)->second);
+      }
+    }
+    offsets->InsertNextId(triangles->GetNumberOfIds() / 3);
+  }
+}
+
 void vtkPolyhedron::Contour(double value, vtkDataArray* pointScalars,
   vtkIncrementalPointLocator* locator, vtkCellArray* verts, vtkCellArray* lines,
   vtkCellArray* polys, vtkPointData* inPd, vtkPointData* outPd, vtkCellData* inCd, vtkIdType cellId,
@@ -2023,9 +2148,10 @@ void vtkPolyhedron::Contour(double value, vtkDataArray* pointScalars,
   EdgeSet originalEdges;
   std::vector<std::vector<vtkIdType>> oririginalFaceTriFaceMap;
 
-  if (!GetContourPoints(value, this, this->PointIdMap, faceEdgesVector, edgeFaceMap, originalEdges,
-        oririginalFaceTriFaceMap, contourPointEdgeMultiMap, edgeContourPointMap, pointLocationMap,
-        locator, pointScalars, inPd, outPd))
+  if (!GetContourPoints(value, this, this->PointIdMap,
+        this->Topology ? &this->BoundTopology : nullptr, faceEdgesVector, edgeFaceMap,
+        originalEdges, oririginalFaceTriFaceMap, contourPointEdgeMultiMap, edgeContourPointMap,
+        pointLocationMap, locator, pointScalars, inPd, outPd))
   {
     return;
   }
@@ -2396,9 +2522,10 @@ void vtkPolyhedron::Clip(double value, vtkDataArray* pointScalars,
   EdgeSet originalEdges;
   std::vector<std::vector<vtkIdType>> oririginalFaceTriFaceMap;
 
-  if (!GetContourPoints(value, this, this->PointIdMap, faceEdgesVector, edgeFaceMap, originalEdges,
-        oririginalFaceTriFaceMap, contourPointEdgeMultiMap, edgeContourPointMap, pointLocationMap,
-        locator, pointScalars, inPd, outPd))
+  if (!GetContourPoints(value, this, this->PointIdMap,
+        this->Topology ? &this->BoundTopology : nullptr, faceEdgesVector, edgeFaceMap,
+        originalEdges, oririginalFaceTriFaceMap, contourPointEdgeMultiMap, edgeContourPointMap,
+        pointLocationMap, locator, pointScalars, inPd, outPd))
   {
     return;
   }
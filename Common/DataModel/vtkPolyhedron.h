@@ -121,7 +121,9 @@
 #define vtkPolyhedron_h
 
 #include "vtkCell3D.h"
-#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkCommonDataModelModule.h"    // For export macro
+#include "vtkSmartPointer.h"             // For vtkSmartPointer
+#include "vtkStaticPolyhedronTopology.h" // For CellTopology
 
 VTK_ABI_NAMESPACE_BEGIN
 class vtkIdTypeArray;
@@ -434,6 +436,25 @@ public:
    */
   vtkPolyData* GetPolyData();
 
+  /**
+   * Bind this polyhedron to the topology of the cell cellId stored in a
+   * vtkStaticPolyhedronTopology. The faces, edges, incident faces of the
+   * points, convexity and contouring triangulation of the polyhedron are then
+   * read from it instead of being derived. This method must be called after
+   * Initialize(), which releases the binding, and the topology must have been
+   * built from the points and faces the polyhedron was initialized with.
+   * Return false (and leave the polyhedron unbound) if the cell is not a
+   * polyhedron of the topology or does not match this polyhedron.
+   * vtkUnstructuredGrid::GetCell() binds the polyhedra it returns to the
+   * topology built by vtkUnstructuredGrid::BuildPolyhedronTopology().
+   */
+  bool BindTopology(vtkStaticPolyhedronTopology* topology, vtkIdType cellId);
+
+  /**
+   * Return the topology this polyhedron is bound to, or nullptr.
+   */
+  vtkStaticPolyhedronTopology* GetTopology() { return this->Topology; }
+
 protected:
   vtkPolyhedron();
   ~vtkPolyhedron() override;
@@ -482,6 +503,7 @@ protected:
   void ComputePositionFromParametricCoordinate(const double pc[3], double x[3]);
 
   void GeneratePointToIncidentFacesAndValenceAtPoint();
+  void ClearPointToIncidentFacesAndValenceAtPoint();
 
   // Members for supporting geometric operations
   int PolyDataConstructed;
@@ -496,12 +518,22 @@ protected:
   // Members used in GetPointToIncidentFaces
   vtkIdType** PointToIncidentFaces;
   vtkIdType* ValenceAtPoint;
+  vtkIdType NumberOfPointsWithValence = 0;
+
+  // The topology bound with BindTopology(), released by Initialize()
+  vtkSmartPointer<vtkStaticPolyhedronTopology> Topology;
+  vtkStaticPolyhedronTopology::CellTopology BoundTopology;
+
+  // Triangulate the faces the way Contour() and Clip() do. The triangles of
+  // face i, in canonical ids, are [offsets[i], offsets[i+1]) in triangles.
+  void TriangulateContourFaces(vtkIdList* offsets, vtkIdList* triangles);
 
 private:
   vtkPolyhedron(const vtkPolyhedron&) = delete;
   void operator=(const vtkPolyhedron&) = delete;
 
   friend class vtkPolyhedronUtilities;
+  friend class vtkStaticPolyhedronTopology;
 };
 
 //----------------------------------------------------------------------------
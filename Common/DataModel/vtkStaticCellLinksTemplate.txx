@@ -209,21 +209,19 @@ struct BuildLinks
   template <typename CellStateT, typename TIds>
   void operator()(CellStateT& state, TIds* linkOffsets, TIds* links, vtkIdType idOffset = 0)
   {
-    using ValueType = typename CellStateT::ValueType;
-
     const vtkIdType numCells = state.GetNumberOfCells();
 
     const auto cellConnectivity = vtk::DataArrayValueRange<1>(state.GetConnectivity());
-    const auto cellOffsets = vtk::DataArrayValueRange<1>(state.GetOffsets());
     // Now build the links. The summation from the prefix sum indicates where
     // the cells are to be inserted. Each time a cell is inserted, the offset
     // is decremented. In the end, the offset array is also constructed as it
     // points to the beginning of each cell run.
-    ValueType ptIdOffset;
+    vtkIdType ptIdOffset;
     size_t ptId;
     for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
     {
-      for (ptIdOffset = cellOffsets[cellId]; ptIdOffset < cellOffsets[cellId + 1]; ++ptIdOffset)
+      const vtkIdType endOffset = state.GetEndOffset(cellId);
+      for (ptIdOffset = state.GetBeginOffset(cellId); ptIdOffset < endOffset; ++ptIdOffset)
       {
         ptId = static_cast<size_t>(cellConnectivity[ptIdOffset]);
         --linkOffsets[ptId];
@@ -240,20 +238,18 @@ struct BuildLinksThreaded
   void operator()(CellStateT& state, const TIds* offsets, std::atomic<TIds>* counts, TIds* links,
     vtkIdType beginCellId, vtkIdType endCellId, const TIds idOffset = 0)
   {
-    using ValueType = typename CellStateT::ValueType;
-
     const auto cellConnectivity = vtk::DataArrayValueRange<1>(state.GetConnectivity());
-    const auto cellOffsets = vtk::DataArrayValueRange<1>(state.GetOffsets());
     // Now build the links. The summation from the prefix sum indicates where
     // the cells are to be inserted. Each time a cell is inserted, the offset
     // is decremented. In the end, the offset array is also constructed as it
     // points to the beginning of each cell run.
-    ValueType ptIdOffset;
+    vtkIdType ptIdOffset;
     size_t ptId;
     TIds offset;
     for (vtkIdType cellId = beginCellId; cellId < endCellId; ++cellId)
     {
-      for (ptIdOffset = cellOffsets[cellId]; ptIdOffset < cellOffsets[cellId + 1]; ++ptIdOffset)
+      const vtkIdType endOffset = state.GetEndOffset(cellId);
+      for (ptIdOffset = state.GetBeginOffset(cellId); ptIdOffset < endOffset; ++ptIdOffset)
       {
         ptId = static_cast<size_t>(cellConnectivity[ptIdOffset]);
         // memory_order_relaxed is safe here, since we're not using the atomics for synchronization.
@@ -417,15 +413,9 @@ void vtkStaticCellLinksTemplate<TIds>::ThreadedBuildLinksFromMultipleArrays(
   }
 
   // Perform prefix sum to determine offsets
-  vtkIdType ptId, npts;
   this->OffsetsSharedPtr.reset(new TIds[numPts + 1], std::default_delete<TIds[]>());
   this->Offsets = this->OffsetsSharedPtr.get();
-  this->Offsets[0] = 0;
-  for (ptId = 1; ptId < numPts; ++ptId)
-  {
-    npts = counts[ptId - 1].load(std::memory_order_relaxed);
-    this->Offsets[ptId] = this->Offsets[ptId - 1] + npts;
-  }
+  vtkSMPTools::ExclusiveScan(counts, counts + numPts, this->Offsets, static_cast<TIds>(0));
   this->Offsets[numPts] = this->LinksSize;
 
   // Now insert cell ids into cell links.
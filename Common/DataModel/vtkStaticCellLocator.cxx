@@ -198,15 +198,16 @@ struct vtkCellBinner
   void Reduce()
   {
     // Perform prefix sum
-    vtkIdType* counts = this->Counts;
-    vtkIdType numBins, total = 0, numCells = this->NumCells;
-    for (vtkIdType i = 0; i < numCells; ++i)
+    vtkIdType numCells = this->NumCells;
+    if (numCells <= 0)
     {
-      numBins = *counts;
-      *counts++ = total;
-      total += numBins;
+      this->NumFragments = 0;
+      return;
     }
-    this->NumFragments = total;
+    const vtkIdType lastCount = this->Counts[numCells - 1];
+    vtkSMPTools::ExclusiveScan(
+      this->Counts, this->Counts + numCells, this->Counts, static_cast<vtkIdType>(0));
+    this->NumFragments = this->Counts[numCells - 1] + lastCount;
   }
 
 }; // vtkCellBinner
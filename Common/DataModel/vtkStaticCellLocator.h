@@ -183,6 +183,11 @@ public:
   void FindCellsAlongPlane(
     const double o[3], const double n[3], double tolerance, vtkIdList* cells) override;
 
+  /**
+   * Return true: FindCell() is thread safe.
+   */
+  bool SupportsThreadSafeFindCell() override { return true; }
+
   /**
    * Find the cell containing a given point. returns -1 if no cell found
    * the cell parameters are copied into the supplied variables, a cell must
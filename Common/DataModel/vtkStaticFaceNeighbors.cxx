@@ -0,0 +1,464 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkStaticFaceNeighbors.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellTypes.h"
+#include "vtkGenericCell.h"
+#include "vtkHexagonalPrism.h"
+#include "vtkHexahedron.h"
+#include "vtkIdList.h"
+#include "vtkObjectFactory.h"
+#include "vtkPentagonalPrism.h"
+#include "vtkPyramid.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkTetra.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkVoxel.h"
+#include "vtkWedge.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <tuple>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkStaticFaceNeighbors);
+
+//------------------------------------------------------------------------------
+// The faces of all the cells are gathered, each one being identified by a
+// key made of its three smallest point ids, its number of points and the sum
+// of its point ids. The 2D cells are gathered as well, as a single face, so
+// that they are counted among the neighbors of the faces they match. The keys
+// are sorted in parallel, so that the faces made of the same points end up
+// next to each other, and the runs of identical keys are then matched in
+// parallel. The key identifies the faces of up to four points exactly: the
+// points of the larger faces are compared to confirm a match.
+namespace
+{
+constexpr int MaxLinearCellSize = 12; // the hexagonal prism
+constexpr int MaxLinearFaceSize = 6;  // the hexagonal prism hexagons
+
+//------------------------------------------------------------------------------
+// The faces of a linear 3D cell type, with a fixed number of faces.
+struct LinearFaces
+{
+  vtkIdType NumberOfFaces;
+  vtkIdType MaximumFaceSize;
+  const vtkIdType* (*GetFaceArray)(vtkIdType);
+
+  // Gather the points of a face from the points of the cell. The face arrays
+  // of the cells with faces of different sizes are terminated by -1.
+  vtkIdType GetFacePoints(vtkIdType faceId, const vtkIdType* cellPts, vtkIdType* facePts) const
+  {
+    const vtkIdType* localIds = this->GetFaceArray(faceId);
+    vtkIdType npts = 0;
+    for (; npts < this->MaximumFaceSize && localIds[npts] >= 0; ++npts)
+    {
+      facePts[npts] = cellPts[localIds[npts]];
+    }
+    return npts;
+  }
+};
+
+//------------------------------------------------------------------------------
+template <typename TCell>
+LinearFaces MakeLinearFaces()
+{
+  return LinearFaces{ TCell::NumberOfFaces, TCell::MaximumFaceSize, &TCell::GetFaceArray };
+}
+
+//------------------------------------------------------------------------------
+bool GetLinearFaces(unsigned char cellType, LinearFaces& faces)
+{
+  switch (cellType)
+  {
+    case VTK_TETRA:
+      faces = MakeLinearFaces<vtkTetra>();
+      return true;
+    case VTK_VOXEL:
+      faces = MakeLinearFaces<vtkVoxel>();
+      return true;
+    case VTK_HEXAHEDRON:
+      faces = MakeLinearFaces<vtkHexahedron>();
+      return true;
+    case VTK_WEDGE:
+      faces = MakeLinearFaces<vtkWedge>();
+      return true;
+    case VTK_PYRAMID:
+      faces = MakeLinearFaces<vtkPyramid>();
+      return true;
+    case VTK_PENTAGONAL_PRISM:
+      faces = MakeLinearFaces<vtkPentagonalPrism>();
+      return true;
+    case VTK_HEXAGONAL_PRISM:
+      faces = MakeLinearFaces<vtkHexagonalPrism>();
+      return true;
+    default:
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Whether two lists of npts distinct points are made of the same points.
+bool SamePoints(vtkIdType npts, const vtkIdType* pts, const vtkIdType* otherPts)
+{
+  for (vtkIdType i = 0; i < npts; ++i)
+  {
+    if (std::find(otherPts, otherPts + npts, pts[i]) == otherPts + npts)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// A face of a 3D cell (FaceId >= 0) or a 2D cell (FaceId == -1).
+struct FaceKey
+{
+  vtkIdType Min[3]; // the three smallest point ids, padded with -1
+  vtkIdType NumberOfPoints;
+  uint64_t Sum; // the sum of the point ids
+  vtkIdType CellId;
+  vtkIdType FaceId;
+
+  bool SameKey(const FaceKey& other) const
+  {
+    return this->Min[0] == other.Min[0] && this->Min[1] == other.Min[1] &&
+      this->Min[2] == other.Min[2] && this->NumberOfPoints == other.NumberOfPoints &&
+      this->Sum == other.Sum;
+  }
+
+  bool operator<(const FaceKey& other) const
+  {
+    if (!this->SameKey(other))
+    {
+      return std::tie(this->Min[0], this->Min[1], this->Min[2], this->NumberOfPoints, this->Sum) <
+        std::tie(other.Min[0], other.Min[1], other.Min[2], other.NumberOfPoints, other.Sum);
+    }
+    return this->CellId < other.CellId ||
+      (this->CellId == other.CellId && this->FaceId < other.FaceId);
+  }
+};
+
+//------------------------------------------------------------------------------
+// Visit the faces of the cells, with thread local buffers.
+struct FaceGatherer
+{
+  vtkSmartPointer<vtkIdList> Points;
+  vtkSmartPointer<vtkIdList> FaceIds;
+  std::vector<vtkIdType> Sorted;
+
+  void Initialize()
+  {
+    if (!this->Points)
+    {
+      this->Points = vtkSmartPointer<vtkIdList>::New();
+      this->FaceIds = vtkSmartPointer<vtkIdList>::New();
+    }
+  }
+
+  // Return the number of faces visited by ForEachFace().
+  static vtkIdType CountFaces(vtkUnstructuredGrid* grid, vtkIdType cellId, vtkGenericCell* cell)
+  {
+    const unsigned char cellType = static_cast<unsigned char>(grid->GetCellType(cellId));
+    const int dimension = vtkCellTypes::GetDimension(cellType);
+    LinearFaces faces;
+    if (dimension == 2)
+    {
+      return 1;
+    }
+    else if (dimension != 3)
+    {
+      return 0;
+    }
+    else if (GetLinearFaces(cellType, faces))
+    {
+      return faces.NumberOfFaces;
+    }
+    else if (cellType == VTK_POLYHEDRON)
+    {
+      vtkCellArray* faceLocations = grid->GetPolyhedronFaceLocations();
+      return faceLocations ? faceLocations->GetCellSize(cellId) : 0;
+    }
+    grid->GetCell(cellId, cell);
+    return cell->GetNumberOfFaces();
+  }
+
+  // Call func(faceId, npts, pts) for each face of a 3D cell, or once with a
+  // faceId of -1 for a 2D cell.
+  template <typename TFunc>
+  void ForEachFace(vtkUnstructuredGrid* grid, vtkIdType cellId, vtkGenericCell* cell, TFunc&& func)
+  {
+    const unsigned char cellType = static_cast<unsigned char>(grid->GetCellType(cellId));
+    const int dimension = vtkCellTypes::GetDimension(cellType);
+    LinearFaces faces;
+    if (dimension == 2)
+    {
+      grid->GetCells()->GetCellAtId(cellId, this->Points);
+      func(-1, this->Points->GetNumberOfIds(), this->Points->GetPointer(0));
+    }
+    else if (dimension != 3)
+    {
+      return;
+    }
+    else if (GetLinearFaces(cellType, faces))
+    {
+      vtkIdType numCellPts;
+      vtkIdType cellPts[MaxLinearCellSize] = {};
+      vtkIdType facePts[MaxLinearFaceSize];
+      grid->GetCells()->GetCellAtId(cellId, this->Points);
+      numCellPts = std::min<vtkIdType>(this->Points->GetNumberOfIds(), MaxLinearCellSize);
+      std::copy_n(this->Points->GetPointer(0), numCellPts, cellPts);
+      for (vtkIdType faceId = 0; faceId < faces.NumberOfFaces; ++faceId)
+      {
+        func(faceId, faces.GetFacePoints(faceId, cellPts, facePts), facePts);
+      }
+    }
+    else if (cellType == VTK_POLYHEDRON)
+    {
+      vtkCellArray* faceLocations = grid->GetPolyhedronFaceLocations();
+      vtkCellArray* polyFaces = grid->GetPolyhedronFaces();
+      if (!faceLocations || !polyFaces)
+      {
+        return;
+      }
+      faceLocations->GetCellAtId(cellId, this->FaceIds);
+      for (vtkIdType faceId = 0; faceId < this->FaceIds->GetNumberOfIds(); ++faceId)
+      {
+        polyFaces->GetCellAtId(this->FaceIds->GetId(faceId), this->Points);
+        func(faceId, this->Points->GetNumberOfIds(), this->Points->GetPointer(0));
+      }
+    }
+    else
+    {
+      grid->GetCell(cellId, cell);
+      for (vtkIdType faceId = 0, numFaces = cell->GetNumberOfFaces(); faceId < numFaces; ++faceId)
+      {
+        vtkCell* face = cell->GetFace(static_cast<int>(faceId));
+        func(faceId, face->GetNumberOfPoints(), face->GetPointIds()->GetPointer(0));
+      }
+    }
+  }
+
+  FaceKey MakeKey(vtkIdType cellId, vtkIdType faceId, vtkIdType npts, const vtkIdType* pts)
+  {
+    FaceKey key;
+    key.NumberOfPoints = npts;
+    key.CellId = cellId;
+    key.FaceId = faceId;
+    key.Sum = 0;
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      key.Sum += static_cast<uint64_t>(pts[i]);
+    }
+    this->Sorted.assign(pts, pts + npts);
+    const vtkIdType numMin = std::min<vtkIdType>(npts, 3);
+    std::partial_sort(this->Sorted.begin(), this->Sorted.begin() + numMin, this->Sorted.end());
+    for (vtkIdType i = 0; i < 3; ++i)
+    {
+      key.Min[i] = i < numMin ? this->Sorted[i] : -1;
+    }
+    return key;
+  }
+
+  // Gather the sorted points of a face.
+  void GetSortedFacePoints(vtkUnstructuredGrid* grid, const FaceKey& key, vtkGenericCell* cell,
+    std::vector<vtkIdType>& facePts)
+  {
+    this->ForEachFace(grid, key.CellId, cell,
+      [&](vtkIdType faceId, vtkIdType npts, const vtkIdType* pts) {
+        if (faceId == key.FaceId)
+        {
+          facePts.assign(pts, pts + npts);
+        }
+      });
+    std::sort(facePts.begin(), facePts.end());
+  }
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkStaticFaceNeighbors::BuildNeighbors(vtkUnstructuredGrid* grid)
+{
+  this->Reset();
+  const vtkIdType numCells = grid->GetNumberOfCells();
+
+  // Count the faces of the 3D cells, and the faces to sort (including the 2D cells).
+  this->Offsets.assign(numCells + 1, 0);
+  std::vector<vtkIdType> keyOffsets(numCells + 1, 0);
+  vtkSMPThreadLocalObject<vtkGenericCell> tlCell;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkGenericCell* cell = tlCell.Local();
+    for (; cellId < endCellId; ++cellId)
+    {
+      const vtkIdType numFaces = FaceGatherer::CountFaces(grid, cellId, cell);
+      keyOffsets[cellId + 1] = numFaces;
+      if (vtkCellTypes::GetDimension(static_cast<unsigned char>(grid->GetCellType(cellId))) == 3)
+      {
+        this->Offsets[cellId + 1] = numFaces;
+      }
+    }
+  });
+  std::partial_sum(this->Offsets.begin(), this->Offsets.end(), this->Offsets.begin());
+  std::partial_sum(keyOffsets.begin(), keyOffsets.end(), keyOffsets.begin());
+  this->Neighbors.resize(this->Offsets[numCells]);
+
+  // Gather and sort the faces
+  const vtkIdType numKeys = keyOffsets[numCells];
+  std::vector<FaceKey> keys(numKeys);
+  vtkSMPThreadLocal<FaceGatherer> tlGatherer;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType cellId, vtkIdType endCellId) {
+    vtkGenericCell* cell = tlCell.Local();
+    FaceGatherer& gatherer = tlGatherer.Local();
+    gatherer.Initialize();
+    for (; cellId < endCellId; ++cellId)
+    {
+      FaceKey* key = keys.data() + keyOffsets[cellId];
+      gatherer.ForEachFace(grid, cellId, cell,
+        [&](vtkIdType faceId, vtkIdType npts, const vtkIdType* pts) {
+          *key++ = gatherer.MakeKey(cellId, faceId, npts, pts);
+        });
+    }
+  });
+  keyOffsets.clear();
+  keyOffsets.shrink_to_fit();
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+
+  // Match the faces of each run of identical keys. A run is processed by the
+  // thread owning its first face.
+  vtkSMPTools::For(0, numKeys, [&](vtkIdType begin, vtkIdType end) {
+    vtkGenericCell* cell = tlCell.Local();
+    FaceGatherer& gatherer = tlGatherer.Local();
+    gatherer.Initialize();
+    std::vector<std::vector<vtkIdType>> runPoints;
+    vtkIdType runBegin = begin;
+    while (runBegin > 0 && runBegin < end && keys[runBegin].SameKey(keys[runBegin - 1]))
+    {
+      ++runBegin;
+    }
+    while (runBegin < end)
+    {
+      vtkIdType runEnd = runBegin + 1;
+      while (runEnd < numKeys && keys[runEnd].SameKey(keys[runBegin]))
+      {
+        ++runEnd;
+      }
+      const FaceKey* run = keys.data() + runBegin;
+      const vtkIdType runSize = runEnd - runBegin;
+      const bool exactKey = run[0].NumberOfPoints <= 4;
+      if (!exactKey && runSize > 1)
+      {
+        runPoints.resize(runSize);
+        for (vtkIdType i = 0; i < runSize; ++i)
+        {
+          gatherer.GetSortedFacePoints(grid, run[i], cell, runPoints[i]);
+        }
+      }
+      for (vtkIdType i = 0; i < runSize; ++i)
+      {
+        if (run[i].FaceId < 0)
+        {
+          continue;
+        }
+        // The faces of a run are sorted by cell, so a cell using the face
+        // several times is only counted once.
+        vtkIdType numNeighbors = 0;
+        vtkIdType neighbor = BOUNDARY_FACE;
+        for (vtkIdType j = 0; j < runSize; ++j)
+        {
+          if (run[j].CellId != run[i].CellId && run[j].CellId != neighbor &&
+            (exactKey || runPoints[i] == runPoints[j]))
+          {
+            ++numNeighbors;
+            neighbor = run[j].CellId;
+          }
+        }
+        this->Neighbors[this->Offsets[run[i].CellId] + run[i].FaceId] =
+          numNeighbors > 1 ? static_cast<vtkIdType>(MULTIPLE_NEIGHBORS) : neighbor;
+      }
+      runBegin = runEnd;
+    }
+  });
+
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticFaceNeighbors::Reset()
+{
+  this->Offsets.clear();
+  this->Offsets.shrink_to_fit();
+  this->Neighbors.clear();
+  this->Neighbors.shrink_to_fit();
+}
+
+//------------------------------------------------------------------------------
+vtkIdType vtkStaticFaceNeighbors::FindCellFace(
+  vtkUnstructuredGrid* grid, vtkIdType cellId, vtkIdType npts, const vtkIdType* pts)
+{
+  const unsigned char cellType = static_cast<unsigned char>(grid->GetCellType(cellId));
+  LinearFaces faces;
+  if (GetLinearFaces(cellType, faces))
+  {
+    vtkCellArray* cells = grid->GetCells();
+    if (npts > faces.MaximumFaceSize || cells->GetCellSize(cellId) > MaxLinearCellSize)
+    {
+      return -1;
+    }
+    vtkIdType numCellPts;
+    vtkIdType cellPts[MaxLinearCellSize] = {};
+    vtkIdType facePts[MaxLinearFaceSize];
+    cells->GetCellAtId(cellId, numCellPts, cellPts);
+    for (vtkIdType faceId = 0; faceId < faces.NumberOfFaces; ++faceId)
+    {
+      if (faces.GetFacePoints(faceId, cellPts, facePts) == npts &&
+        SamePoints(npts, pts, facePts))
+      {
+        return faceId;
+      }
+    }
+  }
+  else if (cellType == VTK_POLYHEDRON && grid->GetPolyhedronFaces())
+  {
+    vtkCellArray* faceLocations = grid->GetPolyhedronFaceLocations();
+    vtkCellArray* polyFaces = grid->GetPolyhedronFaces();
+    vtkIdType numFaces, numFacePts;
+    std::vector<vtkIdType> faceIds(faceLocations->GetCellSize(cellId));
+    std::vector<vtkIdType> facePts(npts);
+    faceLocations->GetCellAtId(cellId, numFaces, faceIds.data());
+    for (vtkIdType faceId = 0; faceId < numFaces; ++faceId)
+    {
+      if (polyFaces->GetCellSize(faceIds[faceId]) == npts)
+      {
+        polyFaces->GetCellAtId(faceIds[faceId], numFacePts, facePts.data());
+        if (SamePoints(npts, pts, facePts.data()))
+        {
+          return faceId;
+        }
+      }
+    }
+  }
+  return -1;
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkStaticFaceNeighbors::GetActualMemorySize()
+{
+  const size_t size = (this->Offsets.capacity() + this->Neighbors.capacity()) * sizeof(vtkIdType);
+  return static_cast<unsigned long>(size / 1024);
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticFaceNeighbors::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Number Of Cells: " << this->GetNumberOfCells() << "\n";
+  os << indent << "Number Of Faces: " << this->GetNumberOfFaces() << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,146 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkStaticFaceNeighbors
+ * @brief   the cells across each face of the 3D cells of an unstructured grid
+ *
+ * vtkStaticFaceNeighbors is a supplemental object to vtkUnstructuredGrid
+ * storing, for each face of each 3D cell, the other cell using the same face.
+ * It is built once (statically), in parallel, by sorting all the faces of the
+ * grid, and must be rebuilt if the cells change. Polyhedra are supported, as
+ * well as nonlinear cells (whose faces are then obtained from their
+ * vtkGenericCell representation).
+ *
+ * The faces of a cell are numbered as in vtkCell::GetFace(); for polyhedra,
+ * in the order of vtkUnstructuredGrid::GetPolyhedronFaceLocations(). Two
+ * faces match if they are made of the same points, in any order. A face is
+ * also matched with the 2D cells made of the same points, so that the
+ * neighbors of a face are exactly the cells using all of its points, assuming
+ * the cells only share points through common faces. A face used by a single
+ * cell has no neighbor (BOUNDARY_FACE); a face used by more than two cells
+ * has several (MULTIPLE_NEIGHBORS), which must be looked up with the cell
+ * links. 0D, 1D and 2D cells have no faces.
+ *
+ * Usually vtkStaticFaceNeighbors is not used directly: calling
+ * vtkUnstructuredGrid::BuildFaceNeighbors() caches it on the grid, which
+ * then answers the GetCellNeighbors() and IsCellBoundary() queries on faces
+ * with it until the cells change.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
+ * @sa
+ * vtkUnstructuredGrid vtkStaticCellLinks vtkStaticFaceHashLinksTemplate
+ */
+
+#ifndef vtkStaticFaceNeighbors_h
+#define vtkStaticFaceNeighbors_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+
+#include <vector> // For std::vector
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkUnstructuredGrid;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkStaticFaceNeighbors : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type manipulation and printing.
+   */
+  static vtkStaticFaceNeighbors* New();
+  vtkTypeMacro(vtkStaticFaceNeighbors, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * Special values of the neighbor of a face.
+   */
+  enum FaceNeighborType
+  {
+    BOUNDARY_FACE = -1,
+    MULTIPLE_NEIGHBORS = -2
+  };
+
+  /**
+   * Build the face neighbors of the cells of the grid.
+   */
+  void BuildNeighbors(vtkUnstructuredGrid* grid);
+
+  /**
+   * Free the memory and reset to an empty state.
+   */
+  void Reset();
+
+  /**
+   * Return the number of cells of the grid the neighbors were built from.
+   */
+  vtkIdType GetNumberOfCells() const
+  {
+    return this->Offsets.empty() ? 0 : static_cast<vtkIdType>(this->Offsets.size()) - 1;
+  }
+
+  /**
+   * Return the total number of faces of the 3D cells.
+   */
+  vtkIdType GetNumberOfFaces() const { return static_cast<vtkIdType>(this->Neighbors.size()); }
+
+  /**
+   * Return the number of faces of a cell (0 if it is not a 3D cell).
+   */
+  vtkIdType GetNumberOfCellFaces(vtkIdType cellId) const
+  {
+    return this->Offsets[cellId + 1] - this->Offsets[cellId];
+  }
+
+  /**
+   * Return the neighbors across each face of a cell. There are
+   * GetNumberOfCellFaces(cellId) of them.
+   */
+  const vtkIdType* GetCellFaceNeighbors(vtkIdType cellId) const
+  {
+    return this->Neighbors.data() + this->Offsets[cellId];
+  }
+
+  /**
+   * Return the neighbor across a face of a cell: a cell id, BOUNDARY_FACE
+   * or MULTIPLE_NEIGHBORS.
+   */
+  vtkIdType GetFaceNeighbor(vtkIdType cellId, vtkIdType faceId) const
+  {
+    return this->Neighbors[this->Offsets[cellId] + faceId];
+  }
+
+  /**
+   * Return the face of a cell made of the given points (in any order), or -1
+   * if there is none. Only the faces of the linear 3D cells and the polyhedra
+   * are searched: -1 is returned for the other cells. This method is thread
+   * safe.
+   */
+  static vtkIdType FindCellFace(
+    vtkUnstructuredGrid* grid, vtkIdType cellId, vtkIdType npts, const vtkIdType* pts);
+
+  /**
+   * Return the memory in kibibytes (1024 bytes) consumed by this object.
+   */
+  unsigned long GetActualMemorySize();
+
+protected:
+  vtkStaticFaceNeighbors() = default;
+  ~vtkStaticFaceNeighbors() override = default;
+
+  std::vector<vtkIdType> Offsets;   // the faces of cell i are [Offsets[i], Offsets[i+1])
+  std::vector<vtkIdType> Neighbors; // the neighbor across each face
+
+private:
+  vtkStaticFaceNeighbors(const vtkStaticFaceNeighbors&) = delete;
+  void operator=(const vtkStaticFaceNeighbors&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
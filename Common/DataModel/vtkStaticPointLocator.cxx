@@ -6,7 +6,9 @@
 #include "vtkBox.h"
 #include "vtkCellArray.h"
 #include "vtkDataArray.h"
+#include "vtkDoubleArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkIntArray.h"
 #include "vtkLine.h"
 #include "vtkMath.h"
@@ -18,6 +20,8 @@
 #include "vtkSMPTools.h"
 #include "vtkStructuredData.h"
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -46,6 +50,19 @@ constexpr size_t VTK_INITIAL_BUCKET_SIZE = 10000;
 // in vtkPointLocator and vtkStaticPointLocator and causing weird faults.
 struct NeighborBuckets;
 
+namespace
+{
+//------------------------------------------------------------------------------
+// Obtaining closest points requires sorting nearby points
+struct IdTuple
+{
+  vtkIdType PtId;
+  double Dist2;
+
+  bool operator<(const IdTuple& tuple) const { return Dist2 < tuple.Dist2; }
+};
+}
+
 //------------------------------------------------------------------------------
 // The bucketed points, including the sorted map. This is just a PIMPLd
 // wrapper around the classes that do the real work.
@@ -480,6 +497,10 @@ struct BucketList : public vtkBucketList
     double radius, const double x[3], double inputDataLength, double& dist2);
   void FindClosestNPoints(int N, const double x[3], vtkIdList* result);
   void FindPointsWithinRadius(double R, const double x[3], vtkIdList* result);
+  void FindClosestNPoints(int N, vtkPoints* queryPts, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* ids, vtkDoubleArray* dist2);
+  void FindPointsWithinRadius(double R, vtkPoints* queryPts, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* ids, vtkDoubleArray* dist2);
   int IntersectWithLine(double a0[3], double a1[3], double tol, double& t, double lineX[3],
     double ptX[3], vtkIdType& ptId);
   void MergePoints(double tol, vtkIdType* pointMap, int orderingMode);
@@ -487,6 +508,11 @@ struct BucketList : public vtkBucketList
   void GenerateRepresentation(int vtkNotUsed(level), vtkPolyData* pd);
 
   // Internal methods
+  vtkIdType FindClosestNPoints(
+    int N, const double x[3], NeighborBuckets& buckets, std::vector<IdTuple>& res);
+  template <typename TFunc>
+  void ForPointsWithinRadius(double R, const double x[3], TFunc&& func);
+  std::vector<LocatorTuple<vtkIdType>> SortQueries(vtkPoints* queryPts);
   void GetOverlappingBuckets(
     NeighborBuckets* buckets, const double x[3], const int ijk[3], double dist, int level);
   void GetOverlappingBuckets(NeighborBuckets* buckets, const double x[3], double dist,
@@ -1270,34 +1296,43 @@ vtkIdType BucketList<TIds>::FindClosestPointWithinRadius(
   return closest;
 }
 
-namespace
-{
-//------------------------------------------------------------------------------
-// Obtaining closest points requires sorting nearby points
-struct IdTuple
-{
-  vtkIdType PtId;
-  double Dist2;
-
-  bool operator<(const IdTuple& tuple) const { return Dist2 < tuple.Dist2; }
-};
-}
-
 //------------------------------------------------------------------------------
+// Find the N closest points, returned in res sorted from closest to farthest.
+// The number of points found is returned (it is less than N only if the
+// locator contains less than N points).
 template <typename TIds>
-void BucketList<TIds>::FindClosestNPoints(int N, const double x[3], vtkIdList* result)
+vtkIdType BucketList<TIds>::FindClosestNPoints(
+  int N, const double x[3], NeighborBuckets& buckets, std::vector<IdTuple>& res)
 {
   int i, j;
-  double dist2;
   double pt[3];
   int level;
-  vtkIdType ptId, cno, numIds;
+  vtkIdType cno, numIds;
   int ijk[3], *nei;
-  NeighborBuckets buckets;
   const LocatorTuple<TIds>* ids;
 
   // Clear out any previous results
-  result->Reset();
+  res.clear();
+  if (N <= 0)
+  {
+    return 0;
+  }
+
+  // The results are kept sorted. Once N points have been found, a point
+  // closer than the farthest one replaces it.
+  auto insert = [&res, N](vtkIdType ptId, double dist2) {
+    IdTuple tuple{ ptId, dist2 };
+    auto pos = std::upper_bound(res.begin(), res.end(), tuple);
+    if (static_cast<int>(res.size()) < N)
+    {
+      res.insert(pos, tuple);
+    }
+    else if (pos != res.end())
+    {
+      std::move_backward(pos, res.end() - 1, res.end());
+      *pos = tuple;
+    }
+  };
 
   //  Find the bucket the point is in.
   //
@@ -1307,12 +1342,8 @@ void BucketList<TIds>::FindClosestNPoints(int N, const double x[3], vtkIdList* r
   // we have enough points. Then a refinement to make sure we have the
   // N closest points.
   level = 0;
-  double maxDistance = 0.0;
-  int currentCount = 0;
-  std::vector<IdTuple> res(N);
-
   this->GetBucketNeighbors(&buckets, ijk, this->Divisions, level);
-  while (buckets.GetNumberOfNeighbors() && currentCount < N)
+  while (buckets.GetNumberOfNeighbors() && static_cast<int>(res.size()) < N)
   {
     for (i = 0; i < buckets.GetNumberOfNeighbors(); i++)
     {
@@ -1324,30 +1355,8 @@ void BucketList<TIds>::FindClosestNPoints(int N, const double x[3], vtkIdList* r
         ids = this->GetIds(cno);
         for (j = 0; j < numIds; j++)
         {
-          ptId = ids[j].PtId;
-          this->DataSet->GetPoint(ptId, pt);
-          dist2 = vtkMath::Distance2BetweenPoints(x, pt);
-          if (currentCount < N)
-          {
-            res[currentCount].Dist2 = dist2;
-            res[currentCount].PtId = ptId;
-            if (dist2 > maxDistance)
-            {
-              maxDistance = dist2;
-            }
-            currentCount++;
-            if (currentCount == N)
-            {
-              std::sort(res.begin(), res.begin() + currentCount);
-            }
-          }
-          else if (dist2 < maxDistance)
-          {
-            res[N - 1].Dist2 = dist2;
-            res[N - 1].PtId = ptId;
-            std::sort(res.begin(), res.begin() + N);
-            maxDistance = res[N - 1].Dist2;
-          }
+          this->DataSet->GetPoint(ids[j].PtId, pt);
+          insert(ids[j].PtId, vtkMath::Distance2BetweenPoints(x, pt));
         }
       }
     }
@@ -1355,11 +1364,13 @@ void BucketList<TIds>::FindClosestNPoints(int N, const double x[3], vtkIdList* r
     this->GetBucketNeighbors(&buckets, ijk, this->Divisions, level);
   }
 
-  // do a sort
-  std::sort(res.begin(), res.begin() + currentCount);
-
-  // Now do the refinement
-  this->GetOverlappingBuckets(&buckets, x, ijk, sqrt(maxDistance), level - 1);
+  // Now do the refinement. If less than N points were found, all the buckets
+  // have already been visited.
+  if (static_cast<int>(res.size()) < N)
+  {
+    return static_cast<vtkIdType>(res.size());
+  }
+  this->GetOverlappingBuckets(&buckets, x, ijk, sqrt(res.back().Dist2), level - 1);
 
   for (i = 0; i < buckets.GetNumberOfNeighbors(); i++)
   {
@@ -1371,23 +1382,26 @@ void BucketList<TIds>::FindClosestNPoints(int N, const double x[3], vtkIdList* r
       ids = this->GetIds(cno);
       for (j = 0; j < numIds; j++)
       {
-        ptId = ids[j].PtId;
-        this->DataSet->GetPoint(ptId, pt);
-        dist2 = vtkMath::Distance2BetweenPoints(x, pt);
-        if (dist2 < maxDistance)
-        {
-          res[N - 1].Dist2 = dist2;
-          res[N - 1].PtId = ptId;
-          std::sort(res.begin(), res.begin() + N);
-          maxDistance = res[N - 1].Dist2;
-        }
+        this->DataSet->GetPoint(ids[j].PtId, pt);
+        insert(ids[j].PtId, vtkMath::Distance2BetweenPoints(x, pt));
       }
     }
   }
 
+  return N;
+}
+
+//------------------------------------------------------------------------------
+template <typename TIds>
+void BucketList<TIds>::FindClosestNPoints(int N, const double x[3], vtkIdList* result)
+{
+  NeighborBuckets buckets;
+  std::vector<IdTuple> res;
+  vtkIdType numIds = this->FindClosestNPoints(N, x, buckets, res);
+
   // Fill in the IdList
-  result->SetNumberOfIds(currentCount);
-  for (i = 0; i < currentCount; i++)
+  result->SetNumberOfIds(numIds);
+  for (vtkIdType i = 0; i < numIds; i++)
   {
     result->SetId(i, res[i].PtId);
   }
@@ -1395,9 +1409,10 @@ void BucketList<TIds>::FindClosestNPoints(int N, const double x[3], vtkIdList* r
 
 //------------------------------------------------------------------------------
 // The Radius defines a block of buckets which the sphere of radius R may
-// touch.
+// touch. func(ptId, dist2) is invoked for each point within the sphere.
 template <typename TIds>
-void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkIdList* result)
+template <typename TFunc>
+void BucketList<TIds>::ForPointsWithinRadius(double R, const double x[3], TFunc&& func)
 {
   double dist2;
   double pt[3];
@@ -1419,9 +1434,6 @@ void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkId
   this->GetBucketIndices(xMin, ijkMin);
   this->GetBucketIndices(xMax, ijkMax);
 
-  // Clear out previous results
-  result->Reset();
-
   // Add points within footprint and radius
   for (k = ijkMin[2]; k <= ijkMax[2]; ++k)
   {
@@ -1443,7 +1455,7 @@ void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkId
             dist2 = vtkMath::Distance2BetweenPoints(x, pt);
             if (dist2 <= R2)
             {
-              result->InsertNextId(ptId);
+              func(ptId, dist2);
             }
           } // for all points in bucket
         }   // if points in bucket
@@ -1452,6 +1464,160 @@ void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkId
   }         // k-footprint
 }
 
+//------------------------------------------------------------------------------
+template <typename TIds>
+void BucketList<TIds>::FindPointsWithinRadius(double R, const double x[3], vtkIdList* result)
+{
+  // Clear out previous results
+  result->Reset();
+  this->ForPointsWithinRadius(
+    R, x, [result](vtkIdType ptId, double) { result->InsertNextId(ptId); });
+}
+
+//------------------------------------------------------------------------------
+// Batched queries are processed in the order of the buckets containing the
+// query points: consecutive queries then visit the same buckets, which keeps
+// the locator data in cache. The returned tuples are the query ids sorted by
+// bucket.
+template <typename TIds>
+std::vector<LocatorTuple<vtkIdType>> BucketList<TIds>::SortQueries(vtkPoints* queryPts)
+{
+  vtkIdType numQueries = queryPts->GetNumberOfPoints();
+  std::vector<LocatorTuple<vtkIdType>> queries(numQueries);
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType qId, vtkIdType endQId) {
+    double x[3];
+    for (; qId < endQId; ++qId)
+    {
+      queryPts->GetPoint(qId, x);
+      queries[qId].PtId = qId;
+      queries[qId].Bucket = this->GetBucketIndex(x);
+    }
+  });
+  vtkSMPTools::Sort(queries.begin(), queries.end());
+  return queries;
+}
+
+//------------------------------------------------------------------------------
+// Every query has min(N, NumPts) neighbors, so the offsets are known up front
+// and each query writes its neighbors directly into the output arrays.
+template <typename TIds>
+void BucketList<TIds>::FindClosestNPoints(int N, vtkPoints* queryPts, vtkIdTypeArray* offsets,
+  vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  vtkIdType numQueries = queryPts->GetNumberOfPoints();
+  vtkIdType numNeis = std::max<vtkIdType>(0, std::min<vtkIdType>(N, this->NumPts));
+
+  offsets->SetNumberOfValues(numQueries + 1);
+  ids->SetNumberOfValues(numQueries * numNeis);
+  if (dist2)
+  {
+    dist2->SetNumberOfValues(numQueries * numNeis);
+  }
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  vtkIdType* idsPtr = ids->GetPointer(0);
+  double* dist2Ptr = (dist2 ? dist2->GetPointer(0) : nullptr);
+  vtkSMPTools::For(0, numQueries + 1, [&](vtkIdType qId, vtkIdType endQId) {
+    for (; qId < endQId; ++qId)
+    {
+      offsetsPtr[qId] = qId * numNeis;
+    }
+  });
+  if (numNeis == 0)
+  {
+    return;
+  }
+
+  std::vector<LocatorTuple<vtkIdType>> queries = this->SortQueries(queryPts);
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType idx, vtkIdType endIdx) {
+    NeighborBuckets buckets;
+    std::vector<IdTuple> res;
+    res.reserve(numNeis);
+    double x[3];
+    for (; idx < endIdx; ++idx)
+    {
+      vtkIdType qId = queries[idx].PtId;
+      queryPts->GetPoint(qId, x);
+      this->FindClosestNPoints(static_cast<int>(numNeis), x, buckets, res);
+      vtkIdType* qIds = idsPtr + qId * numNeis;
+      for (vtkIdType i = 0; i < numNeis; ++i)
+      {
+        qIds[i] = res[i].PtId;
+      }
+      if (dist2Ptr)
+      {
+        double* qDist2 = dist2Ptr + qId * numNeis;
+        for (vtkIdType i = 0; i < numNeis; ++i)
+        {
+          qDist2[i] = res[i].Dist2;
+        }
+      }
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// The number of neighbors of each query is not known in advance. Each thread
+// gathers the neighbors of its queries in a thread local buffer and records
+// where they are. The offsets are then prefix summed, and the neighbors
+// copied into the output arrays.
+template <typename TIds>
+void BucketList<TIds>::FindPointsWithinRadius(double R, vtkPoints* queryPts,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  struct QueryResults
+  {
+    const std::vector<IdTuple>* Buffer;
+    size_t Start;
+  };
+
+  vtkIdType numQueries = queryPts->GetNumberOfPoints();
+  offsets->SetNumberOfValues(numQueries + 1);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  offsetsPtr[0] = 0;
+
+  std::vector<LocatorTuple<vtkIdType>> queries = this->SortQueries(queryPts);
+  std::vector<QueryResults> results(numQueries);
+  vtkSMPThreadLocal<std::vector<IdTuple>> buffers;
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType idx, vtkIdType endIdx) {
+    std::vector<IdTuple>& buffer = buffers.Local();
+    double x[3];
+    for (; idx < endIdx; ++idx)
+    {
+      vtkIdType qId = queries[idx].PtId;
+      queryPts->GetPoint(qId, x);
+      size_t start = buffer.size();
+      this->ForPointsWithinRadius(
+        R, x, [&buffer](vtkIdType ptId, double d2) { buffer.push_back(IdTuple{ ptId, d2 }); });
+      results[qId].Buffer = &buffer;
+      results[qId].Start = start;
+      offsetsPtr[qId + 1] = static_cast<vtkIdType>(buffer.size() - start);
+    }
+  });
+  std::partial_sum(offsetsPtr, offsetsPtr + numQueries + 1, offsetsPtr);
+
+  ids->SetNumberOfValues(offsetsPtr[numQueries]);
+  if (dist2)
+  {
+    dist2->SetNumberOfValues(offsetsPtr[numQueries]);
+  }
+  vtkIdType* idsPtr = ids->GetPointer(0);
+  double* dist2Ptr = (dist2 ? dist2->GetPointer(0) : nullptr);
+  vtkSMPTools::For(0, numQueries, [&](vtkIdType qId, vtkIdType endQId) {
+    for (; qId < endQId; ++qId)
+    {
+      const IdTuple* res = results[qId].Buffer->data() + results[qId].Start;
+      for (vtkIdType i = offsetsPtr[qId]; i < offsetsPtr[qId + 1]; ++i, ++res)
+      {
+        idsPtr[i] = res->PtId;
+        if (dist2Ptr)
+        {
+          dist2Ptr[i] = res->Dist2;
+        }
+      }
+    }
+  });
+}
+
 //------------------------------------------------------------------------------
 // Find the point within tol of the finite line, and closest to the starting
 // point of the line (i.e., min parametric coordinate t).
@@ -2237,6 +2403,76 @@ void vtkStaticPointLocator::FindPointsWithinRadius(double R, const double x[3],
   }
 }
 
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindClosestNPoints(int N, vtkPoints* points,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  if (!points || !offsets || !ids)
+  {
+    vtkErrorMacro(<< "Query points and output arrays must be provided");
+    return;
+  }
+
+  this->BuildLocator(); // will subdivide if modified; otherwise returns
+  if (!this->Buckets)
+  {
+    offsets->SetNumberOfValues(points->GetNumberOfPoints() + 1);
+    offsets->FillValue(0);
+    ids->SetNumberOfValues(0);
+    if (dist2)
+    {
+      dist2->SetNumberOfValues(0);
+    }
+    return;
+  }
+
+  if (this->LargeIds)
+  {
+    static_cast<BucketList<vtkIdType>*>(this->Buckets)
+      ->FindClosestNPoints(N, points, offsets, ids, dist2);
+  }
+  else
+  {
+    static_cast<BucketList<int>*>(this->Buckets)
+      ->FindClosestNPoints(N, points, offsets, ids, dist2);
+  }
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPointLocator::FindPointsWithinRadius(double R, vtkPoints* points,
+  vtkIdTypeArray* offsets, vtkIdTypeArray* ids, vtkDoubleArray* dist2)
+{
+  if (!points || !offsets || !ids)
+  {
+    vtkErrorMacro(<< "Query points and output arrays must be provided");
+    return;
+  }
+
+  this->BuildLocator(); // will subdivide if modified; otherwise returns
+  if (!this->Buckets)
+  {
+    offsets->SetNumberOfValues(points->GetNumberOfPoints() + 1);
+    offsets->FillValue(0);
+    ids->SetNumberOfValues(0);
+    if (dist2)
+    {
+      dist2->SetNumberOfValues(0);
+    }
+    return;
+  }
+
+  if (this->LargeIds)
+  {
+    static_cast<BucketList<vtkIdType>*>(this->Buckets)
+      ->FindPointsWithinRadius(R, points, offsets, ids, dist2);
+  }
+  else
+  {
+    static_cast<BucketList<int>*>(this->Buckets)
+      ->FindPointsWithinRadius(R, points, offsets, ids, dist2);
+  }
+}
+
 //------------------------------------------------------------------------------
 // This method traverses the locator along the defined ray, finding the
 // closest point to a0 when projected onto the line (a0,a1) (i.e., min
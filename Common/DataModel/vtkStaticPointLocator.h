@@ -52,6 +52,9 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkIdList;
 struct vtkBucketList;
 class vtkDataArray;
+class vtkDoubleArray;
+class vtkIdTypeArray;
+class vtkPoints;
 
 class VTKCOMMONDATAMODEL_EXPORT vtkStaticPointLocator : public vtkAbstractPointLocator
 {
@@ -139,6 +142,27 @@ public:
    */
   void FindPointsWithinRadius(double R, const double x[3], vtkIdList* result) override;
 
+  ///@{
+  /**
+   * Batched versions of FindClosestNPoints() and FindPointsWithinRadius():
+   * the neighbors of all the query points are found at once, in parallel.
+   * The results are returned in a compressed layout: the neighbors of the
+   * i-th query point are ids[offsets[i]] to ids[offsets[i+1]-1], so offsets
+   * has one more value than there are query points. If dist2 is provided, it
+   * is filled with the squared distances matching ids. As with the single
+   * point methods, the closest N points are sorted from closest to farthest
+   * (there are min(N, number of points) of them for every query), while the
+   * points within the radius are not sorted. The queries are processed in
+   * the order of the buckets containing them, which is much faster than
+   * looping over the single point methods for large numbers of queries.
+   * These methods are not thread safe, but are threaded with vtkSMPTools.
+   */
+  void FindClosestNPoints(int N, vtkPoints* points, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* ids, vtkDoubleArray* dist2 = nullptr);
+  void FindPointsWithinRadius(double R, vtkPoints* points, vtkIdTypeArray* offsets,
+    vtkIdTypeArray* ids, vtkDoubleArray* dist2 = nullptr);
+  ///@}
+
   /**
    * Intersect the points contained in the locator with the line defined by
    * (a0,a1). Return the point within the tolerance tol that is closest to a0
@@ -0,0 +1,265 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkStaticPolyhedronTopology.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellType.h"
+#include "vtkEdgeTable.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkObjectFactory.h"
+#include "vtkPoints.h"
+#include "vtkPolyhedron.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkStaticPolyhedronTopology);
+
+//------------------------------------------------------------------------------
+// The topology of each polyhedron is stored in a block of Data:
+//   a header of BLOCK_HEADER_SIZE values (see below), then
+//   the face offsets (number of faces + 1) and the face connectivity,
+//   the edges (2 points each) and their faces (2 faces each),
+//   the point to face offsets (number of points + 1) and the point faces,
+//   the triangle offsets (number of faces + 1) and the triangles (3 points each).
+// The offsets are relative to the start of the array they index, so that the
+// blocks are computed independently of each other, in parallel, and then
+// concatenated.
+namespace
+{
+enum BlockHeader
+{
+  NUMBER_OF_POINTS = 0,
+  NUMBER_OF_FACES,
+  NUMBER_OF_EDGES,
+  FLAGS,
+  FACE_CONNECTIVITY_SIZE,
+  POINT_FACES_SIZE,
+  NUMBER_OF_TRIANGLES,
+  BLOCK_HEADER_SIZE
+};
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+void vtkStaticPolyhedronTopology::ComputeBlock(vtkPolyhedron* polyhedron,
+  vtkIdList* triangleOffsets, vtkIdList* triangles, std::vector<vtkIdType>& block)
+{
+  block.assign(BLOCK_HEADER_SIZE, 0);
+  polyhedron->GenerateFaces();
+  polyhedron->GenerateEdges();
+  vtkCellArray* faces = polyhedron->Faces;
+  const vtkIdType numPts = polyhedron->PointIds->GetNumberOfIds();
+  const vtkIdType numFaces = faces->GetNumberOfCells();
+  const vtkIdType numEdges = polyhedron->Edges->GetNumberOfTuples();
+
+  // The faces
+  block.push_back(0);
+  for (vtkIdType faceId = 0; faceId < numFaces; ++faceId)
+  {
+    block.push_back(block.back() + faces->GetCellSize(faceId));
+  }
+  const vtkIdType connSize = block.back();
+  vtkIdType npts;
+  const vtkIdType* pts;
+  for (vtkIdType faceId = 0; faceId < numFaces; ++faceId)
+  {
+    faces->GetCellAtId(faceId, npts, pts, triangles);
+    block.insert(block.end(), pts, pts + npts);
+  }
+
+  // The edges, and how many faces use each of them
+  const vtkIdType* edges = polyhedron->Edges->GetPointer(0);
+  const vtkIdType* edgeFaces = polyhedron->EdgeFaces->GetPointer(0);
+  block.insert(block.end(), edges, edges + 2 * numEdges);
+  block.insert(block.end(), edgeFaces, edgeFaces + 2 * numEdges);
+  std::vector<vtkIdType> edgeUses(numEdges, 0);
+  std::vector<vtkIdType> lastEdgeFace(numEdges, -1);
+  std::vector<std::pair<vtkIdType, vtkIdType>> pointFaces;
+  pointFaces.reserve(connSize);
+  for (vtkIdType faceId = 0; faceId < numFaces; ++faceId)
+  {
+    faces->GetCellAtId(faceId, npts, pts, triangles);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      pointFaces.emplace_back(pts[i], faceId);
+      const vtkIdType edgeId =
+        polyhedron->EdgeTable->IsEdge(pts[i], pts[(i + 1) != npts ? i + 1 : 0]);
+      if (edgeId >= 0 && lastEdgeFace[edgeId] != faceId)
+      {
+        lastEdgeFace[edgeId] = faceId;
+        ++edgeUses[edgeId];
+      }
+    }
+  }
+
+  // The faces using each point
+  std::sort(pointFaces.begin(), pointFaces.end());
+  pointFaces.erase(std::unique(pointFaces.begin(), pointFaces.end()), pointFaces.end());
+  const size_t pointOffsetsStart = block.size();
+  block.resize(pointOffsetsStart + numPts + 1, 0);
+  for (const auto& pointFace : pointFaces)
+  {
+    ++block[pointOffsetsStart + pointFace.first + 1];
+  }
+  auto pointOffsets = block.begin() + pointOffsetsStart;
+  std::partial_sum(pointOffsets, block.end(), pointOffsets);
+  for (const auto& pointFace : pointFaces)
+  {
+    block.push_back(pointFace.second);
+  }
+
+  // The triangulation of the faces
+  polyhedron->TriangulateContourFaces(triangleOffsets, triangles);
+  block.insert(block.end(), triangleOffsets->begin(), triangleOffsets->end());
+  block.insert(block.end(), triangles->begin(), triangles->end());
+
+  // IsConvex() requires each edge to have two faces
+  int flags = 0;
+  if (numEdges > 0 &&
+    std::all_of(edgeUses.begin(), edgeUses.end(), [](vtkIdType uses) { return uses == 2; }))
+  {
+    flags |= WATERTIGHT;
+    if (polyhedron->IsConvex())
+    {
+      flags |= CONVEX;
+    }
+  }
+  block[NUMBER_OF_POINTS] = numPts;
+  block[NUMBER_OF_FACES] = numFaces;
+  block[NUMBER_OF_EDGES] = numEdges;
+  block[FLAGS] = flags;
+  block[FACE_CONNECTIVITY_SIZE] = connSize;
+  block[POINT_FACES_SIZE] = static_cast<vtkIdType>(pointFaces.size());
+  block[NUMBER_OF_TRIANGLES] = triangles->GetNumberOfIds() / 3;
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPolyhedronTopology::BuildTopology(vtkUnstructuredGrid* grid)
+{
+  this->Reset();
+  const vtkIdType numCells = grid->GetNumberOfCells();
+  this->CellBlocks.assign(numCells, -1);
+  if (numCells == 0 || !grid->GetPoints())
+  {
+    return;
+  }
+
+  std::vector<vtkIdType> polyhedra;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    if (grid->GetCellType(cellId) == VTK_POLYHEDRON)
+    {
+      polyhedra.push_back(cellId);
+    }
+  }
+  this->NumberOfPolyhedra = static_cast<vtkIdType>(polyhedra.size());
+  this->Points = grid->GetPoints();
+
+  // Compute the blocks in parallel. The polyhedra are loaded the same way as
+  // vtkUnstructuredGrid::GetCell() does, but without being bound to any
+  // topology, so that they derive it themselves.
+  std::vector<std::vector<vtkIdType>> blocks(polyhedra.size());
+  vtkSMPThreadLocalObject<vtkPolyhedron> tlPolyhedron;
+  vtkSMPThreadLocalObject<vtkIdList> tlTriangleOffsets;
+  vtkSMPThreadLocalObject<vtkIdList> tlTriangles;
+  vtkPoints* points = grid->GetPoints();
+  vtkSMPTools::For(0, this->NumberOfPolyhedra, [&](vtkIdType begin, vtkIdType end) {
+    vtkPolyhedron* polyhedron = tlPolyhedron.Local();
+    vtkIdList* triangleOffsets = tlTriangleOffsets.Local();
+    vtkIdList* triangles = tlTriangles.Local();
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      const vtkIdType cellId = polyhedra[i];
+      grid->GetCellPoints(cellId, polyhedron->PointIds);
+      points->GetPoints(polyhedron->PointIds, polyhedron->Points);
+      grid->GetPolyhedronFaces(cellId, polyhedron->GetCellFaces());
+      polyhedron->Initialize();
+      ComputeBlock(polyhedron, triangleOffsets, triangles, blocks[i]);
+    }
+  });
+
+  // Concatenate them
+  std::vector<vtkIdType> blockOffsets(polyhedra.size() + 1, 0);
+  for (size_t i = 0; i < blocks.size(); ++i)
+  {
+    blockOffsets[i + 1] = blockOffsets[i] + static_cast<vtkIdType>(blocks[i].size());
+  }
+  this->Data.resize(blockOffsets.back());
+  vtkSMPTools::For(0, this->NumberOfPolyhedra, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      std::copy(blocks[i].begin(), blocks[i].end(), this->Data.begin() + blockOffsets[i]);
+      this->CellBlocks[polyhedra[i]] = blockOffsets[i];
+      std::vector<vtkIdType>().swap(blocks[i]);
+    }
+  });
+
+  this->Modified();
+}
+
+//------------------------------------------------------------------------------
+bool vtkStaticPolyhedronTopology::GetCellTopology(vtkIdType cellId, CellTopology& topology) const
+{
+  if (cellId < 0 || cellId >= this->GetNumberOfCells() || this->CellBlocks[cellId] < 0)
+  {
+    return false;
+  }
+
+  const vtkIdType* block = this->Data.data() + this->CellBlocks[cellId];
+  topology.NumberOfPoints = block[NUMBER_OF_POINTS];
+  topology.NumberOfFaces = block[NUMBER_OF_FACES];
+  topology.NumberOfEdges = block[NUMBER_OF_EDGES];
+  topology.Flags = static_cast<int>(block[FLAGS]);
+
+  const vtkIdType* data = block + BLOCK_HEADER_SIZE;
+  topology.FaceOffsets = data;
+  data += topology.NumberOfFaces + 1;
+  topology.FaceConnectivity = data;
+  data += block[FACE_CONNECTIVITY_SIZE];
+  topology.Edges = data;
+  data += 2 * topology.NumberOfEdges;
+  topology.EdgeFaces = data;
+  data += 2 * topology.NumberOfEdges;
+  topology.PointFaceOffsets = data;
+  data += topology.NumberOfPoints + 1;
+  topology.PointFaces = data;
+  data += block[POINT_FACES_SIZE];
+  topology.TriangleOffsets = data;
+  data += topology.NumberOfFaces + 1;
+  topology.Triangles = data;
+  return true;
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPolyhedronTopology::Reset()
+{
+  this->Points = nullptr;
+  this->NumberOfPolyhedra = 0;
+  this->CellBlocks.clear();
+  this->CellBlocks.shrink_to_fit();
+  this->Data.clear();
+  this->Data.shrink_to_fit();
+}
+
+//------------------------------------------------------------------------------
+unsigned long vtkStaticPolyhedronTopology::GetActualMemorySize()
+{
+  const size_t size = (this->CellBlocks.capacity() + this->Data.capacity()) * sizeof(vtkIdType);
+  return static_cast<unsigned long>(size / 1024);
+}
+
+//------------------------------------------------------------------------------
+void vtkStaticPolyhedronTopology::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Number Of Cells: " << this->GetNumberOfCells() << "\n";
+  os << indent << "Number Of Polyhedra: " << this->NumberOfPolyhedra << "\n";
+}
+VTK_ABI_NAMESPACE_END
@@ -0,0 +1,149 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkStaticPolyhedronTopology
+ * @brief   the topology of the polyhedra of an unstructured grid
+ *
+ * vtkStaticPolyhedronTopology is a supplemental object to vtkUnstructuredGrid
+ * storing, for each polyhedron of the grid, everything vtkPolyhedron otherwise
+ * derives each time a cell is initialized: its faces in canonical point ids
+ * (0 to the number of points of the cell - 1), its edges with the faces using
+ * them, the faces using each point, whether it is watertight and convex, and
+ * the triangulation of its faces used by vtkPolyhedron::Contour() and
+ * vtkPolyhedron::Clip(). It is built once (statically), in parallel, and must
+ * be rebuilt if the cells or the points of the grid change.
+ *
+ * The topology of each polyhedron is stored in a single contiguous block, and
+ * is read-only once built, so that any number of vtkPolyhedron can be bound to
+ * it concurrently (see vtkPolyhedron::BindTopology()). Usually
+ * vtkStaticPolyhedronTopology is not used directly: calling
+ * vtkUnstructuredGrid::BuildPolyhedronTopology() caches it on the grid, whose
+ * GetCell() then binds the polyhedra it returns to it until the grid changes.
+ *
+ * @warning
+ * This class has been threaded with vtkSMPTools. Using TBB or other
+ * non-sequential type (set in the CMake variable
+ * VTK_SMP_IMPLEMENTATION_TYPE) may improve performance significantly.
+ *
+ * @sa
+ * vtkPolyhedron vtkUnstructuredGrid vtkStaticFaceNeighbors
+ */
+
+#ifndef vtkStaticPolyhedronTopology_h
+#define vtkStaticPolyhedronTopology_h
+
+#include "vtkCommonDataModelModule.h" // For export macro
+#include "vtkObject.h"
+#include "vtkWeakPointer.h" // For vtkWeakPointer
+
+#include <vector> // For std::vector
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkIdList;
+class vtkPoints;
+class vtkPolyhedron;
+class vtkUnstructuredGrid;
+
+class VTKCOMMONDATAMODEL_EXPORT vtkStaticPolyhedronTopology : public vtkObject
+{
+public:
+  ///@{
+  /**
+   * Standard methods for instantiation, type manipulation and printing.
+   */
+  static vtkStaticPolyhedronTopology* New();
+  vtkTypeMacro(vtkStaticPolyhedronTopology, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * Properties of a polyhedron, combined in CellTopology::Flags.
+   */
+  enum PolyhedronFlags
+  {
+    WATERTIGHT = 1, // each edge is used by exactly two faces
+    CONVEX = 2      // as determined by vtkPolyhedron::IsConvex()
+  };
+
+  /**
+   * The topology of a polyhedron, pointing to the storage of a
+   * vtkStaticPolyhedronTopology. All the point ids are canonical.
+   */
+  struct CellTopology
+  {
+    vtkIdType NumberOfPoints = 0;
+    vtkIdType NumberOfFaces = 0;
+    vtkIdType NumberOfEdges = 0;
+    int Flags = 0;
+    // The points of face i are FaceConnectivity[FaceOffsets[i], FaceOffsets[i+1])
+    const vtkIdType* FaceOffsets = nullptr;
+    const vtkIdType* FaceConnectivity = nullptr;
+    // The two points of each edge, and the two faces using it (-1 if only one)
+    const vtkIdType* Edges = nullptr;
+    const vtkIdType* EdgeFaces = nullptr;
+    // The faces using point i, sorted, are PointFaces[PointFaceOffsets[i], PointFaceOffsets[i+1])
+    const vtkIdType* PointFaceOffsets = nullptr;
+    const vtkIdType* PointFaces = nullptr;
+    // The triangles of face i are [TriangleOffsets[i], TriangleOffsets[i+1]), with
+    // their three points in Triangles
+    const vtkIdType* TriangleOffsets = nullptr;
+    const vtkIdType* Triangles = nullptr;
+  };
+
+  /**
+   * Build the topology of the polyhedra of the grid.
+   */
+  void BuildTopology(vtkUnstructuredGrid* grid);
+
+  /**
+   * Free the memory and reset to an empty state.
+   */
+  void Reset();
+
+  /**
+   * Return the number of cells of the grid the topology was built from.
+   */
+  vtkIdType GetNumberOfCells() const { return static_cast<vtkIdType>(this->CellBlocks.size()); }
+
+  /**
+   * Return the points of the grid the topology was built from (nullptr if
+   * they were deleted since).
+   */
+  vtkPoints* GetPoints() const { return this->Points; }
+
+  /**
+   * Return the number of polyhedra of the grid the topology was built from.
+   */
+  vtkIdType GetNumberOfPolyhedra() const { return this->NumberOfPolyhedra; }
+
+  /**
+   * Get the topology of a cell. Return false if the cell is not a polyhedron.
+   * This method is thread safe.
+   */
+  bool GetCellTopology(vtkIdType cellId, CellTopology& topology) const;
+
+  /**
+   * Return the memory in kibibytes (1024 bytes) consumed by this object.
+   */
+  unsigned long GetActualMemorySize();
+
+protected:
+  vtkStaticPolyhedronTopology() = default;
+  ~vtkStaticPolyhedronTopology() override = default;
+
+  vtkWeakPointer<vtkPoints> Points;
+  vtkIdType NumberOfPolyhedra = 0;
+  std::vector<vtkIdType> CellBlocks; // the block of each cell in Data, -1 if not a polyhedron
+  std::vector<vtkIdType> Data;       // the blocks of all the polyhedra
+
+  // Compute the block of an initialized polyhedron
+  static void ComputeBlock(vtkPolyhedron* polyhedron, vtkIdList* triangleOffsets,
+    vtkIdList* triangles, std::vector<vtkIdType>& block);
+
+private:
+  vtkStaticPolyhedronTopology(const vtkStaticPolyhedronTopology&) = delete;
+  void operator=(const vtkStaticPolyhedronTopology&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
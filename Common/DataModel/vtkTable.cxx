@@ -6,6 +6,7 @@
 #include "vtkArrayIteratorIncludes.h"
 
 #include "vtkAbstractArray.h"
+#include "vtkContiguousStringArray.h"
 #include "vtkDataArray.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkInformation.h"
@@ -268,6 +269,14 @@ void vtkTable::MoveRowData(vtkIdType first, vtkIdType last, vtkIdType delta)
         }
       }
     }
+    else if (vtkArrayDownCast<vtkContiguousStringArray>(arr))
+    {
+      vtkContiguousStringArray* data = vtkArrayDownCast<vtkContiguousStringArray>(arr);
+      for (vtkIdType row = start; row * step <= stop * step; row += step)
+      {
+        data->SetTuple(row + delta, row, data);
+      }
+    }
     else if (vtkArrayDownCast<vtkVariantArray>(arr))
     {
       vtkVariantArray* data = vtkArrayDownCast<vtkVariantArray>(arr);
@@ -337,6 +346,11 @@ vtkIdType vtkTable::InsertNextBlankRow(double default_num_val)
         data->InsertNextValue(std::string());
       }
     }
+    else if (vtkArrayDownCast<vtkContiguousStringArray>(arr))
+    {
+      vtkContiguousStringArray* data = vtkArrayDownCast<vtkContiguousStringArray>(arr);
+      data->SetNumberOfValues(data->GetNumberOfValues() + static_cast<vtkIdType>(comps));
+    }
     else if (vtkArrayDownCast<vtkVariantArray>(arr))
     {
       vtkVariantArray* data = vtkArrayDownCast<vtkVariantArray>(arr);
@@ -596,6 +610,26 @@ void vtkTable::SetValue(vtkIdType row, vtkIdType col, vtkVariant value)
       }
     }
   }
+  else if (vtkArrayDownCast<vtkContiguousStringArray>(arr))
+  {
+    vtkContiguousStringArray* data = vtkArrayDownCast<vtkContiguousStringArray>(arr);
+    if (comps == 1)
+    {
+      data->SetValue(row, value.ToString());
+    }
+    else
+    {
+      if (value.IsArray() && value.ToArray()->GetNumberOfComponents() == comps)
+      {
+        data->SetTuple(row, 0, value.ToArray());
+      }
+      else
+      {
+        vtkWarningMacro("Cannot assign this variant type to multi-component string array.");
+        return;
+      }
+    }
+  }
   else if (vtkArrayDownCast<vtkVariantArray>(arr))
   {
     vtkVariantArray* data = vtkArrayDownCast<vtkVariantArray>(arr);
@@ -683,6 +717,16 @@ vtkVariant vtkTable::GetValue(vtkIdType row, vtkIdType col)
     vtkVariant v(sa);
     return v;
   }
+  else if (vtkArrayDownCast<vtkContiguousStringArray>(arr))
+  {
+    vtkContiguousStringArray* data = vtkArrayDownCast<vtkContiguousStringArray>(arr);
+    // Create a variant holding a vtkContiguousStringArray with one tuple.
+    vtkNew<vtkContiguousStringArray> csa;
+    csa->SetNumberOfComponents(comps);
+    csa->InsertNextTuple(row, data);
+    vtkVariant v(csa);
+    return v;
+  }
   else if (vtkArrayDownCast<vtkVariantArray>(arr))
   {
     vtkVariantArray* data = vtkArrayDownCast<vtkVariantArray>(arr);
@@ -20,6 +20,8 @@
 #include "vtkPointData.h"
 #include "vtkPolyhedron.h"
 #include "vtkStaticCellLinks.h"
+#include "vtkStaticFaceNeighbors.h"
+#include "vtkStaticPolyhedronTopology.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGridCellIterator.h"
 
@@ -296,6 +298,8 @@ void vtkUnstructuredGrid::CopyStructure(vtkDataSet* ds)
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = ug->Faces;
   this->FaceLocations = ug->FaceLocations;
+  this->FaceNeighbors = ug->FaceNeighbors;
+  this->PolyhedronTopology = ug->PolyhedronTopology;
 }
 
 //------------------------------------------------------------------------------
@@ -308,6 +312,8 @@ void vtkUnstructuredGrid::Cleanup()
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
+  this->FaceNeighbors = nullptr;
+  this->PolyhedronTopology = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -365,6 +371,13 @@ void vtkUnstructuredGrid::GetCell(vtkIdType cellId, vtkGenericCell* cell)
   {
     cell->Initialize();
   }
+  if (cellType == VTK_POLYHEDRON && this->PolyhedronTopology)
+  {
+    if (vtkStaticPolyhedronTopology* topology = this->GetPolyhedronTopology())
+    {
+      static_cast<vtkPolyhedron*>(cell->GetRepresentativeCell())->BindTopology(topology, cellId);
+    }
+  }
   this->SetCellOrderAndRationalWeights(cellId, cell);
 }
 
@@ -1041,6 +1054,8 @@ void vtkUnstructuredGrid::SetCells(vtkUnsignedCharArray* cellTypes, vtkCellArray
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = nullptr;
   this->FaceLocations = nullptr;
+  this->FaceNeighbors = nullptr;
+  this->PolyhedronTopology = nullptr;
   if (faceLocations != nullptr && faces != nullptr)
   {
     vtkIdType prepareSize = faceLocations->GetSize();
@@ -1092,6 +1107,8 @@ void vtkUnstructuredGrid::SetPolyhedralCells(vtkUnsignedCharArray* cellTypes, vt
   this->DistinctCellTypesUpdateMTime = 0;
   this->Faces = faces;
   this->FaceLocations = faceLocations;
+  this->FaceNeighbors = nullptr;
+  this->PolyhedronTopology = nullptr;
   this->LegacyFaces = nullptr;
   this->LegacyFaceLocations = nullptr;
 }
@@ -1132,6 +1149,86 @@ vtkAbstractCellLinks* vtkUnstructuredGrid::GetCellLinks()
   return this->Links;
 }
 
+//------------------------------------------------------------------------------
+vtkMTimeType vtkUnstructuredGrid::GetCellsMTime()
+{
+  vtkMTimeType time = this->Connectivity ? this->Connectivity->GetMTime() : 0;
+  time = std::max(time, this->Types ? this->Types->GetMTime() : 0);
+  time = std::max(time, this->Faces ? this->Faces->GetMTime() : 0);
+  return std::max(time, this->FaceLocations ? this->FaceLocations->GetMTime() : 0);
+}
+
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::BuildFaceNeighbors()
+{
+  if (this->GetFaceNeighbors() || !this->Connectivity)
+  {
+    return;
+  }
+  // A new object is built each time, since the previous one may be shared
+  // with other grids.
+  this->FaceNeighbors = vtkSmartPointer<vtkStaticFaceNeighbors>::New();
+  this->FaceNeighbors->BuildNeighbors(this);
+}
+
+//------------------------------------------------------------------------------
+vtkStaticFaceNeighbors* vtkUnstructuredGrid::GetFaceNeighbors()
+{
+  if (!this->FaceNeighbors ||
+    this->FaceNeighbors->GetNumberOfCells() != this->GetNumberOfCells() ||
+    this->FaceNeighbors->GetMTime() < this->GetCellsMTime())
+  {
+    return nullptr;
+  }
+  return this->FaceNeighbors;
+}
+
+//------------------------------------------------------------------------------
+void vtkUnstructuredGrid::BuildPolyhedronTopology()
+{
+  if (this->GetPolyhedronTopology() || !this->Connectivity || !this->Points)
+  {
+    return;
+  }
+  // A new object is built each time, since the previous one may be shared
+  // with other grids (or bound to cells).
+  this->PolyhedronTopology = vtkSmartPointer<vtkStaticPolyhedronTopology>::New();
+  this->PolyhedronTopology->BuildTopology(this);
+}
+
+//------------------------------------------------------------------------------
+vtkStaticPolyhedronTopology* vtkUnstructuredGrid::GetPolyhedronTopology()
+{
+  if (!this->PolyhedronTopology ||
+    this->PolyhedronTopology->GetNumberOfCells() != this->GetNumberOfCells() ||
+    this->PolyhedronTopology->GetPoints() != this->Points ||
+    this->PolyhedronTopology->GetMTime() < this->GetCellsMTime() ||
+    this->PolyhedronTopology->GetMTime() < this->Points->GetMTime())
+  {
+    return nullptr;
+  }
+  return this->PolyhedronTopology;
+}
+
+//------------------------------------------------------------------------------
+bool vtkUnstructuredGrid::FindFaceNeighbor(
+  vtkIdType cellId, vtkIdType npts, const vtkIdType* pts, vtkIdType& neighborCellId)
+{
+  // A face has at least three points
+  vtkStaticFaceNeighbors* faceNeighbors = npts >= 3 ? this->GetFaceNeighbors() : nullptr;
+  if (!faceNeighbors)
+  {
+    return false;
+  }
+  const vtkIdType faceId = vtkStaticFaceNeighbors::FindCellFace(this, cellId, npts, pts);
+  if (faceId < 0)
+  {
+    return false;
+  }
+  neighborCellId = faceNeighbors->GetFaceNeighbor(cellId, faceId);
+  return neighborCellId != vtkStaticFaceNeighbors::MULTIPLE_NEIGHBORS;
+}
+
 //------------------------------------------------------------------------------
 void vtkUnstructuredGrid::GetPointCells(vtkIdType ptId, vtkIdType& ncells, vtkIdType*& cells)
 {
@@ -1379,6 +1476,8 @@ void vtkUnstructuredGrid::Reset()
   {
     this->FaceLocations->Reset();
   }
+  this->FaceNeighbors = nullptr;
+  this->PolyhedronTopology = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -1491,6 +1590,16 @@ unsigned long vtkUnstructuredGrid::GetActualMemorySize()
     size += this->Links->GetActualMemorySize();
   }
 
+  if (this->FaceNeighbors)
+  {
+    size += this->FaceNeighbors->GetActualMemorySize();
+  }
+
+  if (this->PolyhedronTopology)
+  {
+    size += this->PolyhedronTopology->GetActualMemorySize();
+  }
+
   if (this->Types)
   {
     size += this->Types->GetActualMemorySize();
@@ -1529,6 +1638,10 @@ void vtkUnstructuredGrid::ShallowCopy(vtkDataObject* dataObject)
     this->DistinctCellTypesUpdateMTime = 0;
     this->Faces = grid->Faces;
     this->FaceLocations = grid->FaceLocations;
+    // The face neighbors and the polyhedron topology are never modified once
+    // built, so they can be shared
+    this->FaceNeighbors = grid->FaceNeighbors;
+    this->PolyhedronTopology = grid->PolyhedronTopology;
 
     if (grid->Links)
     {
@@ -1634,6 +1747,10 @@ void vtkUnstructuredGrid::DeepCopy(vtkDataObject* dataObject)
     {
       this->Links = nullptr;
     }
+    // The cells are new: the face neighbors and the polyhedron topology would
+    // be out of date
+    this->FaceNeighbors = nullptr;
+    this->PolyhedronTopology = nullptr;
   }
   else
   {
@@ -1724,18 +1841,17 @@ struct IsCellBoundaryImpl
     // Now for each cell, see if it contains all the face points
     // in the facePts list. If so, then this is not a boundary face.
     const ValueType* connectivityPtr = state.GetConnectivity()->GetPointer(0);
-    const ValueType* offsetsPtr = state.GetOffsets()->GetPointer(0);
     bool match;
     vtkIdType j;
-    ValueType k;
+    vtkIdType k;
     for (vtkIdType i = 0; i < minNumCells; ++i)
     {
       const auto& minCellId = minCells[i];
       if (minCellId != cellId) // don't include current cell
       {
         // get cell points
-        const ValueType nCellPts = offsetsPtr[minCellId + 1] - offsetsPtr[minCellId];
-        const ValueType* cellPts = connectivityPtr + offsetsPtr[minCellId];
+        const vtkIdType nCellPts = state.GetCellSize(minCellId);
+        const ValueType* cellPts = connectivityPtr + state.GetBeginOffset(minCellId);
         match = true;
         for (j = 0; j < nPts && match; ++j) // for all pts in input boundary entity
         {
@@ -1795,18 +1911,17 @@ struct GetCellNeighborsImpl
     // Now for each cell, see if it contains all the face points
     // in the facePts list. If so, then this is not a boundary face.
     const ValueType* connectivityPtr = state.GetConnectivity()->GetPointer(0);
-    const ValueType* offsetsPtr = state.GetOffsets()->GetPointer(0);
     bool match;
     vtkIdType j;
-    ValueType k;
+    vtkIdType k;
     for (vtkIdType i = 0; i < minNumCells; ++i)
     {
       const auto& minCellId = minCells[i];
       if (minCellId != cellId) // don't include current cell
       {
         // get cell points
-        const ValueType nCellPts = offsetsPtr[minCellId + 1] - offsetsPtr[minCellId];
-        const ValueType* cellPts = connectivityPtr + offsetsPtr[minCellId];
+        const vtkIdType nCellPts = state.GetCellSize(minCellId);
+        const ValueType* cellPts = connectivityPtr + state.GetBeginOffset(minCellId);
         match = true;
         for (j = 0; j < nPts && match; ++j) // for all pts in input boundary entity
         {
@@ -1844,6 +1959,12 @@ bool vtkUnstructuredGrid::IsCellBoundary(
     return false;
   }
 
+  // Use the face neighbors if possible
+  if (this->FindFaceNeighbor(cellId, npts, pts, neighborCellId))
+  {
+    return neighborCellId < 0;
+  }
+
   // Ensure that cell links are available.
   if (!this->Links)
   {
@@ -1884,6 +2005,17 @@ void vtkUnstructuredGrid::GetCellNeighbors(
     return;
   }
 
+  // Use the face neighbors if possible
+  vtkIdType neighborCellId;
+  if (this->FindFaceNeighbor(cellId, npts, pts, neighborCellId))
+  {
+    if (neighborCellId >= 0)
+    {
+      cellIds->InsertNextId(neighborCellId);
+    }
+    return;
+  }
+
   // Ensure that links are built.
   if (!this->Links)
   {
@@ -29,6 +29,8 @@ VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
 class vtkIdList;
 class vtkIdTypeArray;
+class vtkStaticFaceNeighbors;
+class vtkStaticPolyhedronTopology;
 class vtkUnsignedCharArray;
 class vtkIdTypeArray;
 
@@ -248,6 +250,42 @@ public:
   VTK_DEPRECATED_IN_9_3_0("Use GetLinks() instead.")
   vtkAbstractCellLinks* GetCellLinks();
 
+  /**
+   * Build the face neighbors of the cells (the cell across each face of each
+   * 3D cell, see vtkStaticFaceNeighbors), unless they are already built and
+   * the cells did not change since. This is optional: once built, the
+   * GetCellNeighbors() and IsCellBoundary() queries on the faces of the linear
+   * 3D cells and the polyhedra are answered with the face neighbors instead
+   * of searching the cell links, until the cells change. The face neighbors
+   * are shared with the shallow copies of the grid, so that the filters
+   * processing the same cells do not match their faces again.
+   */
+  void BuildFaceNeighbors();
+
+  /**
+   * Return the face neighbors of the cells if they are built and up to date
+   * with the cells, nullptr otherwise.
+   */
+  vtkStaticFaceNeighbors* GetFaceNeighbors();
+
+  /**
+   * Build the topology of the polyhedra (see vtkStaticPolyhedronTopology),
+   * unless it is already built and neither the cells nor the points changed
+   * since. This is optional: once built, the polyhedra returned by GetCell()
+   * are bound to it instead of deriving their faces, edges and triangulation
+   * each time, which speeds up the filters evaluating, contouring or clipping
+   * the same polyhedra repeatedly. The topology is read-only, so that the
+   * cells can be requested concurrently, and is shared with the shallow copies
+   * of the grid.
+   */
+  void BuildPolyhedronTopology();
+
+  /**
+   * Return the topology of the polyhedra if it is built and up to date with
+   * the cells and the points, nullptr otherwise.
+   */
+  vtkStaticPolyhedronTopology* GetPolyhedronTopology();
+
   /**
    * Get the face stream of a polyhedron cell in the following format:
    * (numCellFaces, numFace0Pts, id1, id2, id3, numFace1Pts,id1, id2, id3, ...).
@@ -300,7 +338,8 @@ public:
    * A topological inquiry to retrieve all of the cells using list of points
    * exclusive of the current cell specified (e.g., cellId).  THIS METHOD IS
    * THREAD SAFE IF FIRST CALLED FROM A SINGLE THREAD AND THE DATASET IS NOT
-   * MODIFIED.
+   * MODIFIED. If the face neighbors are built (see BuildFaceNeighbors()), the
+   * queries on the faces of 3D cells are answered with them.
    */
   void GetCellNeighbors(vtkIdType cellId, vtkIdList* ptIds, vtkIdList* cellIds) override
   {
@@ -319,7 +358,9 @@ public:
    * related to GetCellNeighbors() except that it simply indicates whether a
    * topological feature is boundary - hence the method is faster.
    * THIS METHOD IS THREAD SAFE IF FIRST CALLED FROM A
-   * SINGLE THREAD AND THE DATASET IS NOT MODIFIED.
+   * SINGLE THREAD AND THE DATASET IS NOT MODIFIED. If the face neighbors are
+   * built (see BuildFaceNeighbors()), the queries on the faces of 3D cells
+   * are answered with them.
    */
   bool IsCellBoundary(
     vtkIdType cellId, vtkIdType npts, const vtkIdType* ptIds, vtkIdType& neighborCellId);
@@ -578,6 +619,23 @@ protected:
   vtkSmartPointer<vtkCellArray> Faces;
   vtkSmartPointer<vtkCellArray> FaceLocations;
 
+  // The face neighbors of the cells, built on request, and valid until the
+  // cells change.
+  vtkSmartPointer<vtkStaticFaceNeighbors> FaceNeighbors;
+
+  // The topology of the polyhedra, built on request, and valid until the
+  // cells or the points change.
+  vtkSmartPointer<vtkStaticPolyhedronTopology> PolyhedronTopology;
+
+  // The last modification time of the cells, regardless of the points.
+  vtkMTimeType GetCellsMTime();
+
+  // Find the neighbor across the face of a cell made of the given points
+  // with the face neighbors. Return false if the face neighbors cannot
+  // answer, in which case the cell links must be searched.
+  bool FindFaceNeighbor(
+    vtkIdType cellId, vtkIdType npts, const vtkIdType* pts, vtkIdType& neighborCellId);
+
   // Legacy support -- stores the old-style cell array locations.
   vtkSmartPointer<vtkIdTypeArray> CellLocations;
 
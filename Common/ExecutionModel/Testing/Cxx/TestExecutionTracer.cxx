@@ -0,0 +1,83 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkElevationFilter.h"
+#include "vtkExecutionTracer.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkSphereSource.h"
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+
+namespace
+{
+//------------------------------------------------------------------------------
+bool Contains(const std::string& trace, const std::string& text)
+{
+  if (trace.find(text) == std::string::npos)
+  {
+    vtkLog(ERROR, "Trace does not contain " << text);
+    return false;
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestExecutionTracer(int, char*[])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  vtkNew<vtkElevationFilter> elevation;
+  elevation->SetObjectName("elevation");
+  elevation->SetInputConnection(sphere->GetOutputPort());
+
+  // Nothing is recorded while tracing is disabled.
+  vtkExecutionTracer::SetEnabled(false);
+  vtkExecutionTracer::Clear();
+  elevation->Update();
+  if (vtkExecutionTracer::GetNumberOfEvents() != 0)
+  {
+    vtkLog(ERROR, "Events were recorded while tracing was disabled.");
+    return EXIT_FAILURE;
+  }
+
+  vtkExecutionTracer::SetEnabled(true);
+  sphere->Modified();
+  elevation->Update();
+  {
+    vtkExecutionTracer::Scope scope("custom \"event\"", "test");
+    scope.AddArgument("text", "a\\b");
+    scope.AddArgument("integer", 42);
+    scope.AddArgument("real", 0.5);
+  }
+  vtkExecutionTracer::SetEnabled(false);
+
+  std::ostringstream stream;
+  vtkExecutionTracer::WriteTrace(stream);
+  const std::string trace = stream.str();
+  if (!Contains(trace, "{\"traceEvents\":[") ||
+    !Contains(trace, "\"name\":\"vtkSphereSource: REQUEST_DATA\"") ||
+    !Contains(trace, "\"name\":\"vtkSphereSource: REQUEST_INFORMATION\"") ||
+    !Contains(trace, "\"name\":\"elevation: REQUEST_UPDATE_EXTENT\"") ||
+    !Contains(trace, "\"name\":\"elevation: REQUEST_DATA\"") ||
+    !Contains(trace, "\"output_memory_kib\":") || !Contains(trace, "\"cat\":\"pipeline\"") ||
+    !Contains(trace, "\"name\":\"vtkSMPTools::For\",\"cat\":\"smp\"") ||
+    !Contains(trace, "\"name\":\"custom \\\"event\\\"\"") ||
+    !Contains(trace, "\"args\":{\"text\":\"a\\\\b\",\"integer\":42,\"real\":0.5}"))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Clearing discards the events.
+  const vtkIdType numberOfEvents = vtkExecutionTracer::GetNumberOfEvents();
+  vtkExecutionTracer::Clear();
+  if (numberOfEvents < 4 || vtkExecutionTracer::GetNumberOfEvents() != 0)
+  {
+    vtkLog(ERROR, "Wrong number of events: " << numberOfEvents);
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
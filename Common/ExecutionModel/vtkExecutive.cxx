@@ -5,6 +5,7 @@
 #include "vtkAlgorithm.h"
 #include "vtkAlgorithmOutput.h"
 #include "vtkDataObject.h"
+#include "vtkExecutionTracer.h"
 #include "vtkGarbageCollector.h"
 #include "vtkInformation.h"
 #include "vtkInformationExecutivePortKey.h"
@@ -12,11 +13,13 @@
 #include "vtkInformationIntegerKey.h"
 #include "vtkInformationIterator.h"
 #include "vtkInformationKeyVectorKey.h"
+#include "vtkInformationRequestKey.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkSmartPointer.h"
 
 #include <sstream>
+#include <string>
 #include <vector>
 
 #include "vtkCompositeDataPipeline.h"
@@ -711,6 +714,15 @@ void vtkExecutive::CopyDefaultInformation(vtkInformation* request, int direction
   }
 }
 
+//------------------------------------------------------------------------------
+// Return the name of the request key of a pipeline request, such as
+// REQUEST_DATA.
+static std::string vtkExecutiveGetRequestName(vtkInformation* request)
+{
+  vtkInformationRequestKey* key = request->GetRequest();
+  return key ? key->GetName() : "UNKNOWN_REQUEST";
+}
+
 //------------------------------------------------------------------------------
 int vtkExecutive::CallAlgorithm(vtkInformation* request, int direction,
   vtkInformationVector** inInfo, vtkInformationVector* outInfo)
@@ -718,11 +730,42 @@ int vtkExecutive::CallAlgorithm(vtkInformation* request, int direction,
   // Copy default information in the direction of information flow.
   this->CopyDefaultInformation(request, direction, inInfo, outInfo);
 
+  vtkExecutionTracer::Scope traceScope;
+  std::string requestName;
+  if (vtkExecutionTracer::GetEnabled())
+  {
+    requestName = vtkExecutiveGetRequestName(request);
+    std::string name = this->Algorithm->GetObjectName();
+    if (name.empty())
+    {
+      name = this->Algorithm->GetClassName();
+    }
+    name += ": " + requestName;
+    traceScope.Begin(name.c_str(), "pipeline");
+    traceScope.AddArgument("algorithm", this->Algorithm->GetObjectDescription().c_str());
+    traceScope.AddArgument("request", requestName.c_str());
+  }
+
   // Invoke the request on the algorithm.
   this->InAlgorithm = 1;
   int result = this->Algorithm->ProcessRequest(request, inInfo, outInfo);
   this->InAlgorithm = 0;
 
+  if (traceScope.IsActive() && requestName == "REQUEST_DATA")
+  {
+    // Memory size of the outputs, in kibibytes.
+    vtkTypeInt64 outputSize = 0;
+    for (int i = 0; i < outInfo->GetNumberOfInformationObjects(); ++i)
+    {
+      vtkDataObject* output = outInfo->GetInformationObject(i)->Get(vtkDataObject::DATA_OBJECT());
+      if (output)
+      {
+        outputSize += static_cast<vtkTypeInt64>(output->GetActualMemorySize());
+      }
+    }
+    traceScope.AddArgument("output_memory_kib", outputSize);
+  }
+
   // If the algorithm failed report it now.
   if (!result)
   {
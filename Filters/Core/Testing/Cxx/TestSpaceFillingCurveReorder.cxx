@@ -0,0 +1,359 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that vtkSpaceFillingCurveReorder sorts the points along the curves,
+// and permutes the connectivity and the attributes consistently.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkLogger.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSpaceFillingCurveReorder.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// A random permutation of the ids from 0 to n.
+std::vector<vtkIdType> Shuffled(vtkIdType n, int seed)
+{
+  std::vector<vtkIdType> ids(n);
+  std::iota(ids.begin(), ids.end(), 0);
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(seed);
+  for (vtkIdType i = n - 1; i > 0; --i)
+  {
+    const vtkIdType j = std::min(i, static_cast<vtkIdType>(random->GetNextRangeValue(0, i + 1)));
+    std::swap(ids[i], ids[j]);
+  }
+  return ids;
+}
+
+//------------------------------------------------------------------------------
+// The points of a lattice of dim^3 points of spacing 1, in random order, and
+// their id in the lattice.
+vtkNew<vtkPoints> LatticePoints(int dim, std::vector<vtkIdType>& latticeIds)
+{
+  latticeIds = Shuffled(dim * dim * dim, 1);
+  vtkNew<vtkPoints> points;
+  points->SetDataTypeToDouble();
+  for (vtkIdType id : latticeIds)
+  {
+    points->InsertNextPoint(id % dim, (id / dim) % dim, id / (dim * dim));
+  }
+  return points;
+}
+
+//------------------------------------------------------------------------------
+vtkIdTypeArray* GetIds(vtkDataSetAttributes* attributes, const char* name, vtkIdType n)
+{
+  auto ids = vtkIdTypeArray::SafeDownCast(attributes->GetArray(name));
+  if (!ids || ids->GetNumberOfValues() != n)
+  {
+    vtkLog(ERROR, << "Missing or wrong " << name << " array.");
+    return nullptr;
+  }
+  std::vector<vtkIdType> sorted(ids->GetPointer(0), ids->GetPointer(0) + n);
+  std::sort(sorted.begin(), sorted.end());
+  for (vtkIdType i = 0; i < n; ++i)
+  {
+    if (sorted[i] != i)
+    {
+      vtkLog(ERROR, << name << " is not a permutation.");
+      return nullptr;
+    }
+  }
+  return ids;
+}
+
+//------------------------------------------------------------------------------
+// The consecutive points along the Hilbert curve of a lattice of 8^3 points
+// are neighbors, and the ones along the Morton curve fill 2x2x2 blocks.
+bool TestCurves()
+{
+  std::vector<vtkIdType> latticeIds;
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(LatticePoints(8, latticeIds));
+
+  vtkNew<vtkSpaceFillingCurveReorder> reorder;
+  reorder->SetInputData(polyData);
+  reorder->Update();
+  vtkPoints* points = reorder->GetPolyDataOutput()->GetPoints();
+  for (vtkIdType ptId = 1; ptId < points->GetNumberOfPoints(); ++ptId)
+  {
+    double x[3], y[3];
+    points->GetPoint(ptId - 1, x);
+    points->GetPoint(ptId, y);
+    if (std::abs(x[0] - y[0]) + std::abs(x[1] - y[1]) + std::abs(x[2] - y[2]) != 1.0)
+    {
+      vtkLog(ERROR, << "Points " << ptId - 1 << " and " << ptId
+                    << " are not neighbors along the Hilbert curve.");
+      return false;
+    }
+  }
+
+  reorder->SetCurveToMorton();
+  reorder->Update();
+  points = reorder->GetPolyDataOutput()->GetPoints();
+  for (vtkIdType block = 0; block < points->GetNumberOfPoints() / 8; ++block)
+  {
+    double min[3] = { 8.0, 8.0, 8.0 }, max[3] = { -1.0, -1.0, -1.0 };
+    for (vtkIdType ptId = 8 * block; ptId < 8 * block + 8; ++ptId)
+    {
+      double x[3];
+      points->GetPoint(ptId, x);
+      for (int i = 0; i < 3; ++i)
+      {
+        min[i] = std::min(min[i], x[i]);
+        max[i] = std::max(max[i], x[i]);
+      }
+    }
+    if (max[0] - min[0] != 1.0 || max[1] - min[1] != 1.0 || max[2] - min[2] != 1.0)
+    {
+      vtkLog(ERROR, << "Block " << block << " of the Morton curve is not a cube.");
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Sum of the differences of the ids of the consecutive points of the cells.
+double IdSpread(vtkUnstructuredGrid* grid)
+{
+  double spread = 0.0;
+  vtkNew<vtkIdList> ptIds;
+  for (vtkIdType cellId = 0; cellId < grid->GetNumberOfCells(); ++cellId)
+  {
+    grid->GetCellPoints(cellId, ptIds);
+    for (vtkIdType i = 1; i < ptIds->GetNumberOfIds(); ++i)
+    {
+      spread += std::abs(ptIds->GetId(i) - ptIds->GetId(i - 1));
+    }
+  }
+  return spread;
+}
+
+//------------------------------------------------------------------------------
+// Build a grid of hexahedra and one polyhedron, with shuffled points and cells,
+// and check that the reordered grid is the same mesh.
+bool TestUnstructuredGrid()
+{
+  const int dim = 12;
+  std::vector<vtkIdType> latticeIds;
+  vtkNew<vtkPoints> points = LatticePoints(dim, latticeIds);
+  std::vector<vtkIdType> pointOfLatticeId(latticeIds.size());
+  for (vtkIdType ptId = 0; ptId < static_cast<vtkIdType>(latticeIds.size()); ++ptId)
+  {
+    pointOfLatticeId[latticeIds[ptId]] = ptId;
+  }
+  auto pointAt = [&](int i, int j, int k) { return pointOfLatticeId[i + dim * (j + dim * k)]; };
+
+  vtkNew<vtkUnstructuredGrid> grid;
+  grid->SetPoints(points);
+  const vtkIdType numHexes = (dim - 1) * (dim - 1) * (dim - 1);
+  const std::vector<vtkIdType> hexes = Shuffled(numHexes, 2);
+  for (vtkIdType h = 0; h < numHexes; ++h)
+  {
+    const int i = hexes[h] % (dim - 1), j = (hexes[h] / (dim - 1)) % (dim - 1),
+              k = hexes[h] / ((dim - 1) * (dim - 1));
+    const vtkIdType pts[8] = { pointAt(i, j, k), pointAt(i + 1, j, k), pointAt(i + 1, j + 1, k),
+      pointAt(i, j + 1, k), pointAt(i, j, k + 1), pointAt(i + 1, j, k + 1),
+      pointAt(i + 1, j + 1, k + 1), pointAt(i, j + 1, k + 1) };
+    if (h == numHexes / 2)
+    {
+      const vtkIdType faces[30] = { 4, pts[0], pts[3], pts[2], pts[1], 4, pts[4], pts[5], pts[6],
+        pts[7], 4, pts[0], pts[1], pts[5], pts[4], 4, pts[1], pts[2], pts[6], pts[5], 4, pts[2],
+        pts[3], pts[7], pts[6], 4, pts[3], pts[0], pts[4], pts[7] };
+      grid->InsertNextCell(VTK_POLYHEDRON, 8, pts, 6, faces);
+    }
+    else
+    {
+      grid->InsertNextCell(VTK_HEXAHEDRON, 8, pts);
+    }
+  }
+
+  // Attributes equal to the coordinates of the points and to the cell ids
+  vtkNew<vtkDoubleArray> coordinates;
+  coordinates->DeepCopy(points->GetData());
+  coordinates->SetName("Coordinates");
+  grid->GetPointData()->AddArray(coordinates);
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellIds");
+  cellIds->SetNumberOfValues(numHexes);
+  std::iota(cellIds->GetPointer(0), cellIds->GetPointer(0) + numHexes, 0);
+  grid->GetCellData()->AddArray(cellIds);
+
+  vtkNew<vtkSpaceFillingCurveReorder> reorder;
+  reorder->SetInputData(grid);
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(1), [&]() { reorder->Update(); });
+  vtkNew<vtkUnstructuredGrid> expected;
+  expected->DeepCopy(reorder->GetOutput());
+  reorder->Modified();
+  reorder->Update();
+  vtkUnstructuredGrid* output = vtkUnstructuredGrid::SafeDownCast(reorder->GetOutput());
+
+  const vtkIdType numPts = points->GetNumberOfPoints();
+  vtkIdTypeArray* originalPointIds =
+    GetIds(output->GetPointData(), "vtkOriginalPointIds", numPts);
+  vtkIdTypeArray* originalCellIds = GetIds(output->GetCellData(), "vtkOriginalCellIds", numHexes);
+  vtkIdTypeArray* expectedPointIds =
+    GetIds(expected->GetPointData(), "vtkOriginalPointIds", numPts);
+  vtkIdTypeArray* expectedCellIds =
+    GetIds(expected->GetCellData(), "vtkOriginalCellIds", numHexes);
+  if (!originalPointIds || !originalCellIds || !expectedPointIds || !expectedCellIds)
+  {
+    return false;
+  }
+  if (!std::equal(originalPointIds->GetPointer(0), originalPointIds->GetPointer(0) + numPts,
+        expectedPointIds->GetPointer(0)) ||
+    !std::equal(originalCellIds->GetPointer(0), originalCellIds->GetPointer(0) + numHexes,
+      expectedCellIds->GetPointer(0)))
+  {
+    vtkLog(ERROR, << "The order depends on the number of threads.");
+    return false;
+  }
+
+  // Same points and point data
+  auto outCoordinates =
+    vtkDoubleArray::SafeDownCast(output->GetPointData()->GetArray("Coordinates"));
+  for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+  {
+    double x[3], y[3];
+    output->GetPoint(ptId, x);
+    points->GetPoint(originalPointIds->GetValue(ptId), y);
+    if (!std::equal(x, x + 3, y) || !std::equal(x, x + 3, outCoordinates->GetPointer(3 * ptId)))
+    {
+      vtkLog(ERROR, << "Point " << ptId << " or its data is not permuted.");
+      return false;
+    }
+  }
+
+  // Same cells and cell data
+  auto outCellIds = vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("CellIds"));
+  vtkNew<vtkIdList> ptIds, inPtIds;
+  for (vtkIdType cellId = 0; cellId < numHexes; ++cellId)
+  {
+    const vtkIdType inCellId = originalCellIds->GetValue(cellId);
+    if (outCellIds->GetValue(cellId) != inCellId ||
+      output->GetCellType(cellId) != grid->GetCellType(inCellId))
+    {
+      vtkLog(ERROR, << "Cell " << cellId << " or its data is not permuted.");
+      return false;
+    }
+    if (output->GetCellType(cellId) == VTK_POLYHEDRON)
+    {
+      output->GetFaceStream(cellId, ptIds);
+      grid->GetFaceStream(inCellId, inPtIds);
+      // Map the point ids of the faces, not their sizes
+      vtkIdType nextSize = 1;
+      for (vtkIdType i = 1; i < ptIds->GetNumberOfIds(); ++i)
+      {
+        if (i == nextSize)
+        {
+          nextSize += ptIds->GetId(i) + 1;
+        }
+        else
+        {
+          ptIds->SetId(i, originalPointIds->GetValue(ptIds->GetId(i)));
+        }
+      }
+    }
+    else
+    {
+      output->GetCellPoints(cellId, ptIds);
+      grid->GetCellPoints(inCellId, inPtIds);
+      for (vtkIdType i = 0; i < ptIds->GetNumberOfIds(); ++i)
+      {
+        ptIds->SetId(i, originalPointIds->GetValue(ptIds->GetId(i)));
+      }
+    }
+    if (ptIds->GetNumberOfIds() != inPtIds->GetNumberOfIds() ||
+      !std::equal(ptIds->begin(), ptIds->end(), inPtIds->begin()))
+    {
+      vtkLog(ERROR, << "The points of cell " << cellId << " differ.");
+      return false;
+    }
+  }
+
+  // The points of the cells are much closer in memory
+  if (IdSpread(output) * 4 > IdSpread(grid))
+  {
+    vtkLog(ERROR, << "The locality is not improved.");
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// The cells of a polydata are sorted within each cell array.
+bool TestPolyData()
+{
+  std::vector<vtkIdType> latticeIds;
+  vtkNew<vtkPolyData> polyData;
+  polyData->SetPoints(LatticePoints(6, latticeIds));
+  vtkNew<vtkCellArray> verts, lines;
+  for (vtkIdType ptId = 0; ptId < polyData->GetNumberOfPoints(); ++ptId)
+  {
+    verts->InsertNextCell(1, &ptId);
+    if (ptId > 0)
+    {
+      const vtkIdType pts[2] = { ptId - 1, ptId };
+      lines->InsertNextCell(2, pts);
+    }
+  }
+  polyData->SetVerts(verts);
+  polyData->SetLines(lines);
+
+  vtkNew<vtkSpaceFillingCurveReorder> reorder;
+  reorder->SetInputData(polyData);
+  reorder->ReorderPointsOff();
+  reorder->Update();
+  vtkPolyData* output = reorder->GetPolyDataOutput();
+  const vtkIdType numVerts = verts->GetNumberOfCells();
+  const vtkIdType numCells = polyData->GetNumberOfCells();
+  vtkIdTypeArray* originalCellIds = GetIds(output->GetCellData(), "vtkOriginalCellIds", numCells);
+  if (!originalCellIds || output->GetVerts()->GetNumberOfCells() != numVerts ||
+    output->GetLines()->GetNumberOfCells() != lines->GetNumberOfCells())
+  {
+    return false;
+  }
+  vtkNew<vtkIdList> ptIds, inPtIds;
+  for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+  {
+    const vtkIdType inCellId = originalCellIds->GetValue(cellId);
+    output->GetCellPoints(cellId, ptIds);
+    polyData->GetCellPoints(inCellId, inPtIds);
+    if ((cellId < numVerts) != (inCellId < numVerts) ||
+      ptIds->GetNumberOfIds() != inPtIds->GetNumberOfIds() ||
+      !std::equal(ptIds->begin(), ptIds->end(), inPtIds->begin()))
+    {
+      vtkLog(ERROR, << "Cell " << cellId << " of the polydata is wrong.");
+      return false;
+    }
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestSpaceFillingCurveReorder(int, char*[])
+{
+  if (!TestCurves() || !TestUnstructuredGrid() || !TestPolyData())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -23,6 +23,7 @@
 #include "vtkMergePoints.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
+#include "vtkObjectPool.h"
 #include "vtkPlane.h"
 #include "vtkPlaneCutter.h"
 #include "vtkPointData.h"
@@ -486,7 +487,6 @@ void vtkCutter::DataSetCutter(vtkDataSet* input, vtkPolyData* output)
   int iter;
   vtkPoints* cellPts;
   vtkDoubleArray* cellScalars;
-  vtkGenericCell* cell;
   vtkCellArray *newVerts, *newLines, *newPolys;
   vtkPoints* newPoints;
   vtkDoubleArray* cutScalars;
@@ -576,9 +576,12 @@ void vtkCutter::DataSetCutter(vtkDataSet* input, vtkPolyData* output)
 
   // Compute some information for progress methods
   //
-  cell = vtkGenericCell::New();
+  vtkPooledObject<vtkGenericCell> cell;
   vtkContourHelper helper(this->Locator, newVerts, newLines, newPolys, inPD, inCD, outPD, outCD,
     estimatedSize, this->GenerateTriangles != 0);
+  // The cells interpolate the point data of the new points edge by edge; record
+  // these interpolations to interpolate all the arrays in batches instead.
+  outPD->BeginDeferredInterpolation(inPD);
   if (this->SortBy == VTK_SORT_BY_CELL)
   {
     vtkIdType numCuts = numContours * numCells;
@@ -687,10 +690,11 @@ void vtkCutter::DataSetCutter(vtkDataSet* input, vtkPolyData* output)
     }     // for all dimensions.
   }       // sort by value
 
+  outPD->EndDeferredInterpolation();
+
   // Update ourselves.  Because we don't know upfront how many verts, lines,
   // polys we've created, take care to reclaim memory.
   //
-  cell->Delete();
   cellScalars->Delete();
   cutScalars->Delete();
 
@@ -822,7 +826,7 @@ void vtkCutter::UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
 
   vtkSmartPointer<vtkCellIterator> cellIter =
     vtkSmartPointer<vtkCellIterator>::Take(input->NewCellIterator());
-  vtkNew<vtkGenericCell> cell;
+  vtkPooledObject<vtkGenericCell> cell;
   vtkIdList* pointIdList;
   double* scalarArrayPtr = cutScalars->GetPointer(0);
   double tempScalar;
@@ -833,6 +837,9 @@ void vtkCutter::UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
 
   vtkContourHelper helper(this->Locator, newVerts, newLines, newPolys, inPD, inCD, outPD, outCD,
     estimatedSize, this->GenerateTriangles != 0);
+  // The cells interpolate the point data of the new points edge by edge; record
+  // these interpolations to interpolate all the arrays in batches instead.
+  outPD->BeginDeferredInterpolation(inPD);
   if (this->SortBy == VTK_SORT_BY_CELL)
   {
     // Compute some information for progress methods
@@ -988,6 +995,8 @@ void vtkCutter::UnstructuredGridCutter(vtkDataSet* input, vtkPolyData* output)
     }       // for all dimensions (1,2,3).
   }         // sort by value
 
+  outPD->EndDeferredInterpolation();
+
   // Update ourselves.  Because we don't know upfront how many verts, lines,
   // polys we've created, take care to reclaim memory.
   //
@@ -3,9 +3,11 @@
 #include "vtkElevationFilter.h"
 
 #include "vtkArrayDispatch.h"
+#include "vtkArrayExpression.h"
 #include "vtkCellData.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
+#include "vtkExpressionArray.h"
 #include "vtkFloatArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
@@ -110,6 +112,28 @@ struct Elevate
   }
 };
 
+//------------------------------------------------------------------------------
+// Create an implicit array computing the elevation of the points on access.
+vtkSmartPointer<vtkDataArray> NewImplicitElevation(vtkDataArray* pointArray,
+  const double lowPoint[3], const double v[3], double l2, const double scalarRange[2])
+{
+  const vtkArrayExpression points = vtkArrayExpression::Array(pointArray);
+  vtkArrayExpression s = vtkArrayExpression::Constant(-vtkMath::Dot(lowPoint, v));
+  for (int i = 0; i < 3; ++i)
+  {
+    s = s + vtkArrayExpression::Component(points, i) * v[i];
+  }
+  s = vtkArrayExpression::Clamp(s / l2, 0., 1.);
+  s = vtkArrayExpression::Affine(s, scalarRange[1] - scalarRange[0], scalarRange[0]);
+
+  vtkSmartPointer<vtkExpressionArray<float>> scalars =
+    vtkSmartPointer<vtkExpressionArray<float>>::New();
+  scalars->ConstructBackend(s);
+  scalars->SetNumberOfComponents(1);
+  scalars->SetNumberOfTuples(pointArray->GetNumberOfTuples());
+  return scalars;
+}
+
 } // end anon namespace
 
 //------------------------------------------------------------------------------
@@ -141,6 +165,7 @@ void vtkElevationFilter::PrintSelf(ostream& os, vtkIndent indent)
      << this->HighPoint[2] << ")\n";
   os << indent << "Scalar Range: (" << this->ScalarRange[0] << ", " << this->ScalarRange[1]
      << ")\n";
+  os << indent << "Use Implicit Array: " << (this->UseImplicitArray ? "On\n" : "Off\n");
 }
 
 //------------------------------------------------------------------------------
@@ -159,10 +184,6 @@ int vtkElevationFilter::RequestData(
     return 1;
   }
 
-  // Allocate space for the elevation scalar data.
-  vtkSmartPointer<vtkFloatArray> newScalars = vtkSmartPointer<vtkFloatArray>::New();
-  newScalars->SetNumberOfTuples(numPts);
-
   // Set up 1D parametric system and make sure it is valid.
   double diffVector[3] = { this->HighPoint[0] - this->LowPoint[0],
     this->HighPoint[1] - this->LowPoint[1], this->HighPoint[2] - this->LowPoint[2] };
@@ -178,17 +199,30 @@ int vtkElevationFilter::RequestData(
 
   vtkDebugMacro("Generating elevation scalars!");
 
-  float* scalars = newScalars->GetPointer(0);
   vtkDataArray* pointsArray = input->GetPoints()->GetData();
-
-  Elevate worker; // Entry point to vtkElevationAlgorithm
-
-  // Generate an optimized fast-path for float/double
-  using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<vtkArrayDispatch::AllArrays,
-    vtkArrayDispatch::Reals>;
-  if (!Dispatcher::Execute(pointsArray, worker, this, diffVector, length2, scalars))
-  { // fallback for unknown arrays and integral value types:
-    worker(pointsArray, this, diffVector, length2, scalars);
+  vtkSmartPointer<vtkDataArray> newScalars;
+  if (this->UseImplicitArray)
+  {
+    newScalars = NewImplicitElevation(
+      pointsArray, this->LowPoint, diffVector, length2, this->ScalarRange);
+  }
+  else
+  {
+    // Allocate space for the elevation scalar data.
+    vtkSmartPointer<vtkFloatArray> floatScalars = vtkSmartPointer<vtkFloatArray>::New();
+    floatScalars->SetNumberOfTuples(numPts);
+    float* scalars = floatScalars->GetPointer(0);
+
+    Elevate worker; // Entry point to vtkElevationAlgorithm
+
+    // Generate an optimized fast-path for float/double
+    using Dispatcher = vtkArrayDispatch::DispatchByValueTypeUsingArrays<
+      vtkArrayDispatch::AllArrays, vtkArrayDispatch::Reals>;
+    if (!Dispatcher::Execute(pointsArray, worker, this, diffVector, length2, scalars))
+    { // fallback for unknown arrays and integral value types:
+      worker(pointsArray, this, diffVector, length2, scalars);
+    }
+    newScalars = floatScalars;
   }
 
   // Copy all the input geometry and data to the output.
@@ -63,6 +63,19 @@ public:
   vtkGetVectorMacro(ScalarRange, double, 2);
   ///@}
 
+  ///@{
+  /**
+   * When set, the elevation is output as a vtkExpressionArray<float>
+   * implicit array that computes it from the input points on access instead
+   * of storing it. This saves the memory of the output array and lets filters
+   * downstream fuse their own expressions with the elevation.
+   * This option is disabled by default.
+   */
+  vtkSetMacro(UseImplicitArray, bool);
+  vtkGetMacro(UseImplicitArray, bool);
+  vtkBooleanMacro(UseImplicitArray, bool);
+  ///@}
+
 protected:
   vtkElevationFilter();
   ~vtkElevationFilter() override;
@@ -72,6 +85,7 @@ protected:
   double LowPoint[3];
   double HighPoint[3];
   double ScalarRange[2];
+  bool UseImplicitArray = false;
 
 private:
   vtkElevationFilter(const vtkElevationFilter&) = delete;
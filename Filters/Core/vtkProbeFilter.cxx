@@ -17,6 +17,7 @@
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkObjectPool.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPolyData.h"
@@ -51,6 +52,62 @@ inline bool IsBlankedCell(vtkUnsignedCharArray* gcells, vtkIdType cellId)
   }
   return false;
 }
+
+// Interpolations of probed points, recorded to interpolate the point data of
+// blocks of points at once with vtkDataSetAttributes::InterpolatePoints().
+class PointInterpolations
+{
+public:
+  PointInterpolations(vtkDataSetAttributes::FieldList* list, vtkPointData* sourcePD,
+    int sourceIndex, vtkPointData* outputPD)
+    : List(list)
+    , SourcePD(sourcePD)
+    , SourceIndex(sourceIndex)
+    , OutputPD(outputPD)
+  {
+    this->Offsets.push_back(0);
+  }
+
+  void Add(vtkIdType pointId, vtkIdList* ids, const double* weights)
+  {
+    const vtkIdType numIds = ids->GetNumberOfIds();
+    this->ToIds.push_back(pointId);
+    this->FromIds.insert(this->FromIds.end(), ids->begin(), ids->end());
+    this->Weights.insert(this->Weights.end(), weights, weights + numIds);
+    this->Offsets.push_back(static_cast<vtkIdType>(this->FromIds.size()));
+    if (this->ToIds.size() >= BlockSize)
+    {
+      this->Interpolate();
+    }
+  }
+
+  void Interpolate()
+  {
+    if (this->ToIds.empty())
+    {
+      return;
+    }
+    this->OutputPD->InterpolatePoints(*this->List, this->SourcePD, this->SourceIndex,
+      static_cast<vtkIdType>(this->ToIds.size()), this->ToIds.data(), this->Offsets.data(),
+      this->FromIds.data(), this->Weights.data());
+    this->ToIds.clear();
+    this->Offsets.resize(1);
+    this->FromIds.clear();
+    this->Weights.clear();
+  }
+
+private:
+  static constexpr size_t BlockSize = 1024;
+
+  vtkDataSetAttributes::FieldList* List;
+  vtkPointData* SourcePD;
+  int SourceIndex;
+  vtkPointData* OutputPD;
+  std::vector<vtkIdType> ToIds;
+  std::vector<vtkIdType> Offsets;
+  std::vector<vtkIdType> FromIds;
+  std::vector<double> Weights;
+};
 }
 
 //------------------------------------------------------------------------------
@@ -411,8 +468,6 @@ class vtkProbeFilter::ProbeEmptyPointsWorklet
     vtkSmartPointer<vtkFindCellStrategy> Strategy;
     vtkCellLocatorStrategy* CellLocatorStrategy;
     vtkClosestPointStrategy* ClosestPointStrategy;
-    vtkSmartPointer<vtkGenericCell> CurrentCell;
-    vtkSmartPointer<vtkGenericCell> LastCell;
     std::vector<double> Weights;
     double LastPCoords[3];
     int LastSubId;
@@ -422,6 +477,8 @@ class vtkProbeFilter::ProbeEmptyPointsWorklet
     vtkIdType LastCellId;
   };
   vtkSMPThreadLocal<LocalData> TLData;
+  vtkSMPThreadLocalObject<vtkGenericCell> TLCurrentCell;
+  vtkSMPThreadLocalObject<vtkGenericCell> TLLastCell;
 
 public:
   ProbeEmptyPointsWorklet(vtkProbeFilter* probeFilter, int sourceIndex, vtkDataSet* input,
@@ -441,7 +498,7 @@ public:
     , MaxCellSize(maxCellSize)
   {
     // instantiate the cell map for polydata
-    vtkNew<vtkGenericCell> cell;
+    vtkPooledObject<vtkGenericCell> cell;
     this->Source->GetCell(0, cell);
   }
 
@@ -462,8 +519,6 @@ public:
       tlData.CellLocatorStrategy = nullptr;
       tlData.ClosestPointStrategy = nullptr;
     }
-    tlData.CurrentCell = vtkSmartPointer<vtkGenericCell>::New();
-    tlData.LastCell = vtkSmartPointer<vtkGenericCell>::New();
     tlData.Weights.resize(static_cast<size_t>(this->MaxCellSize));
     tlData.LastCellId = -1;
   }
@@ -477,8 +532,8 @@ public:
     auto& strategy = tlData.Strategy;
     auto& cellLocatorStrategy = tlData.CellLocatorStrategy;
     auto& closestPointStrategy = tlData.ClosestPointStrategy;
-    auto& currentCell = tlData.CurrentCell;
-    auto& lastCell = tlData.LastCell;
+    vtkGenericCell* currentCell = this->TLCurrentCell.Local();
+    vtkGenericCell* lastCell = this->TLLastCell.Local();
     auto weights = tlData.Weights.data();
     auto& lastPCoords = tlData.LastPCoords;
     auto& lastSubId = tlData.LastSubId;
@@ -493,6 +548,8 @@ public:
     bool foundInCache, insideCellBounds;
     bool isFirst = vtkSMPTools::GetSingleThread();
     vtkIdType checkAbortInterval = std::min((endPointId - beginPointId) / 10 + 1, (vtkIdType)1000);
+    PointInterpolations interpolations(
+      this->ProbeFilter->PointList, this->SourcePD, this->SourceIdx, this->OutputPD);
 
     for (vtkIdType pointId = beginPointId; pointId < endPointId; ++pointId)
     {
@@ -633,8 +690,7 @@ public:
         }
 
         // Interpolate the point data
-        this->OutputPD->InterpolatePoint(*this->ProbeFilter->PointList, this->SourcePD,
-          this->SourceIdx, pointId, currentCell->PointIds, weights);
+        interpolations.Add(pointId, currentCell->PointIds, weights);
         for (size_t i = 0, numArrays = this->ProbeFilter->InputCellArrays.size(); i < numArrays;
              ++i)
         {
@@ -648,6 +704,7 @@ public:
         maskArray[pointId] = static_cast<char>(1);
       }
     }
+    interpolations.Interpolate();
   }
 
   void Reduce() {}
@@ -1093,6 +1150,7 @@ void vtkProbeFilter::ProbeImageDataPointsSMP(vtkDataSet* input, vtkImageData* so
     vtkUnsignedCharArray::SafeDownCast(cd->GetArray(vtkDataSetAttributes::GhostArrayName()));
 
   // Loop over all input points, interpolating source data
+  PointInterpolations interpolations(this->PointList, pd, srcIdx, outPD);
   vtkIdType progressInterval = endId / 20 + 1;
   for (vtkIdType ptId = startId; ptId < endId; ptId++)
   {
@@ -1127,7 +1185,7 @@ void vtkProbeFilter::ProbeImageDataPointsSMP(vtkDataSet* input, vtkImageData* so
       source->GetCellPoints(cellId, pointIds);
 
       // Interpolate the point data
-      outPD->InterpolatePoint(*this->PointList, pd, srcIdx, ptId, pointIds, weights);
+      interpolations.Add(ptId, pointIds, weights);
       for (size_t i = 0, numArrays = this->InputCellArrays.size(); i < numArrays; ++i)
       {
         auto inputArray = this->InputCellArrays[i];
@@ -1140,6 +1198,7 @@ void vtkProbeFilter::ProbeImageDataPointsSMP(vtkDataSet* input, vtkImageData* so
       maskArray[ptId] = static_cast<char>(1);
     }
   }
+  interpolations.Interpolate();
 }
 
 //------------------------------------------------------------------------------
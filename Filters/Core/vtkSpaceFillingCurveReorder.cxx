@@ -0,0 +1,466 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkSpaceFillingCurveReorder.h"
+
+#include "vtkArrayListTemplate.h" // For processing attribute data
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkInformation.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkSpaceFillingCurveReorder);
+
+namespace
+{ // anonymous
+
+// Number of bits of the quantized coordinates, so that the positions on the
+// curve fit in 64 bits.
+constexpr int CurveBits = 21;
+constexpr double CurveMaxValue = static_cast<double>((1u << CurveBits) - 1);
+
+//------------------------------------------------------------------------------
+// Spread the CurveBits low bits of v, inserting two zero bits between
+// consecutive bits.
+inline std::uint64_t SpreadBits(std::uint64_t v)
+{
+  v &= 0x1fffff;
+  v = (v | v << 32) & 0x1f00000000ffffull;
+  v = (v | v << 16) & 0x1f0000ff0000ffull;
+  v = (v | v << 8) & 0x100f00f00f00f00full;
+  v = (v | v << 4) & 0x10c30c30c30c30c3ull;
+  v = (v | v << 2) & 0x1249249249249249ull;
+  return v;
+}
+
+//------------------------------------------------------------------------------
+// Transform the quantized coordinates into the "transposed" Hilbert index,
+// whose bits, interleaved from x[0] to x[2], give the position along the
+// curve (J. Skilling, "Programming the Hilbert curve", AIP Conf. Proc. 707,
+// 2004).
+inline void HilbertTranspose(std::uint32_t x[3])
+{
+  const std::uint32_t m = 1u << (CurveBits - 1);
+  for (std::uint32_t q = m; q > 1; q >>= 1)
+  {
+    const std::uint32_t p = q - 1;
+    for (int i = 0; i < 3; ++i)
+    {
+      if (x[i] & q)
+      {
+        x[0] ^= p; // invert
+      }
+      else
+      {
+        const std::uint32_t t = (x[0] ^ x[i]) & p; // exchange
+        x[0] ^= t;
+        x[i] ^= t;
+      }
+    }
+  }
+
+  // Gray encode
+  x[1] ^= x[0];
+  x[2] ^= x[1];
+  std::uint32_t t = 0;
+  for (std::uint32_t q = m; q > 1; q >>= 1)
+  {
+    if (x[2] & q)
+    {
+      t ^= q - 1;
+    }
+  }
+  x[0] ^= t;
+  x[1] ^= t;
+  x[2] ^= t;
+}
+
+//------------------------------------------------------------------------------
+// Map positions to their index along the curve covering the given bounds.
+class CurveEncoder
+{
+public:
+  CurveEncoder(const double bounds[6], int curve)
+    : Curve(curve)
+  {
+    for (int i = 0; i < 3; ++i)
+    {
+      const double width = bounds[2 * i + 1] - bounds[2 * i];
+      this->Origin[i] = bounds[2 * i];
+      this->Scale[i] = width > 0.0 ? CurveMaxValue / width : 0.0;
+    }
+  }
+
+  std::uint64_t Encode(const double x[3]) const
+  {
+    std::uint32_t q[3];
+    for (int i = 0; i < 3; ++i)
+    {
+      const double t = (x[i] - this->Origin[i]) * this->Scale[i];
+      q[i] = t > 0.0 ? static_cast<std::uint32_t>(std::min(t, CurveMaxValue)) : 0; // NaN gives 0
+    }
+    if (this->Curve == vtkSpaceFillingCurveReorder::HILBERT_CURVE)
+    {
+      HilbertTranspose(q);
+      return SpreadBits(q[0]) << 2 | SpreadBits(q[1]) << 1 | SpreadBits(q[2]);
+    }
+    return SpreadBits(q[2]) << 2 | SpreadBits(q[1]) << 1 | SpreadBits(q[0]);
+  }
+
+private:
+  double Origin[3];
+  double Scale[3];
+  int Curve;
+};
+
+//------------------------------------------------------------------------------
+// Sort the ids from 0 to n by the position on the curve given by
+// encode(id), equal positions keeping the order of the ids, and store the
+// sorted ids in order.
+template <class EncodeT>
+void SortAlongCurve(vtkIdType n, EncodeT&& encode, vtkIdType* order)
+{
+  std::vector<std::pair<std::uint64_t, vtkIdType>> keys(n);
+  vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType id = begin; id < end; ++id)
+    {
+      keys[id] = std::make_pair(encode(id), id);
+    }
+  });
+  vtkSMPTools::Sort(keys.begin(), keys.end());
+  vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      order[i] = keys[i].second;
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Sort the cells of cells along the curve by their centroid.
+void SortCells(
+  vtkCellArray* cells, vtkPoints* points, const CurveEncoder& encoder, vtkIdType* order)
+{
+  vtkSMPThreadLocalObject<vtkIdList> cellPointIds;
+  ::SortAlongCurve(
+    cells->GetNumberOfCells(),
+    [&](vtkIdType cellId) {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      cells->GetCellAtId(cellId, npts, pts, cellPointIds.Local());
+      double center[3] = { 0.0, 0.0, 0.0 };
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        double x[3];
+        points->GetPoint(pts[i], x);
+        center[0] += x[0];
+        center[1] += x[1];
+        center[2] += x[2];
+      }
+      if (npts > 0)
+      {
+        center[0] /= npts;
+        center[1] /= npts;
+        center[2] /= npts;
+      }
+      return encoder.Encode(center);
+    },
+    order);
+}
+
+//------------------------------------------------------------------------------
+// Build the cell array holding the cells of cells in the given order (new to
+// old ids, or the input order if null), their point ids being mapped through
+// pointMap (or kept if null).
+vtkSmartPointer<vtkCellArray> PermuteCells(
+  vtkCellArray* cells, const vtkIdType* order, const vtkIdType* pointMap)
+{
+  const vtkIdType numCells = cells->GetNumberOfCells();
+  vtkNew<vtkIdTypeArray> offsets;
+  offsets->SetNumberOfValues(numCells + 1);
+  vtkIdType* offsetsPtr = offsets->GetPointer(0);
+  offsetsPtr[0] = 0;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      offsetsPtr[cellId + 1] = cells->GetCellSize(order ? order[cellId] : cellId);
+    }
+  });
+  std::partial_sum(offsetsPtr, offsetsPtr + numCells + 1, offsetsPtr);
+
+  vtkNew<vtkIdTypeArray> connectivity;
+  connectivity->SetNumberOfValues(offsetsPtr[numCells]);
+  vtkIdType* connectivityPtr = connectivity->GetPointer(0);
+  vtkSMPThreadLocalObject<vtkIdList> cellPointIds;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* ids = cellPointIds.Local();
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      vtkIdType npts;
+      const vtkIdType* pts;
+      cells->GetCellAtId(order ? order[cellId] : cellId, npts, pts, ids);
+      vtkIdType* outPts = connectivityPtr + offsetsPtr[cellId];
+      for (vtkIdType i = 0; i < npts; ++i)
+      {
+        outPts[i] = pointMap ? pointMap[pts[i]] : pts[i];
+      }
+    }
+  });
+
+  auto permuted = vtkSmartPointer<vtkCellArray>::New();
+  permuted->SetData(offsets, connectivity);
+  return permuted;
+}
+
+//------------------------------------------------------------------------------
+// Copy the tuples of the input arrays to the output arrays in the given order
+// (new to old ids).
+void PermuteTuples(ArrayList& arrays, const vtkIdType* order, vtkIdType n)
+{
+  vtkSMPTools::For(0, n, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType i = begin; i < end; ++i)
+    {
+      arrays.Copy(order[i], i);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Copy and permute the attributes in the given order.
+void PermuteAttributes(
+  vtkDataSetAttributes* inAttributes, vtkDataSetAttributes* outAttributes, const vtkIdType* order,
+  vtkIdType n)
+{
+  outAttributes->CopyAllOn();
+  outAttributes->CopyAllocate(inAttributes, n);
+  ArrayList arrays;
+  arrays.AddArrays(n, inAttributes, outAttributes, 0.0, /*promote=*/false);
+  ::PermuteTuples(arrays, order, n);
+}
+
+//------------------------------------------------------------------------------
+// Add to attributes an id array holding the given ids.
+void AddIdsArray(
+  vtkDataSetAttributes* attributes, const char* name, const std::vector<vtkIdType>& ids)
+{
+  vtkNew<vtkIdTypeArray> array;
+  array->SetName(name);
+  array->SetNumberOfValues(static_cast<vtkIdType>(ids.size()));
+  std::copy(ids.begin(), ids.end(), array->GetPointer(0));
+  attributes->AddArray(array);
+}
+
+} // anonymous namespace
+
+//------------------------------------------------------------------------------
+vtkSpaceFillingCurveReorder::vtkSpaceFillingCurveReorder()
+  : Curve(HILBERT_CURVE)
+  , ReorderPoints(true)
+  , ReorderCells(true)
+  , GenerateOriginalPointIds(true)
+  , GenerateOriginalCellIds(true)
+  , OriginalPointIdsArrayName(nullptr)
+  , OriginalCellIdsArrayName(nullptr)
+{
+  this->SetOriginalPointIdsArrayName("vtkOriginalPointIds");
+  this->SetOriginalCellIdsArrayName("vtkOriginalCellIds");
+}
+
+//------------------------------------------------------------------------------
+vtkSpaceFillingCurveReorder::~vtkSpaceFillingCurveReorder()
+{
+  this->SetOriginalPointIdsArrayName(nullptr);
+  this->SetOriginalCellIdsArrayName(nullptr);
+}
+
+//------------------------------------------------------------------------------
+int vtkSpaceFillingCurveReorder::FillInputPortInformation(
+  int vtkNotUsed(port), vtkInformation* info)
+{
+  info->Set(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkPolyData");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkUnstructuredGrid");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+int vtkSpaceFillingCurveReorder::RequestData(vtkInformation* vtkNotUsed(request),
+  vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkPointSet* input = vtkPointSet::GetData(inputVector[0]);
+  vtkPointSet* output = vtkPointSet::GetData(outputVector);
+  vtkPolyData* inputPolyData = vtkPolyData::SafeDownCast(input);
+  vtkUnstructuredGrid* inputGrid = vtkUnstructuredGrid::SafeDownCast(input);
+  if (!inputPolyData && !inputGrid)
+  {
+    vtkErrorMacro(<< "Unsupported input type " << input->GetClassName() << ".");
+    return 0;
+  }
+
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  const vtkIdType numCells = input->GetNumberOfCells();
+  if (numPts == 0)
+  {
+    output->ShallowCopy(input);
+    return 1;
+  }
+
+  double bounds[6];
+  input->GetBounds(bounds);
+  const ::CurveEncoder encoder(bounds, this->Curve);
+  vtkPoints* inPts = input->GetPoints();
+
+  // Sort the points, and map the input point ids to the output ones
+  std::vector<vtkIdType> pointOrder(numPts);
+  if (this->ReorderPoints)
+  {
+    ::SortAlongCurve(
+      numPts,
+      [&](vtkIdType ptId) {
+        double x[3];
+        inPts->GetPoint(ptId, x);
+        return encoder.Encode(x);
+      },
+      pointOrder.data());
+  }
+  else
+  {
+    std::iota(pointOrder.begin(), pointOrder.end(), 0);
+  }
+  std::vector<vtkIdType> pointMap(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      pointMap[pointOrder[ptId]] = ptId;
+    }
+  });
+  this->UpdateProgress(0.25);
+
+  // Sort the cells, and build the output cells with the new point ids
+  std::vector<vtkIdType> cellOrder(numCells);
+  if (inputPolyData)
+  {
+    vtkPolyData* outputPolyData = vtkPolyData::SafeDownCast(output);
+    vtkCellArray* cellArrays[4] = { inputPolyData->GetVerts(), inputPolyData->GetLines(),
+      inputPolyData->GetPolys(), inputPolyData->GetStrips() };
+    vtkSmartPointer<vtkCellArray> outCellArrays[4];
+    vtkIdType offset = 0;
+    for (int i = 0; i < 4; ++i)
+    {
+      const vtkIdType numArrayCells = cellArrays[i]->GetNumberOfCells();
+      vtkIdType* order = cellOrder.data() + offset;
+      if (this->ReorderCells)
+      {
+        ::SortCells(cellArrays[i], inPts, encoder, order);
+      }
+      else
+      {
+        std::iota(order, order + numArrayCells, 0);
+      }
+      outCellArrays[i] = ::PermuteCells(cellArrays[i], order, pointMap.data());
+
+      // The cells of each array follow the ones of the previous arrays
+      std::transform(
+        order, order + numArrayCells, order, [offset](vtkIdType id) { return id + offset; });
+      offset += numArrayCells;
+    }
+    outputPolyData->SetVerts(outCellArrays[0]);
+    outputPolyData->SetLines(outCellArrays[1]);
+    outputPolyData->SetPolys(outCellArrays[2]);
+    outputPolyData->SetStrips(outCellArrays[3]);
+  }
+  else if (numCells > 0)
+  {
+    vtkUnstructuredGrid* outputGrid = vtkUnstructuredGrid::SafeDownCast(output);
+    vtkCellArray* cells = inputGrid->GetCells();
+    if (this->ReorderCells)
+    {
+      ::SortCells(cells, inPts, encoder, cellOrder.data());
+    }
+    else
+    {
+      std::iota(cellOrder.begin(), cellOrder.end(), 0);
+    }
+    vtkSmartPointer<vtkCellArray> outCells =
+      ::PermuteCells(cells, cellOrder.data(), pointMap.data());
+
+    vtkUnsignedCharArray* inTypes = inputGrid->GetCellTypesArray();
+    vtkNew<vtkUnsignedCharArray> outTypes;
+    outTypes->SetNumberOfValues(numCells);
+    vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
+      {
+        outTypes->SetValue(cellId, inTypes->GetValue(cellOrder[cellId]));
+      }
+    });
+
+    // The faces of the polyhedra keep their order, only the lists of faces of
+    // the cells are permuted
+    vtkSmartPointer<vtkCellArray> outFaceLocations, outFaces;
+    vtkCellArray* faceLocations = inputGrid->GetPolyhedronFaceLocations();
+    vtkCellArray* faces = inputGrid->GetPolyhedronFaces();
+    if (faceLocations && faces)
+    {
+      outFaceLocations = ::PermuteCells(faceLocations, cellOrder.data(), nullptr);
+      outFaces = ::PermuteCells(faces, nullptr, pointMap.data());
+    }
+    outputGrid->SetPolyhedralCells(outTypes, outCells, outFaceLocations, outFaces);
+  }
+  this->UpdateProgress(0.6);
+
+  // Permute the points and the attributes
+  ArrayList pointsArrays;
+  vtkStdString pointsName(inPts->GetData()->GetName() ? inPts->GetData()->GetName() : "");
+  vtkNew<vtkPoints> outPts;
+  outPts->SetData(vtkArrayDownCast<vtkDataArray>(
+    pointsArrays.AddArrayPair(numPts, inPts->GetData(), pointsName, 0.0, /*promote=*/false)));
+  ::PermuteTuples(pointsArrays, pointOrder.data(), numPts);
+  output->SetPoints(outPts);
+  ::PermuteAttributes(input->GetPointData(), output->GetPointData(), pointOrder.data(), numPts);
+  ::PermuteAttributes(input->GetCellData(), output->GetCellData(), cellOrder.data(), numCells);
+  output->GetFieldData()->ShallowCopy(input->GetFieldData());
+
+  if (this->GenerateOriginalPointIds)
+  {
+    ::AddIdsArray(output->GetPointData(), this->OriginalPointIdsArrayName, pointOrder);
+  }
+  if (this->GenerateOriginalCellIds)
+  {
+    ::AddIdsArray(output->GetCellData(), this->OriginalCellIdsArrayName, cellOrder);
+  }
+
+  this->CheckAbort();
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkSpaceFillingCurveReorder::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+
+  os << indent << "Curve: " << (this->Curve == HILBERT_CURVE ? "Hilbert" : "Morton") << endl;
+  os << indent << "ReorderPoints: " << this->ReorderPoints << endl;
+  os << indent << "ReorderCells: " << this->ReorderCells << endl;
+  os << indent << "GenerateOriginalPointIds: " << this->GenerateOriginalPointIds << endl;
+  os << indent << "GenerateOriginalCellIds: " << this->GenerateOriginalCellIds << endl;
+  os << indent << "OriginalPointIdsArrayName: "
+     << (this->OriginalPointIdsArrayName ? this->OriginalPointIdsArrayName : "(null)") << endl;
+  os << indent << "OriginalCellIdsArrayName: "
+     << (this->OriginalCellIdsArrayName ? this->OriginalCellIdsArrayName : "(null)") << endl;
+}
+VTK_ABI_NAMESPACE_END
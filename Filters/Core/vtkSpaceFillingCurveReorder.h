@@ -0,0 +1,134 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class   vtkSpaceFillingCurveReorder
+ * @brief   renumber the points and cells of a mesh along a space-filling curve
+ *
+ * vtkSpaceFillingCurveReorder renumbers the points and cells of a vtkPolyData
+ * or a vtkUnstructuredGrid so that points and cells close in space get close
+ * ids. Downstream filters traversing the cells and accessing their points,
+ * point data and cell data then touch memory in a more local order, which
+ * reduces cache misses on large meshes read in an arbitrary order.
+ *
+ * The points are sorted by the position of their coordinates along a Hilbert
+ * curve or a Morton (Z-order) curve covering the bounds of the input, and the
+ * cells by the position of their centroid, the average of their points. The
+ * Hilbert curve gives a slightly better locality, the Morton curve is a bit
+ * faster to compute. The cells of a vtkPolyData are sorted within each of its
+ * verts, lines, polys and strips arrays, since vtkPolyData orders its cells
+ * by array. The geometry and the topology are unchanged: the connectivity is
+ * updated with the new point ids, and all the point data and cell data are
+ * permuted accordingly. Arrays recording the original id of each point and
+ * cell can be generated.
+ *
+ * The coordinates are quantized on 21 bits per axis before being mapped on
+ * the curve; the points (or cells) falling in the same position of the curve
+ * keep their relative order. The computation of the positions on the curve,
+ * the sorting and the permutation of the connectivity and of the attributes
+ * are threaded with vtkSMPTools. The output does not depend on the number of
+ * threads.
+ *
+ * @sa
+ * vtkRemoveUnusedPoints vtkStaticCleanUnstructuredGrid vtkGenerateIds
+ */
+
+#ifndef vtkSpaceFillingCurveReorder_h
+#define vtkSpaceFillingCurveReorder_h
+
+#include "vtkFiltersCoreModule.h" // For export macro
+#include "vtkPointSetAlgorithm.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKFILTERSCORE_EXPORT vtkSpaceFillingCurveReorder : public vtkPointSetAlgorithm
+{
+public:
+  ///@{
+  /**
+   * Standard methods for construction, type information and printing.
+   */
+  static vtkSpaceFillingCurveReorder* New();
+  vtkTypeMacro(vtkSpaceFillingCurveReorder, vtkPointSetAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+  ///@}
+
+  /**
+   * The space-filling curves along which points and cells are sorted.
+   */
+  enum CurveType
+  {
+    HILBERT_CURVE = 0,
+    MORTON_CURVE
+  };
+
+  ///@{
+  /**
+   * Specify the curve along which the points and cells are sorted. By
+   * default, the Hilbert curve is used.
+   */
+  vtkSetClampMacro(Curve, int, HILBERT_CURVE, MORTON_CURVE);
+  vtkGetMacro(Curve, int);
+  void SetCurveToHilbert() { this->SetCurve(HILBERT_CURVE); }
+  void SetCurveToMorton() { this->SetCurve(MORTON_CURVE); }
+  ///@}
+
+  ///@{
+  /**
+   * Indicate whether the points, respectively the cells, are reordered. When
+   * off, they keep their input order. Both are on by default.
+   */
+  vtkSetMacro(ReorderPoints, bool);
+  vtkGetMacro(ReorderPoints, bool);
+  vtkBooleanMacro(ReorderPoints, bool);
+  vtkSetMacro(ReorderCells, bool);
+  vtkGetMacro(ReorderCells, bool);
+  vtkBooleanMacro(ReorderCells, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Enable adding to the point data, respectively to the cell data, an id
+   * array holding the input id of each output point, respectively cell. Both
+   * are on by default.
+   */
+  vtkSetMacro(GenerateOriginalPointIds, bool);
+  vtkGetMacro(GenerateOriginalPointIds, bool);
+  vtkBooleanMacro(GenerateOriginalPointIds, bool);
+  vtkSetMacro(GenerateOriginalCellIds, bool);
+  vtkGetMacro(GenerateOriginalCellIds, bool);
+  vtkBooleanMacro(GenerateOriginalCellIds, bool);
+  ///@}
+
+  ///@{
+  /**
+   * Choose the names of the original point ids and original cell ids arrays.
+   * Default are `vtkOriginalPointIds` and `vtkOriginalCellIds`.
+   */
+  vtkSetStringMacro(OriginalPointIdsArrayName);
+  vtkGetStringMacro(OriginalPointIdsArrayName);
+  vtkSetStringMacro(OriginalCellIdsArrayName);
+  vtkGetStringMacro(OriginalCellIdsArrayName);
+  ///@}
+
+protected:
+  vtkSpaceFillingCurveReorder();
+  ~vtkSpaceFillingCurveReorder() override;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+  int Curve;
+  bool ReorderPoints;
+  bool ReorderCells;
+  bool GenerateOriginalPointIds;
+  bool GenerateOriginalCellIds;
+  char* OriginalPointIdsArrayName;
+  char* OriginalCellIdsArrayName;
+
+private:
+  vtkSpaceFillingCurveReorder(const vtkSpaceFillingCurveReorder&) = delete;
+  void operator=(const vtkSpaceFillingCurveReorder&) = delete;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
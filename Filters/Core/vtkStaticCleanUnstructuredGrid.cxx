@@ -615,15 +615,10 @@ void vtkStaticCleanUnstructuredGrid::AveragePoints(vtkPoints* inPts, vtkPointDat
   vtkSMPTools::For(0, numInPts, count);
 
   // Perform a prefix sum to determine the offsets.
-  vtkIdType ptId, npts;
   std::unique_ptr<vtkIdType[]> uOffsets(new vtkIdType[numOutPts + 1]); // extra +1 for convenience
   vtkIdType* offsets = uOffsets.get();
-  offsets[0] = 0;
-  for (ptId = 1; ptId <= numOutPts; ++ptId)
-  {
-    npts = counts[ptId - 1];
-    offsets[ptId] = offsets[ptId - 1] + npts;
-  }
+  vtkSMPTools::ExclusiveScan(counts, counts + numOutPts, offsets, static_cast<vtkIdType>(0));
+  offsets[numOutPts] = numOutPts > 0 ? offsets[numOutPts - 1] + counts[numOutPts - 1] : 0;
 
   // Configure the "links" which are, for each output point, lists
   // the input points merged to that output point. The offsets point into
@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 //------------------------------------------------------------------------------
@@ -219,14 +220,29 @@ struct vtkThreshold::EvaluateCellsFunctor
 
   void Reduce()
   {
-    this->KeptCellsList->Allocate(this->NumberOfCells);
-    for (vtkIdType cellId = 0; cellId < this->NumberOfCells; ++cellId)
+    // Compact the ids of the kept cells: a prefix sum over the insideness gives the
+    // position of each kept cell in the output list.
+    if (this->NumberOfCells <= 0)
     {
-      if (this->InsidenessArray->GetValue(cellId))
+      this->KeptCellsList->Reset();
+      return;
+    }
+    auto insideness = vtk::DataArrayValueRange<1>(this->InsidenessArray);
+    std::vector<vtkIdType> positions(this->NumberOfCells);
+    vtkSMPTools::ExclusiveScan(
+      insideness.cbegin(), insideness.cend(), positions.begin(), static_cast<vtkIdType>(0));
+    const vtkIdType lastCell = this->NumberOfCells - 1;
+    this->KeptCellsList->SetNumberOfIds(positions[lastCell] + insideness[lastCell]);
+    vtkIdType* keptCells = this->KeptCellsList->GetPointer(0);
+    vtkSMPTools::For(0, this->NumberOfCells, [&](vtkIdType begin, vtkIdType end) {
+      for (vtkIdType cellId = begin; cellId < end; ++cellId)
       {
-        this->KeptCellsList->InsertNextId(cellId);
+        if (insideness[cellId])
+        {
+          keptCells[positions[cellId]] = cellId;
+        }
       }
-    }
+    });
   }
 };
 
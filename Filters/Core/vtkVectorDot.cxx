@@ -3,12 +3,15 @@
 #include "vtkVectorDot.h"
 
 #include "vtkArrayDispatch.h"
+#include "vtkArrayExpression.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
+#include "vtkExpressionArray.h"
 #include "vtkFloatArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkSMPTools.h"
@@ -194,6 +197,31 @@ int vtkVectorDot::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
+  if (this->UseImplicitArray)
+  {
+    vtkArrayExpression dot = vtkArrayExpression::Dot(
+      vtkArrayExpression::Array(inNormals), vtkArrayExpression::Array(inVectors));
+    double range[2] = { 0.0, 0.0 };
+    dot.ComputeRange(range);
+    this->ActualRange[0] = range[0];
+    this->ActualRange[1] = range[1];
+    if (this->GetMapScalars() && range[1] > range[0])
+    {
+      const double scale = (this->ScalarRange[1] - this->ScalarRange[0]) / (range[1] - range[0]);
+      dot = vtkArrayExpression::Affine(dot, scale, this->ScalarRange[0] - range[0] * scale);
+    }
+
+    vtkNew<vtkExpressionArray<float>> dotArray;
+    dotArray->ConstructBackend(dot);
+    dotArray->SetNumberOfComponents(1);
+    dotArray->SetNumberOfTuples(numPts);
+
+    outPD->PassData(input->GetPointData());
+    int idx = outPD->AddArray(dotArray);
+    outPD->SetActiveAttribute(idx, vtkDataSetAttributes::SCALARS);
+    return 1;
+  }
+
   // Allocate
   //
   newScalars = vtkFloatArray::New();
@@ -224,9 +252,9 @@ int vtkVectorDot::RequestData(vtkInformation* vtkNotUsed(request),
   // Map if requested:
   if (this->GetMapScalars())
   {
-    MapWorker mapWorker{ newScalars, aRange[1] - aRange[0], aRange[0],
-      static_cast<float>(this->ScalarRange[1] - this->ScalarRange[0]),
-      static_cast<float>(this->ScalarRange[0]), this };
+    MapWorker mapWorker{ newScalars, aRange[0], aRange[1] - aRange[0],
+      static_cast<float>(this->ScalarRange[0]),
+      static_cast<float>(this->ScalarRange[1] - this->ScalarRange[0]), this };
 
     vtkSMPTools::For(0, newScalars->GetNumberOfValues(), mapWorker);
   }
@@ -254,5 +282,7 @@ void vtkVectorDot::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Actual Range: (" << this->ActualRange[0] << ", " << this->ActualRange[1]
      << ")\n";
+
+  os << indent << "UseImplicitArray: " << (this->UseImplicitArray ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -68,6 +68,19 @@ public:
   vtkGetVectorMacro(ActualRange, double, 2);
   ///@}
 
+  ///@{
+  /**
+   * When set, the dot products are output as a vtkExpressionArray<float>
+   * implicit array that computes them from the normals and vectors on access
+   * instead of storing them. The mapping into ScalarRange is part of the
+   * expression. The actual range is still computed when the filter executes.
+   * This option is disabled by default.
+   */
+  vtkSetMacro(UseImplicitArray, bool);
+  vtkGetMacro(UseImplicitArray, bool);
+  vtkBooleanMacro(UseImplicitArray, bool);
+  ///@}
+
 protected:
   vtkVectorDot();
   ~vtkVectorDot() override = default;
@@ -75,6 +88,7 @@ protected:
   vtkTypeBool MapScalars;
   double ScalarRange[2];
   double ActualRange[2];
+  bool UseImplicitArray = false;
 
   int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
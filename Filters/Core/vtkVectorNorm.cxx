@@ -3,15 +3,18 @@
 #include "vtkVectorNorm.h"
 
 #include "vtkArrayDispatch.h"
+#include "vtkArrayExpression.h"
 #include "vtkCellData.h"
 #include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
+#include "vtkExpressionArray.h"
 #include "vtkFloatArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 
 #include <cmath>
 
@@ -96,7 +99,7 @@ struct vtkVectorNormDispatch // Interface between VTK and templated functions.
     {
       if (*itr > max)
       {
-        *itr = max;
+        max = *itr;
       }
     }
 
@@ -112,6 +115,41 @@ struct vtkVectorNormDispatch // Interface between VTK and templated functions.
     }
   }
 };
+
+//------------------------------------------------------------------------------
+// Create an implicit array computing the norm of the vectors on access.
+vtkSmartPointer<vtkDataArray> NewImplicitNorm(vtkDataArray* vectors, bool normalize)
+{
+  vtkArrayExpression norm = vtkArrayExpression::Norm(vtkArrayExpression::Array(vectors));
+  double range[2];
+  if (normalize && norm.ComputeRange(range) && range[1] > 0.0)
+  {
+    norm = norm / range[1];
+  }
+  vtkSmartPointer<vtkExpressionArray<float>> scalars =
+    vtkSmartPointer<vtkExpressionArray<float>>::New();
+  scalars->ConstructBackend(norm);
+  scalars->SetNumberOfComponents(1);
+  scalars->SetNumberOfTuples(vectors->GetNumberOfTuples());
+  return scalars;
+}
+
+//------------------------------------------------------------------------------
+// Compute and store the norm of the vectors.
+vtkSmartPointer<vtkDataArray> NewNorm(vtkDataArray* vectors, bool normalize, vtkVectorNorm* filter)
+{
+  vtkIdType numVectors = vectors->GetNumberOfTuples();
+  vtkSmartPointer<vtkFloatArray> scalars = vtkSmartPointer<vtkFloatArray>::New();
+  scalars->SetNumberOfTuples(numVectors);
+
+  vtkVectorNormDispatch normDispatch;
+  if (!vtkArrayDispatch::Dispatch::Execute(
+        vectors, normDispatch, normalize, numVectors, scalars->GetPointer(0), filter))
+  {
+    normDispatch(vectors, normalize, numVectors, scalars->GetPointer(0), filter);
+  }
+  return scalars;
+}
 }
 
 //=================================Begin class proper=========================
@@ -135,9 +173,8 @@ int vtkVectorNorm::RequestData(vtkInformation* vtkNotUsed(request),
   vtkDataSet* input = vtkDataSet::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
   vtkDataSet* output = vtkDataSet::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
-  vtkIdType numVectors;
   int computePtScalars = 1, computeCellScalars = 1;
-  vtkFloatArray* newScalars;
+  vtkSmartPointer<vtkDataArray> newScalars;
   vtkDataArray *ptVectors, *cellVectors;
   vtkPointData *pd = input->GetPointData(), *outPD = output->GetPointData();
   vtkCellData *cd = input->GetCellData(), *outCD = output->GetCellData();
@@ -166,26 +203,16 @@ int vtkVectorNorm::RequestData(vtkInformation* vtkNotUsed(request),
     return 1;
   }
 
-  // Needed for point and cell vector normals computation
-  vtkVectorNormDispatch normDispatch;
   bool normalize = (this->GetNormalize() != 0);
 
   // Allocate / operate on point data
   if (computePtScalars)
   {
-    numVectors = ptVectors->GetNumberOfTuples();
-    newScalars = vtkFloatArray::New();
-    newScalars->SetNumberOfTuples(numVectors);
-
-    if (!vtkArrayDispatch::Dispatch::Execute(
-          ptVectors, normDispatch, normalize, numVectors, newScalars->GetPointer(0), this))
-    {
-      normDispatch(ptVectors, normalize, numVectors, newScalars->GetPointer(0), this);
-    }
+    newScalars = this->UseImplicitArray ? NewImplicitNorm(ptVectors, normalize)
+                                        : NewNorm(ptVectors, normalize, this);
 
     int idx = outPD->AddArray(newScalars);
     outPD->SetActiveAttribute(idx, vtkDataSetAttributes::SCALARS);
-    newScalars->Delete();
     outPD->CopyScalarsOff();
   } // if computing point scalars
 
@@ -194,19 +221,11 @@ int vtkVectorNorm::RequestData(vtkInformation* vtkNotUsed(request),
   // Allocate / operate on cell data
   if (computeCellScalars)
   {
-    numVectors = cellVectors->GetNumberOfTuples();
-    newScalars = vtkFloatArray::New();
-    newScalars->SetNumberOfTuples(numVectors);
-
-    if (!vtkArrayDispatch::Dispatch::Execute(
-          cellVectors, normDispatch, normalize, numVectors, newScalars->GetPointer(0), this))
-    {
-      normDispatch(cellVectors, normalize, numVectors, newScalars->GetPointer(0), this);
-    }
+    newScalars = this->UseImplicitArray ? NewImplicitNorm(cellVectors, normalize)
+                                        : NewNorm(cellVectors, normalize, this);
 
     int idx = outCD->AddArray(newScalars);
     outCD->SetActiveAttribute(idx, vtkDataSetAttributes::SCALARS);
-    newScalars->Delete();
     outCD->CopyScalarsOff();
   } // if computing cell scalars
 
@@ -242,5 +261,6 @@ void vtkVectorNorm::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "Normalize: " << (this->Normalize ? "On\n" : "Off\n");
   os << indent << "Attribute Mode: " << this->GetAttributeModeAsString() << endl;
+  os << indent << "Use Implicit Array: " << (this->UseImplicitArray ? "On\n" : "Off\n");
 }
 VTK_ABI_NAMESPACE_END
@@ -69,6 +69,21 @@ public:
   const char* GetAttributeModeAsString();
   ///@}
 
+  ///@{
+  /**
+   * When set, the norms are output as vtkExpressionArray<float> implicit
+   * arrays that compute the norm of the input vectors on access instead of
+   * storing it. This saves the memory of the output arrays and lets filters
+   * downstream fuse their own expressions with the norm, at the cost of
+   * computing the norm on each access. With Normalize on, the maximum norm
+   * is still computed when the filter executes.
+   * This option is disabled by default.
+   */
+  vtkSetMacro(UseImplicitArray, bool);
+  vtkGetMacro(UseImplicitArray, bool);
+  vtkBooleanMacro(UseImplicitArray, bool);
+  ///@}
+
 protected:
   vtkVectorNorm();
   ~vtkVectorNorm() override = default;
@@ -77,6 +92,7 @@ protected:
 
   vtkTypeBool Normalize; // normalize 0<=n<=1 if true.
   int AttributeMode;     // control whether to use point or cell data, or both
+  bool UseImplicitArray = false;
 
 private:
   vtkVectorNorm(const vtkVectorNorm&) = delete;
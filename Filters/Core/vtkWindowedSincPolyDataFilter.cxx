@@ -23,6 +23,7 @@
 #include "vtkTriangleFilter.h"
 
 #include <atomic>
+#include <functional>
 #include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
@@ -433,16 +434,12 @@ struct PointConnectivity : PointConnectivityBase
   }
   void BuildOffsets()
   {
-    // Prefix sum over the offsets. Someday (e.g., C++17) could use system
-    // call to perform the prefix sum. The Offsets are initially setup at the
+    // Prefix sum over the offsets. The Offsets are initially setup at the
     // end of list of edges, and decremented until eventually they point at
     // the beginning of the list.
-    TIds offset = 0;
-    for (auto ptId = 0; ptId < this->NumPts; ++ptId)
-    {
-      offset += this->Offsets[ptId];
-      this->Offsets[ptId] = offset;
-    }
+    vtkSMPTools::InclusiveScan(
+      this->Offsets, this->Offsets + this->NumPts, this->Offsets, std::plus<TIds>());
+    TIds offset = this->NumPts > 0 ? static_cast<TIds>(this->Offsets[this->NumPts - 1]) : 0;
     this->Offsets[this->NumPts] = offset;
 
     // Now create space for edges to be written
@@ -0,0 +1,109 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include <vtkCellData.h>
+#include <vtkCompressArrays.h>
+#include <vtkCompressedArray.h>
+#include <vtkDataArraySelection.h>
+#include <vtkDoubleArray.h>
+#include <vtkImageData.h>
+#include <vtkIntArray.h>
+#include <vtkLogger.h>
+#include <vtkNew.h>
+#include <vtkPointData.h>
+#include <vtkRTAnalyticSource.h>
+
+#include <cmath>
+#include <cstring>
+
+namespace
+{
+bool CheckArray(vtkDataArray* input, vtkDataArray* output, double tolerance)
+{
+  if (output->GetNumberOfTuples() != input->GetNumberOfTuples() ||
+    output->GetNumberOfComponents() != input->GetNumberOfComponents())
+  {
+    vtkLog(ERROR, "Wrong size for " << input->GetName());
+    return false;
+  }
+  for (vtkIdType i = 0; i < input->GetNumberOfValues(); ++i)
+  {
+    const int numComps = input->GetNumberOfComponents();
+    const double value = input->GetComponent(i / numComps, i % numComps);
+    if (std::abs(output->GetComponent(i / numComps, i % numComps) - value) > tolerance)
+    {
+      vtkLog(ERROR, "Wrong value for " << input->GetName() << " at index " << i);
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestCompressArrays(int, char*[])
+{
+  vtkNew<vtkRTAnalyticSource> wavelet;
+  wavelet->SetWholeExtent(-20, 20, -20, 20, -20, 20);
+  wavelet->Update();
+  vtkNew<vtkImageData> image;
+  image->ShallowCopy(wavelet->GetOutput());
+
+  vtkNew<vtkDoubleArray> cellValues;
+  cellValues->SetName("CellValues");
+  cellValues->SetNumberOfComponents(2);
+  cellValues->SetNumberOfTuples(image->GetNumberOfCells());
+  for (vtkIdType i = 0; i < image->GetNumberOfCells(); ++i)
+  {
+    cellValues->SetTuple2(i, std::sqrt(i), -0.5 * i);
+  }
+  image->GetCellData()->AddArray(cellValues);
+  vtkNew<vtkIntArray> ids;
+  ids->SetName("Ids");
+  ids->SetNumberOfTuples(image->GetNumberOfCells());
+  ids->FillValue(1);
+  image->GetCellData()->AddArray(ids);
+
+  vtkNew<vtkCompressArrays> compress;
+  compress->SetInputData(image);
+  compress->GetPointDataArraySelection()->EnableArray("RTData");
+  compress->GetCellDataArraySelection()->EnableArray("CellValues");
+  compress->Update();
+
+  // Lossless compression of the selected arrays, attributes are preserved
+  vtkDataSet* output = vtkDataSet::SafeDownCast(compress->GetOutput());
+  vtkDataArray* rtData = output->GetPointData()->GetScalars();
+  if (!vtkCompressedArray<float>::SafeDownCast(rtData) || strcmp(rtData->GetName(), "RTData") != 0)
+  {
+    vtkLog(ERROR, "RTData should be compressed and remain the active scalars.");
+    return EXIT_FAILURE;
+  }
+  if (!vtkCompressedArray<double>::SafeDownCast(output->GetCellData()->GetArray("CellValues")) ||
+    output->GetCellData()->GetArray("Ids") != ids.Get())
+  {
+    vtkLog(ERROR, "Only the selected cell array should be compressed.");
+    return EXIT_FAILURE;
+  }
+  if (!CheckArray(image->GetPointData()->GetScalars(), rtData, 0.0) ||
+    !CheckArray(cellValues, output->GetCellData()->GetArray("CellValues"), 0.0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Lossy compression
+  compress->SetCompressionMethodToZFPFixedAccuracy();
+  compress->SetTolerance(1e-3);
+  compress->Update();
+  output = vtkDataSet::SafeDownCast(compress->GetOutput());
+  rtData = output->GetPointData()->GetScalars();
+  if (!CheckArray(image->GetPointData()->GetScalars(), rtData, 1e-3) ||
+    !CheckArray(cellValues, output->GetCellData()->GetArray("CellValues"), 1e-3))
+  {
+    return EXIT_FAILURE;
+  }
+  if (rtData->GetActualMemorySize() >= image->GetPointData()->GetScalars()->GetActualMemorySize())
+  {
+    vtkLog(ERROR, "The compressed RTData should be smaller than the input.");
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
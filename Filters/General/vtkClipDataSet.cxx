@@ -345,6 +345,9 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
   numNew[0] = numNew[1] = 0;
   bool sameCell[2] = { false, false };
 
+  // The cells interpolate the point data of the new points edge by edge; record
+  // these interpolations to interpolate all the arrays in batches instead.
+  outPD->BeginDeferredInterpolation(inPD);
   for (vtkIdType cellId = 0; cellId < numCells && !abort; cellId++)
   {
     if (!(cellId % updateTime))
@@ -435,6 +438,7 @@ int vtkClipDataSet::RequestData(vtkInformation* vtkNotUsed(request),
       }
     }
   }
+  outPD->EndDeferredInterpolation();
 
   if (this->ClipFunction)
   {
@@ -0,0 +1,182 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompressArrays.h"
+
+#include "vtkCommand.h"
+#include "vtkCompressedArray.h"
+#include "vtkDataArray.h"
+#include "vtkDataArraySelection.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkInformation.h"
+#include "vtkObjectFactory.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+vtkStandardNewMacro(vtkCompressArrays);
+
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ValueType>
+vtkSmartPointer<vtkDataArray> NewCompressedArray(
+  vtkDataArray* array, const vtkCompressedImplicitBackendOptions& options)
+{
+  if (vtkCompressedArray<ValueType>::SafeDownCast(array))
+  {
+    return nullptr;
+  }
+  vtkSmartPointer<vtkCompressedArray<ValueType>> compressed =
+    vtkSmartPointer<vtkCompressedArray<ValueType>>::New();
+  compressed->ConstructBackend(array, options);
+  compressed->SetNumberOfComponents(array->GetNumberOfComponents());
+  compressed->SetNumberOfTuples(array->GetNumberOfTuples());
+  compressed->SetName(array->GetName());
+  for (int comp = 0; comp < array->GetNumberOfComponents(); ++comp)
+  {
+    if (const char* compName = array->GetComponentName(comp))
+    {
+      compressed->SetComponentName(comp, compName);
+    }
+  }
+  return compressed;
+}
+}
+
+//------------------------------------------------------------------------------
+vtkCompressArrays::vtkCompressArrays()
+{
+  for (int cc = 0; cc < vtkDataObject::NUMBER_OF_ASSOCIATIONS; ++cc)
+  {
+    if (cc != vtkDataObject::FIELD_ASSOCIATION_POINTS_THEN_CELLS)
+    {
+      this->ArraySelections[cc] = vtkSmartPointer<vtkDataArraySelection>::New();
+      this->ArraySelections[cc]->AddObserver(
+        vtkCommand::ModifiedEvent, this, &vtkCompressArrays::Modified);
+    }
+  }
+}
+
+//------------------------------------------------------------------------------
+vtkCompressArrays::~vtkCompressArrays() = default;
+
+//------------------------------------------------------------------------------
+vtkDataArraySelection* vtkCompressArrays::GetArraySelection(int association)
+{
+  if (association >= 0 && association < vtkDataObject::NUMBER_OF_ASSOCIATIONS)
+  {
+    return this->ArraySelections[association];
+  }
+
+  return nullptr;
+}
+
+//------------------------------------------------------------------------------
+int vtkCompressArrays::FillInputPortInformation(int, vtkInformation* info)
+{
+  // Skip composite data sets so that executives will treat this as a simple filter
+  info->Remove(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE());
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkDataSet");
+  info->Append(vtkAlgorithm::INPUT_REQUIRED_DATA_TYPE(), "vtkTable");
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+vtkSmartPointer<vtkDataArray> vtkCompressArrays::Compress(vtkDataArray* array)
+{
+  // The compression methods of the filter match the ones of the backend
+  vtkCompressedImplicitBackendOptions options;
+  options.Method = this->CompressionMethod;
+  options.Rate = this->Rate;
+  options.Tolerance = this->Tolerance;
+  options.BlockSize = this->BlockSize;
+  options.CacheSize = this->CacheSize;
+
+  switch (array->GetDataType())
+  {
+    case VTK_FLOAT:
+      return NewCompressedArray<float>(array, options);
+    case VTK_DOUBLE:
+      return NewCompressedArray<double>(array, options);
+    default:
+      vtkWarningMacro("Array " << array->GetName()
+                               << " is not a floating point array and is not compressed.");
+      return nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+int vtkCompressArrays::RequestData(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  auto input = vtkDataObject::GetData(inputVector[0], 0);
+  auto output = vtkDataObject::GetData(outputVector, 0);
+  output->ShallowCopy(input);
+
+  for (int association = 0; association < vtkDataObject::NUMBER_OF_ASSOCIATIONS; ++association)
+  {
+    if (this->CheckAbort())
+    {
+      break;
+    }
+    if (association == vtkDataObject::FIELD_ASSOCIATION_POINTS_THEN_CELLS)
+    {
+      continue;
+    }
+
+    auto inFD = input->GetAttributesAsFieldData(association);
+    auto outFD = output->GetAttributesAsFieldData(association);
+    auto selection = this->GetArraySelection(association);
+    if (!inFD || !outFD || !selection)
+    {
+      continue;
+    }
+
+    auto inDSA = vtkDataSetAttributes::SafeDownCast(inFD);
+    auto outDSA = vtkDataSetAttributes::SafeDownCast(outFD);
+
+    for (int idx = 0, max = inFD->GetNumberOfArrays(); idx < max; ++idx)
+    {
+      vtkDataArray* inarray = inFD->GetArray(idx);
+      if (!inarray || !inarray->GetName() || !selection->ArrayIsEnabled(inarray->GetName()))
+      {
+        continue;
+      }
+      vtkSmartPointer<vtkDataArray> compressed = this->Compress(inarray);
+      if (!compressed)
+      {
+        continue;
+      }
+
+      // AddArray replaces the array of the same name, preserve attribute type flags.
+      outFD->AddArray(compressed);
+      for (int attr = 0; inDSA && outDSA && (attr < vtkDataSetAttributes::NUM_ATTRIBUTES); ++attr)
+      {
+        if (inDSA->GetAbstractAttribute(attr) == inarray)
+        {
+          outDSA->SetAttribute(compressed, attr);
+        }
+      }
+    }
+  }
+
+  return 1;
+}
+
+//------------------------------------------------------------------------------
+void vtkCompressArrays::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "CompressionMethod: " << this->CompressionMethod << endl;
+  os << indent << "Rate: " << this->Rate << endl;
+  os << indent << "Tolerance: " << this->Tolerance << endl;
+  os << indent << "BlockSize: " << this->BlockSize << endl;
+  os << indent << "CacheSize: " << this->CacheSize << endl;
+  os << indent << "PointDataArraySelection: " << endl;
+  this->GetPointDataArraySelection()->PrintSelf(os, indent.GetNextIndent());
+  os << indent << "CellDataArraySelection: " << endl;
+  this->GetCellDataArraySelection()->PrintSelf(os, indent.GetNextIndent());
+  os << indent << "FieldDataArraySelection: " << endl;
+  this->GetFieldDataArraySelection()->PrintSelf(os, indent.GetNextIndent());
+  os << indent << "RowDataArraySelection: " << endl;
+  this->GetRowDataArraySelection()->PrintSelf(os, indent.GetNextIndent());
+}
+VTK_ABI_NAMESPACE_END
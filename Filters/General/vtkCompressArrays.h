@@ -0,0 +1,160 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @class vtkCompressArrays
+ * @brief compress chosen arrays in memory
+ *
+ * vtkCompressArrays replaces chosen floating point arrays of its input by
+ * vtkCompressedArray implicit arrays, which hold the values compressed by blocks
+ * and decompress them on access. This reduces the memory needed to keep many
+ * large fields resident, for instance to cache several time steps for a
+ * temporal analysis. The output arrays keep the names and attribute types of
+ * the input arrays. The geometry and all the other arrays are passed through.
+ *
+ * The arrays to compress are chosen with the `vtkDataArraySelection` of each
+ * association, see `GetArraySelection`. No array is compressed by default. Only
+ * float and double arrays are compressed, other selected arrays are passed
+ * through.
+ *
+ * Compression is either lossless, with LZ4, or lossy with zfp at a fixed rate
+ * (bits per value) or a fixed accuracy (maximum absolute error). zfp is much
+ * more effective on smooth floating point fields, but the values must be
+ * finite.
+ *
+ * @sa
+ * vtkCompressedArray vtkCompressedImplicitBackend vtkPassSelectedArrays
+ */
+
+#ifndef vtkCompressArrays_h
+#define vtkCompressArrays_h
+
+#include "vtkDataObject.h"           // for vtkDataObject::FieldAssociations
+#include "vtkFiltersGeneralModule.h" // For export macro
+#include "vtkPassInputTypeAlgorithm.h"
+#include "vtkSmartPointer.h" // for ivar
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+class vtkDataArraySelection;
+
+class VTKFILTERSGENERAL_EXPORT vtkCompressArrays : public vtkPassInputTypeAlgorithm
+{
+public:
+  static vtkCompressArrays* New();
+  vtkTypeMacro(vtkCompressArrays, vtkPassInputTypeAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  enum CompressionMethods
+  {
+    LZ4 = 0,
+    ZFP_FIXED_RATE,
+    ZFP_FIXED_ACCURACY
+  };
+
+  ///@{
+  /**
+   * Set/Get the compression method. Only LZ4 is lossless. Default is LZ4.
+   */
+  vtkSetClampMacro(CompressionMethod, int, LZ4, ZFP_FIXED_ACCURACY);
+  vtkGetMacro(CompressionMethod, int);
+  void SetCompressionMethodToLZ4() { this->SetCompressionMethod(LZ4); }
+  void SetCompressionMethodToZFPFixedRate() { this->SetCompressionMethod(ZFP_FIXED_RATE); }
+  void SetCompressionMethodToZFPFixedAccuracy() { this->SetCompressionMethod(ZFP_FIXED_ACCURACY); }
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of bits per compressed value with the ZFP_FIXED_RATE
+   * method. Default is 16.
+   */
+  vtkSetClampMacro(Rate, double, 1.0, 64.0);
+  vtkGetMacro(Rate, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the maximum absolute error with the ZFP_FIXED_ACCURACY method.
+   * Default is 1e-6.
+   */
+  vtkSetClampMacro(Tolerance, double, 0.0, VTK_DOUBLE_MAX);
+  vtkGetMacro(Tolerance, double);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of tuples per compressed block. Larger blocks compress
+   * better but take longer to decompress when accessing a value of a block
+   * that is not cached. Default is 4096.
+   */
+  vtkSetClampMacro(BlockSize, vtkIdType, 1, VTK_ID_MAX);
+  vtkGetMacro(BlockSize, vtkIdType);
+  ///@}
+
+  ///@{
+  /**
+   * Set/Get the number of decompressed blocks cached by each thread for each
+   * array. Default is 4.
+   */
+  vtkSetClampMacro(CacheSize, int, 1, VTK_INT_MAX);
+  vtkGetMacro(CacheSize, int);
+  ///@}
+
+  /**
+   * Returns the vtkDataArraySelection instance associated with a particular
+   * array association type (vtkDataObject::FieldAssociations). Returns nullptr
+   * if the association type is invalid others the corresponding
+   * vtkDataArraySelection instance is returned.
+   */
+  vtkDataArraySelection* GetArraySelection(int association);
+
+  ///@{
+  /**
+   * Convenience methods that call `GetArraySelection` with corresponding
+   * association type.
+   */
+  vtkDataArraySelection* GetPointDataArraySelection()
+  {
+    return this->GetArraySelection(vtkDataObject::FIELD_ASSOCIATION_POINTS);
+  }
+  vtkDataArraySelection* GetCellDataArraySelection()
+  {
+    return this->GetArraySelection(vtkDataObject::FIELD_ASSOCIATION_CELLS);
+  }
+  vtkDataArraySelection* GetFieldDataArraySelection()
+  {
+    return this->GetArraySelection(vtkDataObject::FIELD_ASSOCIATION_NONE);
+  }
+  vtkDataArraySelection* GetRowDataArraySelection()
+  {
+    return this->GetArraySelection(vtkDataObject::FIELD_ASSOCIATION_ROWS);
+  }
+  ///@}
+
+protected:
+  vtkCompressArrays();
+  ~vtkCompressArrays() override;
+
+  int FillInputPortInformation(int port, vtkInformation* info) override;
+  int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
+
+  /**
+   * Create the compressed version of an array, or return nullptr if the array
+   * is not a floating point array or is already compressed.
+   */
+  vtkSmartPointer<vtkDataArray> Compress(vtkDataArray* array);
+
+  int CompressionMethod = LZ4;
+  double Rate = 16.0;
+  double Tolerance = 1e-6;
+  vtkIdType BlockSize = 4096;
+  int CacheSize = 4;
+
+private:
+  vtkCompressArrays(const vtkCompressArrays&) = delete;
+  void operator=(const vtkCompressArrays&) = delete;
+
+  vtkSmartPointer<vtkDataArraySelection> ArraySelections[vtkDataObject::NUMBER_OF_ASSOCIATIONS];
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
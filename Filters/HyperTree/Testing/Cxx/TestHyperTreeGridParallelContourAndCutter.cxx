@@ -0,0 +1,167 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+// Check that the contour and the plane cutter of hyper tree grids, which
+// process the trees in parallel, give the same output as when running with a
+// single thread.
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkDataArray.h"
+#include "vtkHyperTreeGrid.h"
+#include "vtkHyperTreeGridContour.h"
+#include "vtkHyperTreeGridPlaneCutter.h"
+#include "vtkHyperTreeGridSource.h"
+#include "vtkIdList.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+
+namespace
+{
+//------------------------------------------------------------------------------
+// Update the filter with at most numberOfThreads threads (0 for the default)
+// and return a copy of its output.
+vtkSmartPointer<vtkPolyData> Execute(vtkAlgorithm* filter, int numberOfThreads)
+{
+  vtkSMPTools::LocalScope(vtkSMPTools::Config(numberOfThreads), [&]() {
+    filter->Modified();
+    filter->Update();
+  });
+  auto output = vtkSmartPointer<vtkPolyData>::New();
+  output->DeepCopy(filter->GetOutputDataObject(0));
+  return output;
+}
+
+//------------------------------------------------------------------------------
+bool AreSameArrays(vtkDataArray* array1, vtkDataArray* array2)
+{
+  if (array1->GetNumberOfTuples() != array2->GetNumberOfTuples() ||
+    array1->GetNumberOfComponents() != array2->GetNumberOfComponents())
+  {
+    return false;
+  }
+  for (vtkIdType i = 0; i < array1->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < array1->GetNumberOfComponents(); ++c)
+    {
+      if (array1->GetComponent(i, c) != array2->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool AreSameCells(vtkCellArray* cells1, vtkCellArray* cells2)
+{
+  if (cells1->GetNumberOfCells() != cells2->GetNumberOfCells())
+  {
+    return false;
+  }
+  vtkNew<vtkIdList> ids1;
+  vtkNew<vtkIdList> ids2;
+  for (vtkIdType cellId = 0; cellId < cells1->GetNumberOfCells(); ++cellId)
+  {
+    cells1->GetCellAtId(cellId, ids1);
+    cells2->GetCellAtId(cellId, ids2);
+    if (ids1->GetNumberOfIds() != ids2->GetNumberOfIds() ||
+      !std::equal(ids1->begin(), ids1->end(), ids2->begin()))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool AreSameAttributes(vtkDataSetAttributes* attributes1, vtkDataSetAttributes* attributes2)
+{
+  if (attributes1->GetNumberOfArrays() != attributes2->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int i = 0; i < attributes1->GetNumberOfArrays(); ++i)
+  {
+    vtkDataArray* array1 = attributes1->GetArray(i);
+    vtkDataArray* array2 = attributes2->GetArray(array1 ? array1->GetName() : "");
+    if (array1 && (!array2 || !AreSameArrays(array1, array2)))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+bool TestFilter(vtkAlgorithm* filter, const char* name)
+{
+  vtkSmartPointer<vtkPolyData> expected = Execute(filter, 1);
+  vtkSmartPointer<vtkPolyData> output = Execute(filter, 0);
+  if (expected->GetNumberOfCells() == 0)
+  {
+    vtkLog(ERROR, << "The " << name << " is empty.");
+    return false;
+  }
+  if (!AreSameArrays(output->GetPoints()->GetData(), expected->GetPoints()->GetData()) ||
+    !AreSameCells(output->GetVerts(), expected->GetVerts()) ||
+    !AreSameCells(output->GetLines(), expected->GetLines()) ||
+    !AreSameCells(output->GetPolys(), expected->GetPolys()) ||
+    !AreSameAttributes(output->GetPointData(), expected->GetPointData()) ||
+    !AreSameAttributes(output->GetCellData(), expected->GetCellData()))
+  {
+    vtkLog(ERROR, << "The " << name << " differs when using " << vtkSMPTools::GetBackend()
+                  << " with " << vtkSMPTools::GetEstimatedNumberOfThreads() << " threads.");
+    return false;
+  }
+  return true;
+}
+} // anonymous namespace
+
+int TestHyperTreeGridParallelContourAndCutter(int, char*[])
+{
+  // Hyper tree grid of 4x3x2 trees
+  vtkNew<vtkHyperTreeGridSource> htGrid;
+  htGrid->SetMaxDepth(4);
+  htGrid->SetDimensions(5, 4, 3);
+  htGrid->SetGridScale(1.5, 1., .7);
+  htGrid->SetBranchFactor(2);
+  htGrid->SetDescriptor("RRR.R...R.R..R.RR.R..R.R|"
+                        "R....... ........ R.R..... ........ .R.....R ..R..... "
+                        "R....... ........ ....R... .R.....R ......R. ..R.....|"
+                        "........ ........ ........ ........ ........ R....... "
+                        "........ ........ ........ ........ ........ ........|"
+                        "........");
+  htGrid->Update();
+  vtkHyperTreeGrid* htg = vtkHyperTreeGrid::SafeDownCast(htGrid->GetOutput());
+  htg->GetCellData()->SetScalars(htg->GetCellData()->GetArray("Depth"));
+
+  vtkNew<vtkHyperTreeGridContour> contour;
+  contour->SetInputConnection(htGrid->GetOutputPort());
+  contour->SetNumberOfContours(2);
+  contour->SetValue(0, 0.5);
+  contour->SetValue(1, 1.5);
+
+  vtkNew<vtkHyperTreeGridPlaneCutter> cutter;
+  cutter->SetInputConnection(htGrid->GetOutputPort());
+  cutter->SetPlane(1., -.2, .2, 2.);
+
+  vtkNew<vtkHyperTreeGridPlaneCutter> dualCutter;
+  dualCutter->SetInputConnection(htGrid->GetOutputPort());
+  dualCutter->SetPlane(1., -.2, .2, 2.);
+  dualCutter->DualOn();
+
+  if (!TestFilter(contour, "contour") || !TestFilter(cutter, "plane cut") ||
+    !TestFilter(dualCutter, "dual plane cut"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
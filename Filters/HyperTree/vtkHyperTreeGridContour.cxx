@@ -6,6 +6,7 @@
 #include "vtkArrayDispatch.h"
 #include "vtkBitArray.h"
 #include "vtkCellArray.h"
+#include "vtkCellArrayIterator.h"
 #include "vtkCellData.h"
 #include "vtkCellIterator.h"
 #include "vtkCompositeArray.h"
@@ -18,6 +19,8 @@
 #include "vtkHyperTreeGridNonOrientedCursor.h"
 #include "vtkHyperTreeGridNonOrientedGeometryCursor.h"
 #include "vtkHyperTreeGridNonOrientedMooreSuperCursor.h"
+#include "vtkHyperTreeGridParallelInternal.h"
+#include "vtkHyperTreeGridParallelTraversal.h"
 #include "vtkIdTypeArray.h"
 #include "vtkIncrementalPointLocator.h"
 #include "vtkIndexedArray.h"
@@ -32,6 +35,8 @@
 #include "vtkPolyData.h"
 #include "vtkPolyhedron.h"
 #include "vtkPolyhedronUtilities.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkUnstructuredGrid.h"
 #include "vtkVoxel.h"
@@ -262,6 +267,23 @@ struct ConvertToIndexedArrayWorker
   }
 };
 
+// Append the cells of from to to, renumbering their points with pointMap.
+void AppendCells(vtkCellArray* from, vtkCellArray* to, const std::vector<vtkIdType>& pointMap)
+{
+  vtkIdType npts;
+  const vtkIdType* pts;
+  auto iter = vtk::TakeSmartPointer(from->NewIterator());
+  for (iter->GoToFirstCell(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
+  {
+    iter->GetCurrentCell(npts, pts);
+    to->InsertNextCell(npts);
+    for (vtkIdType i = 0; i < npts; ++i)
+    {
+      to->InsertCellPoint(pointMap[pts[i]]);
+    }
+  }
+}
+
 // Given the contour array name, the contour values and the output attributes,
 // replace the contour array found in the attibutes by an indexed array.
 // If there are less than 256 contour values:
@@ -309,6 +331,44 @@ void ReplaceWithIndexedArray(const std::string& contourArrayName, vtkContourValu
 //------------------------------------------------------------------------------
 struct vtkHyperTreeGridContour::vtkInternals
 {
+  // Cells selected by the first pass and signs of the cells relative to each
+  // contour value, written concurrently by the trees
+  ::AtomicBitArray SelectedCells;
+  std::vector<::AtomicBitArray> CellSigns;
+};
+
+//------------------------------------------------------------------------------
+struct vtkHyperTreeGridContour::vtkTreeBatch
+{
+  vtkTreeBatch()
+  {
+    this->Polyhedron->GetPointIds()->SetNumberOfIds(::POLY_POINTS_NB);
+    this->Polyhedron->GetPoints()->SetNumberOfPoints(::POLY_POINTS_NB);
+    this->Faces->AllocateExact(::POLY_FACES_NB, ::POLY_FACES_POINTS_NB * ::POLY_FACES_NB);
+  }
+
+  // Output of the batch
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkIncrementalPointLocator> Locator;
+  vtkNew<vtkCellArray> Verts;
+  vtkNew<vtkCellArray> Lines;
+  vtkNew<vtkCellArray> Polys;
+  vtkSmartPointer<vtkPointData> OutPointData;
+
+  // Point data of the dual mesh, i.e. input cell data used for contouring
+  vtkPointData* DualPointData = nullptr;
+
+  // Structures needed to perform isocontouring
+  std::unique_ptr<vtkContourHelper> Helper;
+  vtkSmartPointer<vtkDataArray> CellScalars;
+  vtkNew<vtkLine> Line;
+  vtkNew<vtkPixel> Pixel;
+  vtkNew<vtkVoxel> Voxel;
+  vtkNew<vtkIdList> Leaves;
+
+  // Index of the current dual cell in the batch
+  vtkIdType CurrentId = 0;
+
   // Temporary data structures related to USE_DECOMPOSED_POLYHEDRA strategy
   vtkNew<vtkCellArray> Faces;
   vtkNew<vtkPolyhedron> Polyhedron;
@@ -329,34 +389,12 @@ vtkHyperTreeGridContour::vtkHyperTreeGridContour()
   // Initialize locator to null
   this->Locator = nullptr;
 
-  // Initialize list of selected cells
-  this->SelectedCells = nullptr;
-
-  // Initialize per-cell quantities of interest
-  this->CellSigns = nullptr;
-  this->CellScalars = nullptr;
-
-  // Initialize structures for isocontouring
-  this->Helper = nullptr;
-  this->Leaves = vtkIdList::New();
-  this->Line = vtkLine::New();
-  this->Pixel = vtkPixel::New();
-  this->Voxel = vtkVoxel::New();
-
-  // Output indices begin at 0
-  this->CurrentId = 0;
-
   // Process active point scalars by default
   this->SetInputArrayToProcess(
     0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS_THEN_CELLS, vtkDataSetAttributes::SCALARS);
 
   // Input scalars point to null by default
   this->InScalars = nullptr;
-
-  // Initialize temporal structures related to USE_DECOMPOSED_POLYHEDRA strategy
-  this->Internals->Polyhedron->GetPointIds()->SetNumberOfIds(::POLY_POINTS_NB);
-  this->Internals->Polyhedron->GetPoints()->SetNumberOfPoints(::POLY_POINTS_NB);
-  this->Internals->Faces->AllocateExact(::POLY_FACES_NB, ::POLY_FACES_POINTS_NB * ::POLY_FACES_NB);
 }
 
 //------------------------------------------------------------------------------
@@ -373,30 +411,6 @@ vtkHyperTreeGridContour::~vtkHyperTreeGridContour()
     this->Locator->Delete();
     this->Locator = nullptr;
   }
-
-  if (this->Line)
-  {
-    this->Line->Delete();
-    this->Line = nullptr;
-  }
-
-  if (this->Pixel)
-  {
-    this->Pixel->Delete();
-    this->Pixel = nullptr;
-  }
-
-  if (this->Voxel)
-  {
-    this->Voxel->Delete();
-    this->Voxel = nullptr;
-  }
-
-  if (this->Leaves)
-  {
-    this->Leaves->Delete();
-    this->Leaves = nullptr;
-  }
 }
 
 //------------------------------------------------------------------------------
@@ -406,8 +420,6 @@ void vtkHyperTreeGridContour::PrintSelf(ostream& os, vtkIndent indent)
 
   this->ContourValues->PrintSelf(os, indent.GetNextIndent());
 
-  os << indent << "CurrentId: " << this->CurrentId << endl;
-
   if (this->InScalars)
   {
     os << indent << "InScalars:\n";
@@ -426,42 +438,6 @@ void vtkHyperTreeGridContour::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Locator: (none)\n";
   }
-
-  if (this->Line)
-  {
-    os << indent << ": " << this->Line << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Pixel)
-  {
-    os << indent << ": " << this->Pixel << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Voxel)
-  {
-    os << indent << ": " << this->Voxel << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
-
-  if (this->Leaves)
-  {
-    os << indent << ": " << this->Leaves << "\n";
-  }
-  else
-  {
-    os << indent << ": (none)\n";
-  }
 }
 
 //------------------------------------------------------------------------------
@@ -554,9 +530,6 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   this->OutData = output->GetPointData();
   this->OutData->CopyAllocate(this->InData);
 
-  // Output indices begin at 0
-  this->CurrentId = 0;
-
   // Retrieve material mask
   this->InMask = input->HasMask() ? input->GetMask() : nullptr;
 
@@ -574,89 +547,145 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
     estimatedSize = 1024;
   }
 
-  // Create storage for output points
-  vtkPoints* newPts = vtkPoints::New();
-  newPts->Allocate(estimatedSize, estimatedSize);
-
-  // Create storage for output vertices
-  vtkNew<vtkCellArray> newVerts;
-  newVerts->AllocateExact(estimatedSize, estimatedSize);
-
-  // Create storage for output lines
-  vtkNew<vtkCellArray> newLines;
-  newLines->AllocateExact(estimatedSize, estimatedSize);
-
-  // Create storage for output polygons
-  vtkNew<vtkCellArray> newPolys;
-  newPolys->AllocateExact(estimatedSize, estimatedSize);
-
-  // Create storage for output scalar values
-  this->CellScalars = this->InScalars->NewInstance();
-  this->CellScalars->SetNumberOfComponents(this->InScalars->GetNumberOfComponents());
-  this->CellScalars->Allocate(this->CellScalars->GetNumberOfComponents() * 8);
-
   // Initialize point locator
   if (!this->Locator)
   {
     // Create default locator if needed
     this->CreateDefaultLocator();
   }
-  this->Locator->InitPointInsertion(newPts, input->GetBounds(), estimatedSize);
+  double bounds[6];
+  input->GetBounds(bounds);
 
   // Used to store the input cell data (hyper tree grid cells)
   // as point data (dual mesh point data), the two being equivalent.
   vtkNew<vtkPointData> dualPointData;
   dualPointData->PassData(input->GetCellData());
 
-  // Instantiate a contour helper for convenience, with triangle generation on
-  this->Helper = new vtkContourHelper(this->Locator, newVerts, newLines, newPolys, dualPointData,
-    nullptr, output->GetPointData(), nullptr, estimatedSize, true);
-
-  // Create storage to keep track of selected cells
-  this->SelectedCells = vtkBitArray::New();
-  this->SelectedCells->SetNumberOfTuples(numCells);
-
-  // Initialize storage for signs and values
-  // NOLINTNEXTLINE(bugprone-sizeof-expression)
-  this->CellSigns = (vtkBitArray**)malloc(numContours * sizeof(*this->CellSigns));
-  this->Signs.resize(numContours, true);
-  for (int c = 0; c < numContours; ++c)
+  // Create storage to keep track of selected cells and of their signs, indexed
+  // by global node index
+  const vtkIdType numIndices = std::max(numCells, input->GetGlobalNodeIndexMax() + 1);
+  this->Internals->SelectedCells.Initialize(numIndices);
+  this->Internals->CellSigns.resize(numContours);
+  for (auto& cellSigns : this->Internals->CellSigns)
   {
-    this->CellSigns[c] = vtkBitArray::New();
-    this->CellSigns[c]->SetNumberOfTuples(numCells);
+    cellSigns.Initialize(numIndices);
   }
 
-  // First pass across tree roots to evince cells intersected by contours
-  vtkIdType index;
-  vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-  input->InitializeTreeIterator(it);
-  vtkNew<vtkHyperTreeGridNonOrientedCursor> cursor;
-  while (it.GetNextTree(index))
+  // First pass across tree roots to evince cells intersected by contours.
+  // Each tree only writes the flags of its own cells.
+  vtk::hypertreegrid::ForEachTree<vtkHyperTreeGridNonOrientedCursor>(input,
+    [this, numContours](vtkHyperTreeGridNonOrientedCursor* cursor, vtkIdType) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        return;
+      }
+      std::vector<bool> signs(numContours, true);
+      this->RecursivelyPreProcessTree(cursor, signs);
+    });
+
+  // The trees are split in batches contouring into their own output, a single
+  // one writing directly to the output when running sequentially
+  vtkNew<vtkIdList> treeIndices;
+  input->GetTreeIndices(treeIndices);
+  const vtkIdType numBatches = ::GetNumberOfTreeBatches(treeIndices->GetNumberOfIds());
+  const vtkIdType batchEstimatedSize = std::max<vtkIdType>(1024, estimatedSize / numBatches);
+  std::vector<std::unique_ptr<vtkTreeBatch>> batches(numBatches);
+  for (auto& batch : batches)
   {
-    if (this->CheckAbort())
+    batch.reset(new vtkTreeBatch);
+    if (numBatches == 1)
     {
-      break;
+      batch->Locator = this->Locator;
+      batch->OutPointData = output->GetPointData();
+    }
+    else
+    {
+      batch->Locator.TakeReference(this->Locator->NewInstance());
+      batch->Locator->SetTolerance(this->Locator->GetTolerance());
+      batch->OutPointData = vtkSmartPointer<vtkPointData>::New();
+      batch->OutPointData->CopyAllocate(this->InData, batchEstimatedSize);
     }
-    // Initialize new grid cursor at root of current input tree
-    input->InitializeNonOrientedCursor(cursor, index);
-    // Pre-process tree recursively
-    this->RecursivelyPreProcessTree(cursor);
-  } // it
+    batch->Points = vtkSmartPointer<vtkPoints>::New();
+    batch->Points->Allocate(batchEstimatedSize, batchEstimatedSize);
+    batch->Locator->InitPointInsertion(batch->Points, bounds, batchEstimatedSize);
+    batch->Verts->AllocateExact(batchEstimatedSize, batchEstimatedSize);
+    batch->Lines->AllocateExact(batchEstimatedSize, batchEstimatedSize);
+    batch->Polys->AllocateExact(batchEstimatedSize, batchEstimatedSize);
+    batch->DualPointData = dualPointData;
+
+    // Create storage for output scalar values
+    batch->CellScalars.TakeReference(this->InScalars->NewInstance());
+    batch->CellScalars->SetNumberOfComponents(this->InScalars->GetNumberOfComponents());
+    batch->CellScalars->SetNumberOfTuples(8);
+
+    // Instantiate a contour helper for convenience, with triangle generation on
+    batch->Helper.reset(new vtkContourHelper(batch->Locator, batch->Verts, batch->Lines,
+      batch->Polys, dualPointData, nullptr, batch->OutPointData, nullptr, batchEstimatedSize,
+      true));
+  }
 
   // Second pass across tree roots: now compute isocontours recursively
-  input->InitializeTreeIterator(it);
-  vtkNew<vtkHyperTreeGridNonOrientedMooreSuperCursor> supercursor;
-  while (it.GetNextTree(index))
+  ::ForEachTreeInBatches<vtkHyperTreeGridNonOrientedMooreSuperCursor>(input, treeIndices,
+    numBatches,
+    [this, &batches](vtkHyperTreeGridNonOrientedMooreSuperCursor* supercursor, vtkIdType batch) {
+      bool isFirst = vtkSMPTools::GetSingleThread();
+      if (isFirst)
+      {
+        this->CheckAbort();
+      }
+      if (this->GetAbortOutput())
+      {
+        return;
+      }
+      this->RecursivelyProcessTree(supercursor, batches[batch].get());
+    });
+
+  vtkSmartPointer<vtkPoints> newPts = batches[0]->Points;
+  vtkSmartPointer<vtkCellArray> newVerts = batches[0]->Verts.Get();
+  vtkSmartPointer<vtkCellArray> newLines = batches[0]->Lines.Get();
+  vtkSmartPointer<vtkCellArray> newPolys = batches[0]->Polys.Get();
+  if (numBatches > 1)
   {
-    if (this->CheckAbort())
+    // Merge the outputs of the batches in order, so that the points and cells
+    // are numbered as when the trees are processed sequentially
+    vtkIdType numBatchPts = 0;
+    for (const auto& batch : batches)
     {
-      break;
+      numBatchPts += batch->Points->GetNumberOfPoints();
+    }
+    newPts = vtkSmartPointer<vtkPoints>::New();
+    newPts->Allocate(numBatchPts);
+    this->Locator->InitPointInsertion(newPts, bounds, numBatchPts);
+    vtkPointData* outPD = output->GetPointData();
+    outPD->CopyAllocate(batches[0]->OutPointData, numBatchPts);
+    newVerts = vtkSmartPointer<vtkCellArray>::New();
+    newLines = vtkSmartPointer<vtkCellArray>::New();
+    newPolys = vtkSmartPointer<vtkCellArray>::New();
+    std::vector<vtkIdType> pointMap;
+    double x[3];
+    for (auto& batch : batches)
+    {
+      const vtkIdType numPts = batch->Points->GetNumberOfPoints();
+      pointMap.resize(numPts);
+      for (vtkIdType ptId = 0; ptId < numPts; ++ptId)
+      {
+        batch->Points->GetPoint(ptId, x);
+        if (this->Locator->InsertUniquePoint(x, pointMap[ptId]))
+        {
+          outPD->CopyData(batch->OutPointData, ptId, pointMap[ptId]);
+        }
+      }
+      ::AppendCells(batch->Verts, newVerts, pointMap);
+      ::AppendCells(batch->Lines, newLines, pointMap);
+      ::AppendCells(batch->Polys, newPolys, pointMap);
+      batch.reset();
     }
-    // Initialize new Moore cursor at root of current tree
-    input->InitializeNonOrientedMooreSuperCursor(supercursor, index);
-    // Compute contours recursively
-    this->RecursivelyProcessTree(supercursor, newVerts, newLines, newPolys, dualPointData);
-  } // it
+  }
 
   // Set output
   output->SetPoints(newPts);
@@ -681,18 +710,9 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
   }
 
   // Clean up
-  this->SelectedCells->Delete();
-  for (vtkIdType c = 0; c < this->GetNumberOfContours(); ++c)
-  {
-    if (this->CellSigns[c])
-    {
-      this->CellSigns[c]->Delete();
-    }
-  } // c
-  free(this->CellSigns);
-  delete this->Helper;
-  this->CellScalars->Delete();
-  newPts->Delete();
+  batches.clear();
+  this->Internals->SelectedCells.Initialize(0);
+  this->Internals->CellSigns.clear();
   this->Locator->Initialize();
 
   // Squeeze output
@@ -702,12 +722,13 @@ int vtkHyperTreeGridContour::ProcessTrees(vtkHyperTreeGrid* input, vtkDataObject
 }
 
 //------------------------------------------------------------------------------
-bool vtkHyperTreeGridContour::RecursivelyPreProcessTree(vtkHyperTreeGridNonOrientedCursor* cursor)
+bool vtkHyperTreeGridContour::RecursivelyPreProcessTree(
+  vtkHyperTreeGridNonOrientedCursor* cursor, std::vector<bool>& signs)
 {
   // Retrieve global index of input cursor
   vtkIdType id = cursor->GetGlobalNodeIndex();
 
-  if (this->InGhostArray && this->InGhostArray->GetTuple1(id))
+  if (this->InGhostArray && this->InGhostArray->GetValue(id))
   {
     return false;
   }
@@ -723,17 +744,13 @@ bool vtkHyperTreeGridContour::RecursivelyPreProcessTree(vtkHyperTreeGridNonOrien
     int numChildren = cursor->GetNumberOfChildren();
     for (int child = 0; child < numChildren; ++child)
     {
-      if (this->CheckAbort())
-      {
-        break;
-      }
       // Create storage for signs relative to contour values
-      std::vector<bool> signs(numContours);
+      std::vector<bool> childSigns(numContours);
 
       cursor->ToChild(child);
 
       // Recurse and keep track of whether this branch is selected
-      selected |= this->RecursivelyPreProcessTree(cursor);
+      selected |= this->RecursivelyPreProcessTree(cursor, signs);
 
       // Check if branch not completely selected
       if (!selected)
@@ -748,12 +765,12 @@ bool vtkHyperTreeGridContour::RecursivelyPreProcessTree(vtkHyperTreeGridNonOrien
           if (!child)
           {
             // Initialize sign array with sign of first child
-            signs[c] = (this->CellSigns[c]->GetTuple1(childId) != 0.0);
+            childSigns[c] = this->Internals->CellSigns[c].Get(childId);
           } // if ( ! child )
           else
           {
             // For subsequent children compare their sign with stored value
-            if (signs[c] != (this->CellSigns[c]->GetTuple1(childId) != 0.0))
+            if (childSigns[c] != this->Internals->CellSigns[c].Get(childId))
             {
               // A change of sign occurred, therefore cell must selected
               selected = true;
@@ -765,27 +782,27 @@ bool vtkHyperTreeGridContour::RecursivelyPreProcessTree(vtkHyperTreeGridNonOrien
       cursor->ToParent();
     } // child
   }
-  else if (!this->InGhostArray || !this->InGhostArray->GetTuple1(id))
+  else
   {
     // Cursor is at leaf, retrieve its active scalar value
-    double val = this->InScalars->GetTuple1(id);
+    double val = this->InScalars->GetComponent(id, 0);
 
     // Iterate over all contours
     double* values = this->ContourValues->GetValues();
     for (int c = 0; c < numContours; ++c)
     {
-      this->Signs[c] = val > values[c];
+      signs[c] = val > values[c];
     }
   } // else
 
   // Update list of selected cells
-  this->SelectedCells->SetTuple1(id, selected);
+  this->Internals->SelectedCells.Set(id, selected);
 
   // Set signs for all contours
   for (int c = 0; c < numContours; ++c)
   {
     // Parent cell has that of one of its children
-    this->CellSigns[c]->SetTuple1(id, this->Signs[c]);
+    this->Internals->CellSigns[c].Set(id, signs[c]);
   }
 
   // Return whether current node was fully selected
@@ -794,13 +811,12 @@ bool vtkHyperTreeGridContour::RecursivelyPreProcessTree(vtkHyperTreeGridNonOrien
 
 //------------------------------------------------------------------------------
 void vtkHyperTreeGridContour::RecursivelyProcessTree(
-  vtkHyperTreeGridNonOrientedMooreSuperCursor* supercursor, vtkCellArray* newVerts,
-  vtkCellArray* newLines, vtkCellArray* newPolys, vtkPointData* inPd)
+  vtkHyperTreeGridNonOrientedMooreSuperCursor* supercursor, vtkTreeBatch* batch)
 {
   // Retrieve global index of input cursor
   vtkIdType id = supercursor->GetGlobalNodeIndex();
 
-  if (this->InGhostArray && this->InGhostArray->GetTuple1(id))
+  if (this->InGhostArray && this->InGhostArray->GetValue(id))
   {
     return;
   }
@@ -811,13 +827,13 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
   if (!supercursor->IsLeaf())
   {
     // Selected cells are determined in RecursivelyPreProcessTree
-    bool selected = (this->SelectedCells->GetTuple1(id) == 1.0);
+    bool selected = this->Internals->SelectedCells.Get(id);
 
     // Iterate over contours
     for (vtkIdType c = 0; c < this->ContourValues->GetNumberOfContours() && !selected; ++c)
     {
       // Retrieve sign with respect to contour value at current cursor
-      bool sign = (this->CellSigns[c]->GetTuple1(id) != 0.0);
+      bool sign = this->Internals->CellSigns[c].Get(id);
 
       // Iterate over all cursors of Moore neighborhood around center
       unsigned int nn = supercursor->GetNumberOfCursors() - 1;
@@ -830,9 +846,9 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           vtkIdType idN = supercursor->GetGlobalNodeIndex(icursorN);
 
           // Decide whether neighbor was selected or must be retained because of a sign change
-          selected = this->SelectedCells->GetTuple1(idN) == 1 ||
-            ((this->CellSigns[c]->GetTuple1(idN) != 0.0) != sign) ||
-            (this->InGhostArray && this->InGhostArray->GetTuple1(idN));
+          selected = this->Internals->SelectedCells.Get(idN) ||
+            (this->Internals->CellSigns[c].Get(idN) != sign) ||
+            (this->InGhostArray && this->InGhostArray->GetValue(idN));
         }
         else
         {
@@ -849,24 +865,24 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         // Create child cursor from parent in input grid
         supercursor->ToChild(child);
         // Recurse
-        this->RecursivelyProcessTree(supercursor, newVerts, newLines, newPolys, inPd);
+        this->RecursivelyProcessTree(supercursor, batch);
         supercursor->ToParent();
       }
     }
   }
-  else if ((!this->InMask || !this->InMask->GetTuple1(id)))
+  else if (!this->InMask || !this->InMask->GetValue(id))
   {
     // Cell is not masked, iterate over its corners
     unsigned int numLeavesCorners = 1 << dim;
     for (unsigned int cornerIdx = 0; cornerIdx < numLeavesCorners; ++cornerIdx)
     {
       bool owner = true;
-      this->Leaves->SetNumberOfIds(numLeavesCorners);
+      batch->Leaves->SetNumberOfIds(numLeavesCorners);
 
       // Iterate over every leaf touching the corner and check ownership
       for (unsigned int leafIdx = 0; leafIdx < numLeavesCorners && owner; ++leafIdx)
       {
-        owner = supercursor->GetCornerCursors(cornerIdx, leafIdx, this->Leaves);
+        owner = supercursor->GetCornerCursors(cornerIdx, leafIdx, batch->Leaves);
       } // leafIdx
 
       // If cell owns dual cell, compute contours thereof
@@ -884,13 +900,13 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         switch (dim)
         {
           case 1:
-            cell = this->Line;
+            cell = batch->Line;
             break;
           case 2:
-            cell = this->Pixel;
+            cell = batch->Pixel;
             break;
           case 3:
-            cell = this->Voxel;
+            cell = batch->Voxel;
             break;
           default:
             vtkErrorMacro("Unsupported cell dimension had been encountered (must be 1, 2 or 3).");
@@ -904,7 +920,7 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
         for (unsigned int _cornerIdx = 0; _cornerIdx < numLeavesCorners; ++_cornerIdx)
         {
           // Get cursor corresponding to this corner
-          vtkIdType cursorId = this->Leaves->GetId(_cornerIdx);
+          vtkIdType cursorId = batch->Leaves->GetId(_cornerIdx);
 
           // Retrieve neighbor coordinates and store them
           supercursor->GetPoint(cursorId, x);
@@ -915,7 +931,7 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           cell->PointIds->SetId(_cornerIdx, idN);
 
           // Assign scalar value attached to this contour item
-          this->CellScalars->SetTuple(_cornerIdx, this->InScalars->GetTuple(idN));
+          batch->CellScalars->SetTuple(_cornerIdx, idN, this->InScalars);
         } // cornerIdx
 
         /* If we are in 3D and the contour strategy is set to USE_DECOMPOSED_POLYHEDRA,
@@ -932,35 +948,28 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           // Insert points and global point IDs
           for (int i = 0; i < ::POLY_POINTS_NB; ++i)
           {
-            this->Internals->Polyhedron->GetPointIds()->SetId(i, cell->GetPointId(i));
-            this->Internals->Polyhedron->GetPoints()->SetPoint(i, cell->GetPoints()->GetPoint(i));
+            batch->Polyhedron->GetPointIds()->SetId(i, cell->GetPointId(i));
+            batch->Polyhedron->GetPoints()->SetPoint(i, cell->GetPoints()->GetPoint(i));
           }
 
           // Construct faces from voxel point ids (global ids)
-          this->Internals->Faces->Reset();
+          batch->Faces->Reset();
           for (int faceId = 0, canonicalId = 0; faceId < ::POLY_FACES_NB; faceId++)
           {
-            this->Internals->Faces->InsertNextCell(::POLY_FACES_POINTS_NB);
+            batch->Faces->InsertNextCell(::POLY_FACES_POINTS_NB);
             for (int i = 0; i < ::POLY_FACES_POINTS_NB; i++, canonicalId++)
             {
-              this->Internals->Faces->InsertCellPoint(
+              batch->Faces->InsertCellPoint(
                 cell->GetPointId(::CANONICAL_FACES[canonicalId]));
             }
           }
 
-          this->Internals->Polyhedron->SetCellFaces(this->Internals->Faces);
-          this->Internals->Polyhedron->Initialize();
+          batch->Polyhedron->SetCellFaces(batch->Faces);
+          batch->Polyhedron->Initialize();
 
-          // Decompose the this->Internals->Polyhedron
+          // Decompose the polyhedron
           auto resultUG = vtkPolyhedronUtilities::Decompose(
-            this->Internals->Polyhedron, inPd, this->CurrentId, nullptr);
-
-          auto outPointData = vtkPointData::SafeDownCast(this->OutData);
-          if (!outPointData)
-          {
-            vtkErrorMacro("Unable to retrieve the output point data.");
-            return;
-          }
+            batch->Polyhedron, batch->DualPointData, batch->CurrentId, nullptr);
 
           /* Estimated size: estimated number of generated triangles (before merging them).
            * Only used in that case. Unused here because we choose to output triangles.
@@ -971,8 +980,8 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
            * Needed because we have to change the input point data (now indexed on resultUG point
            * ids)
            */
-          vtkContourHelper helper(this->Locator, newVerts, newLines, newPolys,
-            resultUG->GetPointData(), nullptr, outPointData, nullptr, estimatedSize, true);
+          vtkContourHelper helper(batch->Locator, batch->Verts, batch->Lines, batch->Polys,
+            resultUG->GetPointData(), nullptr, batch->OutPointData, nullptr, estimatedSize, true);
 
           // Retrieve the contouring array in the resultUG
           auto contourScalars = resultUG->GetPointData()->GetArray(this->InScalars->GetName());
@@ -991,18 +1000,18 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
             iter.TakeReference(resultUG->NewCellIterator());
             for (iter->InitTraversal(); !iter->IsDoneWithTraversal(); iter->GoToNextCell())
             {
-              iter->GetCell(this->Internals->Tetra);
+              iter->GetCell(batch->Tetra);
 
               // Scalars used for contouring need to be indexed on tetrahedron local ids
-              this->Internals->TetraScalars->Reset();
-              this->Internals->TetraScalars->SetNumberOfComponents(
+              batch->TetraScalars->Reset();
+              batch->TetraScalars->SetNumberOfComponents(
                 contourScalars->GetNumberOfComponents());
-              this->Internals->TetraScalars->SetNumberOfTuples(iter->GetNumberOfPoints());
-              contourScalars->GetTuples(iter->GetPointIds(), this->Internals->TetraScalars);
+              batch->TetraScalars->SetNumberOfTuples(iter->GetNumberOfPoints());
+              contourScalars->GetTuples(iter->GetPointIds(), batch->TetraScalars);
 
               vtkIdType cellId = iter->GetCellId();
               helper.Contour(
-                this->Internals->Tetra, values[c], this->Internals->TetraScalars, cellId);
+                batch->Tetra, values[c], batch->TetraScalars, cellId);
             }
           }
         }
@@ -1011,12 +1020,12 @@ void vtkHyperTreeGridContour::RecursivelyProcessTree(
           // Compute cell isocontour for each isovalue
           for (int c = 0; c < numContours; ++c)
           {
-            this->Helper->Contour(cell, values[c], this->CellScalars, this->CurrentId);
+            batch->Helper->Contour(cell, values[c], batch->CellScalars, batch->CurrentId);
           }
         }
 
         // Increment output cell counter
-        ++this->CurrentId;
+        ++batch->CurrentId;
       } // if ( owner )
     }   // cornerIdx
   }     // else if ( ! this->InMask || this->InMask->GetTuple1( id ) )
@@ -37,15 +37,10 @@
 VTK_ABI_NAMESPACE_BEGIN
 class vtkBitArray;
 class vtkCellData;
-class vtkContourHelper;
 class vtkDataArray;
 class vtkHyperTreeGrid;
-class vtkIdList;
 class vtkIncrementalPointLocator;
-class vtkLine;
-class vtkPixel;
 class vtkUnsignedCharArray;
-class vtkVoxel;
 class vtkHyperTreeGridNonOrientedCursor;
 class vtkHyperTreeGridNonOrientedMooreSuperCursor;
 
@@ -135,60 +130,32 @@ protected:
   int ProcessTrees(vtkHyperTreeGrid*, vtkDataObject*) override;
 
   /**
-   * Recursively decide whether a cell is intersected by a contour
+   * Output and temporary storage of a batch of trees processed by one thread.
    */
-  bool RecursivelyPreProcessTree(vtkHyperTreeGridNonOrientedCursor*);
+  struct vtkTreeBatch;
 
   /**
-   * Recursively descend into the tree down to the leaves to construct the contour (verts, lines,
-   * polys). dualPointData represents the point data of the dual mesh, i.e. HTG cell data used for
-   * contouring.
-   */
-  void RecursivelyProcessTree(vtkHyperTreeGridNonOrientedMooreSuperCursor*, vtkCellArray* verts,
-    vtkCellArray* lines, vtkCellArray* polys, vtkPointData* dualPointData);
-
-  /**
-   * Storage for contour values.
+   * Recursively decide whether a cell is intersected by a contour. signs
+   * carries the signs relative to the contour values of the last visited leaf.
    */
-  vtkContourValues* ContourValues;
+  bool RecursivelyPreProcessTree(vtkHyperTreeGridNonOrientedCursor*, std::vector<bool>& signs);
 
   /**
-   * Storage for pre-selected cells to be processed
+   * Recursively descend into the tree down to the leaves to construct the contour (verts, lines,
+   * polys) into the output of the batch the tree belongs to.
    */
-  vtkBitArray* SelectedCells;
+  void RecursivelyProcessTree(vtkHyperTreeGridNonOrientedMooreSuperCursor*, vtkTreeBatch* batch);
 
   /**
-   * Sign of isovalue if cell not treated
+   * Storage for contour values.
    */
-  vtkBitArray** CellSigns;
+  vtkContourValues* ContourValues;
 
   /**
    * Spatial locator to merge points.
    */
   vtkIncrementalPointLocator* Locator;
 
-  ///@{
-  /**
-   * Pointers needed to perform isocontouring
-   */
-  vtkContourHelper* Helper;
-  vtkDataArray* CellScalars;
-  vtkLine* Line;
-  vtkPixel* Pixel;
-  vtkVoxel* Voxel;
-  vtkIdList* Leaves;
-  ///@}
-
-  /**
-   * Storage for signs relative to current contour value
-   */
-  std::vector<bool> Signs;
-
-  /**
-   * Keep track of current index in output polydata
-   */
-  vtkIdType CurrentId;
-
   /**
    * Keep track of selected input scalars
    */
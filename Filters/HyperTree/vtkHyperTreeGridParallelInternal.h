@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+/**
+ * @file   vtkHyperTreeGridParallelInternal.h
+ * @brief  Tools shared by the hyper tree grid filters processing trees in parallel
+ *
+ * The filters of this module that process the trees of a vtkHyperTreeGrid in
+ * parallel split them in contiguous batches, each batch being processed by a
+ * single thread into its own output. Merging the outputs in batch order makes
+ * the result independent of the number of threads and of the scheduling.
+ * Per-cell flags computed concurrently are stored in an AtomicBitArray, since
+ * the bits of neighbor cells, possibly in different trees, share memory words.
+ *
+ * @warning
+ * This file is meant as a private include file to avoid code duplication. It
+ * is not meant to define a public API.
+ *
+ * @sa
+ * vtkHyperTreeGridContour vtkHyperTreeGridPlaneCutter
+ */
+
+#ifndef vtkHyperTreeGridParallelInternal_h
+#define vtkHyperTreeGridParallelInternal_h
+
+#include "vtkHyperTreeGrid.h"
+#include "vtkIdList.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+namespace
+{ // anonymous namespace
+
+//------------------------------------------------------------------------------
+// A fixed size array of bits that can be written concurrently, as long as
+// each bit is written by a single thread at a time.
+class AtomicBitArray
+{
+public:
+  void Initialize(vtkIdType numberOfBits)
+  {
+    const vtkIdType numberOfWords = (numberOfBits + 63) / 64;
+    this->Words.reset(new std::atomic<std::uint64_t>[numberOfWords]);
+    for (vtkIdType i = 0; i < numberOfWords; ++i)
+    {
+      this->Words[i].store(0, std::memory_order_relaxed);
+    }
+  }
+
+  void Set(vtkIdType id, bool value)
+  {
+    const std::uint64_t bit = std::uint64_t(1) << (id & 63);
+    if (value)
+    {
+      this->Words[id >> 6].fetch_or(bit, std::memory_order_relaxed);
+    }
+    else
+    {
+      this->Words[id >> 6].fetch_and(~bit, std::memory_order_relaxed);
+    }
+  }
+
+  bool Get(vtkIdType id) const
+  {
+    return ((this->Words[id >> 6].load(std::memory_order_relaxed) >> (id & 63)) & 1) != 0;
+  }
+
+private:
+  std::unique_ptr<std::atomic<std::uint64_t>[]> Words;
+};
+
+//------------------------------------------------------------------------------
+// Number of batches the trees are split into: a few per thread to balance the
+// load, and a single one when running sequentially.
+inline vtkIdType GetNumberOfTreeBatches(vtkIdType numberOfTrees)
+{
+  const int numberOfThreads = vtkSMPTools::GetEstimatedNumberOfThreads();
+  if (numberOfThreads <= 1)
+  {
+    return 1;
+  }
+  return std::max<vtkIdType>(1, std::min<vtkIdType>(numberOfTrees, 8 * numberOfThreads));
+}
+
+//------------------------------------------------------------------------------
+// Call functor(cursor, batch) for each tree of treeIndices, the cursor of type
+// CursorT being initialized at the root of the tree. The batches are processed
+// in parallel, and the trees of a batch sequentially, in order, by one thread.
+template <class CursorT, class FunctorT>
+void ForEachTreeInBatches(
+  vtkHyperTreeGrid* grid, vtkIdList* treeIndices, vtkIdType numberOfBatches, FunctorT&& functor)
+{
+  grid->PrepareForConcurrentTraversal();
+  const vtkIdType numberOfTrees = treeIndices->GetNumberOfIds();
+  vtkSMPThreadLocalObject<CursorT> cursors;
+  vtkSMPTools::For(0, numberOfBatches, 1, [&](vtkIdType beginBatch, vtkIdType endBatch) {
+    CursorT* cursor = cursors.Local();
+    for (vtkIdType batch = beginBatch; batch < endBatch; ++batch)
+    {
+      const vtkIdType end = (batch + 1) * numberOfTrees / numberOfBatches;
+      for (vtkIdType i = batch * numberOfTrees / numberOfBatches; i < end; ++i)
+      {
+        cursor->Initialize(grid, treeIndices->GetId(i));
+        functor(cursor, batch);
+      }
+    }
+  });
+}
+
+} // anonymous namespace
+
+#endif // vtkHyperTreeGridParallelInternal_h
+// VTK-HeaderTest-Exclude: vtkHyperTreeGridParallelInternal.h
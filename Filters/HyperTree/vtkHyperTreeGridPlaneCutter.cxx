@@ -11,6 +11,8 @@
 #include "vtkHyperTreeGrid.h"
 #include "vtkHyperTreeGridNonOrientedGeometryCursor.h"
 #include "vtkHyperTreeGridNonOrientedMooreSuperCursor.h"
+#include "vtkHyperTreeGridParallelInternal.h"
+#include "vtkHyperTreeGridParallelTraversal.h"
 #include "vtkIdList.h"
 #include "vtkInformation.h"
 #include "vtkMath.h"
@@ -19,10 +21,14 @@
 #include "vtkPointData.h"
 #include "vtkPoints.h"
 #include "vtkPolyData.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkUnstructuredGrid.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cmath>
+#include <vector>
 
 VTK_ABI_NAMESPACE_BEGIN
 namespace
@@ -33,10 +39,37 @@ constexpr unsigned int MooreCursors3D[26] = { 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10,
   17, 18, 19, 20, 21, 22, 23, 24, 25, 26 };
 }
 
+//------------------------------------------------------------------------------
+struct vtkHyperTreeGridPlaneCutter::vtkInternals
+{
+  // Cells selected by the first pass in dual mode, written concurrently by
+  // the trees
+  ::AtomicBitArray SelectedCells;
+};
+
+//------------------------------------------------------------------------------
+struct vtkHyperTreeGridPlaneCutter::vtkTreeBatch
+{
+  // Output of the batch
+  vtkSmartPointer<vtkPoints> Points;
+  vtkSmartPointer<vtkCellArray> Cells;
+  vtkSmartPointer<vtkDataSetAttributes> OutData;
+
+  // Storage for dual vertex indices
+  vtkNew<vtkIdList> Leaves;
+
+  // Storage for dual vertices at center of primal cells
+  vtkNew<vtkPoints> Centers;
+
+  // Cutter to be used on dual cells
+  vtkSmartPointer<vtkCutter> Cutter;
+};
+
 vtkStandardNewMacro(vtkHyperTreeGridPlaneCutter);
 
 //------------------------------------------------------------------------------
 vtkHyperTreeGridPlaneCutter::vtkHyperTreeGridPlaneCutter()
+  : Internals(new vtkHyperTreeGridPlaneCutter::vtkInternals())
 {
   this->Points = nullptr;
   this->Cells = nullptr;
@@ -46,12 +79,6 @@ vtkHyperTreeGridPlaneCutter::vtkHyperTreeGridPlaneCutter()
 
   // By default a non-conforming output mesh is produced for better rendering
   this->Dual = 0;
-
-  // By default member variables for dual-based computation are not used
-  this->SelectedCells = nullptr;
-  this->Centers = nullptr;
-  this->Cutter = nullptr;
-  this->Leaves = nullptr;
 }
 
 //------------------------------------------------------------------------------
@@ -68,30 +95,6 @@ vtkHyperTreeGridPlaneCutter::~vtkHyperTreeGridPlaneCutter()
     this->Cells->Delete();
     this->Cells = nullptr;
   }
-
-  if (this->Leaves)
-  {
-    this->Leaves->Delete();
-    this->Leaves = nullptr;
-  }
-
-  if (this->Centers)
-  {
-    this->Centers->Delete();
-    this->Centers = nullptr;
-  }
-
-  if (this->Cutter)
-  {
-    this->Cutter->Delete();
-    this->Cutter = nullptr;
-  }
-
-  if (this->SelectedCells)
-  {
-    this->SelectedCells->Delete();
-    this->SelectedCells = nullptr;
-  }
 }
 
 //------------------------------------------------------------------------------
@@ -130,36 +133,6 @@ void vtkHyperTreeGridPlaneCutter::PrintSelf(ostream& os, vtkIndent indent)
   {
     os << indent << "Cells: ( none )\n";
   }
-
-  if (this->Leaves)
-  {
-    os << indent << "Leaves:\n";
-    this->Leaves->PrintSelf(os, indent.GetNextIndent());
-  }
-  else
-  {
-    os << indent << "Leaves: ( none )\n";
-  }
-
-  if (this->Centers)
-  {
-    os << indent << "Centers:\n";
-    this->Centers->PrintSelf(os, indent.GetNextIndent());
-  }
-  else
-  {
-    os << indent << "Centers: ( none )\n";
-  }
-
-  if (this->Cutter)
-  {
-    os << indent << "Cutter:\n";
-    this->Cutter->PrintSelf(os, indent.GetNextIndent());
-  }
-  else
-  {
-    os << indent << "Cutter: ( none )\n";
-  }
 }
 
 //------------------------------------------------------------------------------
@@ -183,22 +156,7 @@ void vtkHyperTreeGridPlaneCutter::Reset()
     this->Cells->Delete();
   }
   this->Cells = vtkCellArray::New();
-  if (this->Centers)
-  {
-    this->Centers->Initialize();
-  }
-  if (this->Leaves)
-  {
-    this->Leaves->Initialize();
-  }
-  if (this->Cutter)
-  {
-    this->Cutter->SetNumberOfContours(0);
-  }
-  if (this->SelectedCells)
-  {
-    this->SelectedCells->Initialize();
-  }
+  this->Internals->SelectedCells.Initialize(0);
 }
 
 //------------------------------------------------------------------------------
@@ -228,27 +186,38 @@ int vtkHyperTreeGridPlaneCutter::ProcessTrees(vtkHyperTreeGrid* input, vtkDataOb
   // Retrieve material mask
   this->InMask = input->HasMask() ? input->GetMask() : nullptr;
 
-  // Compute cut on dual or primal input depending on specification
-  if (this->Dual)
-  {
-    // Initialize output point data
-    this->OutData = output->GetPointData();
-    this->OutData->CopyAllocate(this->InData);
-
-    // Storage for leaf indices
-    if (this->Leaves == nullptr)
+  // Compute cut on dual or primal input depending on specification, the
+  // output data being point data in the former case and cell data otherwise
+  this->OutData = this->Dual ? static_cast<vtkDataSetAttributes*>(output->GetPointData())
+                             : static_cast<vtkDataSetAttributes*>(output->GetCellData());
+  this->OutData->CopyAllocate(this->InData);
+
+  // The trees are split in batches cutting into their own output, a single
+  // one writing directly to the output when running sequentially
+  vtkNew<vtkIdList> treeIndices;
+  input->GetTreeIndices(treeIndices);
+  const vtkIdType numBatches = ::GetNumberOfTreeBatches(treeIndices->GetNumberOfIds());
+  std::vector<std::unique_ptr<vtkTreeBatch>> batches(numBatches);
+  for (auto& batch : batches)
+  {
+    batch.reset(new vtkTreeBatch);
+    if (numBatches == 1)
     {
-      this->Leaves = vtkIdList::New();
+      batch->Points = this->Points;
+      batch->Cells = this->Cells;
+      batch->OutData = this->OutData;
     }
-    this->Leaves->SetNumberOfIds(8);
-
-    // Initialize storage for dual geometry
-    if (this->Centers == nullptr)
+    else
     {
-      this->Centers = vtkPoints::New();
+      batch->Points = vtkSmartPointer<vtkPoints>::New();
+      batch->Cells = vtkSmartPointer<vtkCellArray>::New();
+      batch->OutData = vtk::TakeSmartPointer(this->OutData->NewInstance());
+      batch->OutData->CopyAllocate(this->InData);
     }
-    this->Centers->SetNumberOfPoints(8);
+  }
 
+  if (this->Dual)
+  {
     // Convert plane parameters into normal/origin specification
     unsigned int maxId = 0;
     if (fabs(this->Plane[1]) > fabs(this->Plane[0]))
@@ -261,93 +230,113 @@ int vtkHyperTreeGridPlaneCutter::ProcessTrees(vtkHyperTreeGrid* input, vtkDataOb
     }
     double origin[] = { 0., 0., 0. };
     origin[maxId] = this->Plane[3] / this->Plane[maxId];
-    vtkPlane* plane = vtkPlane::New();
-    plane->SetOrigin(origin);
-    plane->SetNormal(this->Plane[0], this->Plane[1], this->Plane[2]);
 
-    // Initialize plane cutter
-    if (this->Cutter == nullptr)
-    {
-      this->Cutter = vtkCutter::New();
-    }
-    this->Cutter->GenerateTrianglesOff();
-    this->Cutter->SetCutFunction(plane);
-
-    // Clean up
-    plane->Delete();
-
-    // Create storage to keep track of selected cells
-    if (this->SelectedCells == nullptr)
-    {
-      this->SelectedCells = vtkBitArray::New();
-    }
-    vtkIdType numCells = input->GetNumberOfCells();
-    this->SelectedCells->SetNumberOfTuples(numCells);
-    for (vtkIdType i = 0; i < numCells; ++i)
+    for (auto& batch : batches)
     {
-      // Initialization is needed because not all cells are pre-processed
-      this->SelectedCells->SetValue(i, 0);
+      // Storage for leaf indices and dual geometry
+      batch->Leaves->SetNumberOfIds(8);
+      batch->Centers->SetNumberOfPoints(8);
+
+      // Initialize plane cutter
+      vtkNew<vtkPlane> plane;
+      plane->SetOrigin(origin);
+      plane->SetNormal(this->Plane[0], this->Plane[1], this->Plane[2]);
+      batch->Cutter = vtkSmartPointer<vtkCutter>::New();
+      batch->Cutter->GenerateTrianglesOff();
+      batch->Cutter->SetCutFunction(plane);
     }
 
-    // First pass across tree roots to evince cells intersected by contours
-    vtkIdType index;
-    vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-    input->InitializeTreeIterator(it);
-    vtkNew<vtkHyperTreeGridNonOrientedGeometryCursor> cursor;
-    while (it.GetNextTree(index))
-    {
-      if (this->CheckAbort())
-      {
-        break;
-      }
-      // Initialize new geometric cursor at root of current input tree
-      input->InitializeNonOrientedGeometryCursor(cursor, index);
-      // Pre-process tree recursively
-      this->RecursivelyPreProcessTree(cursor);
-    } // it
+    // Create storage to keep track of selected cells. Initialization is needed
+    // because not all cells are pre-processed
+    this->Internals->SelectedCells.Initialize(
+      std::max(input->GetNumberOfCells(), input->GetGlobalNodeIndexMax() + 1));
+
+    // First pass across tree roots to evince cells intersected by contours.
+    // Each tree only writes the flags of its own cells.
+    vtk::hypertreegrid::ForEachTree<vtkHyperTreeGridNonOrientedGeometryCursor>(
+      input, [this](vtkHyperTreeGridNonOrientedGeometryCursor* cursor, vtkIdType) {
+        bool isFirst = vtkSMPTools::GetSingleThread();
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          return;
+        }
+        this->RecursivelyPreProcessTree(cursor);
+      });
 
     // Second pass across tree roots: now compute isocontours recursively
-    input->InitializeTreeIterator(it);
-    vtkNew<vtkHyperTreeGridNonOrientedMooreSuperCursor> supercursor;
-    while (it.GetNextTree(index))
-    {
-      if (this->CheckAbort())
-      {
-        break;
-      }
-      // Initialize new Moore cursor at root of current tree
-      input->InitializeNonOrientedMooreSuperCursor(supercursor, index);
-      // Generate leaf cell centers recursively
-      this->RecursivelyProcessTreeDual(supercursor);
-    } // it
+    ::ForEachTreeInBatches<vtkHyperTreeGridNonOrientedMooreSuperCursor>(input, treeIndices,
+      numBatches,
+      [this, &batches](vtkHyperTreeGridNonOrientedMooreSuperCursor* supercursor, vtkIdType batch) {
+        bool isFirst = vtkSMPTools::GetSingleThread();
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          return;
+        }
+        this->RecursivelyProcessTreeDual(supercursor, batches[batch].get());
+      });
 
     // Clean up
-    this->SelectedCells->Delete();
-    this->SelectedCells = nullptr;
+    this->Internals->SelectedCells.Initialize(0);
   } // if ( this->Dual )
   else
   {
-    // Initialize output cell data
-    this->OutData = output->GetCellData();
-    this->OutData->CopyAllocate(this->InData);
-
     // Iterate over all hyper trees
-    vtkIdType index;
-    vtkHyperTreeGrid::vtkHyperTreeGridIterator it;
-    input->InitializeTreeIterator(it);
-    vtkNew<vtkHyperTreeGridNonOrientedGeometryCursor> cursor;
-    while (it.GetNextTree(index))
+    ::ForEachTreeInBatches<vtkHyperTreeGridNonOrientedGeometryCursor>(input, treeIndices,
+      numBatches,
+      [this, &batches](vtkHyperTreeGridNonOrientedGeometryCursor* cursor, vtkIdType batch) {
+        bool isFirst = vtkSMPTools::GetSingleThread();
+        if (isFirst)
+        {
+          this->CheckAbort();
+        }
+        if (this->GetAbortOutput())
+        {
+          return;
+        }
+        this->RecursivelyProcessTreePrimal(cursor, batches[batch].get());
+      });
+  } // else
+
+  if (numBatches > 1)
+  {
+    // Concatenate the outputs of the batches in order, so that the points and
+    // cells are numbered as when the trees are processed sequentially
+    vtkIdType numPts = 0;
+    vtkIdType numCells = 0;
+    for (const auto& batch : batches)
     {
-      if (this->CheckAbort())
+      numPts += batch->Points->GetNumberOfPoints();
+      numCells += batch->Cells->GetNumberOfCells();
+    }
+    this->OutData->CopyAllocate(batches[0]->OutData, this->Dual ? numPts : numCells);
+    for (auto& batch : batches)
+    {
+      const vtkIdType pointOffset = this->Points->GetNumberOfPoints();
+      const vtkIdType cellOffset = this->Cells->GetNumberOfCells();
+      const vtkIdType numBatchPts = batch->Points->GetNumberOfPoints();
+      this->Points->InsertPoints(pointOffset, numBatchPts, 0, batch->Points);
+      this->Cells->Append(batch->Cells, pointOffset);
+      if (this->Dual)
+      {
+        this->OutData->CopyData(batch->OutData, pointOffset, numBatchPts, 0);
+      }
+      else
       {
-        break;
+        this->OutData->CopyData(
+          batch->OutData, cellOffset, batch->Cells->GetNumberOfCells(), 0);
       }
-      // Initialize new geometric cursor at root of current tree
-      input->InitializeNonOrientedGeometryCursor(cursor, index);
-      // Generate leaf cell centers recursively
-      this->RecursivelyProcessTreePrimal(cursor);
-    } // it
-  }   // else
+      batch.reset();
+    }
+  }
+  batches.clear();
 
   // Set output geometry and topology
   output->SetPoints(this->Points);
@@ -370,7 +359,7 @@ int vtkHyperTreeGridPlaneCutter::ProcessTrees(vtkHyperTreeGrid* input, vtkDataOb
 
 //------------------------------------------------------------------------------
 void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreePrimal(
-  vtkHyperTreeGridNonOrientedGeometryCursor* cursor)
+  vtkHyperTreeGridNonOrientedGeometryCursor* cursor, vtkTreeBatch* batch)
 {
   // If cursor is at a masked cell stop recursion
   vtkIdType inId = cursor->GetGlobalNodeIndex();
@@ -480,14 +469,14 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreePrimal(
       for (int i = 0; i < n; ++i)
       {
         // Save points and get their IDs
-        ids[i] = this->Points->InsertNextPoint(points[i]);
+        ids[i] = batch->Points->InsertNextPoint(points[i]);
       }
 
       // Insert next face
-      vtkIdType outId = this->Cells->InsertNextCell(n, ids);
+      vtkIdType outId = batch->Cells->InsertNextCell(n, ids);
 
       // Copy face data from that of the cell from which it comes
-      this->OutData->CopyData(this->InData, inId, outId);
+      batch->OutData->CopyData(this->InData, inId, outId);
     } // if ( cursor->IsLeaf() )
     else
     {
@@ -495,13 +484,9 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreePrimal(
       int numChildren = cursor->GetNumberOfChildren();
       for (int ichild = 0; ichild < numChildren; ++ichild)
       {
-        if (this->CheckAbort())
-        {
-          break;
-        }
         cursor->ToChild(ichild);
         // Recurse
-        this->RecursivelyProcessTreePrimal(cursor);
+        this->RecursivelyProcessTreePrimal(cursor, batch);
         cursor->ToParent();
       } // ichild
     }   // else
@@ -549,10 +534,6 @@ bool vtkHyperTreeGridPlaneCutter::RecursivelyPreProcessTree(
       int numChildren = cursor->GetNumberOfChildren();
       for (int ichild = 0; ichild < numChildren; ++ichild)
       {
-        if (this->CheckAbort())
-        {
-          break;
-        }
         cursor->ToChild(ichild);
         // Recurse and keep track of whether this branch is selected
         selected |= this->RecursivelyPreProcessTree(cursor);
@@ -562,7 +543,7 @@ bool vtkHyperTreeGridPlaneCutter::RecursivelyPreProcessTree(
   }     // if ( this->CheckIntersection )
 
   // Update list of selected cells
-  this->SelectedCells->SetTuple1(id, selected);
+  this->Internals->SelectedCells.Set(id, selected);
 
   // Return whether current node was selected
   return selected;
@@ -570,7 +551,7 @@ bool vtkHyperTreeGridPlaneCutter::RecursivelyPreProcessTree(
 
 //------------------------------------------------------------------------------
 void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
-  vtkHyperTreeGridNonOrientedMooreSuperCursor* cursor)
+  vtkHyperTreeGridNonOrientedMooreSuperCursor* cursor, vtkTreeBatch* batch)
 {
   // If cursor is at a masked cell stop recursion
   vtkIdType id = cursor->GetGlobalNodeIndex();
@@ -583,7 +564,7 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
   if (!cursor->IsLeaf())
   {
     // Check if cursor is at selected cell
-    if (!this->SelectedCells->GetTuple1(id))
+    if (!this->Internals->SelectedCells.Get(id))
     {
       // Cell is not selected until proven otherwise
       bool selected = false;
@@ -598,7 +579,7 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
           vtkIdType idN = cursor->GetGlobalNodeIndex(indN);
 
           // Decide whether neighbor was selected
-          selected = (this->SelectedCells->GetTuple1(idN) != 0.0);
+          selected = this->Internals->SelectedCells.Get(idN);
         }
         else
         {
@@ -611,19 +592,15 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
       {
         return;
       }
-    } // if ( this->SelectedCells->GetTuple1( id ) )
+    } // if ( ! this->Internals->SelectedCells.Get( id ) )
 
     // Recurse to all children
     int numChildren = cursor->GetNumberOfChildren();
     for (int ichild = 0; ichild < numChildren; ++ichild)
     {
-      if (this->CheckAbort())
-      {
-        break;
-      }
       cursor->ToChild(ichild);
       // Recurse
-      this->RecursivelyProcessTreeDual(cursor);
+      this->RecursivelyProcessTreeDual(cursor, batch);
       cursor->ToParent();
     } // ichild
   }   // if ( ! cursor->IsLeaf() )
@@ -632,17 +609,13 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
     // Cursor is at leaf, iterate over its corners
     for (unsigned int cornerIdx = 0; cornerIdx < 8; ++cornerIdx)
     {
-      if (this->CheckAbort())
-      {
-        break;
-      }
       // Cell is not selected until proven otherwise
       bool owner = true;
 
       // Iterate over every leaf touching the corner and check ownership
       for (unsigned int leafIdx = 0; leafIdx < 8 && owner; ++leafIdx)
       {
-        owner = cursor->GetCornerCursors(cornerIdx, leafIdx, this->Leaves);
+        owner = cursor->GetCornerCursors(cornerIdx, leafIdx, batch->Leaves);
       } // leafIdx
 
       // If cell owns dual cell, compute intersection thereof
@@ -659,11 +632,11 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
         for (int _cornerIdx = 0; _cornerIdx < 8; ++_cornerIdx)
         {
           // Get cursor corresponding to this corner
-          vtkIdType cursorId = this->Leaves->GetId(_cornerIdx);
+          vtkIdType cursorId = batch->Leaves->GetId(_cornerIdx);
 
           // Retrieve neighbor coordinates and store them
           cursor->GetPoint(cursorId, x);
-          this->Centers->SetPoint(_cornerIdx, x);
+          batch->Centers->SetPoint(_cornerIdx, x);
 
           // Retrieve neighbor index and corresponding input scalar value
           vtkIdType idN = cursor->GetGlobalNodeIndex(cursorId);
@@ -673,14 +646,14 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
         } // _cornerIdx
 
         // Assign geometry of dual cell
-        dual->SetPoints(this->Centers);
+        dual->SetPoints(batch->Centers);
 
         // Compute intersection with plane
-        this->Cutter->SetInputData(dual);
-        this->Cutter->Update();
+        batch->Cutter->SetInputData(dual);
+        batch->Cutter->Update();
 
         // Append computed polygons if some are present in cutter output
-        vtkPolyData* pd = this->Cutter->GetOutput();
+        vtkPolyData* pd = batch->Cutter->GetOutput();
         vtkIdType nPoints = pd->GetNumberOfPoints();
         if (nPoints)
         {
@@ -688,16 +661,16 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
           vtkPointData* pdata = pd->GetPointData();
 
           // Append new points to existing cut points
-          vtkIdType offset = this->Points->GetNumberOfPoints();
+          vtkIdType offset = batch->Points->GetNumberOfPoints();
           double pt[3];
           for (vtkIdType i = 0; i < nPoints; ++i)
           {
             // Retrieve cut point coordinates and insert them into output points
             pd->GetPoint(i, pt);
-            this->Points->InsertNextPoint(pt);
+            batch->Points->InsertNextPoint(pt);
 
             // Copy cut point data to that of corresponding output point
-            this->OutData->CopyData(pdata, i, i + offset);
+            batch->OutData->CopyData(pdata, i, i + offset);
           } // i
 
           // Append new elements to existing cut element
@@ -716,7 +689,7 @@ void vtkHyperTreeGridPlaneCutter::RecursivelyProcessTreeDual(
             } // j
 
             // Insert next cell with offset ids
-            this->Cells->InsertNextCell(n, ids);
+            batch->Cells->InsertNextCell(n, ids);
           } // i
         }   // if ( nPoints )
 
@@ -31,10 +31,10 @@
 #include "vtkFiltersHyperTreeModule.h" // For export macro
 #include "vtkHyperTreeGridAlgorithm.h"
 
+#include <memory> // For std::unique_ptr
+
 VTK_ABI_NAMESPACE_BEGIN
 class vtkCellArray;
-class vtkCutter;
-class vtkIdList;
 class vtkPoints;
 class vtkHyperTreeGridNonOrientedGeometryCursor;
 class vtkHyperTreeGridNonOrientedMooreSuperCursor;
@@ -101,9 +101,15 @@ protected:
   int ProcessTrees(vtkHyperTreeGrid*, vtkDataObject*) override;
 
   /**
-   * Recursively descend into tree down to leaves, cutting primal cells
+   * Output and temporary storage of a batch of trees processed by one thread.
    */
-  void RecursivelyProcessTreePrimal(vtkHyperTreeGridNonOrientedGeometryCursor*);
+  struct vtkTreeBatch;
+
+  /**
+   * Recursively descend into tree down to leaves, cutting primal cells into
+   * the output of the batch the tree belongs to
+   */
+  void RecursivelyProcessTreePrimal(vtkHyperTreeGridNonOrientedGeometryCursor*, vtkTreeBatch*);
 
   /**
    * Recursively decide whether cell is intersected by plane
@@ -111,9 +117,10 @@ protected:
   bool RecursivelyPreProcessTree(vtkHyperTreeGridNonOrientedGeometryCursor*);
 
   /**
-   * Recursively descend into tree down to leaves, cutting dual cells
+   * Recursively descend into tree down to leaves, cutting dual cells into
+   * the output of the batch the tree belongs to
    */
-  void RecursivelyProcessTreeDual(vtkHyperTreeGridNonOrientedMooreSuperCursor*);
+  void RecursivelyProcessTreeDual(vtkHyperTreeGridNonOrientedMooreSuperCursor*, vtkTreeBatch*);
 
   /**
    * Check if a cursor is intersected by a plane
@@ -144,11 +151,6 @@ protected:
    */
   int Dual;
 
-  /**
-   * Storage for pre-selected cells to be processed in dual mode
-   */
-  vtkBitArray* SelectedCells;
-
   /**
    * Storage for points of output unstructured mesh
    */
@@ -159,21 +161,6 @@ protected:
    */
   vtkCellArray* Cells;
 
-  /**
-   * Storage for dual vertex indices
-   */
-  vtkIdList* Leaves;
-
-  /**
-   * Storage for dual vertices at center of primal cells
-   */
-  vtkPoints* Centers;
-
-  /**
-   * Cutter to be used on dual cells
-   */
-  vtkCutter* Cutter;
-
   /**
    * material Mask
    */
@@ -187,6 +174,9 @@ protected:
 private:
   vtkHyperTreeGridPlaneCutter(const vtkHyperTreeGridPlaneCutter&) = delete;
   void operator=(const vtkHyperTreeGridPlaneCutter&) = delete;
+
+  struct vtkInternals;
+  std::unique_ptr<vtkInternals> Internals;
 };
 
 VTK_ABI_NAMESPACE_END
@@ -3,18 +3,24 @@
 
 #include "vtkPCANormalEstimation.h"
 
+#include "vtkAOSDataArrayTemplate.h"
 #include "vtkAbstractPointLocator.h"
 #include "vtkFloatArray.h"
 #include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
 #include "vtkInformationVector.h"
 #include "vtkMath.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
 #include "vtkPointSet.h"
 #include "vtkPoints.h"
 #include "vtkSMPThreadLocalObject.h"
 #include "vtkSMPTools.h"
+#include "vtkStaticPointLocator.h"
+
+#include <algorithm>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkPCANormalEstimation);
@@ -36,46 +42,78 @@ namespace Utils
  * selected inside the radius, if SampleSize is also set to a value, the
  * code checks if at least SampleSize (K) points have been selected.
  * Otherwise, SampleSize (K) points are reselected.
+ *
+ * RequiresSecondSearch() tells if the points found by the first search
+ * (K nearest neighbors or points inside the radius) must be reselected, and
+ * SecondSearch() reselects them.
  */
 template <typename T>
-void FindPoints(vtkAbstractPointLocator* locator, T* inPts, double x[3], int searchMode,
-  int sampleSize, double radius, vtkIdList* ids)
+bool RequiresSecondSearch(const T* inPts, const double x[3], int searchMode, int sampleSize,
+  double radius, vtkIdType numIds, const vtkIdType* ids)
 {
   switch (searchMode)
   {
     case vtkPCANormalEstimation::RADIUS:
-    {
-      locator->FindPointsWithinRadius(radius, x, ids);
       // If not enough points are found, then use K nearest neighbors
-      if (ids->GetNumberOfIds() < sampleSize)
-      {
-        locator->FindClosestNPoints(sampleSize, x, ids);
-      }
-      break;
-    }
+      return numIds < sampleSize;
     case vtkPCANormalEstimation::KNN:
     {
-      locator->FindClosestNPoints(sampleSize, x, ids);
+      if (numIds < 1)
+      {
+        return false;
+      }
       // Retrieve the farthest point found
       double farthestPoint[3];
-      const T* point = inPts + 3 * ids->GetId(ids->GetNumberOfIds() - 1);
+      const T* point = inPts + 3 * ids[numIds - 1];
       for (int i = 0; i < 3; ++i)
       {
         farthestPoint[i] = static_cast<double>(*point++);
       }
 
-      double squaredDistance = vtkMath::Distance2BetweenPoints(x, farthestPoint);
       // If the points found are too densely packed, then use radius search
-      if (squaredDistance < radius * radius)
-      {
-        locator->FindPointsWithinRadius(radius, x, ids);
-      }
-      break;
+      return vtkMath::Distance2BetweenPoints(x, farthestPoint) < radius * radius;
     }
   }
+  return false;
+}
+
+inline void SecondSearch(vtkAbstractPointLocator* locator, double x[3], int searchMode,
+  int sampleSize, double radius, vtkIdList* ids)
+{
+  if (searchMode == vtkPCANormalEstimation::RADIUS)
+  {
+    locator->FindClosestNPoints(sampleSize, x, ids);
+  }
+  else
+  {
+    locator->FindPointsWithinRadius(radius, x, ids);
+  }
 }
+
+template <typename T>
+void FindPoints(vtkAbstractPointLocator* locator, T* inPts, double x[3], int searchMode,
+  int sampleSize, double radius, vtkIdList* ids)
+{
+  if (searchMode == vtkPCANormalEstimation::RADIUS)
+  {
+    locator->FindPointsWithinRadius(radius, x, ids);
+  }
+  else
+  {
+    locator->FindClosestNPoints(sampleSize, x, ids);
+  }
+  if (RequiresSecondSearch(
+        inPts, x, searchMode, sampleSize, radius, ids->GetNumberOfIds(), ids->GetPointer(0)))
+  {
+    SecondSearch(locator, x, searchMode, sampleSize, radius, ids);
+  }
+}
+///@}
 } // Utils namespace
 
+// The number of points whose neighborhoods are found at once
+constexpr vtkIdType NeighborhoodBlockSize = 65536;
+
 //------------------------------------------------------------------------------
 // The threaded core of the algorithm.
 template <typename T>
@@ -95,6 +133,12 @@ struct GenerateNormals
   // storage lots of new/delete.
   vtkSMPThreadLocalObject<vtkIdList> PIds;
 
+  // Optional neighborhoods found beforehand for a block of points starting
+  // at BlockStart, in a compressed layout (see vtkStaticPointLocator).
+  vtkIdType BlockStart = 0;
+  const vtkIdType* Offsets = nullptr;
+  const vtkIdType* Neighbors = nullptr;
+
   GenerateNormals(T* points, vtkAbstractPointLocator* loc, int sample, double radius,
     float* normals, int searchMode, int orient, double opoint[3], bool flip)
     : Points(points)
@@ -125,6 +169,7 @@ struct GenerateNormals
     float* n = this->Normals + 3 * ptId;
     double x[3], mean[3], o[3];
     vtkIdList*& pIds = this->PIds.Local();
+    const vtkIdType* neighbors;
     vtkIdType numPts, nei;
     int sample, i;
     double *a[3], a0[3], a1[3], a2[3], xp[3];
@@ -145,16 +190,36 @@ struct GenerateNormals
       x[2] = static_cast<double>(*px++);
 
       // Retrieve the local neighborhood
-      Utils::FindPoints(
-        this->Locator, this->Points, x, this->SearchMode, this->SampleSize, this->Radius, pIds);
-
-      numPts = pIds->GetNumberOfIds();
+      neighbors = nullptr;
+      if (this->Neighbors)
+      {
+        const vtkIdType* offset = this->Offsets + (ptId - this->BlockStart);
+        neighbors = this->Neighbors + offset[0];
+        numPts = offset[1] - offset[0];
+        if (Utils::RequiresSecondSearch(this->Points, x, this->SearchMode, this->SampleSize,
+              this->Radius, numPts, neighbors))
+        {
+          Utils::SecondSearch(
+            this->Locator, x, this->SearchMode, this->SampleSize, this->Radius, pIds);
+          neighbors = nullptr;
+        }
+      }
+      else
+      {
+        Utils::FindPoints(
+          this->Locator, this->Points, x, this->SearchMode, this->SampleSize, this->Radius, pIds);
+      }
+      if (!neighbors)
+      {
+        numPts = pIds->GetNumberOfIds();
+        neighbors = pIds->GetPointer(0);
+      }
 
       // First step: compute the mean position of the neighborhood.
       mean[0] = mean[1] = mean[2] = 0.0;
       for (sample = 0; sample < numPts; ++sample)
       {
-        nei = pIds->GetId(sample);
+        nei = neighbors[sample];
         py = this->Points + 3 * nei;
         mean[0] += static_cast<double>(*py++);
         mean[1] += static_cast<double>(*py++);
@@ -170,7 +235,7 @@ struct GenerateNormals
       a0[2] = a1[2] = a2[2] = 0.0;
       for (sample = 0; sample < numPts; ++sample)
       {
-        nei = pIds->GetId(sample);
+        nei = neighbors[sample];
         py = this->Points + 3 * nei;
         xp[0] = static_cast<double>(*py++) - mean[0];
         xp[1] = static_cast<double>(*py++) - mean[1];
@@ -226,7 +291,39 @@ struct GenerateNormals
   {
     GenerateNormals gen(points, self->GetLocator(), self->GetSampleSize(), self->GetRadius(),
       normals, searchMode, orient, opoint, flip);
-    vtkSMPTools::For(0, numPts, gen);
+    vtkStaticPointLocator* locator = vtkStaticPointLocator::SafeDownCast(self->GetLocator());
+    if (!locator)
+    {
+      vtkSMPTools::For(0, numPts, gen);
+      return;
+    }
+
+    // The static point locator finds the neighborhoods of many points at once
+    // much faster than one point at a time. This is done by blocks of points
+    // to bound the memory used by the neighborhoods.
+    vtkNew<vtkAOSDataArrayTemplate<T>> blockCoords;
+    blockCoords->SetNumberOfComponents(3);
+    vtkNew<vtkPoints> blockPts;
+    blockPts->SetData(blockCoords);
+    vtkNew<vtkIdTypeArray> offsets;
+    vtkNew<vtkIdTypeArray> neighbors;
+    for (vtkIdType start = 0; start < numPts; start += NeighborhoodBlockSize)
+    {
+      vtkIdType end = std::min(start + NeighborhoodBlockSize, numPts);
+      blockCoords->SetArray(points + 3 * start, 3 * (end - start), 1);
+      if (searchMode == vtkPCANormalEstimation::RADIUS)
+      {
+        locator->FindPointsWithinRadius(gen.Radius, blockPts, offsets, neighbors);
+      }
+      else
+      {
+        locator->FindClosestNPoints(gen.SampleSize, blockPts, offsets, neighbors);
+      }
+      gen.BlockStart = start;
+      gen.Offsets = offsets->GetPointer(0);
+      gen.Neighbors = neighbors->GetPointer(0);
+      vtkSMPTools::For(start, end, gen);
+    }
   }
 }; // GenerateNormals
 } // anonymous namespace
@@ -0,0 +1,161 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompressedArray.h"
+
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkNew.h"
+#include "vtkSMPTools.h"
+
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <vector>
+
+namespace
+{
+//------------------------------------------------------------------------------
+template <typename ValueType>
+vtkSmartPointer<vtkCompressedArray<ValueType>> Compress(
+  vtkDataArray* array, const vtkCompressedImplicitBackendOptions& options)
+{
+  vtkSmartPointer<vtkCompressedArray<ValueType>> compressed =
+    vtkSmartPointer<vtkCompressedArray<ValueType>>::New();
+  compressed->ConstructBackend(array, options);
+  compressed->SetNumberOfComponents(array->GetNumberOfComponents());
+  compressed->SetNumberOfTuples(array->GetNumberOfTuples());
+  return compressed;
+}
+
+//------------------------------------------------------------------------------
+// Check all the values of the compressed array, accessed concurrently from several threads in
+// a different order in each thread, and decompressed at once.
+template <typename ValueType>
+bool CheckValues(const char* name, vtkDataArray* array, vtkCompressedArray<ValueType>* compressed,
+  double tolerance)
+{
+  const vtkIdType numTuples = array->GetNumberOfTuples();
+  const int numComps = array->GetNumberOfComponents();
+  std::atomic<vtkIdType> errors(0);
+  vtkSMPTools::For(0, numTuples, 100, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<ValueType> tuple(numComps);
+    for (vtkIdType i = end - 1; i >= begin; --i)
+    {
+      compressed->GetTypedTuple(i, tuple.data());
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        const double value = array->GetComponent(i, comp);
+        if (std::abs(compressed->GetComponent(i, comp) - value) > tolerance ||
+          std::abs(tuple[comp] - value) > tolerance)
+        {
+          ++errors;
+        }
+      }
+    }
+  });
+  if (errors > 0)
+  {
+    std::cerr << name << ": " << errors << " values differ by more than " << tolerance
+              << std::endl;
+    return false;
+  }
+
+  std::vector<ValueType> values(numTuples * numComps);
+  compressed->GetBackend()->DecompressAll(values.data());
+  for (vtkIdType i = 0; i < numTuples * numComps; ++i)
+  {
+    if (values[i] != compressed->GetValue(i))
+    {
+      std::cerr << name << ": wrong decompressed value " << values[i] << " at index " << i
+                << " instead of " << compressed->GetValue(i) << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestCompressedArray(int, char*[])
+{
+  // Smooth 3 components field, with an incomplete last block
+  const vtkIdType numTuples = 10007;
+  vtkNew<vtkDoubleArray> field;
+  field->SetNumberOfComponents(3);
+  field->SetNumberOfTuples(numTuples);
+  for (vtkIdType i = 0; i < numTuples; ++i)
+  {
+    const double x = 0.001 * i;
+    field->SetTuple3(i, std::sin(x), std::cos(3 * x), x);
+  }
+  const std::size_t rawSize = numTuples * 3 * sizeof(double);
+
+  vtkCompressedImplicitBackendOptions options;
+  options.BlockSize = 1000;
+  options.CacheSize = 2;
+
+  // Lossless
+  auto lz4 = Compress<double>(field, options);
+  if (!CheckValues("LZ4", field, lz4.Get(), 0.0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Fixed accuracy
+  options.Method = vtkCompressedImplicitBackendOptions::ZFP_FIXED_ACCURACY;
+  options.Tolerance = 1e-5;
+  auto accuracy = Compress<double>(field, options);
+  if (!CheckValues("zfp accuracy", field, accuracy.Get(), options.Tolerance))
+  {
+    return EXIT_FAILURE;
+  }
+  if (accuracy->GetBackend()->GetCompressedSize() * 2 > rawSize)
+  {
+    std::cerr << "zfp accuracy: poor compression, " << accuracy->GetBackend()->GetCompressedSize()
+              << " bytes for " << rawSize << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Fixed rate, the compressed size is known
+  options.Method = vtkCompressedImplicitBackendOptions::ZFP_FIXED_RATE;
+  options.Rate = 16;
+  auto rate = Compress<double>(field, options);
+  if (!CheckValues("zfp rate", field, rate.Get(), 1e-2))
+  {
+    return EXIT_FAILURE;
+  }
+  if (rate->GetBackend()->GetCompressedSize() > rawSize / 3)
+  {
+    std::cerr << "zfp rate: compressed size is " << rate->GetBackend()->GetCompressedSize()
+              << " bytes for " << rawSize << std::endl;
+    return EXIT_FAILURE;
+  }
+  if (rate->GetActualMemorySize() >= field->GetActualMemorySize())
+  {
+    std::cerr << "zfp rate: the actual memory size should be the compressed size." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Single precision, values converted from another type
+  vtkNew<vtkFloatArray> single;
+  single->DeepCopy(field);
+  options.Method = vtkCompressedImplicitBackendOptions::LZ4;
+  auto converted = Compress<float>(field, options);
+  if (!CheckValues("float", single, converted.Get(), 0.0))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Empty array
+  vtkNew<vtkFloatArray> empty;
+  auto compressedEmpty = Compress<float>(empty, options);
+  if (compressedEmpty->GetNumberOfTuples() != 0 ||
+    compressedEmpty->GetBackend()->GetCompressedSize() != 0)
+  {
+    std::cerr << "Wrong compression of an empty array." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
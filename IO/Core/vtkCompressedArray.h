@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkCompressedArray_h
+#define vtkCompressedArray_h
+
+#include "vtkCompressedImplicitBackend.h" // for the array backend
+#include "vtkImplicitArray.h"
+
+/**
+ * \var vtkCompressedArray
+ * \brief A utility alias for an implicit array holding the values of another array compressed in
+ * memory
+ *
+ * The values are compressed by blocks, losslessly with LZ4 or lossily with zfp, and decompressed
+ * on access into a small per-thread cache of blocks. See `vtkCompressedImplicitBackend` for the
+ * compression options. Only `float` and `double` value types are supported.
+ *
+ * An example of potential usage:
+ * ```
+ * vtkCompressedImplicitBackendOptions options;
+ * options.Method = vtkCompressedImplicitBackendOptions::ZFP_FIXED_RATE;
+ * options.Rate = 8;
+ * vtkNew<vtkCompressedArray<double>> compressed;
+ * compressed->ConstructBackend(pressure, options);
+ * compressed->SetNumberOfComponents(pressure->GetNumberOfComponents());
+ * compressed->SetNumberOfTuples(pressure->GetNumberOfTuples());
+ * ```
+ *
+ * @sa
+ * vtkCompressedImplicitBackend vtkImplicitArray vtkCompressArrays
+ */
+
+VTK_ABI_NAMESPACE_BEGIN
+template <typename T>
+using vtkCompressedArray = vtkImplicitArray<vtkCompressedImplicitBackend<T>>;
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkCompressedArray_h
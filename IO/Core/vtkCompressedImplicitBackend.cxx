@@ -0,0 +1,395 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkCompressedImplicitBackend.h"
+
+#include "vtkArrayDispatch.h"
+#include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
+#include "vtkSetGet.h"
+
+#include "vtk_lz4.h"
+#include "vtk_zfp.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// zfp reads and writes its streams by 64 bits words, so compressed blocks are stored word aligned.
+using Word = std::uint64_t;
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+struct BlockCache
+{
+  std::vector<vtkIdType> Blocks;
+  std::vector<std::vector<ValueType>> Values;
+  std::vector<unsigned char> Scratch;
+};
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+zfp_type GetZFPType()
+{
+  return std::is_same<ValueType, float>::value ? zfp_type_float : zfp_type_double;
+}
+
+//------------------------------------------------------------------------------
+// Set the zfp compression mode, return false for non zfp methods.
+bool SetZFPMode(zfp_stream* zfp, zfp_type type, const vtkCompressedImplicitBackendOptions& options)
+{
+  switch (options.Method)
+  {
+    case vtkCompressedImplicitBackendOptions::ZFP_FIXED_RATE:
+      zfp_stream_set_rate(zfp, options.Rate, type, 1, 0);
+      return true;
+    case vtkCompressedImplicitBackendOptions::ZFP_FIXED_ACCURACY:
+      zfp_stream_set_accuracy(zfp, options.Tolerance);
+      return true;
+    default:
+      return false;
+  }
+}
+
+//------------------------------------------------------------------------------
+// Compress numTuples tuples of AOS values into a word aligned buffer, returning its size in
+// bytes. With LZ4, the bytes of the values are shuffled so that the bytes of same significance
+// are contiguous, which compresses much better for floating point values. With zfp, each
+// component is compressed as a strided 1D field.
+template <typename ValueType>
+std::size_t CompressBlock(const ValueType* values, vtkIdType numTuples, int numComps,
+  const vtkCompressedImplicitBackendOptions& options, std::vector<Word>& compressed,
+  std::vector<unsigned char>& scratch)
+{
+  const zfp_type type = GetZFPType<ValueType>();
+  zfp_stream* zfp = zfp_stream_open(nullptr);
+  if (!SetZFPMode(zfp, type, options))
+  {
+    zfp_stream_close(zfp);
+
+    const std::size_t numValues = static_cast<std::size_t>(numTuples) * numComps;
+    const std::size_t numBytes = numValues * sizeof(ValueType);
+    const unsigned char* bytes = reinterpret_cast<const unsigned char*>(values);
+    scratch.resize(numBytes);
+    for (std::size_t i = 0; i < numValues; ++i)
+    {
+      for (std::size_t b = 0; b < sizeof(ValueType); ++b)
+      {
+        scratch[b * numValues + i] = bytes[i * sizeof(ValueType) + b];
+      }
+    }
+
+    const int bound = LZ4_compressBound(static_cast<int>(numBytes));
+    compressed.resize((bound + sizeof(Word) - 1) / sizeof(Word));
+    const int size = LZ4_compress_default(reinterpret_cast<const char*>(scratch.data()),
+      reinterpret_cast<char*>(compressed.data()), static_cast<int>(numBytes), bound);
+    return size > 0 ? static_cast<std::size_t>(size) : 0;
+  }
+
+  zfp_field* field =
+    zfp_field_1d(const_cast<ValueType*>(values), type, static_cast<unsigned int>(numTuples));
+  zfp_field_set_stride_1d(field, numComps);
+  const std::size_t bound = zfp_stream_maximum_size(zfp, field) * numComps;
+  compressed.resize((bound + sizeof(Word) - 1) / sizeof(Word));
+  bitstream* stream = stream_open(compressed.data(), compressed.size() * sizeof(Word));
+  zfp_stream_set_bit_stream(zfp, stream);
+  zfp_stream_rewind(zfp);
+
+  std::size_t size = 0;
+  for (int comp = 0; comp < numComps; ++comp)
+  {
+    zfp_field_set_pointer(field, const_cast<ValueType*>(values + comp));
+    size = zfp_compress(zfp, field);
+    if (size == 0)
+    {
+      break;
+    }
+  }
+
+  zfp_field_free(field);
+  zfp_stream_close(zfp);
+  stream_close(stream);
+  return size;
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+bool DecompressBlock(const Word* compressed, std::size_t size, vtkIdType numTuples, int numComps,
+  const vtkCompressedImplicitBackendOptions& options, ValueType* values,
+  std::vector<unsigned char>& scratch)
+{
+  const zfp_type type = GetZFPType<ValueType>();
+  zfp_stream* zfp = zfp_stream_open(nullptr);
+  if (!SetZFPMode(zfp, type, options))
+  {
+    zfp_stream_close(zfp);
+
+    const std::size_t numValues = static_cast<std::size_t>(numTuples) * numComps;
+    const std::size_t numBytes = numValues * sizeof(ValueType);
+    scratch.resize(numBytes);
+    if (LZ4_decompress_safe(reinterpret_cast<const char*>(compressed),
+          reinterpret_cast<char*>(scratch.data()), static_cast<int>(size),
+          static_cast<int>(numBytes)) != static_cast<int>(numBytes))
+    {
+      return false;
+    }
+    unsigned char* bytes = reinterpret_cast<unsigned char*>(values);
+    for (std::size_t b = 0; b < sizeof(ValueType); ++b)
+    {
+      const unsigned char* plane = scratch.data() + b * numValues;
+      for (std::size_t i = 0; i < numValues; ++i)
+      {
+        bytes[i * sizeof(ValueType) + b] = plane[i];
+      }
+    }
+    return true;
+  }
+
+  zfp_field* field = zfp_field_1d(values, type, static_cast<unsigned int>(numTuples));
+  zfp_field_set_stride_1d(field, numComps);
+  bitstream* stream = stream_open(const_cast<Word*>(compressed), size);
+  zfp_stream_set_bit_stream(zfp, stream);
+  zfp_stream_rewind(zfp);
+
+  bool success = true;
+  for (int comp = 0; comp < numComps && success; ++comp)
+  {
+    zfp_field_set_pointer(field, values + comp);
+    success = zfp_decompress(zfp, field) != 0;
+  }
+
+  zfp_field_free(field);
+  zfp_stream_close(zfp);
+  stream_close(stream);
+  return success;
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+struct CompressWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, const vtkCompressedImplicitBackendOptions& options,
+    std::vector<std::vector<Word>>& blocks, std::vector<std::size_t>& sizes) const
+  {
+    const vtkIdType numTuples = array->GetNumberOfTuples();
+    const int numComps = array->GetNumberOfComponents();
+    vtkSMPThreadLocal<std::vector<ValueType>> localValues;
+    vtkSMPThreadLocal<std::vector<unsigned char>> localScratch;
+
+    const vtkIdType numBlocks = static_cast<vtkIdType>(blocks.size());
+    vtkSMPTools::For(0, numBlocks, [&](vtkIdType begin, vtkIdType end) {
+      std::vector<ValueType>& values = localValues.Local();
+      std::vector<unsigned char>& scratch = localScratch.Local();
+      for (vtkIdType block = begin; block < end; ++block)
+      {
+        const vtkIdType firstTuple = block * options.BlockSize;
+        const vtkIdType blockTuples = std::min(options.BlockSize, numTuples - firstTuple);
+        const auto range = vtk::DataArrayValueRange(
+          array, firstTuple * numComps, (firstTuple + blockTuples) * numComps);
+        values.resize(range.size());
+        std::size_t i = 0;
+        for (const auto value : range)
+        {
+          values[i++] = static_cast<ValueType>(value);
+        }
+
+        sizes[block] =
+          CompressBlock(values.data(), blockTuples, numComps, options, blocks[block], scratch);
+        // Only keep the compressed words
+        blocks[block].resize((sizes[block] + sizeof(Word) - 1) / sizeof(Word));
+        blocks[block].shrink_to_fit();
+      }
+    });
+  }
+};
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+struct vtkCompressedImplicitBackend<ValueType>::Internals
+{
+  vtkCompressedImplicitBackendOptions Options;
+  int NumberOfComponents = 1;
+  vtkIdType NumberOfTuples = 0;
+  vtkIdType NumberOfBlocks = 0;
+  std::vector<Word> Data;
+  // Offsets of the blocks in Data in words, and sizes of the blocks in bytes
+  std::vector<std::size_t> Offsets;
+  std::vector<std::size_t> Sizes;
+  vtkSMPThreadLocal<BlockCache<ValueType>> Caches;
+
+  vtkIdType GetNumberOfBlockTuples(vtkIdType block) const
+  {
+    return std::min(
+      this->Options.BlockSize, this->NumberOfTuples - block * this->Options.BlockSize);
+  }
+
+  void Decompress(vtkIdType block, ValueType* values, std::vector<unsigned char>& scratch) const
+  {
+    if (!DecompressBlock(this->Data.data() + this->Offsets[block], this->Sizes[block],
+          this->GetNumberOfBlockTuples(block), this->NumberOfComponents, this->Options, values,
+          scratch))
+    {
+      vtkGenericWarningMacro("Failed to decompress block " << block << ".");
+      std::fill_n(values, this->GetNumberOfBlockTuples(block) * this->NumberOfComponents, 0);
+    }
+  }
+
+  // Return the decompressed values of a block from the cache of the calling thread
+  const ValueType* GetBlock(vtkIdType block)
+  {
+    BlockCache<ValueType>& cache = this->Caches.Local();
+    if (cache.Blocks.empty())
+    {
+      cache.Blocks.resize(this->Options.CacheSize, -1);
+      cache.Values.resize(this->Options.CacheSize);
+    }
+    const std::size_t slot = static_cast<std::size_t>(block) % cache.Blocks.size();
+    std::vector<ValueType>& values = cache.Values[slot];
+    if (cache.Blocks[slot] != block)
+    {
+      values.resize(this->Options.BlockSize * this->NumberOfComponents);
+      this->Decompress(block, values.data(), cache.Scratch);
+      cache.Blocks[slot] = block;
+    }
+    return values.data();
+  }
+};
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::vtkCompressedImplicitBackend(
+  vtkDataArray* array, const vtkCompressedImplicitBackendOptions& options)
+  : Internal(new Internals())
+{
+  Internals& internals = *this->Internal;
+  internals.Options = options;
+  if (options.Method < vtkCompressedImplicitBackendOptions::LZ4 ||
+    options.Method > vtkCompressedImplicitBackendOptions::ZFP_FIXED_ACCURACY)
+  {
+    vtkGenericWarningMacro("Unknown compression method " << options.Method << ", using LZ4.");
+    internals.Options.Method = vtkCompressedImplicitBackendOptions::LZ4;
+  }
+  internals.Options.BlockSize = std::max<vtkIdType>(options.BlockSize, 1);
+  internals.Options.CacheSize = std::max(options.CacheSize, 1);
+  internals.Offsets.push_back(0);
+  if (!array)
+  {
+    return;
+  }
+
+  internals.NumberOfComponents = array->GetNumberOfComponents();
+  internals.NumberOfTuples = array->GetNumberOfTuples();
+  internals.NumberOfBlocks =
+    (internals.NumberOfTuples + internals.Options.BlockSize - 1) / internals.Options.BlockSize;
+
+  // Compress the blocks in parallel, then gather them in a single buffer
+  std::vector<std::vector<Word>> blocks(internals.NumberOfBlocks);
+  internals.Sizes.resize(internals.NumberOfBlocks);
+  CompressWorker<ValueType> worker;
+  if (!vtkArrayDispatch::Dispatch::Execute(
+        array, worker, internals.Options, blocks, internals.Sizes))
+  {
+    worker(array, internals.Options, blocks, internals.Sizes);
+  }
+
+  std::size_t numWords = 0;
+  for (const auto& block : blocks)
+  {
+    numWords += block.size();
+    internals.Offsets.push_back(numWords);
+  }
+  internals.Data.resize(numWords);
+  for (vtkIdType block = 0; block < internals.NumberOfBlocks; ++block)
+  {
+    std::copy(blocks[block].begin(), blocks[block].end(),
+      internals.Data.begin() + internals.Offsets[block]);
+    std::vector<Word>().swap(blocks[block]);
+  }
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+vtkCompressedImplicitBackend<ValueType>::~vtkCompressedImplicitBackend() = default;
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+ValueType vtkCompressedImplicitBackend<ValueType>::operator()(int idx) const
+{
+  const int tupleIdx = idx / this->Internal->NumberOfComponents;
+  return this->mapComponent(tupleIdx, idx - tupleIdx * this->Internal->NumberOfComponents);
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+void vtkCompressedImplicitBackend<ValueType>::mapTuple(int tupleIdx, ValueType* tuple) const
+{
+  const vtkIdType blockSize = this->Internal->Options.BlockSize;
+  const int numComps = this->Internal->NumberOfComponents;
+  const vtkIdType block = tupleIdx / blockSize;
+  const ValueType* values =
+    this->Internal->GetBlock(block) + (tupleIdx - block * blockSize) * numComps;
+  std::copy(values, values + numComps, tuple);
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+ValueType vtkCompressedImplicitBackend<ValueType>::mapComponent(int tupleIdx, int comp) const
+{
+  const vtkIdType blockSize = this->Internal->Options.BlockSize;
+  const vtkIdType block = tupleIdx / blockSize;
+  return this->Internal->GetBlock(
+    block)[(tupleIdx - block * blockSize) * this->Internal->NumberOfComponents + comp];
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+unsigned long vtkCompressedImplicitBackend<ValueType>::getMemorySize() const
+{
+  const std::size_t size = this->GetCompressedSize() +
+    (this->Internal->Offsets.size() + this->Internal->Sizes.size()) * sizeof(std::size_t);
+  return static_cast<unsigned long>((size + 1023) / 1024);
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+std::size_t vtkCompressedImplicitBackend<ValueType>::GetCompressedSize() const
+{
+  return this->Internal->Data.size() * sizeof(Word);
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+const vtkCompressedImplicitBackendOptions& vtkCompressedImplicitBackend<ValueType>::GetOptions()
+  const
+{
+  return this->Internal->Options;
+}
+
+//------------------------------------------------------------------------------
+template <typename ValueType>
+void vtkCompressedImplicitBackend<ValueType>::DecompressAll(ValueType* values) const
+{
+  const Internals& internals = *this->Internal;
+  vtkSMPThreadLocal<std::vector<unsigned char>> localScratch;
+  vtkSMPTools::For(0, internals.NumberOfBlocks, [&](vtkIdType begin, vtkIdType end) {
+    std::vector<unsigned char>& scratch = localScratch.Local();
+    for (vtkIdType block = begin; block < end; ++block)
+    {
+      internals.Decompress(block,
+        values + block * internals.Options.BlockSize * internals.NumberOfComponents, scratch);
+    }
+  });
+}
+
+//------------------------------------------------------------------------------
+// Explicit instantiation
+template class VTKIOCORE_EXPORT vtkCompressedImplicitBackend<float>;
+template class VTKIOCORE_EXPORT vtkCompressedImplicitBackend<double>;
+VTK_ABI_NAMESPACE_END
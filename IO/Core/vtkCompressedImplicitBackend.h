@@ -0,0 +1,142 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#ifndef vtkCompressedImplicitBackend_h
+#define vtkCompressedImplicitBackend_h
+
+/**
+ * \class vtkCompressedImplicitBackend
+ * \brief A backend for the `vtkImplicitArray` framework holding the values of an array compressed
+ * in memory
+ *
+ * The values of the array are split into blocks of a fixed number of tuples, and each block is
+ * compressed independently, either losslessly with LZ4 or with the zfp floating point compressor
+ * at a fixed rate (a fixed number of bits per value) or a fixed accuracy (a maximum absolute
+ * error). Accessing a value decompresses its whole block into a small per-thread cache of
+ * decompressed blocks, so that successive accesses to neighboring values, as done by most
+ * algorithms, only decompress each block once.
+ *
+ * The backend is meant to keep many large arrays resident, such as the fields of several time
+ * steps, at a fraction of their memory cost. Random access is much slower than with a
+ * `vtkAOSDataArrayTemplate`.
+ *
+ * An example of potential usage in a `vtkImplicitArray`:
+ * ```
+ * vtkCompressedImplicitBackendOptions options;
+ * options.Method = vtkCompressedImplicitBackendOptions::ZFP_FIXED_ACCURACY;
+ * options.Tolerance = 1e-4;
+ * vtkNew<vtkImplicitArray<vtkCompressedImplicitBackend<float>>> compressed; // More compact with
+ *                                                                           // vtkCompressedArray
+ * compressed->ConstructBackend(temperature, options);
+ * compressed->SetNumberOfComponents(temperature->GetNumberOfComponents());
+ * compressed->SetNumberOfTuples(temperature->GetNumberOfTuples());
+ * compressed->SetName(temperature->GetName());
+ * ```
+ *
+ * The backend is instantiated for `float` and `double`.
+ *
+ * @sa
+ * vtkCompressedArray vtkImplicitArray vtkLZ4DataCompressor
+ */
+
+#include "vtkIOCoreModule.h" // For export macro
+#include "vtkType.h"         // For vtkIdType
+
+#include <cstddef> // For std::size_t
+#include <memory>  // For std::unique_ptr
+
+VTK_ABI_NAMESPACE_BEGIN
+class vtkDataArray;
+
+/**
+ * Parameters of the compression of a `vtkCompressedImplicitBackend`.
+ */
+struct VTKIOCORE_EXPORT vtkCompressedImplicitBackendOptions
+{
+  enum CompressionMethods
+  {
+    LZ4 = 0,
+    ZFP_FIXED_RATE,
+    ZFP_FIXED_ACCURACY
+  };
+
+  /**
+   * The compression method. Only LZ4 is lossless. Default is LZ4.
+   */
+  int Method = LZ4;
+
+  /**
+   * Number of bits per compressed value with ZFP_FIXED_RATE. Default is 16.
+   */
+  double Rate = 16.0;
+
+  /**
+   * Maximum absolute error with ZFP_FIXED_ACCURACY. Default is 1e-6.
+   */
+  double Tolerance = 1e-6;
+
+  /**
+   * Number of tuples per compressed block. Larger blocks compress better but cost more to
+   * decompress on a cache miss. Default is 4096.
+   */
+  vtkIdType BlockSize = 4096;
+
+  /**
+   * Number of decompressed blocks cached by each thread. Default is 4.
+   */
+  int CacheSize = 4;
+};
+
+template <typename ValueType>
+class VTKIOCORE_EXPORT vtkCompressedImplicitBackend final
+{
+public:
+  /**
+   * Compress the values of an array. The values are cast to ValueType before being compressed.
+   */
+  vtkCompressedImplicitBackend(
+    vtkDataArray* array, const vtkCompressedImplicitBackendOptions& options);
+  ~vtkCompressedImplicitBackend();
+
+  /**
+   * Indexing operation for the compressed array respecting the backend expectations of
+   * `vtkImplicitArray`
+   */
+  ValueType operator()(int idx) const;
+
+  ///@{
+  /**
+   * Tuple and component access, decompressing at most one block.
+   */
+  void mapTuple(int tupleIdx, ValueType* tuple) const;
+  ValueType mapComponent(int tupleIdx, int comp) const;
+  ///@}
+
+  /**
+   * Returns the size in KiB of the compressed values. The per-thread caches of decompressed blocks
+   * are not accounted for.
+   */
+  unsigned long getMemorySize() const;
+
+  /**
+   * Returns the size in bytes of the compressed values.
+   */
+  std::size_t GetCompressedSize() const;
+
+  /**
+   * Returns the compression parameters.
+   */
+  const vtkCompressedImplicitBackendOptions& GetOptions() const;
+
+  /**
+   * Decompress all the values in AOS order into `values`, which must be able to hold all the
+   * values of the array. This does not use the caches.
+   */
+  void DecompressAll(ValueType* values) const;
+
+private:
+  struct Internals;
+  std::unique_ptr<Internals> Internal;
+};
+VTK_ABI_NAMESPACE_END
+
+#endif // vtkCompressedImplicitBackend_h
@@ -0,0 +1,292 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDataArray.h"
+#include "vtkHDFReader.h"
+#include "vtkImageData.h"
+#include "vtkMemoryMappedFile.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+
+#include "vtkHDF5ScopedHandle.h"
+#include "vtk_hdf5.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Checks that vtkHDFReader maps the contiguous datasets of an image, and only
+// those, when UseMemoryMapping is on. Chunked and compressed datasets, datasets
+// stored with the other byte order, selections that are not contiguous in the
+// file and files opened with another driver than sec2 are read instead.
+namespace
+{
+// Large enough for the selections read below to be larger than the minimum
+// size mapped by vtkMemoryMappedFile.
+constexpr int NX = 256;
+constexpr int NY = 128;
+constexpr int NZ = 8;
+
+//------------------------------------------------------------------------------
+double ExpectedValue(const char* name, vtkIdType pointId, int component)
+{
+  if (!strcmp(name, "Vectors"))
+  {
+    const double factors[3] = { 1.0, -1.0, 2.0 };
+    return factors[component] * pointId;
+  }
+  return 0.5 * pointId;
+}
+
+//------------------------------------------------------------------------------
+bool WriteDataset(hid_t group, const char* name, hid_t fileType, hid_t memoryType, int numComps,
+  bool chunked, const void* data)
+{
+  std::vector<hsize_t> dims = { NZ, NY, NX };
+  if (numComps > 1)
+  {
+    dims.push_back(numComps);
+  }
+  vtkHDF::ScopedH5SHandle space =
+    H5Screate_simple(static_cast<int>(dims.size()), dims.data(), nullptr);
+  vtkHDF::ScopedH5PHandle plist = H5Pcreate(H5P_DATASET_CREATE);
+  if (space < 0 || plist < 0)
+  {
+    return false;
+  }
+  if (chunked)
+  {
+    std::vector<hsize_t> chunk = dims;
+    chunk[0] = 2;
+    if (H5Pset_chunk(plist, static_cast<int>(chunk.size()), chunk.data()) < 0 ||
+      (H5Zfilter_avail(H5Z_FILTER_DEFLATE) > 0 && H5Pset_deflate(plist, 1) < 0))
+    {
+      return false;
+    }
+  }
+  vtkHDF::ScopedH5DHandle dataset =
+    H5Dcreate(group, name, fileType, space, H5P_DEFAULT, plist, H5P_DEFAULT);
+  return dataset >= 0 && H5Dwrite(dataset, memoryType, H5S_ALL, H5S_ALL, H5P_DEFAULT, data) >= 0;
+}
+
+//------------------------------------------------------------------------------
+bool WriteAttribute(hid_t group, const char* name, hid_t fileType, hid_t memoryType,
+  hsize_t size, const void* data)
+{
+  vtkHDF::ScopedH5SHandle space = H5Screate_simple(1, &size, nullptr);
+  vtkHDF::ScopedH5AHandle attribute =
+    H5Acreate(group, name, fileType, space, H5P_DEFAULT, H5P_DEFAULT);
+  return attribute >= 0 && H5Awrite(attribute, memoryType, data) >= 0;
+}
+
+//------------------------------------------------------------------------------
+// Write a VTKHDF image whose point data is either contiguous or chunked and
+// compressed.
+bool WriteImage(const std::string& fileName, bool chunked)
+{
+  vtkHDF::ScopedH5FHandle file =
+    H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+  if (file < 0)
+  {
+    std::cerr << "Cannot create " << fileName << std::endl;
+    return false;
+  }
+  vtkHDF::ScopedH5GHandle root = H5Gcreate(file, "VTKHDF", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if (root < 0)
+  {
+    return false;
+  }
+
+  const char* typeName = "ImageData";
+  vtkHDF::ScopedH5SHandle scalarSpace = H5Screate(H5S_SCALAR);
+  vtkHDF::ScopedH5THandle stringType = H5Tcreate(H5T_STRING, strlen(typeName));
+  vtkHDF::ScopedH5AHandle typeAttribute =
+    H5Acreate(root, "Type", stringType, scalarSpace, H5P_DEFAULT, H5P_DEFAULT);
+  if (typeAttribute < 0 || H5Awrite(typeAttribute, stringType, typeName) < 0)
+  {
+    return false;
+  }
+  const int version[2] = { 2, 0 };
+  const int wholeExtent[6] = { 0, NX - 1, 0, NY - 1, 0, NZ - 1 };
+  const double origin[3] = { 0.0, 0.0, 0.0 };
+  const double spacing[3] = { 1.0, 1.0, 1.0 };
+  const double direction[9] = { 1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0 };
+  if (!WriteAttribute(root, "Version", H5T_STD_I64LE, H5T_NATIVE_INT, 2, version) ||
+    !WriteAttribute(root, "WholeExtent", H5T_STD_I64LE, H5T_NATIVE_INT, 6, wholeExtent) ||
+    !WriteAttribute(root, "Origin", H5T_IEEE_F64LE, H5T_NATIVE_DOUBLE, 3, origin) ||
+    !WriteAttribute(root, "Spacing", H5T_IEEE_F64LE, H5T_NATIVE_DOUBLE, 3, spacing) ||
+    !WriteAttribute(root, "Direction", H5T_IEEE_F64LE, H5T_NATIVE_DOUBLE, 9, direction))
+  {
+    return false;
+  }
+
+  const vtkIdType numberOfPoints = NX * NY * NZ;
+  std::vector<double> scalars(numberOfPoints);
+  std::vector<float> vectors(3 * numberOfPoints);
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    scalars[i] = ExpectedValue("Scalars", i, 0);
+    for (int c = 0; c < 3; ++c)
+    {
+      vectors[3 * i + c] = static_cast<float>(ExpectedValue("Vectors", i, c));
+    }
+  }
+  const hid_t swappedType =
+    H5Tget_order(H5T_NATIVE_DOUBLE) == H5T_ORDER_LE ? H5T_IEEE_F64BE : H5T_IEEE_F64LE;
+  vtkHDF::ScopedH5GHandle pointData =
+    H5Gcreate(root, "PointData", H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+  if (pointData < 0 ||
+    !WriteDataset(
+      pointData, "Scalars", H5T_NATIVE_DOUBLE, H5T_NATIVE_DOUBLE, 1, chunked, scalars.data()) ||
+    !WriteDataset(
+      pointData, "Vectors", H5T_NATIVE_FLOAT, H5T_NATIVE_FLOAT, 3, chunked, vectors.data()) ||
+    !WriteDataset(
+      pointData, "Swapped", swappedType, H5T_NATIVE_DOUBLE, 1, chunked, scalars.data()))
+  {
+    std::cerr << "Cannot write the point data of " << fileName << std::endl;
+    return false;
+  }
+  return true;
+}
+
+//------------------------------------------------------------------------------
+// Whether files are opened with the sec2 driver, which is the default unless
+// the HDF5_DRIVER environment variable selects another one.
+bool UsesSec2Driver(const std::string& fileName)
+{
+  vtkHDF::ScopedH5FHandle file = H5Fopen(fileName.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+  vtkHDF::ScopedH5PHandle accessPlist = H5Fget_access_plist(file);
+  return accessPlist >= 0 && H5Pget_driver(accessPlist) == H5FD_SEC2;
+}
+
+//------------------------------------------------------------------------------
+// Read the given extent of the image, and check the values of the arrays and
+// whether they are mapped. The reader is deleted, which closes the mapped
+// file, before the values are checked.
+vtkSmartPointer<vtkImageData> ReadImage(
+  const std::string& fileName, const int extent[6], bool useMapping, bool expectMapped)
+{
+  vtkSmartPointer<vtkImageData> image;
+  {
+    vtkNew<vtkHDFReader> reader;
+    reader->SetFileName(fileName.c_str());
+    reader->SetUseMemoryMapping(useMapping);
+    reader->UpdateExtent(extent);
+    image = vtkImageData::SafeDownCast(reader->GetOutputDataObject(0));
+  }
+  int outExtent[6];
+  image->GetExtent(outExtent);
+  for (int i = 0; i < 6; ++i)
+  {
+    if (outExtent[i] != extent[i])
+    {
+      std::cerr << "Wrong extent read from " << fileName << std::endl;
+      return nullptr;
+    }
+  }
+
+  for (const char* name : { "Scalars", "Vectors", "Swapped" })
+  {
+    const int numComps = strcmp(name, "Vectors") ? 1 : 3;
+    vtkDataArray* array = image->GetPointData()->GetArray(name);
+    if (!array || array->GetNumberOfTuples() != image->GetNumberOfPoints() ||
+      array->GetNumberOfComponents() != numComps)
+    {
+      std::cerr << "Wrong " << name << " array read from " << fileName << std::endl;
+      return nullptr;
+    }
+    const bool mapped = expectMapped && strcmp(name, "Swapped") != 0;
+    if (vtkMemoryMappedFile::IsMapped(array->GetVoidPointer(0)) != mapped)
+    {
+      std::cerr << name << " array of " << fileName << " should " << (mapped ? "" : "not ")
+                << "be mapped with the extent " << extent[0] << " " << extent[1] << " "
+                << extent[2] << " " << extent[3] << " " << extent[4] << " " << extent[5]
+                << std::endl;
+      return nullptr;
+    }
+    vtkIdType tupleId = 0;
+    for (int k = extent[4]; k <= extent[5]; ++k)
+    {
+      for (int j = extent[2]; j <= extent[3]; ++j)
+      {
+        for (int i = extent[0]; i <= extent[1]; ++i, ++tupleId)
+        {
+          const vtkIdType pointId = (static_cast<vtkIdType>(k) * NY + j) * NX + i;
+          for (int c = 0; c < numComps; ++c)
+          {
+            if (array->GetComponent(tupleId, c) != ExpectedValue(name, pointId, c))
+            {
+              std::cerr << "Wrong value in " << name << " array of " << fileName
+                        << " at point " << pointId << std::endl;
+              return nullptr;
+            }
+          }
+        }
+      }
+    }
+  }
+  return image;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestHDFReaderMemoryMapping(int argc, char* argv[])
+{
+  char* tempDirCStr =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  // The test is also run with HDF5_DRIVER set, so use distinct files.
+  const char* driver = std::getenv("HDF5_DRIVER");
+  const std::string prefix =
+    std::string(tempDirCStr) + "/TestHDFReaderMemoryMapping" + (driver ? driver : "");
+  delete[] tempDirCStr;
+
+  const std::string contiguousFile = prefix + "Contiguous.vtkhdf";
+  const std::string chunkedFile = prefix + "Chunked.vtkhdf";
+  if (!WriteImage(contiguousFile, false) || !WriteImage(chunkedFile, true))
+  {
+    return EXIT_FAILURE;
+  }
+  const bool sec2 = UsesSec2Driver(contiguousFile);
+  std::cout << "Files are opened with the " << (sec2 ? "" : "non ") << "sec2 driver"
+            << std::endl;
+
+  // The whole image, a slab of full slices, a part of a single slice, which are
+  // contiguous in the file, and a box which is not.
+  const int extents[4][6] = {
+    { 0, NX - 1, 0, NY - 1, 0, NZ - 1 },
+    { 0, NX - 1, 0, NY - 1, 3, 6 },
+    { 0, NX - 1, 2, 97, 5, 5 },
+    { 0, NX - 1, 2, 97, 3, 6 },
+  };
+  const bool contiguous[4] = { true, true, true, false };
+  for (int e = 0; e < 4; ++e)
+  {
+    for (bool useMapping : { false, true })
+    {
+      const bool expectMapped = useMapping && sec2 && contiguous[e];
+      if (!ReadImage(contiguousFile, extents[e], useMapping, expectMapped) ||
+        !ReadImage(chunkedFile, extents[e], useMapping, false))
+      {
+        return EXIT_FAILURE;
+      }
+    }
+  }
+
+  // Mapped arrays are copy on write: modifying them does not modify the file.
+  vtkSmartPointer<vtkImageData> image = ReadImage(contiguousFile, extents[0], true, sec2);
+  if (!image)
+  {
+    return EXIT_FAILURE;
+  }
+  image->GetPointData()->GetArray("Scalars")->SetComponent(0, 0, -1.0);
+  if (!ReadImage(contiguousFile, extents[0], true, sec2))
+  {
+    std::cerr << "Modifying a mapped array modified the file." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -165,6 +165,8 @@ bool ReadPolyDataPiece(T* impl, std::shared_ptr<CacheT> cache, vtkIdType pointOf
     }
     vtkNew<vtkCellArray> cellArray;
     cellArray->SetData(offsetsArray, connectivityArray);
+    // Cells that all have the same size, e.g. triangles, do not need offsets
+    cellArray->ConvertToFixedSizeStorage();
     cArrays.emplace_back(cellArray);
   }
   pieceData->SetVerts(cArrays[0]);
@@ -378,6 +380,7 @@ void vtkHDFReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "Step: " << this->Step << "\n";
   os << indent << "TimeValue: " << this->TimeValue << "\n";
   os << indent << "TimeRange: " << this->TimeRange[0] << " - " << this->TimeRange[1] << "\n";
+  os << indent << "UseMemoryMapping: " << (this->UseMemoryMapping ? "true" : "false") << "\n";
 }
 
 //----------------------------------------------------------------------------
@@ -924,6 +927,8 @@ int vtkHDFReader::Read(const std::vector<vtkIdType>& numberOfPoints,
     return 0;
   }
   cellArray->SetData(offsetsArray, connectivityArray);
+  // Cells that all have the same size, e.g. tetrahedra, do not need offsets
+  cellArray->ConvertToFixedSizeStorage();
 
   vtkIdType cellOffset =
     std::accumulate(numberOfCells.data(), &numberOfCells[filePiece], startingCellOffset);
@@ -148,6 +148,23 @@ public:
   vtkBooleanMacro(UseCache, bool);
   ///@}
 
+  ///@{
+  /**
+   * Boolean property determining whether to memory map arrays from the file instead of reading
+   * them (default is false).
+   *
+   * Only the parts of datasets that are stored contiguously in the file, with the type of the
+   * array and the byte order of this machine, are mapped; other arrays are read. Pages of the file
+   * are then only loaded when the values are accessed. Mapped arrays are copy on write: modifying
+   * them never modifies the file. The file must not be modified while the arrays are in use.
+   *
+   * @sa vtkMemoryMappedFile
+   */
+  vtkGetMacro(UseMemoryMapping, bool);
+  vtkSetMacro(UseMemoryMapping, bool);
+  vtkBooleanMacro(UseMemoryMapping, bool);
+  ///@}
+
   ///@{
   /**
    * Boolean property determining whether to merge partitions when reading unstructured data.
@@ -300,6 +317,7 @@ protected:
   Implementation* Impl;
 
   bool UseCache = false;
+  bool UseMemoryMapping = false;
   struct DataCache;
   std::shared_ptr<DataCache> Cache;
 
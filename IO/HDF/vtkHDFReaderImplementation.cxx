@@ -24,6 +24,7 @@
 #include "vtkLogger.h"
 #include "vtkLongArray.h"
 #include "vtkLongLongArray.h"
+#include "vtkMemoryMappedFile.h"
 #include "vtkOverlappingAMR.h"
 #include "vtkShortArray.h"
 #include "vtkStringArray.h"
@@ -457,6 +458,11 @@ void vtkHDFReader::Implementation::Close()
     H5Fclose(this->File);
     this->File = -1;
   }
+  if (this->MappedFile)
+  {
+    // Arrays mapped from the file stay valid.
+    this->MappedFile->Close();
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -1049,6 +1055,11 @@ vtkDataArray* vtkHDFReader::Implementation::NewArray(
   }
   auto array = vtkAOSDataArrayTemplate<T>::SafeDownCast(NewVtkDataArray<T>());
   array->SetNumberOfComponents(numberOfComponents);
+  if (this->MapArray(dataset, TemplateTypeToHdfNativeType<T>(), fileExtent, numberOfComponents,
+        numberOfTuples, array))
+  {
+    return array;
+  }
   array->SetNumberOfTuples(numberOfTuples);
   T* data = array->GetPointer(0);
   if (!this->NewArray(dataset, fileExtent, numberOfComponents, data))
@@ -1116,6 +1127,94 @@ bool vtkHDFReader::Implementation::NewArray(
   return true;
 }
 
+//------------------------------------------------------------------------------
+bool vtkHDFReader::Implementation::MapArray(hid_t dataset, hid_t memoryType,
+  const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents, vtkIdType numberOfTuples,
+  vtkDataArray* array)
+{
+  if (!this->Reader->GetUseMemoryMapping() || numberOfTuples <= 0)
+  {
+    return false;
+  }
+
+  // Only datasets stored contiguously in a single file, with the memory type,
+  // can be mapped.
+  vtkHDF::ScopedH5PHandle accessPlist = H5Fget_access_plist(this->File);
+  if (accessPlist < 0 || H5Pget_driver(accessPlist) != H5FD_SEC2)
+  {
+    return false;
+  }
+  vtkHDF::ScopedH5PHandle createPlist = H5Dget_create_plist(dataset);
+  if (createPlist < 0 || H5Pget_layout(createPlist) != H5D_CONTIGUOUS ||
+    H5Pget_external_count(createPlist) != 0)
+  {
+    return false;
+  }
+  const haddr_t address = H5Dget_offset(dataset);
+  vtkHDF::ScopedH5THandle fileType = H5Dget_type(dataset);
+  if (address == HADDR_UNDEF || fileType < 0 || H5Tequal(fileType, memoryType) <= 0)
+  {
+    return false;
+  }
+
+  vtkHDF::ScopedH5SHandle filespace = H5Dget_space(dataset);
+  const int ndims = filespace < 0 ? -1 : H5Sget_simple_extent_ndims(filespace);
+  if (ndims <= 0)
+  {
+    return false;
+  }
+  std::vector<hsize_t> dims(ndims);
+  H5Sget_simple_extent_dims(filespace, dims.data(), nullptr);
+
+  // Same selection as the one read by NewArray
+  std::vector<hsize_t> count(fileExtent.size() >> 1), start(fileExtent.size() >> 1);
+  for (size_t i = 0; i < count.size(); ++i)
+  {
+    count[i] = fileExtent[i * 2 + 1] - fileExtent[i * 2];
+    start[i] = fileExtent[i * 2];
+  }
+  if (numberOfComponents > 1)
+  {
+    count.push_back(numberOfComponents);
+    start.push_back(0);
+  }
+  if (count.size() != dims.size())
+  {
+    return false;
+  }
+
+  // The selection is contiguous in the file if the trailing dimensions are
+  // fully selected, and if a single index is selected in the leading ones
+  // except the last partially selected one.
+  size_t partial = dims.size();
+  while (partial > 0 && start[partial - 1] == 0 && count[partial - 1] == dims[partial - 1])
+  {
+    --partial;
+  }
+  hsize_t firstValue = 0;
+  for (size_t i = 0; i < dims.size(); ++i)
+  {
+    if (i + 1 < partial && count[i] != 1)
+    {
+      return false;
+    }
+    firstValue = firstValue * dims[i] + start[i];
+  }
+
+  if (!this->MappedFile)
+  {
+    this->MappedFile = vtkSmartPointer<vtkMemoryMappedFile>::New();
+    this->MappedFile->SetAccessModeToCopyOnWrite();
+  }
+  if (!this->MappedFile->IsOpen() && !this->MappedFile->Open(this->FileName.c_str()))
+  {
+    return false;
+  }
+  const vtkTypeInt64 offset =
+    static_cast<vtkTypeInt64>(address + firstValue * H5Tget_size(memoryType));
+  return this->MappedFile->MapArray(array, offset, numberOfTuples);
+}
+
 //------------------------------------------------------------------------------
 bool vtkHDFReader::Implementation::IsPathSoftLink(const std::string& path)
 {
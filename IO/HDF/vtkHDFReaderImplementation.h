@@ -11,6 +11,7 @@
 
 #include "vtkHDFReader.h"
 #include "vtkHDFUtilities.h"
+#include "vtkSmartPointer.h" // For vtkSmartPointer
 #include "vtk_hdf5.h"
 #include <array>
 #include <map>
@@ -22,6 +23,7 @@ class vtkAbstractArray;
 class vtkDataArray;
 class vtkStringArray;
 class vtkDataAssembly;
+class vtkMemoryMappedFile;
 
 /**
  * Implementation for the vtkHDFReader. Opens, closes and
@@ -256,6 +258,14 @@ protected:
     hid_t dataset, const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents, T* data);
   vtkStringArray* NewStringArray(hid_t dataset, hsize_t size);
   ///@}
+  /**
+   * Make array use the fileExtent of dataset memory mapped from the file, if
+   * the reader uses memory mapping and if the values are stored contiguously
+   * in the file with the given memory type. Return false if the values must be
+   * read instead.
+   */
+  bool MapArray(hid_t dataset, hid_t memoryType, const std::vector<hsize_t>& fileExtent,
+    hsize_t numberOfComponents, vtkIdType numberOfTuples, vtkDataArray* array);
   /**
    * Builds a map between native types and GetArray routines for that type.
    */
@@ -276,6 +286,8 @@ private:
   int NumberOfPieces;
   std::array<int, 2> Version;
   vtkHDFReader* Reader;
+  // The file mapped by MapArray, opened on demand.
+  vtkSmartPointer<vtkMemoryMappedFile> MappedFile;
   using ArrayReader = vtkDataArray* (vtkHDFReader::Implementation::*)(hid_t dataset,
     const std::vector<hsize_t>& fileExtent, hsize_t numberOfComponents);
   std::map<TypeDescription, ArrayReader> TypeReaderMap;
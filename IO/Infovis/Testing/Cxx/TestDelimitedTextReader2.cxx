@@ -1,7 +1,9 @@
 // SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
 // SPDX-License-Identifier: BSD-3-Clause
 
+#include <vtkContiguousStringArray.h>
 #include <vtkDelimitedTextReader.h>
+#include <vtkIntArray.h>
 #include <vtkTable.h>
 #include <vtkTestUtilities.h>
 
@@ -66,5 +68,28 @@ int TestDelimitedTextReader2(int argc, char* argv[])
 
   reader2->Delete();
 
+  //------------  test the reader with contiguous string columns-----------------
+  vtkDelimitedTextReader* reader3 = vtkDelimitedTextReader::New();
+  reader3->SetHaveHeaders(true);
+  reader3->SetReadFromInputString(1);
+  reader3->SetInputString(inputString);
+  reader3->SetDetectNumericColumns(true);
+  reader3->SetUseContiguousStringArrays(true);
+  reader3->Update();
+
+  vtkTable* table3 = reader3->GetOutput();
+  vtkContiguousStringArray* regions =
+    vtkArrayDownCast<vtkContiguousStringArray>(table3->GetColumnByName("region"));
+  if (table3->GetNumberOfRows() != 6 || !regions || regions->GetValue(5) != "Turkey" ||
+    table3->GetValueByName(0, "region").ToString() != "china" ||
+    !vtkArrayDownCast<vtkIntArray>(table3->GetColumnByName("awesomeness")))
+  {
+    cout << "ERROR: Wrong contiguous string columns" << endl;
+    table3->Dump();
+    return 1;
+  }
+
+  reader3->Delete();
+
   return 0;
 }
@@ -4,6 +4,7 @@
 
 #include "vtkDelimitedTextReader.h"
 #include "vtkCommand.h"
+#include "vtkContiguousStringArray.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkIdTypeArray.h"
 #include "vtkInformation.h"
@@ -54,7 +55,8 @@ public:
   DelimitedTextIterator(const vtkIdType max_records, const std::string& record_delimiters,
     const std::string& field_delimiters, const std::string& string_delimiters,
     const std::string& whitespace, const std::string& escape, bool have_headers,
-    bool merg_cons_delimiters, bool use_string_delimiter, vtkTable* const output_table)
+    bool merg_cons_delimiters, bool use_string_delimiter, bool use_contiguous_strings,
+    vtkTable* const output_table)
     : MaxRecords(max_records)
     , MaxRecordIndex(have_headers ? max_records + 1 : max_records)
     , RecordDelimiters(record_delimiters.begin(), record_delimiters.end())
@@ -71,6 +73,7 @@ public:
     , MergeConsDelims(merg_cons_delimiters)
     , ProcessEscapeSequence(false)
     , UseStringDelimiter(use_string_delimiter)
+    , UseContiguousStrings(use_contiguous_strings)
     , WithinString(0)
   {
   }
@@ -237,7 +240,9 @@ private:
     if (this->CurrentFieldIndex >= this->OutputTable->GetNumberOfColumns() &&
       0 == this->CurrentRecordIndex)
     {
-      vtkAbstractArray* array = vtkStringArray::New();
+      vtkAbstractArray* array = this->UseContiguousStrings
+        ? static_cast<vtkAbstractArray*>(vtkContiguousStringArray::New())
+        : static_cast<vtkAbstractArray*>(vtkStringArray::New());
 
       if (this->HaveHeaders)
       {
@@ -248,8 +253,7 @@ private:
         std::stringstream buffer;
         buffer << "Field " << this->CurrentFieldIndex;
         array->SetName(buffer.str().c_str());
-        vtkArrayDownCast<vtkStringArray>(array)->InsertValue(
-          this->CurrentRecordIndex, this->CurrentField);
+        this->InsertValue(array, this->CurrentRecordIndex);
       }
       this->OutputTable->AddColumn(array);
       array->Delete();
@@ -263,9 +267,19 @@ private:
         rec_index--;
       }
 
-      vtkStringArray* sarray =
-        vtkArrayDownCast<vtkStringArray>(this->OutputTable->GetColumn(this->CurrentFieldIndex));
-      sarray->InsertValue(rec_index, this->CurrentField);
+      this->InsertValue(this->OutputTable->GetColumn(this->CurrentFieldIndex), rec_index);
+    }
+  }
+
+  void InsertValue(vtkAbstractArray* array, vtkIdType index)
+  {
+    if (this->UseContiguousStrings)
+    {
+      vtkArrayDownCast<vtkContiguousStringArray>(array)->InsertValue(index, this->CurrentField);
+    }
+    else
+    {
+      vtkArrayDownCast<vtkStringArray>(array)->InsertValue(index, this->CurrentField);
     }
   }
 
@@ -286,6 +300,7 @@ private:
   bool MergeConsDelims;
   bool ProcessEscapeSequence;
   bool UseStringDelimiter;
+  bool UseContiguousStrings;
   vtkTypeUInt32 WithinString;
 };
 
@@ -325,6 +340,7 @@ vtkDelimitedTextReader::vtkDelimitedTextReader()
   this->StringDelimiter = '"';
   this->UseStringDelimiter = true;
   this->DetectNumericColumns = false;
+  this->UseContiguousStringArrays = false;
   this->ForceDouble = false;
   this->DefaultIntegerValue = 0;
   this->DefaultDoubleValue = 0.0;
@@ -370,6 +386,9 @@ void vtkDelimitedTextReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "UseStringDelimiter: " << (this->UseStringDelimiter ? "true" : "false") << endl;
   os << indent << "DetectNumericColumns: " << (this->DetectNumericColumns ? "true" : "false")
      << endl;
+  os << indent
+     << "UseContiguousStringArrays: " << (this->UseContiguousStringArrays ? "true" : "false")
+     << endl;
   os << indent << "ForceDouble: " << (this->ForceDouble ? "true" : "false") << endl;
   os << indent << "DefaultIntegerValue: " << this->DefaultIntegerValue << endl;
   os << indent << "DefaultDoubleValue: " << this->DefaultDoubleValue << endl;
@@ -576,7 +595,7 @@ int vtkDelimitedTextReader::ReadData(vtkTable* output_table)
     DelimitedTextIterator iterator(this->MaxRecords, this->UnicodeRecordDelimiters,
       this->UnicodeFieldDelimiters, this->UnicodeStringDelimiters, this->UnicodeWhitespace,
       this->UnicodeEscapeCharacter, this->HaveHeaders, this->MergeConsecutiveDelimiters,
-      this->UseStringDelimiter, output_table);
+      this->UseStringDelimiter, this->UseContiguousStringArrays, output_table);
 
     transCodec->ToUnicode(*input_stream_pt, iterator);
     iterator.ReachedEndOfInput();
@@ -201,6 +201,18 @@ public:
   vtkBooleanMacro(DetectNumericColumns, bool);
   ///@}
 
+  ///@{
+  /**
+   * When set to true, the reader creates vtkContiguousStringArray columns
+   * instead of vtkStringArray columns. They store the characters of all the
+   * fields of a column in a single buffer, which uses much less memory for
+   * files with many short string fields. Default is off.
+   */
+  vtkSetMacro(UseContiguousStringArrays, bool);
+  vtkGetMacro(UseContiguousStringArrays, bool);
+  vtkBooleanMacro(UseContiguousStringArrays, bool);
+  ///@}
+
   ///@{
   /**
    * When set to true and DetectNumericColumns is also true, forces all
@@ -328,6 +340,7 @@ protected:
   std::string UnicodeWhitespace;
   std::string UnicodeEscapeCharacter;
   bool DetectNumericColumns;
+  bool UseContiguousStringArrays;
   bool ForceDouble;
   bool TrimWhitespacePriorToNumericConversion;
   int DefaultIntegerValue;
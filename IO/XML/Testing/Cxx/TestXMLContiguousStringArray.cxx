@@ -0,0 +1,100 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+// Check that vtkContiguousStringArray columns are written as "String" arrays
+// that are read back as vtkStringArray in all the data modes.
+
+#include "vtkContiguousStringArray.h"
+#include "vtkIntArray.h"
+#include "vtkLogger.h"
+#include "vtkNew.h"
+#include "vtkStringArray.h"
+#include "vtkTable.h"
+#include "vtkXMLTableReader.h"
+#include "vtkXMLTableWriter.h"
+
+#include <cstdlib>
+#include <string>
+
+namespace
+{
+//------------------------------------------------------------------------------
+bool WriteAndRead(vtkTable* table, int dataMode, bool compress)
+{
+  vtkNew<vtkXMLTableWriter> writer;
+  writer->SetInputData(table);
+  writer->SetDataMode(dataMode);
+  writer->SetCompressorType(compress ? vtkXMLWriter::ZLIB : vtkXMLWriter::NONE);
+  // small blocks split the strings across blocks
+  writer->SetBlockSize(16);
+  writer->WriteToOutputStringOn();
+  if (!writer->Write())
+  {
+    vtkLog(ERROR, "Cannot write the table in data mode " << dataMode);
+    return false;
+  }
+
+  vtkNew<vtkXMLTableReader> reader;
+  reader->ReadFromInputStringOn();
+  reader->SetInputString(writer->GetOutputString());
+  reader->Update();
+  vtkTable* output = reader->GetOutput();
+
+  vtkContiguousStringArray* input =
+    vtkArrayDownCast<vtkContiguousStringArray>(table->GetColumnByName("names"));
+  vtkStringArray* names = vtkArrayDownCast<vtkStringArray>(output->GetColumnByName("names"));
+  if (!names || names->GetNumberOfValues() != input->GetNumberOfValues() ||
+    names->GetNumberOfComponents() != input->GetNumberOfComponents())
+  {
+    vtkLog(ERROR, "Wrong string array read in data mode " << dataMode);
+    return false;
+  }
+  for (vtkIdType i = 0; i < input->GetNumberOfValues(); ++i)
+  {
+    if (names->GetValue(i) != input->GetValue(i))
+    {
+      vtkLog(ERROR, "Wrong value " << i << " in data mode " << dataMode << ": \""
+                                   << names->GetValue(i) << "\" instead of \""
+                                   << input->GetValue(i) << "\"");
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestXMLContiguousStringArray(int, char*[])
+{
+  vtkNew<vtkContiguousStringArray> names;
+  names->SetName("names");
+  names->SetNumberOfComponents(2);
+  vtkNew<vtkIntArray> values;
+  values->SetName("values");
+  for (int i = 0; i < 50; ++i)
+  {
+    names->InsertNextValue(i % 7 ? "name " + std::to_string(i) : std::string());
+    names->InsertNextValue(std::string(static_cast<size_t>(i % 23), 'a' + i % 26));
+    values->InsertNextValue(i);
+  }
+  vtkNew<vtkTable> table;
+  table->AddColumn(names);
+  table->AddColumn(values);
+
+  // vtkTable access
+  if (table->GetValueByName(3, "names").ToArray()->GetVariantValue(0).ToString() != "name 3")
+  {
+    vtkLog(ERROR, "Wrong value returned by vtkTable.");
+    return EXIT_FAILURE;
+  }
+
+  for (bool compress : { false, true })
+  {
+    if (!WriteAndRead(table, vtkXMLWriter::Ascii, compress) ||
+      !WriteAndRead(table, vtkXMLWriter::Binary, compress) ||
+      !WriteAndRead(table, vtkXMLWriter::Appended, compress))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
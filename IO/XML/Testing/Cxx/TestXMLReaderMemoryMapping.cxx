@@ -0,0 +1,117 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkMemoryMappedFile.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkTesting.h"
+#include "vtkXMLImageDataReader.h"
+#include "vtkXMLImageDataWriter.h"
+
+#include <cstdlib>
+#include <iostream>
+#include <string>
+
+// Checks that vtkXMLReader maps the arrays of raw appended data sections, and
+// only those, when UseMemoryMapping is on.
+namespace
+{
+//------------------------------------------------------------------------------
+bool WriteAndRead(vtkImageData* image, const std::string& fileName, bool raw, bool compressed)
+{
+  vtkNew<vtkXMLImageDataWriter> writer;
+  writer->SetFileName(fileName.c_str());
+  writer->SetInputData(image);
+  writer->SetDataModeToAppended();
+  writer->SetEncodeAppendedData(!raw);
+  writer->AlignAppendedDataOn();
+  if (compressed)
+  {
+    writer->SetCompressorTypeToZLib();
+  }
+  else
+  {
+    writer->SetCompressorTypeToNone();
+  }
+  if (!writer->Write())
+  {
+    std::cerr << "Cannot write " << fileName << std::endl;
+    return false;
+  }
+
+  vtkNew<vtkXMLImageDataReader> reader;
+  reader->SetFileName(fileName.c_str());
+  reader->UseMemoryMappingOn();
+  reader->Update();
+  vtkPointData* pointData = reader->GetOutput()->GetPointData();
+  const bool expectMapped = raw && !compressed;
+  for (const char* name : { "Scalars", "Vectors" })
+  {
+    vtkDataArray* expected = image->GetPointData()->GetArray(name);
+    vtkDataArray* array = pointData->GetArray(name);
+    if (!array || array->GetNumberOfTuples() != expected->GetNumberOfTuples() ||
+      array->GetNumberOfComponents() != expected->GetNumberOfComponents())
+    {
+      std::cerr << "Wrong " << name << " array read from " << fileName << std::endl;
+      return false;
+    }
+    if (vtkMemoryMappedFile::IsMapped(array->GetVoidPointer(0)) != expectMapped)
+    {
+      std::cerr << name << " array of " << fileName << " should "
+                << (expectMapped ? "" : "not ") << "be mapped" << std::endl;
+      return false;
+    }
+    const int numComps = expected->GetNumberOfComponents();
+    for (vtkIdType i = 0; i < expected->GetNumberOfTuples(); ++i)
+    {
+      for (int c = 0; c < numComps; ++c)
+      {
+        if (array->GetComponent(i, c) != expected->GetComponent(i, c))
+        {
+          std::cerr << "Wrong value in " << name << " array of " << fileName << std::endl;
+          return false;
+        }
+      }
+    }
+  }
+  return true;
+}
+}
+
+//------------------------------------------------------------------------------
+int TestXMLReaderMemoryMapping(int argc, char* argv[])
+{
+  vtkNew<vtkImageData> image;
+  image->SetDimensions(64, 64, 16);
+  const vtkIdType numberOfPoints = image->GetNumberOfPoints();
+
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfValues(numberOfPoints);
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetName("Vectors");
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(numberOfPoints);
+  for (vtkIdType i = 0; i < numberOfPoints; ++i)
+  {
+    scalars->SetValue(i, 0.5f * static_cast<float>(i));
+    vectors->SetTuple3(i, i, -i, 2.0 * i);
+  }
+  image->GetPointData()->AddArray(scalars);
+  image->GetPointData()->AddArray(vectors);
+
+  vtkNew<vtkTesting> testing;
+  testing->AddArguments(argc, argv);
+  const std::string prefix =
+    std::string(testing->GetTempDirectory()) + "/TestXMLReaderMemoryMapping";
+
+  if (!WriteAndRead(image, prefix + "Raw.vti", true, false) ||
+    !WriteAndRead(image, prefix + "Encoded.vti", false, false) ||
+    !WriteAndRead(image, prefix + "Compressed.vti", true, true))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
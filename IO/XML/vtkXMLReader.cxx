@@ -25,6 +25,7 @@
 #include "vtkInformationVector.h"
 #include "vtkLZ4DataCompressor.h"
 #include "vtkLZMADataCompressor.h"
+#include "vtkMemoryMappedFile.h"
 #include "vtkObjectFactory.h"
 #include "vtkQuadratureSchemeDefinition.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -236,6 +237,7 @@ void vtkXMLReader::PrintSelf(ostream& os, vtkIndent indent)
   os << indent << "NumberOfTimeSteps:" << this->NumberOfTimeSteps << "\n";
   os << indent << "TimeStepRange:(" << this->TimeStepRange[0] << "," << this->TimeStepRange[1]
      << ")\n";
+  os << indent << "UseMemoryMapping: " << this->UseMemoryMapping << "\n";
 }
 
 //------------------------------------------------------------------------------
@@ -448,6 +450,12 @@ void vtkXMLReader::CloseVTKFile()
     delete this->FileStream;
     this->FileStream = nullptr;
   }
+  if (this->MappedFile)
+  {
+    // Arrays mapped from the file stay valid. The file is opened again by the
+    // next read, in case it changed.
+    this->MappedFile->Close();
+  }
 }
 
 //------------------------------------------------------------------------------
@@ -977,12 +985,20 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
                                << arrayIndex + numValues << " were requested to be read");
     return 0;
   }
-  switch (array->GetDataType())
+  if (this->MapArrayValues(da, arrayIndex, array, startIndex, numValues))
   {
-    vtkArrayIteratorTemplateMacro(result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser,
-                                    arrayIndex, static_cast<VTK_TT*>(iter), startIndex, numValues));
-    default:
-      result = 0;
+    result = 1;
+  }
+  else
+  {
+    switch (array->GetDataType())
+    {
+      vtkArrayIteratorTemplateMacro(
+        result = vtkXMLDataReaderReadArrayValues(da, this->XMLParser, arrayIndex,
+          static_cast<VTK_TT*>(iter), startIndex, numValues));
+      default:
+        result = 0;
+    }
   }
   if (iter)
   {
@@ -1002,6 +1018,47 @@ int vtkXMLReader::ReadArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
   return result;
 }
 
+//------------------------------------------------------------------------------
+bool vtkXMLReader::MapArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex,
+  vtkAbstractArray* array, vtkIdType startIndex, vtkIdType numValues)
+{
+  // Only a read filling the whole array can be replaced by a mapping, and
+  // only the files opened by this reader can be mapped.
+  vtkDataArray* dataArray = vtkArrayDownCast<vtkDataArray>(array);
+  if (!this->UseMemoryMapping || !dataArray || !this->FileStream ||
+    this->Stream != this->FileStream || arrayIndex != 0 ||
+    numValues != array->GetNumberOfValues() || !da->GetAttribute("offset") ||
+    array->GetArrayType() != vtkAbstractArray::AoSDataArrayTemplate)
+  {
+    return false;
+  }
+  const int numComps = array->GetNumberOfComponents();
+  if (numComps <= 0 || numValues % numComps != 0)
+  {
+    return false;
+  }
+
+  vtkTypeInt64 offset = 0;
+  da->GetScalarAttribute("offset", offset);
+  const vtkTypeInt64 position = this->XMLParser->GetRawAppendedDataPosition(
+    offset, startIndex, static_cast<size_t>(numValues), array->GetDataType());
+  if (position < 0)
+  {
+    return false;
+  }
+
+  if (!this->MappedFile)
+  {
+    this->MappedFile = vtkSmartPointer<vtkMemoryMappedFile>::New();
+    this->MappedFile->SetAccessModeToCopyOnWrite();
+  }
+  if (!this->MappedFile->IsOpen() && !this->MappedFile->Open(this->FileName))
+  {
+    return false;
+  }
+  return this->MappedFile->MapArray(dataArray, position, numValues / numComps);
+}
+
 //------------------------------------------------------------------------------
 int vtkXMLReader::ReadArrayTuples(vtkXMLDataElement* da, vtkIdType arrayTupleIndex,
   vtkAbstractArray* array, vtkIdType startTupleIndex, vtkIdType numTuples, FieldType fieldType)
@@ -31,6 +31,7 @@ class vtkXMLDataElement;
 class vtkXMLDataParser;
 class vtkInformationVector;
 class vtkInformation;
+class vtkMemoryMappedFile;
 class vtkStringArray;
 
 class VTKIOXML_EXPORT vtkXMLReader : public vtkAlgorithm
@@ -61,6 +62,26 @@ public:
   vtkSetMacro(ReadFromInputString, vtkTypeBool);
   vtkGetMacro(ReadFromInputString, vtkTypeBool);
   vtkBooleanMacro(ReadFromInputString, vtkTypeBool);
+  ///@}
+
+  ///@{
+  /**
+   * When on, arrays stored uncompressed in a raw appended data section with the
+   * byte order of this machine are memory mapped from the file instead of being
+   * read in memory, as long as a piece fills the whole array. Pages of the file
+   * are then only loaded when the values are accessed. Mapped arrays are copy on
+   * write: modifying them never modifies the file. The file must not be modified
+   * while the arrays are in use. The values must be aligned in the file, which
+   * vtkXMLWriter does when its AlignAppendedData option is on; other arrays are
+   * read. Default is off.
+   *
+   * @sa vtkMemoryMappedFile
+   */
+  vtkSetMacro(UseMemoryMapping, bool);
+  vtkGetMacro(UseMemoryMapping, bool);
+  vtkBooleanMacro(UseMemoryMapping, bool);
+  ///@}
+
   ///@{
   /**
    * Specify the InputString for use when reading from a character array.
@@ -507,6 +528,16 @@ protected:
 
   virtual void ConvertGhostLevelsToGhostType(FieldType, vtkAbstractArray*, vtkIdType, vtkIdType) {}
 
+  /**
+   * Make array use the memory mapped values of da when UseMemoryMapping is on
+   * and the values can be used as they are stored in the file. Return false if
+   * the values must be read instead.
+   */
+  bool MapArrayValues(vtkXMLDataElement* da, vtkIdType arrayIndex, vtkAbstractArray* array,
+    vtkIdType startIndex, vtkIdType numValues);
+
+  bool UseMemoryMapping = false;
+
   /*
    * Populate the output's FieldData with the file's FieldData tags content
    */
@@ -517,6 +548,8 @@ private:
   istream* FileStream;
   // The stream used to read the input if it is in a string.
   std::istringstream* StringStream;
+  // The file mapped by MapArrayValues, opened on demand.
+  vtkSmartPointer<vtkMemoryMappedFile> MappedFile;
   int TimeStepWasReadOnce;
 
   int FileMajorVersion;
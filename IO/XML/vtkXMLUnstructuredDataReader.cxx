@@ -857,6 +857,9 @@ int vtkXMLUnstructuredDataReader::ReadCellArray(vtkIdType numberOfCells,
            "type.");
       return 0;
     }
+
+    // Cells that all have the same size, e.g. tetrahedra, do not need offsets
+    outCells->ConvertToFixedSizeStorage();
   }
   else
   { // Construct a temporary vtkCellArray that holds the arrays, and then
@@ -879,6 +882,7 @@ int vtkXMLUnstructuredDataReader::ReadCellArray(vtkIdType numberOfCells,
       return 0;
     }
 
+    tmpCells->ConvertToFixedSizeStorage();
     outCells->Append(tmpCells, this->StartPoint);
   }
 
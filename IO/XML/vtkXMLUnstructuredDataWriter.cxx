@@ -1055,6 +1055,7 @@ struct ConvertCellsVisitor
   void operator()(CellStateT& state)
   {
     using ArrayT = typename CellStateT::ArrayType;
+    using ValueType = typename CellStateT::ValueType;
 
     vtkNew<ArrayT> offsets;
     vtkNew<ArrayT> conn;
@@ -1065,6 +1066,20 @@ struct ConvertCellsVisitor
     conn->SetName("connectivity");
     this->Connectivity = std::move(conn);
 
+    const vtkIdType cellSize = state.GetFixedCellSize();
+    if (cellSize > 0)
+    { // Write the implied offsets of fixed size storage, skipping the first one
+      const vtkIdType numCells = state.GetNumberOfCells();
+      offsets->SetNumberOfValues(numCells);
+      for (vtkIdType cellId = 0; cellId < numCells; ++cellId)
+      {
+        offsets->SetValue(cellId, static_cast<ValueType>((cellId + 1) * cellSize));
+      }
+      offsets->SetName("offsets");
+      this->Offsets = std::move(offsets);
+      return;
+    }
+
     // The file format for offsets always skips the first offset, because
     // it's always zero. Use SetArray and GetPointer to create a view
     // of the offsets array that starts at index=1:
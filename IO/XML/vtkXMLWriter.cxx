@@ -10,6 +10,7 @@
 #include "vtkByteSwap.h"
 #include "vtkCellData.h"
 #include "vtkCommand.h"
+#include "vtkContiguousStringArray.h"
 #include "vtkDataArray.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
@@ -336,11 +337,30 @@ void WriteDataArrayFallback(ValueType*, vtkDataArray* array, WriteBinaryDataBloc
   vtkXMLWriterHelper::SetProgressPartial(worker.Writer, 1);
 }
 
+//------------------------------------------------------------------------------
+// Get the characters of a string of either kind of string arrays:
+inline void vtkXMLWriterGetString(
+  vtkArrayIteratorTemplate<vtkStdString>* iter, size_t index, const char*& data, size_t& length)
+{
+  const vtkStdString& str = iter->GetValue(static_cast<vtkIdType>(index));
+  data = str.c_str();
+  length = str.size();
+}
+
+inline void vtkXMLWriterGetString(
+  vtkContiguousStringArray* array, size_t index, const char*& data, size_t& length)
+{
+  const vtkContiguousStringArray::StringView view =
+    array->GetView(static_cast<vtkIdType>(index));
+  data = view.Data;
+  length = static_cast<size_t>(view.Size);
+}
+
 //------------------------------------------------------------------------------
 // Specialize for string arrays:
-int vtkXMLWriterWriteBinaryDataBlocks(vtkXMLWriter* writer,
-  vtkArrayIteratorTemplate<vtkStdString>* iter, int wordType, size_t outWordSize, size_t numStrings,
-  int)
+template <class StringsT>
+int vtkXMLWriterWriteBinaryDataBlocks(
+  vtkXMLWriter* writer, StringsT* iter, int wordType, size_t outWordSize, size_t numStrings, int)
 {
   vtkXMLWriterHelper::SetProgressPartial(writer, 0);
   vtkStdString::value_type* allocated_buffer = nullptr;
@@ -376,9 +396,9 @@ int vtkXMLWriterWriteBinaryDataBlocks(vtkXMLWriter* writer,
     size_t cur_offset = 0; // offset into the temp_buffer.
     while (index < numStrings && cur_offset < maxCharsPerBlock)
     {
-      vtkStdString& str = iter->GetValue(static_cast<vtkIdType>(index));
-      vtkStdString::size_type length = str.size();
-      const char* data = str.c_str();
+      const char* data;
+      size_t length;
+      vtkXMLWriterGetString(iter, index, data, length);
       data += stringOffset; // advance by the chars already written.
       length -= stringOffset;
       if (length == 0)
@@ -1136,6 +1156,11 @@ int vtkXMLWriter::WriteBinaryDataInternal(vtkAbstractArray* a)
     }
     aiter->Delete();
   }
+  else if (wordType == VTK_CONTIGUOUS_STRING)
+  {
+    ret = vtkXMLWriterWriteBinaryDataBlocks(this,
+      vtkArrayDownCast<vtkContiguousStringArray>(a), wordType, outWordSize, numValues, 1);
+  }
   else if (vtkDataArray* da = vtkArrayDownCast<vtkDataArray>(a))
   {
     // Create a dispatcher that also handles vtkBitArray:
@@ -1451,6 +1476,7 @@ size_t vtkXMLWriter::GetWordTypeSize(int dataType)
     vtkTemplateMacro(size = vtkXMLWriterGetWordTypeSize(static_cast<VTK_TT*>(nullptr)));
 
     case VTK_STRING:
+    case VTK_CONTIGUOUS_STRING:
       size = sizeof(vtkStdString::value_type);
       break;
 
@@ -1477,6 +1503,7 @@ const char* vtkXMLWriter::GetWordTypeName(int dataType)
     case VTK_BIT:
       return "Bit";
     case VTK_STRING:
+    case VTK_CONTIGUOUS_STRING:
       return "String";
     case VTK_FLOAT:
       return "Float32";
@@ -1924,6 +1951,24 @@ inline ostream& vtkXMLWriteAsciiValue(ostream& os, const vtkStdString& str)
   return vtkXMLWriteAsciiValue(os, delim);
 }
 
+//------------------------------------------------------------------------------
+// Provide the iterator interface used by vtkXMLWriteAsciiData for
+// vtkContiguousStringArray, which has no vtkStdString iterator.
+class vtkXMLContiguousStringIterator
+{
+public:
+  vtkXMLContiguousStringIterator(vtkContiguousStringArray* array)
+    : Array(array)
+  {
+  }
+  vtkIdType GetNumberOfTuples() { return this->Array->GetNumberOfTuples(); }
+  int GetNumberOfComponents() { return this->Array->GetNumberOfComponents(); }
+  vtkStdString GetValue(vtkIdType id) { return this->Array->GetValue(id); }
+
+private:
+  vtkContiguousStringArray* Array;
+};
+
 //------------------------------------------------------------------------------
 template <class iterT>
 int vtkXMLWriteAsciiData(ostream& os, iterT* iter, vtkIndent indent)
@@ -1966,8 +2011,13 @@ int vtkXMLWriteAsciiData(ostream& os, iterT* iter, vtkIndent indent)
 //------------------------------------------------------------------------------
 int vtkXMLWriter::WriteAsciiData(vtkAbstractArray* a, vtkIndent indent)
 {
-  vtkArrayIterator* iter = a->NewIterator();
   ostream& os = *(this->Stream);
+  if (vtkContiguousStringArray* csa = vtkArrayDownCast<vtkContiguousStringArray>(a))
+  {
+    vtkXMLContiguousStringIterator citer(csa);
+    return vtkXMLWriteAsciiData(os, &citer, indent);
+  }
+  vtkArrayIterator* iter = a->NewIterator();
   int ret;
   switch (a->GetDataType())
   {
@@ -2027,6 +2077,20 @@ void vtkXMLWriter::WriteArrayAppended(vtkAbstractArray* a, vtkIndent indent, Off
 void vtkXMLWriter::WriteArrayAppendedData(
   vtkAbstractArray* a, vtkTypeInt64 pos, vtkTypeInt64& lastoffset)
 {
+  if (this->AlignAppendedData && !this->EncodeAppendedData && !this->Compressor)
+  {
+    // Pad raw uncompressed data so that the values following the header are
+    // aligned on 8 bytes in the file, which lets readers memory map them.
+    // Readers skip the padding since the offset of each array is stored.
+    ostream& os = *(this->Stream);
+    const vtkTypeInt64 headerSize = this->HeaderType == vtkXMLWriter::UInt64 ? 8 : 4;
+    const vtkTypeInt64 misalignment = (static_cast<vtkTypeInt64>(os.tellp()) + headerSize) % 8;
+    if (misalignment != 0)
+    {
+      const char padding[8] = { 0 };
+      os.write(padding, static_cast<std::streamsize>(8 - misalignment));
+    }
+  }
   this->WriteAppendedDataOffset(pos, lastoffset, "offset");
   this->WriteBinaryData(a);
 }
@@ -28,6 +28,7 @@ vtkXMLWriterBase::vtkXMLWriterBase()
 #endif
   , DataMode(vtkXMLWriterBase::Appended)
   , EncodeAppendedData(true)
+  , AlignAppendedData(false)
   , Compressor(vtkZLibDataCompressor::New())
   , BlockSize(32768) // 2^15
   , CompressionLevel(5)
@@ -258,6 +259,7 @@ void vtkXMLWriterBase::PrintSelf(ostream& os, vtkIndent indent)
     os << indent << "Compressor: (none)\n";
   }
   os << indent << "EncodeAppendedData: " << this->EncodeAppendedData << "\n";
+  os << indent << "AlignAppendedData: " << this->AlignAppendedData << "\n";
   os << indent << "BlockSize: " << this->BlockSize << "\n";
 }
 VTK_ABI_NAMESPACE_END
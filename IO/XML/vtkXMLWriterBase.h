@@ -199,6 +199,19 @@ public:
   vtkBooleanMacro(EncodeAppendedData, bool);
   ///@}
 
+  ///@{
+  /**
+   * Get/Set whether the arrays of a raw, uncompressed appended data section
+   * are padded so that their values are aligned on 8 bytes in the file. This
+   * lets vtkXMLReader map them in memory when its UseMemoryMapping option is
+   * on. Ignored when the appended data is encoded or compressed. The default
+   * is off, which writes the arrays contiguously.
+   */
+  vtkSetMacro(AlignAppendedData, bool);
+  vtkGetMacro(AlignAppendedData, bool);
+  vtkBooleanMacro(AlignAppendedData, bool);
+  ///@}
+
   ///@{
   /**
    * Control whether to write "TimeValue" field data.
@@ -254,6 +267,9 @@ protected:
   // Whether to base64-encode the appended data section.
   bool EncodeAppendedData;
 
+  // Whether to align the arrays of a raw appended data section.
+  bool AlignAppendedData;
+
   // Compression information.
   vtkDataCompressor* Compressor;
   size_t BlockSize;
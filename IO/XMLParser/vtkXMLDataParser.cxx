@@ -962,6 +962,44 @@ size_t vtkXMLDataParser::ReadAppendedData(
   return this->ReadBinaryData(buffer, startWord, numWords, wordType);
 }
 
+//------------------------------------------------------------------------------
+vtkTypeInt64 vtkXMLDataParser::GetRawAppendedDataPosition(
+  vtkTypeInt64 offset, vtkTypeUInt64 startWord, size_t numWords, int wordType)
+{
+#ifdef VTK_WORDS_BIGENDIAN
+  const int nativeByteOrder = vtkXMLDataParser::BigEndian;
+#else
+  const int nativeByteOrder = vtkXMLDataParser::LittleEndian;
+#endif
+  if (!this->Stream || this->Compressor || this->ByteOrder != nativeByteOrder ||
+    this->AppendedDataStream->IsA("vtkBase64InputStream"))
+  {
+    return -1;
+  }
+
+  // Read the length of the data from its header.
+  std::unique_ptr<vtkXMLDataHeader> uh(vtkXMLDataHeader::New(this->HeaderType, 1));
+  size_t const headerSize = uh->DataSize();
+  this->DataStream = this->AppendedDataStream;
+  this->SeekG(this->AppendedDataPosition + offset);
+  this->DataStream->SetStream(this->Stream);
+  this->DataStream->StartReading();
+  size_t r = this->DataStream->Read(uh->Data(), headerSize);
+  this->DataStream->EndReading();
+  if (r < headerSize)
+  {
+    return -1;
+  }
+
+  size_t wordSize = this->GetWordTypeSize(wordType);
+  if ((startWord + numWords) * wordSize > uh->Get(0))
+  {
+    return -1;
+  }
+  return this->AppendedDataPosition + offset + static_cast<vtkTypeInt64>(headerSize) +
+    static_cast<vtkTypeInt64>(startWord * wordSize);
+}
+
 //------------------------------------------------------------------------------
 //------------------------------------------------------------------------------
 // Define a parsing function template.  The extra "long" argument is used
@@ -70,6 +70,16 @@ public:
     return this->ReadAppendedData(offset, buffer, startWord, numWords, VTK_CHAR);
   }
 
+  /**
+   * Return the position in the input stream of the appended data words
+   * [startWord, startWord + numWords) starting at the given appended data
+   * offset, if they are stored in the stream exactly as they are in memory.
+   * Returns -1 if the appended data is encoded or compressed, if its byte
+   * order is not the one of this machine, or if the data is too short.
+   */
+  vtkTypeInt64 GetRawAppendedDataPosition(
+    vtkTypeInt64 offset, vtkTypeUInt64 startWord, size_t numWords, int wordType);
+
   /**
    * Read from an ascii data section starting at the current position in
    * the stream.  Returns the number of words read.
@@ -5,6 +5,7 @@
 #include "vtkStringToCategory.h"
 
 #include "vtkCellData.h"
+#include "vtkContiguousStringArray.h"
 #include "vtkDataSet.h"
 #include "vtkDemandDrivenPipeline.h"
 #include "vtkDoubleArray.h"
@@ -20,6 +21,7 @@
 #include "vtkTable.h"
 
 #include <set>
+#include <unordered_map>
 
 VTK_ABI_NAMESPACE_BEGIN
 vtkStandardNewMacro(vtkStringToCategory);
@@ -69,7 +71,8 @@ int vtkStringToCategory::RequestData(
 
   vtkAbstractArray* arr = this->GetInputAbstractArrayToProcess(0, 0, inputVector);
   vtkStringArray* stringArr = vtkArrayDownCast<vtkStringArray>(arr);
-  if (!stringArr)
+  vtkContiguousStringArray* contiguousArr = vtkArrayDownCast<vtkContiguousStringArray>(arr);
+  if (!stringArr && !contiguousArr)
   {
     vtkErrorMacro("String array input could not be found");
     return 0;
@@ -86,8 +89,8 @@ int vtkStringToCategory::RequestData(
   }
 
   // Perform the conversion
-  vtkIdType numTuples = stringArr->GetNumberOfTuples();
-  int numComp = stringArr->GetNumberOfComponents();
+  vtkIdType numTuples = arr->GetNumberOfTuples();
+  int numComp = arr->GetNumberOfComponents();
   vtkIntArray* catArr = vtkIntArray::New();
   if (this->CategoryArrayName)
   {
@@ -101,9 +104,28 @@ int vtkStringToCategory::RequestData(
   catArr->SetNumberOfTuples(numTuples);
   fd->AddArray(catArr);
   catArr->Delete();
+  int category = 0;
+  if (contiguousArr)
+  {
+    // Number the strings in a single pass, in the order of their first
+    // occurrence, without building the lookup of the array.
+    std::unordered_map<std::string, int> categories;
+    for (vtkIdType i = 0; i < numTuples * numComp; i++)
+    {
+      const vtkContiguousStringArray::StringView view = contiguousArr->GetView(i);
+      auto inserted =
+        categories.emplace(std::string(view.Data, static_cast<size_t>(view.Size)), category);
+      if (inserted.second)
+      {
+        strings->InsertNextValue(inserted.first->first);
+        ++category;
+      }
+      catArr->SetValue(i, inserted.first->second);
+    }
+    return 1;
+  }
   vtkIdList* list = vtkIdList::New();
   std::set<std::string> s;
-  int category = 0;
   for (vtkIdType i = 0; i < numTuples * numComp; i++)
   {
     if (s.find(stringArr->GetValue(i)) == s.end())
@@ -7,7 +7,8 @@
  *
  *
  * vtkStringToCategory creates an integer array named "category" based on the
- * values in a string array.  You may use this filter to create an array that
+ * values in a string array, which may be a vtkStringArray or a
+ * vtkContiguousStringArray.  You may use this filter to create an array that
  * you may use to color points/cells by the values in a string array.  Currently
  * there is not support to color by a string array directly.
  * The category values will range from zero to N-1,
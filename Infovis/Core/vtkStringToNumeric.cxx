@@ -5,6 +5,7 @@
 #include "vtkStringToNumeric.h"
 
 #include "vtkCellData.h"
+#include "vtkContiguousStringArray.h"
 #include "vtkDataSet.h"
 #include "vtkDemandDrivenPipeline.h"
 #include "vtkDoubleArray.h"
@@ -41,8 +42,8 @@ int vtkStringToNumeric::CountItemsToConvert(vtkFieldData* fieldData)
   for (int arr = 0; arr < fieldData->GetNumberOfArrays(); arr++)
   {
     vtkAbstractArray* array = fieldData->GetAbstractArray(arr);
-    vtkStringArray* stringArray = vtkArrayDownCast<vtkStringArray>(array);
-    if (stringArray)
+    if (vtkArrayDownCast<vtkStringArray>(array) ||
+      vtkArrayDownCast<vtkContiguousStringArray>(array))
     {
       count += array->GetNumberOfTuples() * array->GetNumberOfComponents();
     }
@@ -129,9 +130,10 @@ void vtkStringToNumeric::ConvertArrays(vtkFieldData* fieldData)
 {
   for (int arr = 0; arr < fieldData->GetNumberOfArrays(); arr++)
   {
-    vtkStringArray* stringArray =
-      vtkArrayDownCast<vtkStringArray>(fieldData->GetAbstractArray(arr));
-    if (!stringArray)
+    vtkAbstractArray* stringArray = fieldData->GetAbstractArray(arr);
+    vtkStringArray* sa = vtkArrayDownCast<vtkStringArray>(stringArray);
+    vtkContiguousStringArray* csa = vtkArrayDownCast<vtkContiguousStringArray>(stringArray);
+    if (!sa && !csa)
     {
       continue;
     }
@@ -164,7 +166,7 @@ void vtkStringToNumeric::ConvertArrays(vtkFieldData* fieldData)
           static_cast<double>(this->ItemsConverted) / static_cast<double>(this->ItemsToConvert));
       }
 
-      std::string str = stringArray->GetValue(i);
+      std::string str = sa ? sa->GetValue(i) : csa->GetValue(i);
 
       if (this->TrimWhitespacePriorToNumericConversion)
       {
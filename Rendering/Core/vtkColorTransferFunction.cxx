@@ -6,6 +6,7 @@
 #include "vtkDoubleArray.h"
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
+#include "vtkSMPTools.h"
 
 #include <algorithm>
 #include <cmath>
@@ -1443,6 +1444,10 @@ void vtkColorTransferFunction::ShallowCopy(vtkColorTransferFunction* f)
   }
 }
 
+//------------------------------------------------------------------------------
+// Smaller sets of values are mapped by the calling thread.
+static constexpr vtkIdType vtkColorTransferFunctionGrainSize = 65536;
+
 //------------------------------------------------------------------------------
 // Accelerate the mapping by copying the data in 32-bit chunks instead
 // of 8-bit chunks.  The extra "long" argument is to help broken
@@ -1452,11 +1457,6 @@ template <class T>
 void vtkColorTransferFunctionMapData(vtkColorTransferFunction* self, T* input,
   unsigned char* output, int length, int inIncr, int outFormat, long)
 {
-  double x;
-  int i = length;
-  double rgb[3];
-  unsigned char* optr = output;
-  T* iptr = input;
   unsigned char alpha = static_cast<unsigned char>(self->GetAlpha() * 255.0);
 
   if (self->GetSize() == 0)
@@ -1465,29 +1465,37 @@ void vtkColorTransferFunctionMapData(vtkColorTransferFunction* self, T* input,
     return;
   }
 
-  while (--i >= 0)
-  {
-    x = static_cast<double>(*iptr);
-    self->GetColor(x, rgb);
+  // GetColor only reads the nodes of the function when IndexedLookup is off,
+  // indexed lookup being mapped by vtkColorTransferFunctionIndexedMapData, so
+  // that values are mapped concurrently.
+  vtkSMPTools::For(0, length, vtkColorTransferFunctionGrainSize,
+    [=](vtkIdType begin, vtkIdType end) {
+      double rgb[3];
+      unsigned char* optr = output + begin * outFormat;
+      const T* iptr = input + begin * inIncr;
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        self->GetColor(static_cast<double>(*iptr), rgb);
 
-    if (outFormat == VTK_RGB || outFormat == VTK_RGBA)
-    {
-      *(optr++) = static_cast<unsigned char>(rgb[0] * 255.0 + 0.5);
-      *(optr++) = static_cast<unsigned char>(rgb[1] * 255.0 + 0.5);
-      *(optr++) = static_cast<unsigned char>(rgb[2] * 255.0 + 0.5);
-    }
-    else // LUMINANCE  use coeffs of (0.30  0.59  0.11)*255.0
-    {
-      *(optr++) =
-        static_cast<unsigned char>(rgb[0] * 76.5 + rgb[1] * 150.45 + rgb[2] * 28.05 + 0.5);
-    }
+        if (outFormat == VTK_RGB || outFormat == VTK_RGBA)
+        {
+          *(optr++) = static_cast<unsigned char>(rgb[0] * 255.0 + 0.5);
+          *(optr++) = static_cast<unsigned char>(rgb[1] * 255.0 + 0.5);
+          *(optr++) = static_cast<unsigned char>(rgb[2] * 255.0 + 0.5);
+        }
+        else // LUMINANCE  use coeffs of (0.30  0.59  0.11)*255.0
+        {
+          *(optr++) =
+            static_cast<unsigned char>(rgb[0] * 76.5 + rgb[1] * 150.45 + rgb[2] * 28.05 + 0.5);
+        }
 
-    if (outFormat == VTK_RGBA || outFormat == VTK_LUMINANCE_ALPHA)
-    {
-      *(optr++) = alpha;
-    }
-    iptr += inIncr;
-  }
+        if (outFormat == VTK_RGBA || outFormat == VTK_LUMINANCE_ALPHA)
+        {
+          *(optr++) = alpha;
+        }
+        iptr += inIncr;
+      }
+    });
 }
 
 //------------------------------------------------------------------------------
@@ -7,6 +7,7 @@
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPiecewiseFunction.h"
+#include "vtkSMPTools.h"
 #include "vtkTemplateAliasMacro.h"
 #include "vtkTuple.h"
 #include "vtkUnsignedCharArray.h"
@@ -349,6 +350,10 @@ double vtkDiscretizableColorTransferFunction::GetOpacity(double v)
   return this->ScalarOpacityFunction->GetValue(v);
 }
 
+//------------------------------------------------------------------------------
+// Smaller sets of values are mapped by the calling thread.
+static constexpr vtkIdType vtkDiscretizableColorTransferFunctionGrainSize = 65536;
+
 //------------------------------------------------------------------------------
 // Internal mapping of the opacity value through the lookup table
 template <class T>
@@ -356,12 +361,8 @@ static void vtkDiscretizableColorTransferFunctionMapOpacity(
   vtkDiscretizableColorTransferFunction* self, T* input, unsigned char* output, int length,
   int inIncr, int outFormat)
 {
-  double x;
-  int i = length;
-  unsigned char* optr = output;
-  T* iptr = input;
-
-  if (self->GetScalarOpacityFunction()->GetSize() == 0)
+  vtkPiecewiseFunction* opacityFunction = self->GetScalarOpacityFunction();
+  if (opacityFunction->GetSize() == 0)
   {
     vtkGenericWarningMacro("Transfer Function Has No Points!");
     return;
@@ -373,18 +374,21 @@ static void vtkDiscretizableColorTransferFunctionMapOpacity(
   }
 
   // opacity component stride
-  unsigned int stride = (outFormat == VTK_RGBA ? 4 : 2);
-
-  optr += stride - 1; // Move to first alpha value
-  // Iterate through color components
-  while (--i >= 0)
-  {
-    x = static_cast<double>(*iptr);
-    double alpha = self->GetScalarOpacityFunction()->GetValue(x);
-    *(optr) = static_cast<unsigned char>(alpha * 255.0 + 0.5);
-    optr += stride;
-    iptr += inIncr;
-  }
+  const int stride = (outFormat == VTK_RGBA ? 4 : 2);
+
+  // Evaluating the opacity function does not modify it, values are mapped concurrently
+  vtkSMPTools::For(0, length, vtkDiscretizableColorTransferFunctionGrainSize,
+    [=](vtkIdType begin, vtkIdType end) {
+      const T* iptr = input + begin * inIncr;
+      unsigned char* optr = output + begin * stride + stride - 1; // Move to first alpha value
+      for (vtkIdType i = begin; i < end; ++i)
+      {
+        double alpha = opacityFunction->GetValue(static_cast<double>(*iptr));
+        *(optr) = static_cast<unsigned char>(alpha * 255.0 + 0.5);
+        optr += stride;
+        iptr += inIncr;
+      }
+    });
 }
 
 //------------------------------------------------------------------------------
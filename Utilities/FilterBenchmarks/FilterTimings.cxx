@@ -0,0 +1,44 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+/*
+To add a test you must define a subclass of vtkFTTest and implement the
+pure virtual functions. Then in the main section at the bottom of this
+file add your test to the tests to be run and rebuild. See some of the
+existing tests in vtkFilterTimingTests.h to get an idea of what to do.
+*/
+
+#include "vtkFilterTimingTests.h"
+
+/*=========================================================================
+The main entry point
+=========================================================================*/
+int main(int argc, char* argv[])
+{
+  // create the timing framework
+  vtkFilterTimings a;
+
+  // add the tests
+  a.TestsToRun.push_back(new flyingEdgesTest("FlyingEdges3D"));
+  a.TestsToRun.push_back(new contourGridTest("ContourGrid"));
+
+  a.TestsToRun.push_back(new clipTest("TableBasedClip"));
+  a.TestsToRun.push_back(new thresholdTest("Threshold"));
+
+  a.TestsToRun.push_back(new normalsTest("PolyDataNormals"));
+  a.TestsToRun.push_back(new cellToPointTest("CellDataToPointData"));
+  a.TestsToRun.push_back(new probeTest("ProbeFilter"));
+
+  a.TestsToRun.push_back(new pointLocatorBuildTest("StaticPointLocatorBuild"));
+  a.TestsToRun.push_back(new pointLocatorQueryTest("StaticPointLocatorQuery"));
+  a.TestsToRun.push_back(new cellLocatorBuildTest("StaticCellLocatorBuild"));
+  a.TestsToRun.push_back(new cellLocatorQueryTest("StaticCellLocatorQuery"));
+
+  a.TestsToRun.push_back(new xmlTest("XMLWrite", ".vtu", false));
+  a.TestsToRun.push_back(new xmlTest("XMLRead", ".vtu", true));
+  a.TestsToRun.push_back(new hdfTest("HDFWrite", ".vtkhdf", false));
+  a.TestsToRun.push_back(new hdfTest("HDFRead", ".vtkhdf", true));
+
+  // process them
+  return a.ParseCommandLineArguments(argc, argv);
+}
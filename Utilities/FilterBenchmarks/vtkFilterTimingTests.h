@@ -0,0 +1,563 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkFilterTimingTests_h
+#define vtkFilterTimingTests_h
+
+/*
+To add a test you must define a subclass of vtkFTTest and implement the
+pure virtual functions. Then in the main section of FilterTimings.cxx
+add your test to the tests to be run and rebuild. Setup creates the input
+of the test from a synthetic source scaled by the size, and Run executes
+the timed algorithm on it once. See some of the existing tests to get an
+idea of what to do.
+*/
+
+#include "vtkFilterTimings.h"
+
+#include "vtkCellTypeSource.h"
+#include "vtkDataArray.h"
+#include "vtkFloatArray.h"
+#include "vtkGenericCell.h"
+#include "vtkImageData.h"
+#include "vtkMinimalStandardRandomSequence.h"
+#include "vtkNew.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <atomic>
+#include <cmath>
+#include <vector>
+
+VTK_ABI_NAMESPACE_BEGIN
+/*=========================================================================
+Synthetic inputs
+=========================================================================*/
+// an image of size^3 points with the "RTData" point scalars of
+// vtkRTAnalyticSource, computed here so that the benchmarks do not depend on
+// the imaging modules
+inline vtkSmartPointer<vtkImageData> vtkFTMakeImage(int size)
+{
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("RTData");
+  scalars->SetNumberOfTuples(static_cast<vtkIdType>(size) * size * size);
+  float* values = scalars->GetPointer(0);
+  const double center = 0.5 * (size - 1);
+  const double scale = size > 1 ? 1.0 / (size - 1) : 1.0;
+  vtkSMPTools::For(0, size, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType k = begin; k < end; ++k)
+    {
+      const double z = (center - k) * scale;
+      const double zfactor = 5.0 * std::cos(40.0 * z);
+      for (vtkIdType j = 0; j < size; ++j)
+      {
+        const double y = (center - j) * scale;
+        const double yfactor = 18.0 * std::sin(30.0 * y);
+        float* row = values + (k * size + j) * size;
+        for (vtkIdType i = 0; i < size; ++i)
+        {
+          const double x = (center - i) * scale;
+          row[i] = static_cast<float>(255.0 * std::exp(-2.0 * (x * x + y * y + z * z)) +
+            10.0 * std::sin(60.0 * x) + yfactor + zfactor);
+        }
+      }
+    }
+  });
+  vtkSmartPointer<vtkImageData> image = vtkSmartPointer<vtkImageData>::New();
+  image->SetDimensions(size, size, size);
+  image->GetPointData()->SetScalars(scalars);
+  return image;
+}
+
+// an unstructured grid of size^3 blocks of cells of the given type, with the
+// "DistanceToCenter" point scalars
+inline vtkSmartPointer<vtkUnstructuredGrid> vtkFTMakeGrid(int size, int cellType)
+{
+  vtkNew<vtkCellTypeSource> source;
+  source->SetCellType(cellType);
+  source->SetBlocksDimensions(size, size, size);
+  source->Update();
+  vtkSmartPointer<vtkUnstructuredGrid> grid = source->GetOutput();
+  grid->GetPointData()->SetActiveScalars("DistanceToCenter");
+  return grid;
+}
+
+// value at the given fraction of the range of the active point scalars
+inline double vtkFTScalarFraction(vtkDataSet* data, double fraction)
+{
+  double range[2];
+  data->GetPointData()->GetScalars()->GetRange(range);
+  return range[0] + fraction * (range[1] - range[0]);
+}
+
+/*=========================================================================
+Define a test for filters that take a single input
+=========================================================================*/
+template <typename FilterT>
+class filterTest : public vtkFTTest
+{
+public:
+  filterTest(const char* name)
+    : vtkFTTest(name)
+  {
+  }
+
+  void Run() override
+  {
+    this->Filter->Modified();
+    this->Filter->Update();
+  }
+
+  vtkIdType GetNumberOfElements() override
+  {
+    return this->Input ? this->Input->GetNumberOfCells() : 0;
+  }
+
+  void TearDown() override
+  {
+    this->Filter = nullptr;
+    this->Input = nullptr;
+  }
+
+protected:
+  // create the filter on the given input
+  void SetInput(vtkDataObject* input)
+  {
+    this->Input = vtkDataSet::SafeDownCast(input);
+    this->Filter = vtkSmartPointer<FilterT>::New();
+    this->Filter->SetInputData(input);
+  }
+
+  vtkSmartPointer<FilterT> Filter;
+  vtkSmartPointer<vtkDataSet> Input;
+};
+
+VTK_ABI_NAMESPACE_END
+/*=========================================================================
+Contouring
+=========================================================================*/
+#include "vtkContourGrid.h"
+#include "vtkFlyingEdges3D.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class flyingEdgesTest : public filterTest<vtkFlyingEdges3D>
+{
+public:
+  flyingEdgesTest(const char* name)
+    : filterTest<vtkFlyingEdges3D>(name)
+  {
+  }
+
+  void Setup(int size) override
+  {
+    this->SetInput(vtkFTMakeImage(size));
+    this->Filter->GenerateValues(5, 100.0, 250.0);
+    this->Filter->ComputeNormalsOn();
+  }
+};
+
+class contourGridTest : public filterTest<vtkContourGrid>
+{
+public:
+  contourGridTest(const char* name)
+    : filterTest<vtkContourGrid>(name)
+  {
+  }
+
+  void Setup(int size) override
+  {
+    // tetrahedra are 5 or 6 times as many as the blocks
+    this->SetInput(vtkFTMakeGrid(size / 2, VTK_TETRA));
+    this->Filter->GenerateValues(
+      5, vtkFTScalarFraction(this->Input, 0.1), vtkFTScalarFraction(this->Input, 0.9));
+  }
+};
+
+VTK_ABI_NAMESPACE_END
+/*=========================================================================
+Clipping and thresholding
+=========================================================================*/
+#include "vtkTableBasedClipDataSet.h"
+#include "vtkThreshold.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class clipTest : public filterTest<vtkTableBasedClipDataSet>
+{
+public:
+  clipTest(const char* name)
+    : filterTest<vtkTableBasedClipDataSet>(name)
+  {
+  }
+
+  void Setup(int size) override
+  {
+    this->SetInput(vtkFTMakeGrid(size, VTK_HEXAHEDRON));
+    this->Filter->SetValue(vtkFTScalarFraction(this->Input, 0.5));
+  }
+};
+
+class thresholdTest : public filterTest<vtkThreshold>
+{
+public:
+  thresholdTest(const char* name)
+    : filterTest<vtkThreshold>(name)
+  {
+  }
+
+  void Setup(int size) override
+  {
+    this->SetInput(vtkFTMakeGrid(size, VTK_HEXAHEDRON));
+    this->Filter->SetInputArrayToProcess(
+      0, 0, 0, vtkDataObject::FIELD_ASSOCIATION_POINTS, "DistanceToCenter");
+    this->Filter->SetThresholdFunction(vtkThreshold::THRESHOLD_BETWEEN);
+    this->Filter->SetLowerThreshold(vtkFTScalarFraction(this->Input, 0.25));
+    this->Filter->SetUpperThreshold(vtkFTScalarFraction(this->Input, 0.75));
+  }
+};
+
+VTK_ABI_NAMESPACE_END
+/*=========================================================================
+Attributes
+=========================================================================*/
+#include "vtkCellDataToPointData.h"
+#include "vtkPointDataToCellData.h"
+#include "vtkPolyDataNormals.h"
+#include "vtkProbeFilter.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+class normalsTest : public filterTest<vtkPolyDataNormals>
+{
+public:
+  normalsTest(const char* name)
+    : filterTest<vtkPolyDataNormals>(name)
+  {
+  }
+
+  void Setup(int size) override
+  {
+    vtkNew<vtkFlyingEdges3D> contour;
+    contour->SetInputData(vtkFTMakeImage(size));
+    contour->GenerateValues(5, 100.0, 250.0);
+    contour->ComputeNormalsOff();
+    contour->Update();
+    this->SetInput(contour->GetOutput());
+  }
+};
+
+class cellToPointTest : public filterTest<vtkCellDataToPointData>
+{
+public:
+  cellToPointTest(const char* name)
+    : filterTest<vtkCellDataToPointData>(name)
+  {
+  }
+
+  void Setup(int size) override
+  {
+    vtkNew<vtkPointDataToCellData> toCells;
+    toCells->SetInputData(vtkFTMakeGrid(size, VTK_HEXAHEDRON));
+    toCells->Update();
+    vtkNew<vtkUnstructuredGrid> grid;
+    grid->ShallowCopy(toCells->GetOutput());
+    grid->GetPointData()->Initialize();
+    this->SetInput(grid);
+  }
+};
+
+class probeTest : public filterTest<vtkProbeFilter>
+{
+public:
+  probeTest(const char* name)
+    : filterTest<vtkProbeFilter>(name)
+  {
+  }
+
+  void Setup(int size) override
+  {
+    // probe the cells of an unstructured grid at the points of an image
+    // covering the grid
+    vtkSmartPointer<vtkUnstructuredGrid> source = vtkFTMakeGrid(size, VTK_HEXAHEDRON);
+    double bounds[6];
+    source->GetBounds(bounds);
+    vtkNew<vtkImageData> probes;
+    probes->SetDimensions(size, size, size);
+    probes->SetOrigin(bounds[0], bounds[2], bounds[4]);
+    probes->SetSpacing((bounds[1] - bounds[0]) / size, (bounds[3] - bounds[2]) / size,
+      (bounds[5] - bounds[4]) / size);
+    this->SetInput(probes);
+    this->Filter->SetSourceData(source);
+  }
+
+  const char* GetElementName() override { return "points"; }
+
+  vtkIdType GetNumberOfElements() override
+  {
+    return this->Input ? this->Input->GetNumberOfPoints() : 0;
+  }
+};
+
+VTK_ABI_NAMESPACE_END
+/*=========================================================================
+Locators
+=========================================================================*/
+#include "vtkStaticCellLocator.h"
+#include "vtkStaticPointLocator.h"
+
+VTK_ABI_NAMESPACE_BEGIN
+// random query points inside the given bounds
+inline std::vector<double> vtkFTMakeQueries(const double bounds[6], vtkIdType count)
+{
+  std::vector<double> queries(3 * count);
+  vtkNew<vtkMinimalStandardRandomSequence> random;
+  random->SetSeed(1);
+  for (vtkIdType i = 0; i < 3 * count; ++i)
+  {
+    const int axis = i % 3;
+    queries[i] = random->GetNextRangeValue(bounds[2 * axis], bounds[2 * axis + 1]);
+  }
+  return queries;
+}
+
+class pointLocatorBuildTest : public vtkFTTest
+{
+public:
+  pointLocatorBuildTest(const char* name)
+    : vtkFTTest(name)
+  {
+  }
+
+  const char* GetElementName() override { return "points"; }
+
+  void Setup(int size) override { this->Input = vtkFTMakeImage(size); }
+
+  void Run() override
+  {
+    vtkNew<vtkStaticPointLocator> locator;
+    locator->SetDataSet(this->Input);
+    locator->BuildLocator();
+  }
+
+  vtkIdType GetNumberOfElements() override { return this->Input->GetNumberOfPoints(); }
+
+  void TearDown() override { this->Input = nullptr; }
+
+protected:
+  vtkSmartPointer<vtkImageData> Input;
+};
+
+class pointLocatorQueryTest : public pointLocatorBuildTest
+{
+public:
+  pointLocatorQueryTest(const char* name)
+    : pointLocatorBuildTest(name)
+  {
+  }
+
+  const char* GetElementName() override { return "queries"; }
+
+  void Setup(int size) override
+  {
+    this->pointLocatorBuildTest::Setup(size);
+    this->Locator = vtkSmartPointer<vtkStaticPointLocator>::New();
+    this->Locator->SetDataSet(this->Input);
+    this->Locator->BuildLocator();
+    this->Queries = vtkFTMakeQueries(this->Input->GetBounds(), this->Input->GetNumberOfPoints());
+  }
+
+  void Run() override
+  {
+    std::atomic<vtkIdType> checksum(0);
+    vtkSMPTools::For(0, this->GetNumberOfElements(),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        vtkIdType sum = 0;
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          sum += this->Locator->FindClosestPoint(&this->Queries[3 * i]);
+        }
+        checksum += sum;
+      });
+  }
+
+  vtkIdType GetNumberOfElements() override
+  {
+    return static_cast<vtkIdType>(this->Queries.size() / 3);
+  }
+
+  void TearDown() override
+  {
+    this->pointLocatorBuildTest::TearDown();
+    this->Locator = nullptr;
+    this->Queries.clear();
+  }
+
+protected:
+  vtkSmartPointer<vtkStaticPointLocator> Locator;
+  std::vector<double> Queries;
+};
+
+class cellLocatorBuildTest : public vtkFTTest
+{
+public:
+  cellLocatorBuildTest(const char* name)
+    : vtkFTTest(name)
+  {
+  }
+
+  void Setup(int size) override { this->Input = vtkFTMakeGrid(size, VTK_HEXAHEDRON); }
+
+  void Run() override
+  {
+    vtkNew<vtkStaticCellLocator> locator;
+    locator->SetDataSet(this->Input);
+    locator->BuildLocator();
+  }
+
+  vtkIdType GetNumberOfElements() override { return this->Input->GetNumberOfCells(); }
+
+  void TearDown() override { this->Input = nullptr; }
+
+protected:
+  vtkSmartPointer<vtkUnstructuredGrid> Input;
+};
+
+class cellLocatorQueryTest : public cellLocatorBuildTest
+{
+public:
+  cellLocatorQueryTest(const char* name)
+    : cellLocatorBuildTest(name)
+  {
+  }
+
+  const char* GetElementName() override { return "queries"; }
+
+  void Setup(int size) override
+  {
+    this->cellLocatorBuildTest::Setup(size);
+    this->Locator = vtkSmartPointer<vtkStaticCellLocator>::New();
+    this->Locator->SetDataSet(this->Input);
+    this->Locator->BuildLocator();
+    this->Queries = vtkFTMakeQueries(this->Input->GetBounds(), this->Input->GetNumberOfCells());
+  }
+
+  void Run() override
+  {
+    vtkSMPThreadLocalObject<vtkGenericCell> cells;
+    std::atomic<vtkIdType> found(0);
+    vtkSMPTools::For(0, this->GetNumberOfElements(),
+      [&](vtkIdType begin, vtkIdType end)
+      {
+        vtkGenericCell* cell = cells.Local();
+        double pcoords[3];
+        double weights[8];
+        int subId;
+        vtkIdType count = 0;
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          count += this->Locator->FindCell(&this->Queries[3 * i], 0.0, cell, subId, pcoords,
+                     weights) >= 0;
+        }
+        found += count;
+      });
+  }
+
+  vtkIdType GetNumberOfElements() override
+  {
+    return static_cast<vtkIdType>(this->Queries.size() / 3);
+  }
+
+  void TearDown() override
+  {
+    this->cellLocatorBuildTest::TearDown();
+    this->Locator = nullptr;
+    this->Queries.clear();
+  }
+
+protected:
+  vtkSmartPointer<vtkStaticCellLocator> Locator;
+  std::vector<double> Queries;
+};
+
+VTK_ABI_NAMESPACE_END
+/*=========================================================================
+Reading and writing files
+=========================================================================*/
+#include "vtkHDFReader.h"
+#include "vtkHDFWriter.h"
+#include "vtkXMLUnstructuredGridReader.h"
+#include "vtkXMLUnstructuredGridWriter.h"
+
+#include <vtksys/SystemTools.hxx>
+
+VTK_ABI_NAMESPACE_BEGIN
+// writes an unstructured grid to a file, or reads it back when Read is true
+template <typename WriterT, typename ReaderT>
+class ioTest : public vtkFTTest
+{
+public:
+  ioTest(const char* name, const char* extension, bool read)
+    : vtkFTTest(name)
+    , Extension(extension)
+    , Read(read)
+  {
+  }
+
+  bool IsThreaded() override { return false; }
+
+  void Setup(int size) override
+  {
+    this->Input = vtkFTMakeGrid(size, VTK_HEXAHEDRON);
+    this->FileName = this->TemporaryDirectory + "/" + this->Name + this->Extension;
+    if (this->Read)
+    {
+      this->Write();
+    }
+  }
+
+  void Run() override
+  {
+    if (this->Read)
+    {
+      vtkNew<ReaderT> reader;
+      reader->SetFileName(this->FileName.c_str());
+      reader->Update();
+    }
+    else
+    {
+      this->Write();
+    }
+  }
+
+  vtkIdType GetNumberOfElements() override { return this->Input->GetNumberOfCells(); }
+
+  void TearDown() override
+  {
+    this->Input = nullptr;
+    vtksys::SystemTools::RemoveFile(this->FileName);
+  }
+
+protected:
+  void Write()
+  {
+    vtkNew<WriterT> writer;
+    writer->SetFileName(this->FileName.c_str());
+    writer->SetInputData(this->Input);
+    writer->Write();
+  }
+
+  std::string Extension;
+  bool Read;
+  std::string FileName;
+  vtkSmartPointer<vtkUnstructuredGrid> Input;
+};
+
+using xmlTest = ioTest<vtkXMLUnstructuredGridWriter, vtkXMLUnstructuredGridReader>;
+using hdfTest = ioTest<vtkHDFWriter, vtkHDFReader>;
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkFilterTimingTests.h
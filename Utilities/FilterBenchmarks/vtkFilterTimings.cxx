@@ -0,0 +1,349 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "vtkFilterTimings.h"
+
+#include "vtkSMPTools.h"
+#include "vtkTimerLog.h"
+#include "vtkVersion.h"
+
+#include <vtksys/FStream.hxx>
+#include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemInformation.hxx>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <numeric>
+#include <sstream>
+
+VTK_ABI_NAMESPACE_BEGIN
+namespace
+{
+// parse a comma separated list of positive integers
+std::vector<int> ParseList(const std::string& text)
+{
+  std::vector<int> values;
+  std::stringstream stream(text);
+  std::string item;
+  while (std::getline(stream, item, ','))
+  {
+    const int value = std::atoi(item.c_str());
+    if (value > 0)
+    {
+      values.push_back(value);
+    }
+  }
+  return values;
+}
+
+void WriteJSONString(ostream& ost, const std::string& text)
+{
+  ost << '"';
+  for (const char c : text)
+  {
+    if (c == '"' || c == '\\')
+    {
+      ost << '\\' << c;
+    }
+    else if (static_cast<unsigned char>(c) < 0x20)
+    {
+      ost << ' ';
+    }
+    else
+    {
+      ost << c;
+    }
+  }
+  ost << '"';
+}
+}
+
+double vtkFTTestResult::GetMinimum() const
+{
+  return this->Times.empty() ? 0.0 : *std::min_element(this->Times.begin(), this->Times.end());
+}
+
+double vtkFTTestResult::GetMedian() const
+{
+  if (this->Times.empty())
+  {
+    return 0.0;
+  }
+  std::vector<double> sorted(this->Times);
+  std::sort(sorted.begin(), sorted.end());
+  const size_t half = sorted.size() / 2;
+  return sorted.size() % 2 ? sorted[half] : 0.5 * (sorted[half - 1] + sorted[half]);
+}
+
+double vtkFTTestResult::GetMean() const
+{
+  if (this->Times.empty())
+  {
+    return 0.0;
+  }
+  return std::accumulate(this->Times.begin(), this->Times.end(), 0.0) / this->Times.size();
+}
+
+double vtkFTTestResult::GetStandardDeviation() const
+{
+  if (this->Times.size() < 2)
+  {
+    return 0.0;
+  }
+  const double mean = this->GetMean();
+  double sum = 0.0;
+  for (double time : this->Times)
+  {
+    sum += (time - mean) * (time - mean);
+  }
+  return std::sqrt(sum / (this->Times.size() - 1));
+}
+
+vtkFilterTimings::vtkFilterTimings()
+{
+  vtksys::SystemInformation si;
+  si.RunOSCheck();
+  this->SystemName = si.GetOSDescription();
+  this->Sizes = "32,64,128";
+  this->TemporaryDirectory = ".";
+  this->ResultsFileName = "results.json";
+  this->DisplayHelp = false;
+  this->ListTests = false;
+  this->Repeats = 5;
+  this->WarmUps = 1;
+}
+
+vtkFilterTimings::~vtkFilterTimings()
+{
+  for (vtkFTTest* test : this->TestsToRun)
+  {
+    delete test;
+  }
+}
+
+void vtkFilterTimings::RunTest(vtkFTTest* test, int size, int numberOfThreads)
+{
+  vtkFTTestResult result;
+  result.Name = test->GetName();
+  result.ElementName = test->GetElementName();
+  result.Size = size;
+  result.NumberOfThreads = numberOfThreads;
+
+  vtkSMPTools::Config config(numberOfThreads);
+  config.Backend = this->Backend;
+  vtkSMPTools::LocalScope(config,
+    [&]()
+    {
+      for (int i = 0; i < this->WarmUps; ++i)
+      {
+        test->Run();
+      }
+      for (int i = 0; i < this->Repeats; ++i)
+      {
+        const double startTime = vtkTimerLog::GetUniversalTime();
+        test->Run();
+        result.Times.push_back(vtkTimerLog::GetUniversalTime() - startTime);
+      }
+    });
+  result.NumberOfElements = test->GetNumberOfElements();
+
+  cout << result.Name << ", size " << size << ", " << numberOfThreads << " threads: "
+       << result.GetMinimum() << " s min, " << result.GetMedian() << " s median" << endl;
+  this->TestResults.push_back(result);
+}
+
+int vtkFilterTimings::RunTests()
+{
+  // what tests to run?
+  vtksys::RegularExpression re;
+  const bool useRegex = !this->Regex.empty();
+  if (useRegex && !re.compile(this->Regex))
+  {
+    cerr << "Invalid regular expression " << this->Regex << endl;
+    return 1;
+  }
+
+  const std::vector<int> sizes = ::ParseList(this->Sizes);
+  std::vector<int> threads = ::ParseList(this->Threads);
+  vtkSMPTools::Config config;
+  if (!this->Backend.empty())
+  {
+    config.Backend = this->Backend;
+  }
+  vtkSMPTools::LocalScope(config,
+    [&]()
+    {
+      this->Backend = vtkSMPTools::GetBackend();
+      if (threads.empty())
+      {
+        threads.push_back(1);
+        const int maxThreads = vtkSMPTools::GetEstimatedDefaultNumberOfThreads();
+        if (maxThreads > 1)
+        {
+          threads.push_back(maxThreads);
+        }
+      }
+    });
+  if (sizes.empty())
+  {
+    cerr << "No valid size in " << this->Sizes << endl;
+    return 1;
+  }
+
+  for (vtkFTTest* test : this->TestsToRun)
+  {
+    if (useRegex && !re.find(test->GetName()))
+    {
+      continue;
+    }
+    test->SetTemporaryDirectory(this->TemporaryDirectory);
+    for (int size : sizes)
+    {
+      test->Setup(size);
+      if (test->IsThreaded())
+      {
+        for (int numberOfThreads : threads)
+        {
+          this->RunTest(test, size, numberOfThreads);
+        }
+      }
+      else
+      {
+        this->RunTest(test, size, 1);
+      }
+      test->TearDown();
+    }
+  }
+
+  return 0;
+}
+
+void vtkFilterTimings::ReportResults(ostream& ost)
+{
+  vtksys::SystemInformation si;
+  si.RunCPUCheck();
+  si.RunMemoryCheck();
+
+  ost << "{\n  \"vtk_version\": ";
+  ::WriteJSONString(ost, vtkVersion::GetVTKVersionFull());
+  ost << ",\n  \"platform\": ";
+  ::WriteJSONString(ost, this->SystemName);
+  ost << ",\n  \"cpu\": ";
+  ::WriteJSONString(ost, si.GetModelName());
+  ost << ",\n  \"physical_cpus\": " << si.GetNumberOfPhysicalCPU()
+      << ",\n  \"logical_cpus\": " << si.GetNumberOfLogicalCPU()
+      << ",\n  \"memory_mib\": " << si.GetTotalPhysicalMemory() << ",\n  \"smp_backend\": ";
+  ::WriteJSONString(ost, this->Backend);
+  ost << ",\n  \"repeats\": " << this->Repeats << ",\n  \"results\": [";
+
+  const char* separator = "\n";
+  for (const vtkFTTestResult& result : this->TestResults)
+  {
+    const double minimum = result.GetMinimum();
+    ost << separator << "    {\"name\": ";
+    ::WriteJSONString(ost, result.Name);
+    ost << ", \"size\": " << result.Size << ", \"threads\": " << result.NumberOfThreads
+        << ", \"elements\": " << result.NumberOfElements << ", \"element_name\": ";
+    ::WriteJSONString(ost, result.ElementName);
+    ost << ",\n     \"min_seconds\": " << minimum << ", \"median_seconds\": " << result.GetMedian()
+        << ", \"mean_seconds\": " << result.GetMean()
+        << ", \"stddev_seconds\": " << result.GetStandardDeviation()
+        << ", \"elements_per_second\": "
+        << (minimum > 0.0 ? result.NumberOfElements / minimum : 0.0) << ",\n     \"times\": [";
+    for (size_t i = 0; i < result.Times.size(); ++i)
+    {
+      ost << (i ? ", " : "") << result.Times[i];
+    }
+    ost << "]}";
+    separator = ",\n";
+  }
+  ost << "\n  ]\n}\n";
+}
+
+int vtkFilterTimings::ParseCommandLineArguments(int argc, char* argv[])
+{
+  this->Arguments.Initialize(argc, argv);
+  this->Arguments.StoreUnusedArguments(true);
+
+  typedef vtksys::CommandLineArguments argT;
+  this->Arguments.AddArgument("-rn", argT::SPACE_ARGUMENT, &this->ResultsFileName,
+    "Specify where to write the JSON results to. Defaults to results.json.");
+  this->Arguments.AddArgument("-regex", argT::SPACE_ARGUMENT, &this->Regex,
+    "Specify a regular expression for what tests should be run.");
+  this->Arguments.AddArgument("-sizes", argT::SPACE_ARGUMENT, &this->Sizes,
+    "Specify a comma separated list of problem sizes, as numbers of points or "
+    "cells along each axis of the synthetic inputs. Defaults to 32,64,128.");
+  this->Arguments.AddArgument("-threads", argT::SPACE_ARGUMENT, &this->Threads,
+    "Specify a comma separated list of numbers of threads. Defaults to 1 and the "
+    "default number of threads of the SMP backend.");
+  this->Arguments.AddArgument("-backend", argT::SPACE_ARGUMENT, &this->Backend,
+    "Specify the SMP backend to use. Defaults to the default backend.");
+  this->Arguments.AddArgument("-repeats", argT::SPACE_ARGUMENT, &this->Repeats,
+    "Specify how many timed runs are made for each size and number of threads. "
+    "Defaults to 5.");
+  this->Arguments.AddArgument("-warmups", argT::SPACE_ARGUMENT, &this->WarmUps,
+    "Specify how many untimed runs are made before the timed runs. Defaults to 1.");
+  this->Arguments.AddArgument("-tmp", argT::SPACE_ARGUMENT, &this->TemporaryDirectory,
+    "Specify the directory where the I/O tests write their files. Defaults to the "
+    "current directory.");
+  this->Arguments.AddArgument("-platform", argT::SPACE_ARGUMENT, &this->SystemName,
+    "Specify a name for this platform. This is included in the output.");
+  this->Arguments.AddBooleanArgument(
+    "--help", &this->DisplayHelp, "Provide a listing of command line options.");
+  this->Arguments.AddBooleanArgument(
+    "-help", &this->DisplayHelp, "Provide a listing of command line options.");
+  this->Arguments.AddBooleanArgument(
+    "-list", &this->ListTests, "Provide a listing of available tests.");
+
+  if (!this->Arguments.Parse())
+  {
+    cerr << "Problem parsing arguments" << endl;
+    return 1;
+  }
+
+  if (this->DisplayHelp)
+  {
+    cerr << "Usage" << endl
+         << endl
+         << "  FilterTimings [options]" << endl
+         << endl
+         << "Options" << endl;
+    cerr << this->Arguments.GetHelp();
+    return 0;
+  }
+
+  if (this->ListTests)
+  {
+    vtksys::RegularExpression re;
+    const bool useRegex = !this->Regex.empty() && re.compile(this->Regex);
+    for (vtkFTTest* test : this->TestsToRun)
+    {
+      if (!useRegex || re.find(test->GetName()))
+      {
+        cerr << test->GetName() << endl;
+      }
+    }
+    return 0;
+  }
+
+  this->Repeats = std::max(this->Repeats, 1);
+  this->WarmUps = std::max(this->WarmUps, 0);
+
+  // run the tests
+  if (this->RunTests())
+  {
+    return 1;
+  }
+
+  vtksys::ofstream rfile(this->ResultsFileName.c_str());
+  if (!rfile)
+  {
+    cerr << "Cannot write the results to " << this->ResultsFileName << endl;
+    return 1;
+  }
+  this->ReportResults(rfile);
+  cout << "Results written to " << this->ResultsFileName << endl;
+  return 0;
+}
+VTK_ABI_NAMESPACE_END
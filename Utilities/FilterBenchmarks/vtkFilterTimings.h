@@ -0,0 +1,121 @@
+// SPDX-FileCopyrightText: Copyright (c) Ken Martin, Will Schroeder, Bill Lorensen
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef vtkFilterTimings_h
+#define vtkFilterTimings_h
+
+/**
+ * Define the classes we use for running headless timing benchmarks of data
+ * processing algorithms. Unlike vtkRenderTimings, the tests are run for a
+ * fixed list of problem sizes and numbers of threads, each one several times,
+ * so that the results of two builds can be compared point by point.
+ */
+
+#include "vtkSystemIncludes.h"
+#include "vtkUtilitiesFilterBenchmarksModule.h"
+#include <string>
+#include <vector>
+#include <vtksys/CommandLineArguments.hxx>
+
+VTK_ABI_NAMESPACE_BEGIN
+class VTKUTILITIESFILTERBENCHMARKS_EXPORT vtkFTTest
+{
+public:
+  // what is the name of this test
+  std::string GetName() { return this->Name; }
+
+  // what the elements counted by GetNumberOfElements are, used to report
+  // the throughput of the test
+  virtual const char* GetElementName() { return "cells"; }
+
+  // does this test use vtkSMPTools, tests that do not are only run once
+  // instead of once per number of threads
+  virtual bool IsThreaded() { return true; }
+
+  // create the input of the test for the given size, this is not timed.
+  // The size is a number of points or cells along each axis.
+  virtual void Setup(int size) = 0;
+
+  // run the timed part of the test once
+  virtual void Run() = 0;
+
+  // number of elements processed by Run
+  virtual vtkIdType GetNumberOfElements() = 0;
+
+  // release the data created by Setup
+  virtual void TearDown() {}
+
+  // directory where tests can write files
+  void SetTemporaryDirectory(const std::string& dir) { this->TemporaryDirectory = dir; }
+
+  vtkFTTest(const char* name)
+    : Name(name)
+  {
+  }
+
+  virtual ~vtkFTTest() = default;
+
+protected:
+  std::string Name;
+  std::string TemporaryDirectory;
+};
+
+// the timings of one test for one size and number of threads
+class VTKUTILITIESFILTERBENCHMARKS_EXPORT vtkFTTestResult
+{
+public:
+  std::string Name;
+  std::string ElementName;
+  int Size = 0;
+  int NumberOfThreads = 0;
+  vtkIdType NumberOfElements = 0;
+  std::vector<double> Times;
+
+  double GetMinimum() const;
+  double GetMedian() const;
+  double GetMean() const;
+  double GetStandardDeviation() const;
+};
+
+// a class to run a bunch of timing tests and report the results as JSON
+class VTKUTILITIESFILTERBENCHMARKS_EXPORT vtkFilterTimings
+{
+public:
+  vtkFilterTimings();
+  ~vtkFilterTimings();
+
+  // parse and act on the command line arguments
+  int ParseCommandLineArguments(int argc, char* argv[]);
+
+  // write the results as a JSON document
+  void ReportResults(ostream& ost);
+
+  // the tests are deleted by the destructor
+  std::vector<vtkFTTest*> TestsToRun;
+  std::vector<vtkFTTestResult> TestResults;
+
+protected:
+  int RunTests();
+  void RunTest(vtkFTTest* test, int size, int numberOfThreads);
+
+private:
+  vtkFilterTimings(const vtkFilterTimings&) = delete;
+  void operator=(const vtkFilterTimings&) = delete;
+
+  std::string Regex; // regular expression for tests
+  std::string Sizes;
+  std::string Threads;
+  std::string Backend;
+  std::string SystemName;
+  std::string TemporaryDirectory;
+  std::string ResultsFileName;
+  vtksys::CommandLineArguments Arguments;
+  bool DisplayHelp;
+  bool ListTests;
+  int Repeats;
+  int WarmUps;
+};
+
+VTK_ABI_NAMESPACE_END
+#endif
+// VTK-HeaderTest-Exclude: vtkFilterTimings.h